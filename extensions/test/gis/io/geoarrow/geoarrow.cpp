@@ -0,0 +1,368 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <boost/geometry/extensions/gis/io/geoarrow/arrays.hpp>
+
+
+namespace bgi = bg::index;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+typedef bg::geoarrow::interleaved_coordinates<point_type> interleaved_type;
+typedef bg::geoarrow::separated_coordinates<point_type> separated_type;
+
+// Buffers of a GeoArrow array built from geometries
+struct buffers
+{
+    std::vector<double> xy, x, y;
+    std::vector<boost::int32_t> geometry_offsets, part_offsets, ring_offsets;
+
+    std::size_t num_points() const
+    {
+        return x.size();
+    }
+
+    void add(point_type const& p)
+    {
+        xy.push_back(bg::get<0>(p));
+        xy.push_back(bg::get<1>(p));
+        x.push_back(bg::get<0>(p));
+        y.push_back(bg::get<1>(p));
+    }
+
+    template <typename Range>
+    void add_points(Range const& range, std::vector<boost::int32_t>& offsets)
+    {
+        for (typename boost::range_iterator<Range const>::type it = boost::begin(range);
+             it != boost::end(range); ++it)
+        {
+            add(*it);
+        }
+        offsets.push_back(boost::int32_t(num_points()));
+    }
+
+    void add_polygon(polygon_type const& polygon, std::vector<boost::int32_t>& offsets)
+    {
+        add_points(polygon.outer(), ring_offsets);
+        for (std::size_t i = 0 ; i < polygon.inners().size() ; ++i)
+        {
+            add_points(polygon.inners()[i], ring_offsets);
+        }
+        offsets.push_back(boost::int32_t(ring_offsets.size() - 1));
+    }
+
+    interleaved_type interleaved() const
+    {
+        return interleaved_type(xy.data(), num_points());
+    }
+
+    separated_type separated() const
+    {
+        return separated_type(x.data(), y.data(), num_points());
+    }
+};
+
+std::vector<multi_polygon_type> test_multi_polygons()
+{
+    char const* wkts[] = {
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2)),((20 20,20 25,25 25,20 20)))",
+        "MULTIPOLYGON()",
+        "MULTIPOLYGON(((5 5,5 15,15 15,15 5,5 5)))",
+        "MULTIPOLYGON(((100 100,100 101,101 101,101 100,100 100),(100.2 100.2,100.8 100.2,100.8 100.8,100.2 100.2)))"
+    };
+
+    std::vector<multi_polygon_type> result(sizeof(wkts) / sizeof(wkts[0]));
+    for (std::size_t i = 0 ; i < result.size() ; ++i)
+    {
+        bg::read_wkt(wkts[i], result[i]);
+        bg::correct(result[i]);
+    }
+    return result;
+}
+
+buffers multi_polygon_buffers(std::vector<multi_polygon_type> const& multi_polygons)
+{
+    buffers result;
+    result.geometry_offsets.push_back(0);
+    result.part_offsets.push_back(0);
+    result.ring_offsets.push_back(0);
+    for (std::size_t i = 0 ; i < multi_polygons.size() ; ++i)
+    {
+        for (std::size_t j = 0 ; j < multi_polygons[i].size() ; ++j)
+        {
+            result.add_polygon(multi_polygons[i][j], result.part_offsets);
+        }
+        result.geometry_offsets.push_back(boost::int32_t(result.part_offsets.size() - 1));
+    }
+    return result;
+}
+
+template <typename Array>
+void check_multi_polygons(Array const& array, std::vector<multi_polygon_type> const& expected)
+{
+    typedef typename boost::range_value<Array>::type view_type;
+    typedef typename boost::range_value<view_type>::type polygon_view_type;
+
+    BOOST_CHECK_EQUAL(array.size(), expected.size());
+
+    point_type const probe(3, 8);
+    multi_polygon_type const other = expected[2];
+
+    std::size_t i = 0;
+    for (typename Array::const_iterator it = array.begin() ; it != array.end() ; ++it, ++i)
+    {
+        view_type const view = *it;
+        multi_polygon_type const& mp = expected[i];
+
+        BOOST_CHECK_EQUAL(boost::size(view), mp.size());
+        BOOST_CHECK_EQUAL(bg::num_points(view), bg::num_points(mp));
+        BOOST_CHECK_EQUAL(bg::num_interior_rings(view), bg::num_interior_rings(mp));
+        BOOST_CHECK_EQUAL(bg::to_wkt(view), bg::to_wkt(mp));
+        BOOST_CHECK_CLOSE(bg::area(view), bg::area(mp), 1e-12);
+        BOOST_CHECK_CLOSE(bg::perimeter(view), bg::perimeter(mp), 1e-12);
+
+        if (! mp.empty())
+        {
+            box_type b1, b2;
+            bg::envelope(view, b1);
+            bg::envelope(mp, b2);
+            BOOST_CHECK(bg::equals(b1, b2));
+
+            BOOST_CHECK_CLOSE(bg::distance(probe, view), bg::distance(probe, mp), 1e-12);
+            BOOST_CHECK_EQUAL(bg::within(probe, view), bg::within(probe, mp));
+            BOOST_CHECK_EQUAL(bg::covered_by(probe, view), bg::covered_by(probe, mp));
+
+            multi_polygon_type copy;
+            bg::convert(view, copy);
+            BOOST_CHECK(bg::equals(copy, mp));
+        }
+
+        for (std::size_t j = 0 ; j < view.size() ; ++j)
+        {
+            polygon_view_type const polygon = view[j];
+            BOOST_CHECK_CLOSE(bg::area(polygon), bg::area(mp[j]), 1e-12);
+            BOOST_CHECK_CLOSE(bg::area(polygon.outer()), bg::area(mp[j].outer()), 1e-12);
+            BOOST_CHECK_EQUAL(bg::within(probe, polygon), bg::within(probe, mp[j]));
+        }
+    }
+}
+
+// Algorithms referring to the points, supported by interleaved coordinates
+template <typename Array>
+void check_multi_polygons_overlay(Array const& array, std::vector<multi_polygon_type> const& expected)
+{
+    typedef typename boost::range_value<Array>::type view_type;
+    typedef typename boost::range_value<view_type>::type polygon_view_type;
+
+    multi_polygon_type const other = expected[2];
+
+    for (std::size_t i = 0 ; i < array.size() ; ++i)
+    {
+        view_type const view = array[i];
+        multi_polygon_type const& mp = expected[i];
+        if (mp.empty())
+        {
+            continue;
+        }
+
+        BOOST_CHECK_EQUAL(bg::intersects(view, other), bg::intersects(mp, other));
+        BOOST_CHECK_EQUAL(bg::intersects(view, view), true);
+        BOOST_CHECK_EQUAL(bg::disjoint(other, view), bg::disjoint(other, mp));
+        BOOST_CHECK_CLOSE(bg::distance(view, other), bg::distance(mp, other), 1e-12);
+
+        multi_polygon_type result, expected_result;
+        bg::intersection(view, other, result);
+        bg::intersection(mp, other, expected_result);
+        BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected_result), 1e-12);
+
+        for (std::size_t j = 0 ; j < view.size() ; ++j)
+        {
+            polygon_view_type const polygon = view[j];
+            BOOST_CHECK_EQUAL(bg::intersects(polygon, other[0]), bg::intersects(mp[j], other[0]));
+        }
+    }
+}
+
+void test_multi_polygon()
+{
+    std::vector<multi_polygon_type> const expected = test_multi_polygons();
+
+    buffers const buf = multi_polygon_buffers(expected);
+
+    bg::geoarrow::multi_polygon_array<interleaved_type> const interleaved(buf.interleaved(),
+        buf.geometry_offsets.data(), buf.part_offsets.data(), buf.ring_offsets.data(),
+        expected.size());
+    check_multi_polygons(interleaved, expected);
+    check_multi_polygons_overlay(interleaved, expected);
+
+    bg::geoarrow::multi_polygon_array<separated_type> const separated(buf.separated(),
+        buf.geometry_offsets.data(), buf.part_offsets.data(), buf.ring_offsets.data(),
+        expected.size());
+    check_multi_polygons(separated, expected);
+
+    // The polygons of all multi-polygons as polygon array, packed in an rtree
+    bg::geoarrow::polygon_array<interleaved_type> const polygons(buf.interleaved(),
+        buf.part_offsets.data(), buf.ring_offsets.data(), buf.part_offsets.size() - 1);
+    BOOST_CHECK_EQUAL(polygons.size(), 4u);
+
+    typedef std::pair<box_type, std::size_t> value_type;
+    std::vector<value_type> values;
+    for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+    {
+        values.push_back(value_type(bg::return_envelope<box_type>(polygons[i]), i));
+    }
+    bgi::rtree<value_type, bgi::rstar<4> > const rtree(values);
+
+    std::vector<std::size_t> found;
+    for (bgi::rtree<value_type, bgi::rstar<4> >::const_query_iterator
+            it = rtree.qbegin(bgi::intersects(point_type(6, 6)));
+         it != rtree.qend(); ++it)
+    {
+        if (bg::within(point_type(6, 6), polygons[it->second]))
+        {
+            found.push_back(it->second);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    BOOST_CHECK_EQUAL(found.size(), 2u);
+    BOOST_CHECK(found.size() == 2 && found[0] == 0 && found[1] == 2);
+}
+
+// Rings without turns are copied from the input by overlay
+void test_overlay_without_turns()
+{
+    char const* wkts[] = {
+        // Contained in the other polygon
+        "MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((4 4,4 6,6 6,6 4,4 4)))",
+        // Disjoint with the other polygon
+        "MULTIPOLYGON(((20 20,20 22,22 22,22 20,20 20)))",
+        // A hole inside of the other polygon
+        "MULTIPOLYGON(((-20 -20,-20 20,20 20,20 -20,-20 -20),(-2 -2,2 -2,2 2,-2 2,-2 -2)))"
+    };
+
+    std::vector<multi_polygon_type> expected(sizeof(wkts) / sizeof(wkts[0]));
+    for (std::size_t i = 0 ; i < expected.size() ; ++i)
+    {
+        bg::read_wkt(wkts[i], expected[i]);
+        bg::correct(expected[i]);
+    }
+
+    multi_polygon_type other;
+    bg::read_wkt("MULTIPOLYGON(((-10 -10,-10 10,10 10,10 -10,-10 -10)))", other);
+
+    buffers const buf = multi_polygon_buffers(expected);
+    bg::geoarrow::multi_polygon_array<interleaved_type> const array(buf.interleaved(),
+        buf.geometry_offsets.data(), buf.part_offsets.data(), buf.ring_offsets.data(),
+        expected.size());
+
+    for (std::size_t i = 0 ; i < expected.size() ; ++i)
+    {
+        multi_polygon_type result, expected_result;
+        bg::intersection(array[i], other, result);
+        bg::intersection(expected[i], other, expected_result);
+        BOOST_CHECK_EQUAL(bg::to_wkt(result), bg::to_wkt(expected_result));
+
+        result.clear();
+        expected_result.clear();
+        bg::union_(array[i], other, result);
+        bg::union_(expected[i], other, expected_result);
+        BOOST_CHECK_EQUAL(bg::to_wkt(result), bg::to_wkt(expected_result));
+
+        result.clear();
+        expected_result.clear();
+        bg::difference(other, array[i], result);
+        bg::difference(other, expected[i], expected_result);
+        BOOST_CHECK_EQUAL(bg::to_wkt(result), bg::to_wkt(expected_result));
+    }
+}
+
+void test_linear()
+{
+    multi_linestring_type mls;
+    bg::read_wkt("MULTILINESTRING((0 0,3 4,3 8),(10 10,11 11))", mls);
+    linestring_type const other_ls = mls[0];
+
+    buffers buf;
+    buf.geometry_offsets.push_back(0);
+    buf.part_offsets.push_back(0);
+    for (std::size_t i = 0 ; i < mls.size() ; ++i)
+    {
+        buf.add_points(mls[i], buf.part_offsets);
+    }
+    buf.geometry_offsets.push_back(2);
+
+    bg::geoarrow::linestring_array<separated_type> const linestrings(buf.separated(),
+        buf.part_offsets.data(), 2);
+    BOOST_CHECK_EQUAL(linestrings.size(), 2u);
+    BOOST_CHECK_CLOSE(bg::length(linestrings[0]), 9.0, 1e-12);
+    BOOST_CHECK_EQUAL(bg::to_wkt(linestrings[1]), "LINESTRING(10 10,11 11)");
+    BOOST_CHECK_CLOSE(bg::distance(point_type(0, 4), linestrings[0]), 2.4, 1e-12);
+
+    bg::geoarrow::multi_linestring_array<interleaved_type> const multi(buf.interleaved(),
+        buf.geometry_offsets.data(), buf.part_offsets.data(), 1);
+    BOOST_CHECK_EQUAL(multi.size(), 1u);
+    BOOST_CHECK_EQUAL(bg::to_wkt(multi[0]), bg::to_wkt(mls));
+    BOOST_CHECK(bg::intersects(multi[0][0], other_ls));
+    BOOST_CHECK(! bg::intersects(multi[0][1], other_ls));
+    BOOST_CHECK_CLOSE(bg::length(multi[0]), bg::length(mls), 1e-12);
+
+    // The points as points and as multi-point
+    bg::geoarrow::point_array<interleaved_type> const points(buf.interleaved());
+    BOOST_CHECK_EQUAL(points.size(), 5u);
+    BOOST_CHECK(bg::equals(points[1], point_type(3, 4)));
+
+    std::vector<boost::int32_t> const mp_offsets = {0, 3, 5};
+    bg::geoarrow::multi_point_array<separated_type> const multi_points(buf.separated(),
+        mp_offsets.data(), 2);
+    BOOST_CHECK_EQUAL(bg::to_wkt(multi_points[1]), "MULTIPOINT((10 10),(11 11))");
+    box_type box;
+    bg::envelope(multi_points[0], box);
+    BOOST_CHECK_EQUAL(bg::to_wkt(box), "POLYGON((0 0,0 8,3 8,3 0,0 0))");
+    BOOST_CHECK(bg::within(point_type(3, 4), multi_points[0]));
+}
+
+void test_3d()
+{
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+    typedef bg::geoarrow::separated_coordinates<point3d_type> coordinates_type;
+
+    double const x[] = {0, 1, 2};
+    double const y[] = {0, 0, 2};
+    double const z[] = {5, 6, 7};
+    boost::int64_t const offsets[] = {0, 3};
+    bg::geoarrow::linestring_array<coordinates_type, boost::int64_t> const linestrings(
+        coordinates_type(x, y, z, 3), offsets, 1);
+    BOOST_CHECK_EQUAL(bg::to_wkt(linestrings[0]), "LINESTRING(0 0 5,1 0 6,2 2 7)");
+}
+
+int test_main(int, char* [])
+{
+    test_multi_polygon();
+    test_overlay_without_turns();
+    test_linear();
+    test_3d();
+
+    return 0;
+}
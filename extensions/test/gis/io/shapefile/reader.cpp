@@ -0,0 +1,430 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/endian/conversion.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/extensions/gis/io/shapefile/mapped_reader.hpp>
+#include <boost/geometry/extensions/gis/io/shapefile/read.hpp>
+#include <boost/geometry/extensions/gis/io/shapefile/reader.hpp>
+
+
+namespace shp = bg::detail::shapefile;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_t;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_t;
+typedef bg::model::box<point_t> box_t;
+typedef bg::model::linestring<point_t> linestring_t;
+typedef bg::model::multi_linestring<linestring_t> multi_linestring_t;
+typedef bg::model::polygon<point_t> polygon_t;
+typedef bg::model::polygon<point_t, false, false> polygon_ccw_open_t;
+typedef bg::model::multi_polygon<polygon_t> multi_polygon_t;
+typedef bg::model::multi_point<point_t> multi_point_t;
+
+
+// Writer of the files used in this test, only the content required by
+// the readers is written correctly, e.g. the boxes of the files are not
+struct shapefile_writer
+{
+    explicit shapefile_writer(boost::int32_t type)
+        : type(type)
+    {}
+
+    static void put_big(std::string & str, boost::int32_t v)
+    {
+        boost::endian::native_to_big_inplace(v);
+        str.append(reinterpret_cast<const char*>(&v), 4);
+    }
+
+    static void put_little(std::string & str, boost::int32_t v)
+    {
+        boost::endian::native_to_little_inplace(v);
+        str.append(reinterpret_cast<const char*>(&v), 4);
+    }
+
+    static void put_double(std::string & str, double d)
+    {
+        boost::int64_t v;
+        std::memcpy(&v, &d, 8);
+        boost::endian::native_to_little_inplace(v);
+        str.append(reinterpret_cast<const char*>(&v), 8);
+    }
+
+    void add_record(std::string const& content)
+    {
+        put_big(index, boost::int32_t((100 + shapes.size()) / 2));
+        put_big(index, boost::int32_t(content.size() / 2));
+        put_big(shapes, boost::int32_t(++count));
+        put_big(shapes, boost::int32_t(content.size() / 2));
+        shapes += content;
+    }
+
+    void add_null()
+    {
+        std::string content;
+        put_little(content, 0);
+        add_record(content);
+    }
+
+    void add_point(double x, double y)
+    {
+        std::string content;
+        put_little(content, type);
+        put_double(content, x);
+        put_double(content, y);
+        add_record(content);
+    }
+
+    // Parts of polylines or polygons, z coordinates are equal to x + y
+    void add_parts(std::vector<std::vector<point_t> > const& parts)
+    {
+        std::vector<point_t> points;
+        std::vector<boost::int32_t> offsets;
+        for (std::size_t i = 0 ; i < parts.size() ; ++i)
+        {
+            offsets.push_back(boost::int32_t(points.size()));
+            points.insert(points.end(), parts[i].begin(), parts[i].end());
+        }
+
+        box_t box;
+        bg::assign_inverse(box);
+        for (std::size_t i = 0 ; i < points.size() ; ++i)
+        {
+            bg::expand(box, points[i]);
+        }
+
+        std::string content;
+        put_little(content, type);
+        put_double(content, bg::get<0, 0>(box));
+        put_double(content, bg::get<0, 1>(box));
+        put_double(content, bg::get<1, 0>(box));
+        put_double(content, bg::get<1, 1>(box));
+        put_little(content, boost::int32_t(offsets.size()));
+        put_little(content, boost::int32_t(points.size()));
+        for (std::size_t i = 0 ; i < offsets.size() ; ++i)
+        {
+            put_little(content, offsets[i]);
+        }
+        for (std::size_t i = 0 ; i < points.size() ; ++i)
+        {
+            put_double(content, bg::get<0>(points[i]));
+            put_double(content, bg::get<1>(points[i]));
+        }
+        if (type == shp::shape_type::polyline_z)
+        {
+            put_double(content, 0);
+            put_double(content, 0);
+            for (std::size_t i = 0 ; i < points.size() ; ++i)
+            {
+                put_double(content, bg::get<0>(points[i]) + bg::get<1>(points[i]));
+            }
+        }
+        add_record(content);
+    }
+
+    static std::string header(boost::int32_t type, std::size_t size)
+    {
+        std::string result;
+        put_big(result, 9994);
+        for (int i = 0 ; i < 5 ; ++i)
+        {
+            put_big(result, 0);
+        }
+        put_big(result, boost::int32_t(size / 2));
+        put_little(result, 1000);
+        put_little(result, type);
+        for (int i = 0 ; i < 8 ; ++i)
+        {
+            put_double(result, i < 2 ? -1.0 : 1.0);
+        }
+        return result;
+    }
+
+    std::string shp() const
+    {
+        return header(type, 100 + shapes.size()) + shapes;
+    }
+
+    std::string shx() const
+    {
+        return header(type, 100 + index.size()) + index;
+    }
+
+    boost::int32_t type;
+    int count = 0;
+    std::string shapes;
+    std::string index;
+};
+
+std::vector<point_t> make_ring(double x, double y, double size, bool cw)
+{
+    std::vector<point_t> result;
+    result.push_back(point_t(x, y));
+    result.push_back(cw ? point_t(x, y + size) : point_t(x + size, y));
+    result.push_back(point_t(x + size, y + size));
+    result.push_back(cw ? point_t(x + size, y) : point_t(x, y + size));
+    result.push_back(point_t(x, y));
+    return result;
+}
+
+template <typename Reader>
+void test_points(Reader & reader)
+{
+    BOOST_CHECK_EQUAL(reader.shape_type(), int(shp::shape_type::point));
+
+    box_t box;
+    reader.envelope(box);
+    BOOST_CHECK_EQUAL((bg::get<0, 0>(box)), -1.0);
+    BOOST_CHECK_EQUAL((bg::get<1, 1>(box)), 1.0);
+
+    // Null shapes are skipped
+    point_t pt;
+    std::vector<std::size_t> indexes;
+    std::vector<double> xs;
+    while (reader.next(pt))
+    {
+        indexes.push_back(reader.record_index());
+        xs.push_back(bg::get<0>(pt));
+    }
+    BOOST_CHECK_EQUAL(indexes.size(), 3u);
+    BOOST_CHECK(indexes == std::vector<std::size_t>({0, 2, 3}));
+    BOOST_CHECK(xs == std::vector<double>({1, 3, 4}));
+    BOOST_CHECK(! reader.next(pt));
+
+    BOOST_CHECK_EQUAL(reader.size(), 4u);
+    BOOST_CHECK(reader.has_index());
+
+    // Random access
+    BOOST_CHECK(reader.read(2, pt));
+    BOOST_CHECK_EQUAL(bg::get<0>(pt), 3.0);
+    BOOST_CHECK_EQUAL(bg::get<1>(pt), 30.0);
+    BOOST_CHECK(! reader.read(1, pt));
+    BOOST_CHECK_EQUAL(reader.record_index(), 1u);
+    BOOST_CHECK_THROW(reader.read(4, pt), bg::read_shapefile_exception);
+
+    multi_point_t mpt;
+    BOOST_CHECK(reader.read(0, mpt));
+    BOOST_CHECK_EQUAL(mpt.size(), 1u);
+
+    // The geometry has to match the type of the shapes
+    linestring_t ls;
+    BOOST_CHECK_THROW(reader.read(0, ls), bg::read_shapefile_exception);
+
+    // Filter and seek
+    reader.seek(1);
+    reader.set_filter(box_t(point_t(2.5, 0), point_t(10, 35)));
+    BOOST_CHECK(reader.next(pt));
+    BOOST_CHECK_EQUAL(reader.record_index(), 2u);
+    BOOST_CHECK(! reader.next(pt));
+
+    reader.reset_filter();
+    reader.seek(0);
+    BOOST_CHECK(reader.next(pt));
+    BOOST_CHECK_EQUAL(reader.record_index(), 0u);
+}
+
+void test_points()
+{
+    shapefile_writer writer(shp::shape_type::point);
+    writer.add_point(1, 10);
+    writer.add_null();
+    writer.add_point(3, 30);
+    writer.add_point(4, 40);
+
+    std::string const shp_data = writer.shp();
+    std::string const shx_data = writer.shx();
+
+    {
+        std::istringstream shp_stream(shp_data);
+        bg::shapefile_reader<std::istringstream> reader(shp_stream);
+        BOOST_CHECK(! reader.has_index());
+        test_points(reader);
+    }
+    {
+        std::istringstream shp_stream(shp_data);
+        std::istringstream shx_stream(shx_data);
+        bg::shapefile_reader<std::istringstream> reader(shp_stream, shx_stream);
+        BOOST_CHECK(reader.has_index());
+        test_points(reader);
+    }
+    {
+        bg::shapefile_memory_reader reader(shp_data.data(), shp_data.size());
+        test_points(reader);
+    }
+    {
+        bg::shapefile_memory_reader reader(shp_data.data(), shp_data.size(),
+                                           shx_data.data(), shx_data.size());
+        test_points(reader);
+    }
+
+    // Truncated file, the last record is not read
+    {
+        std::string const truncated = shp_data.substr(0, shp_data.size() - 10);
+        bg::shapefile_memory_reader reader(truncated.data(), truncated.size());
+        point_t pt;
+        BOOST_CHECK(reader.next(pt));
+        BOOST_CHECK(reader.next(pt));
+        BOOST_CHECK_THROW(reader.next(pt), bg::read_shapefile_exception);
+    }
+
+    BOOST_CHECK_THROW(bg::shapefile_memory_reader(shx_data.data(), 50),
+                      bg::read_shapefile_exception);
+}
+
+void test_polylines()
+{
+    shapefile_writer writer(shp::shape_type::polyline_z);
+    for (int i = 0 ; i < 100 ; ++i)
+    {
+        std::vector<std::vector<point_t> > parts(1 + i % 3);
+        for (std::size_t j = 0 ; j < parts.size() ; ++j)
+        {
+            for (int k = 0 ; k < 2 + i % 5 ; ++k)
+            {
+                parts[j].push_back(point_t(10 * i + k, 10 * j));
+            }
+        }
+        writer.add_parts(parts);
+    }
+
+    std::string const shp_data = writer.shp();
+    std::istringstream shp_stream(shp_data);
+    bg::shapefile_reader<std::istringstream> reader(shp_stream);
+
+    // The multi linestring is reused
+    bg::model::multi_linestring<bg::model::linestring<point3d_t> > mls;
+    std::size_t count = 0;
+    while (reader.next(mls))
+    {
+        std::size_t const i = reader.record_index();
+        BOOST_CHECK_EQUAL(mls.size(), 1 + i % 3);
+        BOOST_CHECK_EQUAL(bg::num_points(mls), (1 + i % 3) * (2 + i % 5));
+        BOOST_CHECK_EQUAL(bg::get<2>(mls.back().back()),
+                          bg::get<0>(mls.back().back()) + bg::get<1>(mls.back().back()));
+        ++count;
+    }
+    BOOST_CHECK_EQUAL(count, 100u);
+
+    // The records with more than one part can not be read into a linestring
+    linestring_t ls;
+    BOOST_CHECK(reader.read(3, ls));
+    BOOST_CHECK_EQUAL(ls.size(), 2u + 3 % 5);
+    BOOST_CHECK_EQUAL(bg::get<0>(ls.front()), 30.0);
+    BOOST_CHECK_THROW(reader.read(4, ls), bg::read_shapefile_exception);
+
+    // Only the records intersecting the box are decoded
+    reader.set_filter(box_t(point_t(495, -1), point_t(520, 1)));
+    reader.seek(0);
+    multi_linestring_t mls2d;
+    std::vector<std::size_t> indexes;
+    while (reader.next(mls2d))
+    {
+        indexes.push_back(reader.record_index());
+    }
+    BOOST_CHECK(indexes == std::vector<std::size_t>({49, 50, 51, 52}));
+}
+
+void test_polygons()
+{
+    shapefile_writer writer(shp::shape_type::polygon);
+    {
+        std::vector<std::vector<point_t> > parts;
+        parts.push_back(make_ring(0, 0, 10, true));
+        parts.push_back(make_ring(2, 2, 2, false));
+        writer.add_parts(parts);
+    }
+    {
+        std::vector<std::vector<point_t> > parts;
+        parts.push_back(make_ring(0, 0, 10, true));
+        parts.push_back(make_ring(20, 0, 10, true));
+        parts.push_back(make_ring(22, 2, 2, false));
+        writer.add_parts(parts);
+    }
+    writer.add_parts(std::vector<std::vector<point_t> >(1, make_ring(0, 0, 5, true)));
+
+    std::string const shp_data = writer.shp();
+    std::string const shx_data = writer.shx();
+    bg::shapefile_memory_reader reader(shp_data.data(), shp_data.size(),
+                                       shx_data.data(), shx_data.size());
+
+    multi_polygon_t mpoly;
+    BOOST_CHECK(reader.read(1, mpoly));
+    BOOST_CHECK_EQUAL(mpoly.size(), 2u);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(mpoly), 1u);
+    BOOST_CHECK_EQUAL(mpoly[1].inners().size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(mpoly), 196.0, 1e-12);
+
+    polygon_t poly;
+    BOOST_CHECK(reader.read(0, poly));
+    BOOST_CHECK_EQUAL(poly.inners().size(), 1u);
+    BOOST_CHECK_CLOSE(bg::area(poly), 96.0, 1e-12);
+    BOOST_CHECK_THROW(reader.read(1, poly), bg::read_shapefile_exception);
+    // The interior rings of the previous polygon are removed
+    BOOST_CHECK(reader.read(2, poly));
+    BOOST_CHECK_EQUAL(poly.inners().size(), 0u);
+    BOOST_CHECK_CLOSE(bg::area(poly), 25.0, 1e-12);
+
+    // Different order and closure
+    polygon_ccw_open_t poly_ccw;
+    BOOST_CHECK(reader.read(0, poly_ccw));
+    BOOST_CHECK_EQUAL(poly_ccw.outer().size(), 4u);
+    BOOST_CHECK_CLOSE(bg::area(poly_ccw), 96.0, 1e-12);
+
+    // The same polygons as read by read_shapefile()
+    std::istringstream shp_stream(shp_data);
+    std::vector<polygon_t> polygons;
+    bg::read_shapefile(shp_stream, polygons);
+    BOOST_CHECK_EQUAL(polygons.size(), 4u);
+    BOOST_CHECK_CLOSE(bg::area(polygons[0]), 96.0, 1e-12);
+    BOOST_CHECK_CLOSE(bg::area(polygons[2]), 96.0, 1e-12);
+}
+
+void test_mapped()
+{
+    shapefile_writer writer(shp::shape_type::point);
+    for (int i = 0 ; i < 10 ; ++i)
+    {
+        writer.add_point(i, -i);
+    }
+
+    std::string const path = "shapefile_mapped_reader_test.shp";
+    std::ofstream(path.c_str(), std::ios::binary) << writer.shp();
+    std::ofstream("shapefile_mapped_reader_test.shx", std::ios::binary) << writer.shx();
+
+    {
+        bg::shapefile_mapped_reader reader(path);
+        BOOST_CHECK(reader.has_index());
+        BOOST_CHECK_EQUAL(reader.size(), 10u);
+        point_t pt;
+        BOOST_CHECK(reader.read(7, pt));
+        BOOST_CHECK_EQUAL(bg::get<1>(pt), -7.0);
+    }
+
+    std::remove("shapefile_mapped_reader_test.shp");
+    std::remove("shapefile_mapped_reader_test.shx");
+}
+
+int test_main(int, char*[])
+{
+    test_points();
+    test_polylines();
+    test_polygons();
+    test_mapped();
+
+    return 0;
+}
@@ -0,0 +1,349 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/extensions/gis/io/twkb/read_twkb.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/write_twkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::polygon<point_type, false, false> open_polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+std::string to_hex(byte_vector const& bytes)
+{
+    std::string hex;
+    if (! bytes.empty())
+    {
+        bg::wkb2hex(bytes.begin(), bytes.end(), hex);
+    }
+    return hex;
+}
+
+byte_vector byte_vector_from(std::string const& hex)
+{
+    byte_vector result;
+    BOOST_CHECK(bg::hex2wkb(hex, std::back_inserter(result)));
+    return result;
+}
+
+template <typename Geometry>
+void test_twkb(std::string const& wkt, std::string const& hex,
+               bg::twkb_options const& options = bg::twkb_options(),
+               std::string const& expected_wkt = "")
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    byte_vector twkb;
+    BOOST_CHECK(bg::write_twkb(geometry, std::back_inserter(twkb), options));
+    BOOST_CHECK_EQUAL(to_hex(twkb), hex);
+
+    Geometry read_back;
+    bg::twkb_info info;
+    BOOST_CHECK_MESSAGE(bg::read_twkb(twkb.data(), twkb.size(), read_back, info),
+                        "read_twkb failed for " << hex);
+    BOOST_CHECK_EQUAL(info.size, twkb.size());
+    BOOST_CHECK_EQUAL(info.precision, options.precision);
+    BOOST_CHECK_EQUAL(bg::to_wkt(read_back),
+                      expected_wkt.empty() ? bg::to_wkt(geometry) : expected_wkt);
+
+    // The truncated bytes are not read
+    for (std::size_t size = 0 ; size < twkb.size() ; ++size)
+    {
+        BOOST_CHECK_MESSAGE(! bg::read_twkb(twkb.data(), size, read_back),
+                            "read_twkb of " << size << " bytes of " << hex);
+    }
+}
+
+void test_types()
+{
+    // Examples of PostGIS ST_AsTWKB
+    test_twkb<point_type>("POINT(1 2)", "01000204");
+    test_twkb<linestring_type>("LINESTRING(1 1,5 5)", "02000202020808");
+
+    test_twkb<polygon_type>("POLYGON((0 0,0 1,1 1,1 0,0 0))",
+                            "0300010500000002020000010100");
+    test_twkb<open_polygon_type>("POLYGON((0 0,1 0,1 1,0 1))",
+                                 "0300010500000200000201000001");
+    test_twkb<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 1))",
+                            "0300020500000014140000131300040202020000020101");
+    test_twkb<multi_point_type>("MULTIPOINT((1 2),(3 4))", "04000202040404");
+    test_twkb<multi_linestring_type>("MULTILINESTRING((1 1,5 5),(5 6,0 0))",
+                                     "0500020202020808020002090B");
+    test_twkb<multi_polygon_type>(
+        "MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((5 5,5 6,6 6,5 5)))",
+        "06000201050000000202000001010001040A0A000202000101");
+
+    // Empty geometries
+    test_twkb<linestring_type>("LINESTRING()", "0210");
+    test_twkb<polygon_type>("POLYGON()", "0310");
+    test_twkb<multi_polygon_type>("MULTIPOLYGON()", "0610");
+}
+
+void test_precision()
+{
+    test_twkb<point_type>("POINT(1.25 -2)", "21001A27", bg::twkb_options(1),
+                          "POINT(1.3 -2)");
+    test_twkb<point_type>("POINT(1234 -5678)", "1100F601EF08", bg::twkb_options(-1),
+                          "POINT(1230 -5680)");
+    test_twkb<linestring_type>("LINESTRING(0.001 0.002,0.003 0.004)",
+                               "62000202040404", bg::twkb_options(3));
+
+    bg::twkb_options z_options(0);
+    z_options.z_precision = 1;
+    test_twkb<point3d_type>("POINT(1 2 3.14)", "01080502043E", z_options,
+                            "POINT(1 2 3.1)");
+
+    // Invalid precisions
+    point_type const point(1, 2);
+    byte_vector twkb;
+    BOOST_CHECK(! bg::write_twkb(point, std::back_inserter(twkb), bg::twkb_options(8)));
+    BOOST_CHECK(! bg::write_twkb(point, std::back_inserter(twkb), bg::twkb_options(-8)));
+    BOOST_CHECK(twkb.empty());
+}
+
+void test_metadata()
+{
+    bg::twkb_options options;
+    options.bbox = true;
+    options.size = true;
+    test_twkb<linestring_type>("LINESTRING(1 1,5 5)",
+                               "020309020802080202020808", options);
+    test_twkb<linestring_type>("LINESTRING()", "021200", options);
+
+    // A 2D TWKB read into a 3D point and a 3D TWKB read into a 2D point
+    {
+        byte_vector twkb;
+        bg::write_twkb(point_type(1, 2), std::back_inserter(twkb));
+        point3d_type point;
+        BOOST_CHECK(bg::read_twkb(twkb.data(), twkb.size(), point));
+        BOOST_CHECK_EQUAL(bg::to_wkt(point), "POINT(1 2 0)");
+    }
+    {
+        byte_vector twkb;
+        bg::write_twkb(point3d_type(1, 2, 3), std::back_inserter(twkb));
+        point_type point;
+        bg::twkb_info info;
+        BOOST_CHECK(bg::read_twkb(twkb.data(), twkb.size(), point, info));
+        BOOST_CHECK_EQUAL(bg::to_wkt(point), "POINT(1 2)");
+        BOOST_CHECK(info.has_z);
+    }
+
+    // Geometries written one after another are read consecutively
+    {
+        std::vector<polygon_type> polygons(3);
+        bg::read_wkt("POLYGON((0 0,0 1,1 1,1 0,0 0))", polygons[0]);
+        bg::read_wkt("POLYGON((10 10,10 20,20 20,10 10))", polygons[1]);
+        bg::read_wkt("POLYGON((-5 -5,-5 5,5 5,-5 -5))", polygons[2]);
+
+        byte_vector twkb;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            bg::write_twkb(polygons[i], std::back_inserter(twkb), options);
+        }
+
+        std::size_t offset = 0;
+        polygon_type polygon;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            bg::twkb_info info;
+            BOOST_CHECK(bg::read_twkb(twkb.data() + offset, twkb.size() - offset,
+                                      polygon, info));
+            BOOST_CHECK(info.has_bbox);
+            BOOST_CHECK_EQUAL(bg::to_wkt(polygon), bg::to_wkt(polygons[i]));
+            offset += info.size;
+        }
+        BOOST_CHECK_EQUAL(offset, twkb.size());
+    }
+
+    // Ids of multi-geometries are skipped
+    {
+        byte_vector const twkb = byte_vector_from("04040207080204040404");
+        multi_point_type multi_point;
+        BOOST_CHECK(bg::read_twkb(twkb.data(), twkb.size(), multi_point));
+        BOOST_CHECK_EQUAL(bg::to_wkt(multi_point), "MULTIPOINT((1 2),(3 4))");
+    }
+}
+
+void test_batch()
+{
+    std::vector<linestring_type> linestrings(100);
+    for (std::size_t i = 0 ; i < linestrings.size() ; ++i)
+    {
+        for (std::size_t j = 0 ; j < i ; ++j)
+        {
+            linestrings[i].push_back(point_type(i * 1000.0 + j * 0.5, 0.0 - j * 0.25));
+        }
+    }
+
+    bg::twkb_options options(2);
+    options.size = true;
+
+    byte_vector expected;
+    std::vector<boost::int32_t> expected_offsets(1, 3);
+    for (std::size_t i = 0 ; i < linestrings.size() ; ++i)
+    {
+        bg::write_twkb(linestrings[i], std::back_inserter(expected), options);
+        expected_offsets.push_back(boost::int32_t(3 + expected.size()));
+    }
+
+    byte_vector data(3, 0xff);
+    std::vector<boost::int32_t> offsets;
+    BOOST_CHECK(bg::write_twkb_batch(linestrings, data, offsets, options));
+    BOOST_CHECK_EQUAL(data.size(), 3 + expected.size());
+    BOOST_CHECK(std::equal(expected.begin(), expected.end(), data.begin() + 3));
+    BOOST_CHECK(offsets == expected_offsets);
+
+    linestring_type linestring;
+    for (std::size_t i = 0 ; i < linestrings.size() ; ++i)
+    {
+        BOOST_CHECK(bg::read_twkb(data.data() + offsets[i], offsets[i + 1] - offsets[i],
+                                  linestring));
+        BOOST_CHECK_EQUAL(bg::to_wkt(linestring), bg::to_wkt(linestrings[i]));
+    }
+
+    // Offsets overflowing
+    std::vector<boost::int8_t> small_offsets;
+    BOOST_CHECK(! bg::write_twkb_batch(linestrings, data, small_offsets, options));
+    BOOST_CHECK_EQUAL(data.size(), 3 + expected.size());
+    BOOST_CHECK(small_offsets.empty());
+}
+
+void test_invalid()
+{
+    point_type point;
+    linestring_type linestring;
+
+    byte_vector twkb;
+    bg::write_twkb(point_type(1, 2), std::back_inserter(twkb));
+
+    // Other type
+    BOOST_CHECK(! bg::read_twkb(twkb.data(), twkb.size(), linestring));
+
+    // Empty point
+    byte_vector const empty_point = byte_vector_from("0110");
+    BOOST_CHECK(! bg::read_twkb(empty_point.data(), empty_point.size(), point));
+
+    // Wrong size
+    byte_vector const wrong_size = byte_vector_from("02020802020808");
+    BOOST_CHECK(! bg::read_twkb(wrong_size.data(), wrong_size.size(), linestring));
+
+    // Number of points larger than the data
+    byte_vector const too_many = byte_vector_from("0200FFFFFFFF0F0202");
+    BOOST_CHECK(! bg::read_twkb(too_many.data(), too_many.size(), linestring));
+}
+
+void test_overflow()
+{
+    linestring_type linestring;
+    byte_vector twkb;
+
+    // Coordinates which can not be quantized are not written
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    double const inf = std::numeric_limits<double>::infinity();
+    double const values[] = { nan, inf, -inf, 1.0e19, -1.0e19 };
+    for (std::size_t i = 0 ; i < sizeof(values) / sizeof(values[0]) ; ++i)
+    {
+        bg::read_wkt("LINESTRING(1 1,2 2)", linestring);
+        bg::set<1>(linestring[1], values[i]);
+        BOOST_CHECK(! bg::write_twkb(linestring, std::back_inserter(twkb)));
+        BOOST_CHECK(twkb.empty());
+
+        std::vector<linestring_type> linestrings(2, linestring);
+        byte_vector data;
+        std::vector<boost::int32_t> offsets;
+        BOOST_CHECK(! bg::write_twkb_batch(linestrings, data, offsets));
+        BOOST_CHECK(data.empty());
+        BOOST_CHECK(offsets.empty());
+    }
+
+    // Within the range but scaled out of it
+    bg::read_wkt("LINESTRING(1 1,1.0e14 2)", linestring);
+    BOOST_CHECK(bg::write_twkb(linestring, std::back_inserter(twkb)));
+    twkb.clear();
+    BOOST_CHECK(! bg::write_twkb(linestring, std::back_inserter(twkb),
+                                 bg::twkb_options(7)));
+    BOOST_CHECK(twkb.empty());
+
+    // Differences and the box overflowing 64 bit integers are read back
+    bg::twkb_options options;
+    options.bbox = true;
+    bg::read_wkt("LINESTRING(-9.0e18 9.0e18,9.0e18 -9.0e18,-9.0e18 9.0e18)", linestring);
+    BOOST_CHECK(bg::write_twkb(linestring, std::back_inserter(twkb), options));
+    linestring_type read_back;
+    BOOST_CHECK(bg::read_twkb(twkb.data(), twkb.size(), read_back));
+    BOOST_CHECK(bg::equals(read_back, linestring));
+
+    // Extreme deltas wrap around, the largest delta is encoded as
+    // FEFFFFFFFFFFFFFFFF01 and the smallest one as FFFFFFFFFFFFFFFFFF01
+    std::string const max_delta = "FEFFFFFFFFFFFFFFFF01";
+    std::string const min_delta = "FFFFFFFFFFFFFFFFFF01";
+    std::string hex = "020004";
+    for (std::size_t i = 0 ; i < 4 ; ++i)
+    {
+        hex += i % 2 == 0 ? max_delta + max_delta : min_delta + max_delta;
+    }
+    twkb = byte_vector_from(hex);
+    BOOST_CHECK(bg::read_twkb(twkb.data(), twkb.size(), linestring));
+    BOOST_CHECK_EQUAL(linestring.size(), 4u);
+
+    point_type point;
+    twkb = byte_vector_from("0100" + min_delta + max_delta);
+    BOOST_CHECK(bg::read_twkb(twkb.data(), twkb.size(), point));
+
+    // Random deltas of all sizes, read with and without the checks of the
+    // size of each varint
+    boost::uint64_t state = 12345;
+    for (std::size_t i = 0 ; i < 1000 ; ++i)
+    {
+        std::size_t const count = 1 + i % 20;
+        twkb = byte_vector_from("0200");
+        bg::detail::twkb::write_varint(count, std::back_inserter(twkb));
+        for (std::size_t j = 0 ; j < 2 * count ; ++j)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            boost::uint64_t const delta = state >> (state % 64);
+            bg::detail::twkb::write_varint(delta, std::back_inserter(twkb));
+        }
+        BOOST_CHECK(bg::read_twkb(twkb.data(), twkb.size(), linestring));
+        BOOST_CHECK_EQUAL(linestring.size(), count);
+        BOOST_CHECK(! bg::read_twkb(twkb.data(), twkb.size() - 1, linestring));
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_types();
+    test_precision();
+    test_metadata();
+    test_batch();
+    test_invalid();
+    test_overflow();
+
+    return 0;
+}
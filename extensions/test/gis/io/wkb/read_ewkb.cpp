@@ -0,0 +1,259 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/read_ewkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_view.hpp>
+#include <boost/geometry/extensions/multi/gis/io/wkb/read_wkb.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+byte_vector to_bytes(std::string const& hex)
+{
+    byte_vector result;
+    BOOST_CHECK(bg::hex2wkb(hex, std::back_inserter(result)));
+    return result;
+}
+
+template <typename Geometry>
+void test_ewkb(std::string const& hex, std::string const& wkt,
+               boost::uint32_t srid = 0, bool has_z = false, bool has_m = false)
+{
+    byte_vector const wkb = to_bytes(hex);
+
+    Geometry geometry;
+    bg::ewkb_info info;
+    BOOST_CHECK_MESSAGE(bg::read_ewkb(wkb.data(), wkb.size(), geometry, info),
+                        "read_ewkb failed for " << hex);
+    BOOST_CHECK_EQUAL(info.size, wkb.size());
+    BOOST_CHECK_EQUAL(info.srid, srid);
+    BOOST_CHECK_EQUAL(info.has_srid, srid != 0);
+    BOOST_CHECK_EQUAL(info.has_z, has_z);
+    BOOST_CHECK_EQUAL(info.has_m, has_m);
+    BOOST_CHECK_EQUAL(bg::to_wkt(geometry), wkt);
+
+    // The truncated bytes are not read
+    for (std::size_t size = 0 ; size < wkb.size() ; size += 1 + size / 4)
+    {
+        Geometry truncated;
+        BOOST_CHECK(! bg::read_ewkb(wkb.data(), size, truncated));
+    }
+}
+
+template <typename Geometry>
+void test_same_as_read_wkb(std::string const& hex)
+{
+    byte_vector const wkb = to_bytes(hex);
+
+    Geometry expected, geometry;
+    BOOST_CHECK(bg::read_wkb(wkb.begin(), wkb.end(), expected));
+    BOOST_CHECK(bg::read_ewkb(wkb.data(), wkb.size(), geometry));
+    BOOST_CHECK_EQUAL(bg::to_wkt(geometry), bg::to_wkt(expected));
+}
+
+void test_read()
+{
+    // WKB, both byte orders
+    test_ewkb<point_type>("0101000000000000000000F03F0000000000000040", "POINT(1 2)");
+    test_ewkb<point_type>("00000000013FF00000000000004000000000000000", "POINT(1 2)");
+
+    // XYZ, ISO and EWKB
+    test_ewkb<point3d_type>("01E9030000000000000000F03F00000000000000400000000000000840",
+                            "POINT(1 2 3)", 0, true);
+    test_ewkb<point3d_type>("0101000080000000000000F03F00000000000000400000000000000840",
+                            "POINT(1 2 3)", 0, true);
+    // Z ignored
+    test_ewkb<point_type>("0101000080000000000000F03F00000000000000400000000000000840",
+                          "POINT(1 2)", 0, true);
+    // Z missing
+    test_ewkb<point3d_type>("0101000000000000000000F03F0000000000000040", "POINT(1 2 0)");
+
+    // SRID=32632;POINT(1.234 5.678)
+    test_ewkb<point_type>("0101000020787F00005839B4C876BEF33F83C0CAA145B61640",
+                          "POINT(1.234 5.678)", 32632);
+    // SRID=4326;POINTM(1.234 5.678 99)
+    test_ewkb<point_type>("0101000060E61000005839B4C876BEF33F83C0CAA145B616400000000000C05840",
+                          "POINT(1.234 5.678)", 4326, false, true);
+    // SRID=4326;POINT(1.234 5.678 15 79)
+    test_ewkb<point3d_type>("01010000E0E61000005839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
+                            "POINT(1.234 5.678 15)", 4326, true, true);
+    // ISO POINT ZM
+    test_ewkb<point3d_type>("01B90B00005839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
+                            "POINT(1.234 5.678 15)", 0, true, true);
+
+    // LINESTRING Z (1 2 3,2 3 4,4 5 6), ISO and EWKB with SRID
+    test_ewkb<bg::model::linestring<point3d_type> >(
+        "01EA03000003000000000000000000F03F00000000000000400000000000000840000000000000004000000000000008400000000000001040000000000000104000000000000014400000000000001840",
+        "LINESTRING(1 2 3,2 3 4,4 5 6)", 0, true);
+    test_ewkb<linestring_type>(
+        "01020000A0E610000003000000000000000000F03F00000000000000400000000000000840000000000000004000000000000008400000000000001040000000000000104000000000000014400000000000001840",
+        "LINESTRING(1 2,2 3,4 5)", 4326, true);
+
+    test_ewkb<polygon_type>(
+        "0103000000020000000500000000000000008041400000000000002440000000000080464000000000008046400000000000002E40000000000000444000000000000024400000000000003440000000000080414000000000000024400400000000000000000034400000000000003E40000000000080414000000000008041400000000000003E40000000000000344000000000000034400000000000003E40",
+        "POLYGON((35 10,45 45,15 40,10 20,35 10),(20 30,35 35,30 20,20 30))");
+
+    test_ewkb<multi_point_type>(
+        "01040000000200000001010000005839b4c876bef33f83c0caa145b61640010100000062a1d634ef3824409cc420b072482a40",
+        "MULTIPOINT((1.234 5.678),(10.1112 13.1415))");
+    // Elements in different byte order
+    test_ewkb<multi_point_type>(
+        "0104000000020000000101000000000000000000F03F000000000000004000000000013FF00000000000004000000000000000",
+        "MULTIPOINT((1 2),(1 2))");
+
+    test_ewkb<multi_linestring_type>(
+        "01050000000200000001020000000200000000000000000000000000000000000000000000000000F03F000000000000F03F0102000000020000000000000000000040000000000000004000000000000008400000000000000840",
+        "MULTILINESTRING((0 0,1 1),(2 2,3 3))");
+
+    test_ewkb<multi_polygon_type>(
+        "010600000002000000010300000001000000040000000000000000000000000000000000000000000000000000000000000000000040000000000000F03F000000000000F03F000000000000000000000000000000000103000000010000000400000000000000000008400000000000000000000000000000104000000000000000000000000000001040000000000000004000000000000008400000000000000000",
+        "MULTIPOLYGON(((0 0,0 2,1 1,0 0)),((3 0,4 0,4 2,3 0)))");
+
+    test_same_as_read_wkb<linestring_type>(
+        "0102000000030000005839B4C876BEF33F83C0CAA145B616404F401361C333224062A1D634EF3824409CC420B072482A40EB73B515FB2B3040");
+    test_same_as_read_wkb<polygon_type>(
+        "010300000001000000050000000000000000005940000000000000694000000000000069400000000000006940000000000000694000000000000079400000000000005940000000000000794000000000000059400000000000006940");
+}
+
+void test_invalid()
+{
+    // Wrong type
+    byte_vector const wkb = to_bytes("0101000000000000000000F03F0000000000000040");
+    linestring_type ls;
+    BOOST_CHECK(! bg::read_ewkb(wkb.data(), wkb.size(), ls));
+
+    // Wrong byte order
+    byte_vector const wrong_order = to_bytes("0201000000000000000000F03F0000000000000040");
+    point_type pt;
+    BOOST_CHECK(! bg::read_ewkb(wrong_order.data(), wrong_order.size(), pt));
+
+    // Number of points exceeding the size
+    byte_vector const too_many = to_bytes("0102000000FFFFFFFF000000000000F03F0000000000000040");
+    BOOST_CHECK(! bg::read_ewkb(too_many.data(), too_many.size(), ls));
+}
+
+void test_reuse()
+{
+    std::string const hex = "0102000000030000005839B4C876BEF33F83C0CAA145B616404F401361C333224062A1D634EF3824409CC420B072482A40EB73B515FB2B3040";
+    byte_vector const wkb = to_bytes(hex);
+
+    linestring_type ls;
+    for (int i = 0 ; i < 50 ; ++i)
+    {
+        bg::append(ls, point_type(i, i));
+    }
+    BOOST_CHECK(bg::read_ewkb(wkb.data(), wkb.size(), ls));
+    BOOST_CHECK_EQUAL(ls.size(), 3u);
+    BOOST_CHECK_GE(ls.capacity(), 50u);
+
+    // Interior rings are removed
+    polygon_type poly;
+    bg::read_wkt("POLYGON((0 0,0 9,9 9,9 0,0 0),(1 1,2 1,2 2,1 1),(3 3,4 3,4 4,3 3))", poly);
+    byte_vector const square = to_bytes("010300000001000000050000000000000000005940000000000000694000000000000069400000000000006940000000000000694000000000000079400000000000005940000000000000794000000000000059400000000000006940");
+    BOOST_CHECK(bg::read_ewkb(square.data(), square.size(), poly));
+    BOOST_CHECK_EQUAL(poly.inners().size(), 0u);
+    BOOST_CHECK_EQUAL(poly.outer().size(), 5u);
+
+    // Long linestring in the opposite byte order, decoded in several blocks
+    byte_vector xdr = to_bytes("0000000002");
+    std::size_t const count = 1000;
+    for (int i = 3 ; i >= 0 ; --i)
+    {
+        xdr.push_back(boost::uint8_t(count >> (8 * i)));
+    }
+    for (std::size_t i = 0 ; i < 2 * count ; ++i)
+    {
+        double const value = double(i) + 0.5;
+        boost::uint64_t bits;
+        std::memcpy(&bits, &value, 8);
+        for (int j = 7 ; j >= 0 ; --j)
+        {
+            xdr.push_back(boost::uint8_t(bits >> (8 * j)));
+        }
+    }
+    BOOST_CHECK(bg::read_ewkb(xdr.data(), xdr.size(), ls));
+    BOOST_CHECK_EQUAL(ls.size(), count);
+    BOOST_CHECK_EQUAL(bg::get<0>(ls[999]), 1998.5);
+    BOOST_CHECK_EQUAL(bg::get<1>(ls[999]), 1999.5);
+}
+
+void test_view()
+{
+    {
+        byte_vector const wkb = to_bytes("01020000A0E610000003000000000000000000F03F00000000000000400000000000000840000000000000004000000000000008400000000000001040000000000000104000000000000014400000000000001840");
+
+        bg::wkb_linestring_view<point_type> view(wkb.data(), wkb.size());
+        BOOST_CHECK_EQUAL(view.size(), 3u);
+        BOOST_CHECK_EQUAL(view.srid(), 4326u);
+        BOOST_CHECK_EQUAL(bg::to_wkt(view), "LINESTRING(1 2,2 3,4 5)");
+        BOOST_CHECK_CLOSE(bg::length(view), std::sqrt(2.0) + std::sqrt(8.0), 1e-12);
+
+        bg::wkb_linestring_view<point3d_type> view3d(wkb.data(), wkb.size());
+        BOOST_CHECK_EQUAL(bg::to_wkt(view3d), "LINESTRING(1 2 3,2 3 4,4 5 6)");
+
+        bg::model::box<point_type> box;
+        bg::envelope(view, box);
+        BOOST_CHECK_EQUAL(bg::to_wkt(box), "POLYGON((1 2,1 5,4 5,4 2,1 2))");
+        BOOST_CHECK_CLOSE(bg::distance(point_type(0, 2), view), 1.0, 1e-12);
+
+        // Not a linestring
+        BOOST_CHECK(! view.assign(wkb.data(), 10));
+        BOOST_CHECK(view.empty());
+    }
+
+    {
+        // Polygon stored in big endian
+        std::string const hex = "000000000300000002000000053FF00000000000003FF00000000000003FF000000000000040240000000000004024000000000000402400000000000040240000000000003FF00000000000003FF00000000000003FF00000000000000000000440000000000000004000000000000000400800000000000040080000000000004000000000000000400800000000000040000000000000004000000000000000";
+        byte_vector const wkb = to_bytes(hex);
+
+        bg::wkb_ring_view<point_type> exterior(wkb.data(), wkb.size());
+        BOOST_CHECK_EQUAL(exterior.size(), 5u);
+        BOOST_CHECK_CLOSE(bg::area(exterior), 81.0, 1e-12);
+        BOOST_CHECK(bg::within(point_type(5, 5), exterior));
+
+        bg::wkb_ring_view<point_type, false> interior(wkb.data(), wkb.size(), 1);
+        BOOST_CHECK_EQUAL(interior.size(), 4u);
+        BOOST_CHECK_CLOSE(bg::area(interior), 0.5, 1e-12);
+
+        polygon_type poly;
+        BOOST_CHECK(bg::read_ewkb(wkb.data(), wkb.size(), poly));
+        BOOST_CHECK_CLOSE(bg::area(poly), 80.5, 1e-12);
+
+        BOOST_CHECK(! interior.assign(wkb.data(), wkb.size(), 2));
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_read();
+    test_invalid();
+    test_reuse();
+    test_view();
+
+    return 0;
+}
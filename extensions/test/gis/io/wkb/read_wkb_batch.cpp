@@ -0,0 +1,174 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <geometry_test_common.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/read_wkb_batch.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+std::vector<polygon_type> make_polygons(std::size_t count)
+{
+    std::vector<polygon_type> result(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const x = double(i % 100);
+        double const y = double(i / 100);
+        std::size_t const n = 4 + i % 5;
+        polygon_type& polygon = result[i];
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            double const a = -2.0 * bg::math::pi<double>() * double(j) / double(n);
+            bg::append(polygon, point_type(x + 0.25 * std::cos(a), y + 0.25 * std::sin(a)));
+        }
+        bg::append(polygon, polygon.outer().front());
+    }
+    return result;
+}
+
+// Prefixes the WKBs stored between the offsets by their sizes
+byte_vector make_records(byte_vector const& data, std::vector<boost::uint32_t> const& offsets)
+{
+    byte_vector result;
+    for (std::size_t i = 0 ; i + 1 < offsets.size() ; ++i)
+    {
+        boost::uint32_t const size = offsets[i + 1] - offsets[i];
+        for (int b = 0 ; b < 4 ; ++b)
+        {
+            result.push_back(boost::uint8_t(size >> (8 * b)));
+        }
+        result.insert(result.end(), data.begin() + offsets[i], data.begin() + offsets[i + 1]);
+    }
+    return result;
+}
+
+template <typename Executor>
+void test_batch(Executor const& executor)
+{
+    std::vector<polygon_type> const polygons = make_polygons(10000);
+    byte_vector data;
+    std::vector<boost::uint32_t> offsets;
+    BOOST_CHECK(bg::write_wkb_batch(polygons, data, offsets,
+                                    bg::detail::wkb::byte_order_type::ndr));
+
+    std::vector<polygon_type> result(1);
+    BOOST_CHECK(bg::read_wkb_batch(data.data(), offsets.data(), polygons.size(),
+                                   result, executor));
+    BOOST_CHECK_EQUAL(result.size(), polygons.size() + 1);
+    for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+    {
+        BOOST_CHECK_MESSAGE(bg::equals(result[i + 1], polygons[i]), "polygon " << i);
+    }
+
+    std::vector<polygon_type> geometries;
+    std::vector<std::pair<box_type, std::size_t> > values;
+    BOOST_CHECK(bg::read_wkb_batch(data.data(), offsets.data(), polygons.size(),
+                                   geometries, values, executor));
+    BOOST_CHECK_EQUAL(values.size(), polygons.size());
+    for (std::size_t i = 0 ; i < values.size() ; ++i)
+    {
+        BOOST_CHECK_EQUAL(values[i].second, i);
+        BOOST_CHECK(bg::equals(values[i].first,
+                               bg::return_envelope<box_type>(polygons[i])));
+    }
+
+    bg::index::rtree<std::pair<box_type, std::size_t>, bg::index::rstar<16> >
+        rtree(values);
+    std::vector<std::pair<box_type, std::size_t> > found;
+    rtree.query(bg::index::intersects(point_type(7.0, 42.0)), std::back_inserter(found));
+    BOOST_CHECK_EQUAL(found.size(), 1u);
+    if (! found.empty())
+    {
+        BOOST_CHECK_EQUAL(found.front().second, 4207u);
+    }
+
+    // Size prefixed records
+    byte_vector const records = make_records(data, offsets);
+    std::vector<box_type> boxes;
+    geometries.clear();
+    BOOST_CHECK(bg::read_wkb_records(records.data(), records.size(),
+                                     geometries, boxes, executor));
+    BOOST_CHECK_EQUAL(geometries.size(), polygons.size());
+    BOOST_CHECK_EQUAL(boxes.size(), polygons.size());
+    BOOST_CHECK(bg::equals(geometries[9999], polygons[9999]));
+    BOOST_CHECK(bg::equals(boxes[9999], bg::return_envelope<box_type>(polygons[9999])));
+
+    geometries.clear();
+    BOOST_CHECK(bg::read_wkb_records(records.data(), std::size_t(0), geometries, executor));
+    BOOST_CHECK(geometries.empty());
+}
+
+template <typename Executor>
+void test_invalid(Executor const& executor)
+{
+    std::vector<polygon_type> const polygons = make_polygons(5000);
+    byte_vector data;
+    std::vector<boost::uint32_t> offsets;
+    bg::write_wkb_batch(polygons, data, offsets,
+                        bg::detail::wkb::byte_order_type::ndr);
+
+    std::vector<polygon_type> result(2);
+    std::vector<box_type> boxes(3);
+
+    // Nothing is appended if any of the WKBs is not valid
+    byte_vector corrupted = data;
+    corrupted[offsets[3000] + 1] = 99;
+    BOOST_CHECK(! bg::read_wkb_batch(corrupted.data(), offsets.data(), polygons.size(),
+                                     result, boxes, executor));
+    BOOST_CHECK_EQUAL(result.size(), 2u);
+    BOOST_CHECK_EQUAL(boxes.size(), 3u);
+
+    // The WKBs have to end at the next offset
+    std::vector<boost::uint32_t> shifted = offsets;
+    shifted[4000] += 1;
+    BOOST_CHECK(! bg::read_wkb_batch(data.data(), shifted.data(), polygons.size(),
+                                     result, executor));
+    BOOST_CHECK_EQUAL(result.size(), 2u);
+
+    // The WKBs have to be of the type of the geometries
+    std::vector<multi_polygon_type> multi_polygons;
+    BOOST_CHECK(! bg::read_wkb_batch(data.data(), offsets.data(), polygons.size(),
+                                     multi_polygons, executor));
+    BOOST_CHECK(multi_polygons.empty());
+
+    // Truncated records
+    byte_vector const records = make_records(data, offsets);
+    BOOST_CHECK(! bg::read_wkb_records(records.data(), records.size() - 1,
+                                       result, executor));
+    BOOST_CHECK(! bg::read_wkb_records(records.data(), std::size_t(2),
+                                       result, executor));
+    BOOST_CHECK_EQUAL(result.size(), 2u);
+}
+
+int test_main(int, char* [])
+{
+    test_batch(bg::sequential_executor());
+    test_batch(bg::thread_executor(4));
+    test_invalid(bg::sequential_executor());
+    test_invalid(bg::thread_executor(4));
+    return 0;
+}
@@ -7,6 +7,8 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <algorithm>
+#include <deque>
 #include <iterator>
 #include <string>
 #include <vector>
@@ -21,8 +23,10 @@
 
 #include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/register/point.hpp>
 #include <boost/geometry/io/wkt/read.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_ewkb.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
 
 #include <boost/geometry/io/wkt/wkt.hpp>
@@ -40,6 +44,14 @@
 
 namespace bg = boost::geometry;
 
+// Point of consecutive doubles, in another order than its coordinates
+struct swapped_point
+{
+    double y, x;
+};
+
+BOOST_GEOMETRY_REGISTER_POINT_2D(swapped_point, double, bg::cs::cartesian, x, y)
+
 namespace { // anonymous
 
 template <typename Geometry, bool IsEqual>
@@ -54,6 +66,66 @@ void test_geometry_equals(Geometry const& geometry, std::string const& wkbhex)
     boost::algorithm::to_lower(hex_out);
     
     BOOST_CHECK_EQUAL( wkbhex, hex_out);
+
+    // Preallocated buffer
+    std::size_t const size = bg::wkb_size(geometry);
+    BOOST_CHECK_EQUAL(size, wkb_out.size());
+
+    std::vector<boost::uint8_t> buffer(size + 1, 0xff);
+    BOOST_CHECK_EQUAL(bg::write_wkb(geometry, buffer.data(), size - 1), 0u);
+    BOOST_CHECK_EQUAL(buffer[0], 0xff);
+    BOOST_CHECK_EQUAL(bg::write_wkb(geometry, buffer.data(), buffer.size()), size);
+    BOOST_CHECK_EQUAL(buffer[size], 0xff);
+    BOOST_CHECK(std::string(buffer.begin(), buffer.begin() + size) == wkb_out);
+
+    // The other byte order is read back
+    bg::detail::wkb::byte_order_type::enum_t const other_order
+        = bg::detail::wkb::native_byte_order() == bg::detail::wkb::byte_order_type::ndr
+        ? bg::detail::wkb::byte_order_type::xdr
+        : bg::detail::wkb::byte_order_type::ndr;
+    BOOST_CHECK_EQUAL(bg::write_wkb(geometry, buffer.data(), size, other_order), size);
+    BOOST_CHECK_EQUAL(buffer[0], boost::uint8_t(other_order));
+    Geometry read_back = geometry;
+    BOOST_CHECK(bg::read_ewkb(buffer.data(), size, read_back));
+    std::string read_back_wkb;
+    bg::write_wkb(read_back, std::back_inserter(read_back_wkb));
+    BOOST_CHECK(read_back_wkb == wkb_out);
+}
+
+template <typename Geometry>
+void test_batch(std::vector<Geometry> const& geometries)
+{
+    std::vector<char> data(3, 'x');
+    std::vector<boost::int32_t> offsets;
+    BOOST_CHECK(bg::write_wkb_batch(geometries, data, offsets,
+                                    bg::detail::wkb::byte_order_type::ndr));
+    BOOST_CHECK_EQUAL(offsets.size(), geometries.size() + 1);
+    BOOST_CHECK_EQUAL(offsets.front(), 3);
+    BOOST_CHECK_EQUAL(std::size_t(offsets.back()), data.size());
+
+    // Appending continues the offsets
+    BOOST_CHECK(bg::write_wkb_batch(geometries, data, offsets,
+                                    bg::detail::wkb::byte_order_type::ndr));
+    BOOST_CHECK_EQUAL(offsets.size(), 2 * geometries.size() + 1);
+    BOOST_CHECK_EQUAL(std::size_t(offsets.back()), data.size());
+
+    for (std::size_t i = 0 ; i + 1 < offsets.size() ; ++i)
+    {
+        Geometry const& expected = geometries[i % geometries.size()];
+
+        std::string wkb_out;
+        bg::write_wkb(expected, std::back_inserter(wkb_out));
+        BOOST_CHECK_EQUAL(std::size_t(offsets[i + 1] - offsets[i]), wkb_out.size());
+        BOOST_CHECK(std::equal(wkb_out.begin(), wkb_out.end(), data.begin() + offsets[i]));
+    }
+
+    // Offsets not fitting into the offset type
+    std::vector<boost::uint8_t> small_data(250);
+    std::vector<boost::uint8_t> small_offsets;
+    BOOST_CHECK(! bg::write_wkb_batch(geometries, small_data, small_offsets,
+                                      bg::detail::wkb::byte_order_type::ndr));
+    BOOST_CHECK(small_offsets.empty());
+    BOOST_CHECK_EQUAL(small_data.size(), 250u);
 }
 } // namespace anonymous
 
@@ -352,5 +424,73 @@ int test_main(int, char* [])
             );
     }
     
+    //
+    // Points stored in other containers and with other coordinate types
+    //
+
+    {
+        typedef bg::model::point<float, 2, bg::cs::cartesian> point_f_type;
+        bg::model::linestring<point_f_type> linestring;
+        bg::model::linestring<point_type, std::deque> deque_linestring;
+        for (int i = 0 ; i < 1000 ; ++i)
+        {
+            bg::append(linestring, point_f_type(i * 0.5f, i * 0.25f));
+            bg::append(deque_linestring, point_type(i * 0.5, i * 0.25));
+        }
+
+        std::string expected, out;
+        bg::write_wkb(deque_linestring, std::back_inserter(expected));
+        bg::write_wkb(linestring, std::back_inserter(out));
+        BOOST_CHECK(expected == out);
+
+        std::string hex;
+        bg::wkb2hex(expected.begin(), expected.end(), hex);
+        boost::algorithm::to_lower(hex);
+
+        test_geometry_equals<bg::model::linestring<point_type, std::deque>, true>
+            (deque_linestring, hex);
+        test_geometry_equals<bg::model::linestring<point_f_type>, true>
+            (linestring, hex);
+    }
+
+    {
+        // The coordinates are written in the order of the point, not of
+        // its members
+        bg::model::linestring<swapped_point> linestring;
+        bg::model::linestring<point_type, std::deque> deque_linestring;
+        for (int i = 0 ; i < 100 ; ++i)
+        {
+            swapped_point const p = { i * 0.25, i * 0.5 };
+            linestring.push_back(p);
+            bg::append(deque_linestring, point_type(i * 0.5, i * 0.25));
+        }
+
+        std::string expected, out;
+        bg::write_wkb(deque_linestring, std::back_inserter(expected));
+        bg::write_wkb(linestring, std::back_inserter(out));
+        BOOST_CHECK(expected == out);
+
+        std::vector<boost::uint8_t> buffer(bg::wkb_size(linestring));
+        BOOST_CHECK_EQUAL(bg::write_wkb(linestring, buffer.data(), buffer.size()),
+                          expected.size());
+        BOOST_CHECK(std::string(buffer.begin(), buffer.end()) == expected);
+    }
+
+    //
+    // Batch
+    //
+
+    {
+        std::vector<polygon_type> polygons(3);
+        bg::read_wkt("POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1))", polygons[0]);
+        bg::read_wkt("POLYGON((0 0,0 1,1 0,0 0))", polygons[2]);
+        test_batch(polygons);
+
+        std::vector<point3d_type> points;
+        points.push_back(point3d_type(1, 2, 3));
+        points.push_back(point3d_type(4, 5, 6));
+        test_batch(points);
+    }
+
     return 0;
 }
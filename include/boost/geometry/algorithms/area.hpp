@@ -29,6 +29,7 @@
 #include <boost/variant/variant_fwd.hpp>
 
 #include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
 #include <boost/geometry/core/point_order.hpp>
@@ -52,8 +53,10 @@
 
 #include <boost/geometry/strategies/concepts/area_concept.hpp>
 
+#include <boost/geometry/util/condition.hpp>
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/order_as_direction.hpp>
+#include <boost/geometry/util/range.hpp>
 #include <boost/geometry/views/closeable_view.hpp>
 #include <boost/geometry/views/reversible_view.hpp>
 
@@ -81,6 +84,66 @@ struct box_area
 };
 
 
+// Adds the segments of the ring to the state of the strategy
+template
+<
+    iterate_direction Direction,
+    closure_selector Closure,
+    bool Contiguous
+>
+struct ring_area_segments
+{
+    template <typename Ring, typename Strategy, typename State>
+    static inline void apply(Ring const& ring, Strategy const& strategy,
+                             State& state)
+    {
+        typedef typename reversible_view<Ring const, Direction>::type rview_type;
+        typedef typename closeable_view
+            <
+                rview_type const, Closure
+            >::type view_type;
+        typedef typename boost::range_iterator<view_type const>::type iterator_type;
+
+        rview_type rview(ring);
+        view_type view(rview);
+        iterator_type it = boost::begin(view);
+        iterator_type end = boost::end(view);
+
+        for (iterator_type previous = it++;
+            it != end;
+            ++previous, ++it)
+        {
+            strategy.apply(*previous, *it, state);
+        }
+    }
+};
+
+// Adds the segments of a ring of which the coordinates are stored
+// contiguously with one kernel, reversing the sign if traversed reversed
+template <iterate_direction Direction, closure_selector Closure>
+struct ring_area_segments<Direction, Closure, true>
+{
+    template <typename Ring, typename Strategy, typename State>
+    static inline void apply(Ring const& ring, Strategy const& strategy,
+                             State& state)
+    {
+        bool const reversed = Direction == iterate_reverse;
+        strategy.apply_contiguous(geometry::detail::coordinates_begin<double>(ring),
+                                  boost::size(ring), reversed, state);
+        if (BOOST_GEOMETRY_CONDITION(Closure == open))
+        {
+            if (reversed)
+            {
+                strategy.apply(range::front(ring), range::back(ring), state);
+            }
+            else
+            {
+                strategy.apply(range::back(ring), range::front(ring), state);
+            }
+        }
+    }
+};
+
 template
 <
     iterate_direction Direction,
@@ -109,27 +172,17 @@ struct ring_area
             return typename area_result<Ring, Strategies>::type();
         }
 
-        typedef typename reversible_view<Ring const, Direction>::type rview_type;
-        typedef typename closeable_view
-            <
-                rview_type const, Closure
-            >::type view_type;
-        typedef typename boost::range_iterator<view_type const>::type iterator_type;
-
-        rview_type rview(ring);
-        view_type view(rview);
-        iterator_type it = boost::begin(view);
-        iterator_type end = boost::end(view);
-
         strategy_type strategy = strategies.area(ring);
         typename strategy_type::template state<Ring> state;        
 
-        for (iterator_type previous = it++;
-            it != end;
-            ++previous, ++it)
-        {
-            strategy.apply(*previous, *it, state);
-        }
+        ring_area_segments
+            <
+                Direction, Closure,
+                strategy::area::detail::contiguous_kernel
+                    <
+                        strategy_type, Ring
+                    >::value
+            >::apply(ring, strategy, state);
 
         return strategy.result(state);
     }
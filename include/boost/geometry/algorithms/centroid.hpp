@@ -25,6 +25,7 @@
 #include <cstddef>
 
 #include <boost/core/ignore_unused.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/range.hpp>
 #include <boost/throw_exception.hpp>
 
@@ -33,6 +34,7 @@
 #include <boost/variant/variant_fwd.hpp>
 
 #include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
 #include <boost/geometry/core/exception.hpp>
@@ -54,7 +56,9 @@
 #include <boost/geometry/strategies/default_strategy.hpp>
 #include <boost/geometry/views/closeable_view.hpp>
 
+#include <boost/geometry/util/condition.hpp>
 #include <boost/geometry/util/for_each_coordinate.hpp>
+#include <boost/geometry/util/range.hpp>
 #include <boost/geometry/util/select_coordinate_type.hpp>
 
 #include <boost/geometry/algorithms/is_empty.hpp>
@@ -209,6 +213,39 @@ struct centroid_range_state
                              PointTransformer const& transformer,
                              Strategy const& strategy,
                              typename Strategy::state_type& state)
+    {
+        apply(ring, transformer, strategy, state,
+              boost::integral_constant
+                <
+                    bool,
+                    strategy::centroid::detail::contiguous_kernel
+                        <
+                            Strategy, Ring
+                        >::value
+                    && is_translating<PointTransformer>::value
+                >());
+    }
+
+private :
+    template <typename Transformer>
+    struct is_translating
+        : boost::false_type
+    {};
+
+    template <typename Geometry>
+    struct is_translating
+        <
+            translating_transformer<Geometry, areal_tag, cartesian_tag>
+        >
+        : boost::true_type
+    {};
+
+    template<typename Ring, typename PointTransformer, typename Strategy>
+    static inline void apply(Ring const& ring,
+                             PointTransformer const& transformer,
+                             Strategy const& strategy,
+                             typename Strategy::state_type& state,
+                             boost::false_type)
     {
         boost::ignore_unused(strategy);
 
@@ -239,6 +276,37 @@ struct centroid_range_state
             }
         }
     }
+
+    // The coordinates are stored contiguously, all segments are translated
+    // and added by one kernel
+    template<typename Ring, typename PointTransformer, typename Strategy>
+    static inline void apply(Ring const& ring,
+                             PointTransformer const& transformer,
+                             Strategy const& strategy,
+                             typename Strategy::state_type& state,
+                             boost::true_type)
+    {
+        typedef typename geometry::point_type<Ring const>::type point_type;
+
+        if (boost::empty(ring) || transformer.m_origin == NULL)
+        {
+            return;
+        }
+
+        point_type const& origin = *transformer.m_origin;
+        strategy.apply_contiguous(
+                geometry::detail::coordinates_begin<double>(ring),
+                boost::size(ring),
+                geometry::get<0>(origin), geometry::get<1>(origin),
+                state);
+
+        if (BOOST_GEOMETRY_CONDITION(Closure == open))
+        {
+            strategy.apply(transformer.apply(range::back(ring)),
+                           transformer.apply(range::front(ring)),
+                           state);
+        }
+    }
 };
 
 template <closure_selector Closure>
@@ -70,6 +70,22 @@ struct hull_insert
         strategy.result(state, out, Order == clockwise, Closure != open);
         return out;
     }
+
+    template
+    <
+        typename Geometry, typename OutputIterator,
+        typename Strategy, typename Executor
+    >
+    static inline OutputIterator apply(Geometry const& geometry,
+            OutputIterator out, Strategy const& strategy,
+            Executor const& executor)
+    {
+        typename Strategy::state_type state;
+
+        strategy.apply(geometry, state, executor);
+        strategy.result(state, out, Order == clockwise, Closure != open);
+        return out;
+    }
 };
 
 struct hull_to_geometry
@@ -90,6 +106,26 @@ struct hull_to_geometry
                             typename range_type<OutputGeometry>::type
                         >(out)), strategy);
     }
+
+    template
+    <
+        typename Geometry, typename OutputGeometry,
+        typename Strategy, typename Executor
+    >
+    static inline void apply(Geometry const& geometry, OutputGeometry& out,
+            Strategy const& strategy, Executor const& executor)
+    {
+        hull_insert
+            <
+                geometry::point_order<OutputGeometry>::value,
+                geometry::closure<OutputGeometry>::value
+            >::apply(geometry,
+                range::back_inserter(
+                    detail::as_range
+                        <
+                            typename range_type<OutputGeometry>::type
+                        >(out)), strategy, executor);
+    }
 };
 
 }} // namespace detail::convex_hull
@@ -131,6 +167,13 @@ struct convex_hull<Box, box_tag>
             geometry::append(out, *boost::begin(range));
         }
     }
+
+    template <typename OutputGeometry, typename Strategy, typename Executor>
+    static inline void apply(Box const& box, OutputGeometry& out,
+            Strategy const& strategy, Executor const& )
+    {
+        apply(box, out, strategy);
+    }
 };
 
 
@@ -170,6 +213,34 @@ struct convex_hull
 
         apply(geometry, out, strategy_type());
     }
+
+    template
+    <
+        typename Geometry, typename OutputGeometry,
+        typename Strategy, typename Executor
+    >
+    static inline void apply(Geometry const& geometry,
+                             OutputGeometry& out,
+                             Strategy const& strategy,
+                             Executor const& executor)
+    {
+        BOOST_CONCEPT_ASSERT( (geometry::concepts::ConvexHullStrategy<Strategy>) );
+        dispatch::convex_hull<Geometry>::apply(geometry, out, strategy, executor);
+    }
+
+    template <typename Geometry, typename OutputGeometry, typename Executor>
+    static inline void apply(Geometry const& geometry,
+                             OutputGeometry& out,
+                             default_strategy,
+                             Executor const& executor)
+    {
+        typedef typename strategy_convex_hull<
+            Geometry,
+            typename point_type<Geometry>::type
+        >::type strategy_type;
+
+        apply(geometry, out, strategy_type(), executor);
+    }
 };
 
 struct convex_hull_insert
@@ -330,6 +401,46 @@ inline void convex_hull(Geometry const& geometry,
     geometry::convex_hull(geometry, hull, default_strategy());
 }
 
+/*!
+\brief \brief_calc{convex hull} \brief_strategy using an executor
+\ingroup convex_hull
+\details The hulls of chunks of the points of a Linestring, Ring or
+    MultiPoint are calculated in parallel by the executor and merged. The
+    hulls of other geometries are calculated sequentially.
+\tparam Geometry the input geometry type
+\tparam OutputGeometry the output geometry type
+\tparam Strategy the strategy type, it has to support executors
+\tparam Executor executor, e.g. thread_executor
+\param geometry \param_geometry,  input geometry
+\param out \param_geometry \param_set{convex hull}
+\param strategy \param_strategy{convex hull}
+\param executor Executor running the tasks
+
+\qbk{distinguish,with strategy and executor}
+ */
+template
+<
+    typename Geometry, typename OutputGeometry,
+    typename Strategy, typename Executor
+>
+inline void convex_hull(Geometry const& geometry,
+            OutputGeometry& out, Strategy const& strategy,
+            Executor const& executor)
+{
+    concepts::check_concepts_and_equal_dimensions<
+        const Geometry,
+        OutputGeometry
+    >();
+
+    if (geometry::is_empty(geometry))
+    {
+        // Leave output empty
+        return;
+    }
+
+    resolve_strategy::convex_hull::apply(geometry, out, strategy, executor);
+}
+
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace convex_hull
 {
@@ -286,9 +286,11 @@ struct calculate_point_order_by_area
     template <typename Ring, typename Strategy>
     static geometry::order_selector apply(Ring const& ring, Strategy const& strategy)
     {
+        // The points are visited in their order regardless of the declared
+        // order, so the result is positive for clockwise rings
         typedef detail::area::ring_area
             <
-                geometry::order_as_direction<geometry::point_order<Ring>::value>::value,
+                geometry::iterate_forward,
                 geometry::closure<Ring>::value
             > ring_area_type;
 
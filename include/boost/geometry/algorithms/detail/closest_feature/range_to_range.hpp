@@ -16,11 +16,18 @@
 #include <iterator>
 #include <utility>
 
+#include <boost/core/ignore_unused.hpp>
+
+#include <boost/type_traits/is_same.hpp>
+
 #include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/algorithms/dispatch/distance.hpp>
 #include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/index/detail/rtree/utilities/view.hpp>
+#include <boost/geometry/util/math.hpp>
 
 
 namespace boost { namespace geometry
@@ -31,88 +38,178 @@ namespace detail { namespace closest_feature
 {
 
 
-// returns a pair of a objects where the first is an object of the
-// r-tree range and the second an object of the query range that
-// realizes the closest feature of the two ranges
-class range_to_range_rtree
+// An rtree of the points or segments of a range, packed once and used to
+// find the closest feature of the rtree range and of many query ranges.
+// The search of a query range stops at distance 0. In cartesian systems
+// every nearest search is bounded by the distance of the closest pair
+// found so far, so the subtrees further than it are not visited. The
+// comparable distances of the non-cartesian index strategies of boxes
+// are not lower bounds of the comparable distances of the features in
+// them, they can only prune the search of a single query.
+template <typename RTreeValueType, typename Strategy>
+class range_rtree
 {
 private:
-    template
-    <
-        typename RTreeRangeIterator,
-        typename QueryRangeIterator,
-        typename Strategy,
-        typename RTreeValueType,
-        typename Distance
-    >
-    static inline void apply(RTreeRangeIterator rtree_first,
-                             RTreeRangeIterator rtree_last,
-                             QueryRangeIterator queries_first,
-                             QueryRangeIterator queries_last,
-                             Strategy const& strategy,
-                             RTreeValueType& rtree_min,
-                             QueryRangeIterator& qit_min,
-                             Distance& dist_min)
+    typedef strategy::index::services::from_strategy
+        <
+            Strategy
+        > index_strategy_from;
+    typedef index::parameters
+        <
+            index::linear<8>, typename index_strategy_from::type
+        > index_parameters_type;
+    typedef index::rtree<RTreeValueType, index_parameters_type> rtree_type;
+    typedef index::detail::rtree::utilities::view<rtree_type> view_type;
+
+public:
+    template <typename RTreeRangeIterator>
+    inline range_rtree(RTreeRangeIterator rtree_first,
+                       RTreeRangeIterator rtree_last,
+                       Strategy const& strategy)
+        // create -- packing algorithm
+        : m_rtree(rtree_first, rtree_last,
+                  index_parameters_type(index::linear<8>(),
+                                        index_strategy_from::get(strategy)))
+    {}
+
+    inline bool empty() const
     {
-        typedef strategy::index::services::from_strategy
+        return m_rtree.empty();
+    }
+
+    // Finds the value of the rtree and the query realizing the closest
+    // feature, returns false if the rtree or the query range is empty
+    template <typename QueryRangeIterator, typename Distance>
+    inline bool apply(QueryRangeIterator queries_first,
+                      QueryRangeIterator queries_last,
+                      Strategy const& strategy,
+                      RTreeValueType& rtree_min,
+                      QueryRangeIterator& qit_min,
+                      Distance& dist_min) const
+    {
+        typedef typename std::iterator_traits
             <
-                Strategy
-            > index_strategy_from;
-        typedef index::parameters
+                QueryRangeIterator
+            >::value_type query_type;
+        typedef index::detail::predicates::nearest<query_type> predicate_type;
+        typedef index::detail::rtree::visitors::distance_query
             <
-                index::linear<8>, typename index_strategy_from::type
-            > index_parameters_type;
-        typedef index::rtree<RTreeValueType, index_parameters_type> rtree_type;
-
-        BOOST_GEOMETRY_ASSERT( rtree_first != rtree_last );
-        BOOST_GEOMETRY_ASSERT( queries_first != queries_last );
+                typename view_type::members_holder,
+                predicate_type,
+                0,
+                RTreeValueType*
+            > visitor_type;
+        typedef typename visitor_type::value_distance_type index_distance_type;
+
+        static const bool is_bounded = boost::is_same
+            <
+                typename cs_tag<RTreeValueType>::type, cartesian_tag
+            >::value;
 
         Distance const zero = Distance(0);
         dist_min = zero;
 
-        // create -- packing algorithm
-        rtree_type rt(rtree_first, rtree_last,
-                      index_parameters_type(index::linear<8>(),
-                                            index_strategy_from::get(strategy)));
+        view_type const view(m_rtree);
+        typename view_type::translator_type const translator = view.translator();
 
+        bool found = false;
+        // the comparable distance of the closest pair used by the rtree
+        index_distance_type bound = index_distance_type();
         RTreeValueType t_v;
-        bool first = true;
 
-        for (QueryRangeIterator qit = queries_first;
-             qit != queries_last; ++qit, first = false)
+        for (QueryRangeIterator qit = queries_first; qit != queries_last; ++qit)
         {
-            std::size_t n = rt.query(index::nearest(*qit, 1), &t_v);
+            predicate_type const predicate(*qit, 1);
+            std::size_t n = 0;
+            if (found && is_bounded)
+            {
+                visitor_type nearest_v(m_rtree.parameters(), translator,
+                                       predicate, &t_v, bound);
+                view.apply_visitor(nearest_v);
+                n = nearest_v.finish();
+            }
+            else
+            {
+                visitor_type nearest_v(m_rtree.parameters(), translator,
+                                       predicate, &t_v);
+                view.apply_visitor(nearest_v);
+                n = nearest_v.finish();
+            }
 
-            BOOST_GEOMETRY_ASSERT( n > 0 );
-            // n above is unused outside BOOST_GEOMETRY_ASSERT,
-            // hence the call to boost::ignore_unused below
-            //
-            // however, t_v (initialized by the call to rt.query(...))
-            // is used below, which is why we cannot put the call to
-            // rt.query(...) inside BOOST_GEOMETRY_ASSERT
-            boost::ignore_unused(n);
+            if (n == 0)
+            {
+                // no value is closer than the closest pair
+                continue;
+            }
 
             Distance dist = dispatch::distance
                 <
-                    RTreeValueType,
-                    typename std::iterator_traits
-                        <
-                            QueryRangeIterator
-                        >::value_type,
-                    Strategy
+                    RTreeValueType, query_type, Strategy
                 >::apply(t_v, *qit, strategy);
 
-            if (first || dist < dist_min)
+            if (! found || dist < dist_min)
             {
+                found = true;
                 dist_min = dist;
                 rtree_min = t_v;
                 qit_min = qit;
                 if ( math::equals(dist_min, zero) )
                 {
-                    return;
+                    return true;
+                }
+
+                if (is_bounded)
+                {
+                    visitor_type::calculate_value_distance::apply(predicate,
+                        translator(t_v),
+                        index::detail::get_strategy(m_rtree.parameters()),
+                        bound);
                 }
             }
         }
+
+        return found;
+    }
+
+private:
+    rtree_type m_rtree;
+};
+
+
+// returns a pair of a objects where the first is an object of the
+// r-tree range and the second an object of the query range that
+// realizes the closest feature of the two ranges
+class range_to_range_rtree
+{
+private:
+    template
+    <
+        typename RTreeRangeIterator,
+        typename QueryRangeIterator,
+        typename Strategy,
+        typename RTreeValueType,
+        typename Distance
+    >
+    static inline void apply(RTreeRangeIterator rtree_first,
+                             RTreeRangeIterator rtree_last,
+                             QueryRangeIterator queries_first,
+                             QueryRangeIterator queries_last,
+                             Strategy const& strategy,
+                             RTreeValueType& rtree_min,
+                             QueryRangeIterator& qit_min,
+                             Distance& dist_min)
+    {
+        BOOST_GEOMETRY_ASSERT( rtree_first != rtree_last );
+        BOOST_GEOMETRY_ASSERT( queries_first != queries_last );
+
+        range_rtree<RTreeValueType, Strategy> const
+            rt(rtree_first, rtree_last, strategy);
+
+        bool const found = rt.apply(queries_first, queries_last, strategy,
+                                    rtree_min, qit_min, dist_min);
+
+        BOOST_GEOMETRY_ASSERT( found );
+        boost::ignore_unused(found);
     }
 
 public:
@@ -45,6 +45,47 @@
 namespace boost { namespace geometry
 {
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace envelope
+{
+
+// Linestrings and MultiPoints are split into chunks processed by the
+// executor, the envelopes of other geometries are calculated sequentially
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct envelope_with_executor
+{
+    template <typename Box, typename Strategy, typename Executor>
+    static inline void apply(Geometry const& geometry,
+                             Box& box,
+                             Strategy const& strategy,
+                             Executor const& )
+    {
+        dispatch::envelope<Geometry>::apply(geometry, box, strategy);
+    }
+};
+
+template <typename Geometry>
+struct envelope_with_executor<Geometry, linestring_tag>
+{
+    template <typename Box, typename Strategy, typename Executor>
+    static inline void apply(Geometry const& geometry,
+                             Box& box,
+                             Strategy const& strategy,
+                             Executor const& executor)
+    {
+        dispatch::envelope<Geometry>::apply(geometry, box, strategy, executor);
+    }
+};
+
+template <typename Geometry>
+struct envelope_with_executor<Geometry, multi_point_tag>
+    : envelope_with_executor<Geometry, linestring_tag>
+{};
+
+}} // namespace detail::envelope
+#endif // DOXYGEN_NO_DETAIL
+
+
 namespace resolve_strategy
 {
 
@@ -62,6 +103,18 @@ struct envelope
     {
         dispatch::envelope<Geometry>::apply(geometry, box, strategy);
     }
+
+    template <typename Geometry, typename Box, typename Executor>
+    static inline void apply(Geometry const& geometry,
+                             Box& box,
+                             Strategy const& strategy,
+                             Executor const& executor)
+    {
+        detail::envelope::envelope_with_executor
+            <
+                Geometry
+            >::apply(geometry, box, strategy, executor);
+    }
 };
 
 template <typename Strategy>
@@ -78,6 +131,20 @@ struct envelope<Strategy, false>
                 Geometry
             >::apply(geometry, box, strategy_converter<Strategy>::get(strategy));
     }
+
+    template <typename Geometry, typename Box, typename Executor>
+    static inline void apply(Geometry const& geometry,
+                             Box& box,
+                             Strategy const& strategy,
+                             Executor const& executor)
+    {
+        using strategies::envelope::services::strategy_converter;
+        detail::envelope::envelope_with_executor
+            <
+                Geometry
+            >::apply(geometry, box, strategy_converter<Strategy>::get(strategy),
+                     executor);
+    }
 };
 
 template <>
@@ -95,6 +162,23 @@ struct envelope<default_strategy, false>
 
         dispatch::envelope<Geometry>::apply(geometry, box, strategy_type());
     }
+
+    template <typename Geometry, typename Box, typename Executor>
+    static inline void apply(Geometry const& geometry,
+                             Box& box,
+                             default_strategy,
+                             Executor const& executor)
+    {
+        typedef typename strategies::envelope::services::default_strategy
+            <
+                Geometry, Box
+            >::type strategy_type;
+
+        detail::envelope::envelope_with_executor
+            <
+                Geometry
+            >::apply(geometry, box, strategy_type(), executor);
+    }
 };
 
 } // namespace resolve_strategy
@@ -176,6 +260,35 @@ inline void envelope(Geometry const& geometry, Box& mbr, Strategy const& strateg
     resolve_variant::envelope<Geometry>::apply(geometry, mbr, strategy);
 }
 
+/*!
+\brief \brief_calc{envelope (with strategy)} using an executor
+\ingroup envelope
+\details \details_calc{envelope,\det_envelope}. The envelopes of chunks of
+    the points of a Linestring or MultiPoint are calculated in parallel by
+    the executor and merged. On a sphere or spheroid the longitude intervals
+    of the chunks are merged across the antimeridian. The envelopes of other
+    geometries are calculated sequentially.
+\tparam Geometry \tparam_geometry
+\tparam Box \tparam_box
+\tparam Strategy \tparam_strategy{Envelope}
+\tparam Executor executor, e.g. thread_executor
+\param geometry \param_geometry
+\param mbr \param_box \param_set{envelope}
+\param strategy \param_strategy{envelope}
+\param executor Executor running the tasks
+
+\qbk{distinguish,with strategy and executor}
+*/
+template<typename Geometry, typename Box, typename Strategy, typename Executor>
+inline void envelope(Geometry const& geometry, Box& mbr,
+                     Strategy const& strategy, Executor const& executor)
+{
+    concepts::check<Geometry const>();
+    concepts::check<Box>();
+
+    resolve_strategy::envelope<Strategy>::apply(geometry, mbr, strategy, executor);
+}
+
 /*!
 \brief \brief_calc{envelope}
 \ingroup envelope
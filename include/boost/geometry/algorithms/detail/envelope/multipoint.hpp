@@ -36,6 +36,15 @@ struct envelope<MultiPoint, multi_point_tag>
         using strategy_t = decltype(strategy.envelope(multipoint, mbr));
         strategy_t::apply(multipoint, mbr);
     }
+
+    template <typename Box, typename Strategy, typename Executor>
+    static inline void apply(MultiPoint const& multipoint, Box& mbr,
+                             Strategy const& strategy,
+                             Executor const& executor)
+    {
+        using strategy_t = decltype(strategy.envelope(multipoint, mbr));
+        strategy_t::apply(multipoint, mbr, executor);
+    }
 };
 
 
@@ -21,11 +21,14 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_ENVELOPE_RANGE_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_ENVELOPE_RANGE_HPP
 
+#include <cstddef>
 #include <iterator>
 #include <vector>
 
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/geometry/algorithms/is_empty.hpp>
 
@@ -34,8 +37,16 @@
 #include <boost/geometry/algorithms/detail/expand/point.hpp>
 #include <boost/geometry/algorithms/detail/expand/segment.hpp>
 
+#include <boost/geometry/algorithms/dispatch/envelope.hpp>
+#include <boost/geometry/algorithms/dispatch/expand.hpp>
+
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
 
+#include <boost/geometry/strategy/envelope.hpp>
+
+#include <boost/geometry/util/executor.hpp>
+
 namespace boost { namespace geometry
 {
 
@@ -44,6 +55,11 @@ namespace detail { namespace envelope
 {
 
 
+// Number of points or segments of which the envelope is calculated by one
+// task of an executor
+static const std::size_t envelope_chunk_size = 1 << 16;
+
+
 // implementation for simple ranges
 struct envelope_range
 {
@@ -81,8 +97,130 @@ struct envelope_range
     static inline void apply(Range const& range, Box& mbr, Strategy const& strategy)
     {
         using strategy_t = decltype(strategy.envelope(range, mbr));
-        return apply(strategy_t::begin(range), strategy_t::end(range),
-                     mbr, strategy);
+        using contiguous_t = boost::integral_constant
+            <
+                bool,
+                strategy::envelope::detail::contiguous_kernel
+                    <
+                        strategy_t, Range
+                    >::value
+            >;
+
+        apply_range(range, mbr, strategy, contiguous_t());
+    }
+
+    // The range is split into chunks of which the envelopes are calculated
+    // by the executor and merged like the envelopes of a multi-geometry
+    template <typename Range, typename Box, typename Strategy, typename Executor>
+    static inline void apply(Range const& range, Box& mbr,
+                             Strategy const& strategy,
+                             Executor const& executor)
+    {
+        using strategy_t = decltype(strategy.envelope(range, mbr));
+        using contiguous_t = boost::integral_constant
+            <
+                bool,
+                strategy::envelope::detail::contiguous_kernel
+                    <
+                        strategy_t, Range
+                    >::value
+            >;
+
+        std::vector<Box> boxes;
+        apply_chunks(range, boxes, strategy, executor, contiguous_t());
+
+        typename strategy_t::template multi_state<Box> state;
+        for (std::size_t i = 0; i < boxes.size(); ++i)
+        {
+            state.apply(boxes[i]);
+        }
+        state.result(mbr);
+    }
+
+private:
+    template <typename Range, typename Box, typename Strategy>
+    static inline void apply_range(Range const& range, Box& mbr,
+                                   Strategy const& strategy, boost::false_type)
+    {
+        using strategy_t = decltype(strategy.envelope(range, mbr));
+        apply(strategy_t::begin(range), strategy_t::end(range),
+              mbr, strategy);
+    }
+
+    // The coordinates are stored contiguously, all points are compared by
+    // one kernel
+    template <typename Range, typename Box, typename Strategy>
+    static inline void apply_range(Range const& range, Box& mbr,
+                                   Strategy const& strategy, boost::true_type)
+    {
+        using strategy_t = decltype(strategy.envelope(range, mbr));
+
+        std::size_t const count = boost::size(range);
+        if (count == 0)
+        {
+            initialize<Box, 0, dimension<Box>::value>::apply(mbr);
+            return;
+        }
+
+        strategy_t::apply_contiguous(
+            geometry::detail::coordinates_begin<double>(range), count, mbr);
+    }
+
+    // The chunks are delimited by iterators of the strategy, which can
+    // iterate over the points or over the segments, collected in one pass
+    template <typename Range, typename Box, typename Strategy, typename Executor>
+    static inline void apply_chunks(Range const& range, std::vector<Box>& boxes,
+                                    Strategy const& strategy,
+                                    Executor const& executor,
+                                    boost::false_type)
+    {
+        using strategy_t = decltype(strategy.envelope(range, boxes.front()));
+        using iterator_t = decltype(strategy_t::begin(range));
+
+        iterator_t it = strategy_t::begin(range);
+        iterator_t const last = strategy_t::end(range);
+        std::size_t const count = std::distance(it, last);
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::vector<iterator_t> chunks;
+        chunks.push_back(it);
+        for (std::size_t left = count; left > envelope_chunk_size;
+             left -= envelope_chunk_size)
+        {
+            std::advance(it, envelope_chunk_size);
+            chunks.push_back(it);
+        }
+        chunks.push_back(last);
+
+        boxes.resize(chunks.size() - 1);
+        executor(boxes.size(), [&](std::size_t i)
+        {
+            apply(chunks[i], chunks[i + 1], boxes[i], strategy);
+        });
+    }
+
+    template <typename Range, typename Box, typename Strategy, typename Executor>
+    static inline void apply_chunks(Range const& range, std::vector<Box>& boxes,
+                                    Strategy const& strategy,
+                                    Executor const& executor,
+                                    boost::true_type)
+    {
+        using strategy_t = decltype(strategy.envelope(range, boxes.front()));
+
+        std::size_t const count = boost::size(range);
+        boxes.resize((count + envelope_chunk_size - 1) / envelope_chunk_size);
+        geometry::detail::for_each_chunk(executor, count, envelope_chunk_size,
+            [&](std::size_t first, std::size_t last)
+            {
+                double const* const coordinates
+                    = geometry::detail::coordinates_begin<double>(range);
+                strategy_t::apply_contiguous(coordinates + 2 * first,
+                                             last - first,
+                                             boxes[first / envelope_chunk_size]);
+            });
     }
 };
 
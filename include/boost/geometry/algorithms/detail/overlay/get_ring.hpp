@@ -98,7 +98,7 @@ template<>
 struct get_ring<multi_polygon_tag>
 {
     template<typename MultiPolygon>
-    static inline typename ring_type<MultiPolygon>::type const& apply(
+    static inline typename ring_return_type<MultiPolygon const>::type const apply(
                 ring_identifier const& id,
                 MultiPolygon const& multi_polygon)
     {
@@ -318,8 +318,15 @@ public :
             return true;
         }
 
-        cview_type1 cview1(range_by_section(geometry1, sec1));
-        cview_type2 cview2(range_by_section(geometry2, sec2));
+        // The rings may be returned by value if they are proxies, they are
+        // kept alive as long as the views referring to them are used
+        typename ring_return_type<Geometry1 const>::type
+            range1 = range_by_section(geometry1, sec1);
+        typename ring_return_type<Geometry2 const>::type
+            range2 = range_by_section(geometry2, sec2);
+
+        cview_type1 cview1(range1);
+        cview_type2 cview2(range2);
         view_type1 view1(cview1);
         view_type2 view2(cview2);
 
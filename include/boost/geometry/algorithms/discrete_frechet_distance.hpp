@@ -16,6 +16,7 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
 
 #include <algorithm>
+#include <cstddef>
 
 #ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
 #include <iostream>
@@ -26,9 +27,11 @@
 #include <vector>
 #include <limits>
 
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/distance/is_comparable.hpp>
 #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
-#include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/point_type.hpp>
@@ -44,26 +47,197 @@ namespace boost { namespace geometry
 namespace detail { namespace discrete_frechet_distance
 {
 
-template <typename size_type1 , typename size_type2,typename result_type>
-class coup_mat
+// The distances of the points of two linestrings, the cells of the coupling
+// matrix. The rows are the points of the longer linestring, so only rows of
+// the length of the shorter one have to be kept. The strategy is called with
+// the points in the order of the linestrings.
+template <typename Linestring1, typename Linestring2, typename Strategy>
+class point_distances
 {
 public:
-    coup_mat(size_type1 w, size_type2 h)
-        : m_data(w * h,-1), m_width(w), m_height(h)
+    typedef typename strategy::distance::services::return_type
+        <
+            Strategy,
+            typename point_type<Linestring1>::type,
+            typename point_type<Linestring2>::type
+        >::type result_type;
+
+    point_distances(Linestring1 const& ls1, Linestring2 const& ls2,
+                    Strategy const& strategy)
+        : m_ls1(ls1)
+        , m_ls2(ls2)
+        , m_strategy(strategy)
+        , m_transposed(boost::size(ls1) < boost::size(ls2))
     {}
 
-    result_type & operator()(size_type1 i, size_type2 j)
+    std::size_t rows() const
+    {
+        return m_transposed ? boost::size(m_ls2) : boost::size(m_ls1);
+    }
+
+    std::size_t columns() const
     {
-        BOOST_GEOMETRY_ASSERT(i < m_width && j < m_height);
-        return m_data[j * m_width + i];
+        return m_transposed ? boost::size(m_ls1) : boost::size(m_ls2);
+    }
+
+    result_type operator()(std::size_t row, std::size_t column) const
+    {
+        return m_transposed
+             ? m_strategy.apply(range::at(m_ls1, column), range::at(m_ls2, row))
+             : m_strategy.apply(range::at(m_ls1, row), range::at(m_ls2, column));
     }
 
 private:
-    std::vector<result_type> m_data;
-    size_type1 m_width;
-    size_type2 m_height;
+    Linestring1 const& m_ls1;
+    Linestring2 const& m_ls2;
+    Strategy const& m_strategy;
+    bool m_transposed;
 };
 
+// The cells of a row within the given number of columns around the
+// diagonal, the rows are not shorter than the columns so the bands of
+// consecutive rows overlap or touch diagonally
+inline void band_of_row(std::size_t row, std::size_t rows, std::size_t columns,
+                        std::size_t band_width,
+                        std::size_t& first, std::size_t& last)
+{
+    std::size_t const center = rows > 1 ? row * (columns - 1) / (rows - 1) : 0;
+    first = center - (std::min)(center, band_width);
+    last = band_width < columns - 1 - center ? center + band_width : columns - 1;
+}
+
+template <typename T>
+inline void take_min(T const& value, bool& is_set, T& result)
+{
+    if (! is_set || value < result)
+    {
+        result = value;
+        is_set = true;
+    }
+}
+
+// Coupling measure calculated row by row, keeping the previous and the
+// current row. Only the cells within the band are calculated, the cells
+// outside of it are not reachable.
+template <typename Distances>
+inline typename Distances::result_type
+coupling_measure(Distances const& distances, std::size_t band_width)
+{
+    typedef typename Distances::result_type result_type;
+
+    std::size_t const rows = distances.rows();
+    std::size_t const columns = distances.columns();
+
+    std::vector<result_type> previous(columns), current(columns);
+    std::size_t previous_first = 0, previous_last = 0;
+    for (std::size_t i = 0 ; i < rows ; ++i)
+    {
+        std::size_t first, last;
+        band_of_row(i, rows, columns, band_width, first, last);
+
+        for (std::size_t j = first ; j <= last ; ++j)
+        {
+            result_type const dis = distances(i, j);
+
+            bool is_set = false;
+            result_type coupling = dis;
+            if (j > first)
+            {
+                take_min(current[j - 1], is_set, coupling);
+            }
+            if (i > 0 && j >= previous_first && j <= previous_last)
+            {
+                take_min(previous[j], is_set, coupling);
+            }
+            if (i > 0 && j > previous_first && j - 1 <= previous_last)
+            {
+                take_min(previous[j - 1], is_set, coupling);
+            }
+
+            current[j] = (std::max)(coupling, dis);
+        }
+
+        #ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
+        for (std::size_t j = first ; j <= last ; ++j)
+        {
+            std::cout << current[j] << " ";
+        }
+        std::cout << std::endl;
+        #endif
+
+        previous.swap(current);
+        previous_first = first;
+        previous_last = last;
+    }
+
+    return previous[columns - 1];
+}
+
+// Decides whether the coupling measure is not larger than max_distance
+// by walking the reachable cells of the free space row by row. A cell is
+// only tested if a neighbouring cell is reachable so the distances of the
+// most of the cells are not calculated, and the walk stops as soon as a
+// row has no reachable cells.
+template <typename Distances, typename T>
+inline bool is_reachable(Distances const& distances, T const& max_distance)
+{
+    std::size_t const rows = distances.rows();
+    std::size_t const columns = distances.columns();
+
+    if (distances(0, 0) > max_distance
+        || distances(rows - 1, columns - 1) > max_distance)
+    {
+        return false;
+    }
+
+    std::vector<char> previous(columns, 0), current(columns, 0);
+    std::size_t previous_first = 0, previous_last = 0;
+    previous[0] = 1;
+    while (previous_last + 1 < columns
+        && distances(0, previous_last + 1) <= max_distance)
+    {
+        previous[++previous_last] = 1;
+    }
+
+    for (std::size_t i = 1 ; i < rows ; ++i)
+    {
+        std::size_t first = columns, last = 0;
+        for (std::size_t j = previous_first ; j < columns ; ++j)
+        {
+            bool const neighbour
+                = (j <= previous_last && previous[j])
+               || (j > previous_first && j - 1 <= previous_last && previous[j - 1])
+               || (j > previous_first && current[j - 1]);
+
+            bool const reached = neighbour && distances(i, j) <= max_distance;
+            current[j] = reached;
+            if (reached)
+            {
+                if (first == columns)
+                {
+                    first = j;
+                }
+                last = j;
+            }
+            else if (j > previous_last)
+            {
+                break;
+            }
+        }
+
+        if (first == columns)
+        {
+            return false;
+        }
+
+        previous.swap(current);
+        previous_first = first;
+        previous_last = last;
+    }
+
+    return previous_last == columns - 1;
+}
+
 struct linestring_linestring
 {
     template <typename Linestring1, typename Linestring2, typename Strategy>
@@ -74,63 +248,59 @@ struct linestring_linestring
             Strategy
         >::type apply(Linestring1 const& ls1, Linestring2 const& ls2, Strategy const& strategy)
     {
-        typedef typename distance_result
-            <
-                typename point_type<Linestring1>::type,
-                typename point_type<Linestring2>::type,
-                Strategy
-            >::type result_type;
-        typedef typename boost::range_size<Linestring1>::type size_type1;
-        typedef typename boost::range_size<Linestring2>::type size_type2;
-
+        return apply(ls1, ls2, strategy, (std::numeric_limits<std::size_t>::max)());
+    }
 
+    template <typename Linestring1, typename Linestring2, typename Strategy>
+    static inline typename distance_result
+        <
+            typename point_type<Linestring1>::type,
+            typename point_type<Linestring2>::type,
+            Strategy
+        >::type apply(Linestring1 const& ls1, Linestring2 const& ls2, Strategy const& strategy,
+                      std::size_t band_width)
+    {
         boost::geometry::detail::throw_on_empty_input(ls1);
         boost::geometry::detail::throw_on_empty_input(ls2);
 
-        size_type1 const a = boost::size(ls1);
-        size_type2 const b = boost::size(ls2);
+        point_distances<Linestring1, Linestring2, Strategy> const
+            distances(ls1, ls2, strategy);
+        return coupling_measure(distances, band_width);
+    }
 
+    template <typename Linestring1, typename Linestring2, typename T, typename Strategy>
+    static inline bool is_within(Linestring1 const& ls1, Linestring2 const& ls2,
+                                 T const& max_distance, Strategy const& strategy)
+    {
+        namespace sds = strategy::distance::services;
 
-        //Coupling Matrix CoupMat(a,b,-1);
-        coup_mat<size_type1,size_type2,result_type> coup_matrix(a,b);
+        typedef typename point_type<Linestring1>::type point1_type;
+        typedef typename point_type<Linestring2>::type point2_type;
+        typedef typename sds::comparable_type<Strategy>::type comparable_strategy;
 
-        result_type const not_feasible = -100;
-        //findin the Coupling Measure
-        for (size_type1 i = 0 ; i < a ; i++ )
-        {
-            for(size_type2 j=0;j<b;j++)
-            {
-                result_type dis = strategy.apply(range::at(ls1,i), range::at(ls2,j));
-                if(i==0 && j==0)
-                    coup_matrix(i,j) = dis;
-                else if(i==0 && j>0)
-                    coup_matrix(i,j) =
-                        (std::max)(coup_matrix(i,j-1), dis);
-                else if(i>0 && j==0)
-                    coup_matrix(i,j) =
-                        (std::max)(coup_matrix(i-1,j), dis);
-                else if(i>0 && j>0)
-                    coup_matrix(i,j) =
-                        (std::max)((std::min)(coup_matrix(i,j-1),
-                                              (std::min)(coup_matrix(i-1,j),
-                                                         coup_matrix(i-1,j-1))),
-                                   dis);
-                else
-                    coup_matrix(i,j) = not_feasible;
-            }
-        }
+        boost::geometry::detail::throw_on_empty_input(ls1);
+        boost::geometry::detail::throw_on_empty_input(ls2);
 
-        #ifdef BOOST_GEOMETRY_DEBUG_FRECHET_DISTANCE
-        //Print CoupLing Matrix
-        for(size_type i = 0; i <a; i++)
-        {
-            for(size_type j = 0; j <b; j++)
-            std::cout << coup_matrix(i,j) << " ";
-            std::cout << std::endl;
-        }
-        #endif
+        comparable_strategy const cstrategy
+            = sds::get_comparable<Strategy>::apply(strategy);
 
-        return coup_matrix(a-1,b-1);
+        typedef point_distances
+            <
+                Linestring1, Linestring2, comparable_strategy
+            > distances_type;
+        typedef typename distances_type::result_type comparable_type;
+
+        // max_distance is comparable if the strategy is comparable
+        comparable_type const max_comparable
+            = geometry::detail::distance::is_comparable<Strategy>::value
+            ? comparable_type(max_distance)
+            : sds::result_from_distance
+                <
+                    comparable_strategy, point1_type, point2_type
+                >::apply(cstrategy, max_distance);
+
+        distances_type const distances(ls1, ls2, cstrategy);
+        return is_reachable(distances, max_comparable);
     }
 };
 
@@ -244,6 +414,141 @@ discrete_frechet_distance(Geometry1 const& geometry1, Geometry2 const& geometry2
     return discrete_frechet_distance(geometry1, geometry2, strategy_type());
 }
 
+/*!
+\brief Calculate an approximation of the discrete Frechet distance between
+       two geometries (currently works for LineString-LineString) using
+       specified strategy, only couplings near the diagonal are considered.
+\details The points of the longer geometry are coupled with the points of the
+         shorter one at most band_width points away from the proportional
+         position. The time is linear in the number of points for a constant
+         band_width. The result is not smaller than the discrete Frechet
+         distance and equal to it if the optimal coupling is within the band.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param band_width Number of points of the shorter geometry on each side of
+       the diagonal of the coupling matrix
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy>
+inline typename distance_result
+        <
+            typename point_type<Geometry1>::type,
+            typename point_type<Geometry2>::type,
+            Strategy
+        >::type
+discrete_frechet_distance_banded(Geometry1 const& geometry1,
+                                 Geometry2 const& geometry2,
+                                 std::size_t band_width,
+                                 Strategy const& strategy)
+{
+    return dispatch::discrete_frechet_distance
+            <
+                Geometry1, Geometry2
+            >::apply(geometry1, geometry2, strategy, band_width);
+}
+
+/*!
+\brief Calculate an approximation of the discrete Frechet distance between
+       two geometries (currently works for LineString-LineString), only
+       couplings near the diagonal are considered.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param band_width Number of points of the shorter geometry on each side of
+       the diagonal of the coupling matrix
+*/
+template <typename Geometry1, typename Geometry2>
+inline typename distance_result
+        <
+            typename point_type<Geometry1>::type,
+            typename point_type<Geometry2>::type
+        >::type
+discrete_frechet_distance_banded(Geometry1 const& geometry1,
+                                 Geometry2 const& geometry2,
+                                 std::size_t band_width)
+{
+    typedef typename strategy::distance::services::default_strategy
+              <
+                  point_tag, point_tag,
+                  typename point_type<Geometry1>::type,
+                  typename point_type<Geometry2>::type
+              >::type strategy_type;
+
+    return discrete_frechet_distance_banded(geometry1, geometry2, band_width,
+                                            strategy_type());
+}
+
+/*!
+\brief Check if the discrete Frechet distance between two geometries
+       (currently works for LineString-LineString) is not larger than
+       max_distance using specified strategy.
+\details Faster than calculating the distance: only the couplings of points
+         not further than max_distance are followed, using comparable
+         distances, and the check stops as soon as no coupling can be
+         extended.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam T numerical type of the distance
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param max_distance Maximal discrete Frechet distance, comparable if the
+       strategy is comparable
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+\return true if the discrete Frechet distance is not larger than max_distance
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Geometry1, typename Geometry2, typename T, typename Strategy>
+inline bool is_within_discrete_frechet_distance(Geometry1 const& geometry1,
+                                                Geometry2 const& geometry2,
+                                                T const& max_distance,
+                                                Strategy const& strategy)
+{
+    return dispatch::discrete_frechet_distance
+            <
+                Geometry1, Geometry2
+            >::is_within(geometry1, geometry2, max_distance, strategy);
+}
+
+/*!
+\brief Check if the discrete Frechet distance between two geometries
+       (currently works for LineString-LineString) is not larger than
+       max_distance.
+\ingroup discrete_frechet_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam T numerical type of the distance
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param max_distance Maximal discrete Frechet distance
+\return true if the discrete Frechet distance is not larger than max_distance
+*/
+template <typename Geometry1, typename Geometry2, typename T>
+inline bool is_within_discrete_frechet_distance(Geometry1 const& geometry1,
+                                                Geometry2 const& geometry2,
+                                                T const& max_distance)
+{
+    typedef typename strategy::distance::services::default_strategy
+              <
+                  point_tag, point_tag,
+                  typename point_type<Geometry1>::type,
+                  typename point_type<Geometry2>::type
+              >::type strategy_type;
+
+    return is_within_discrete_frechet_distance(geometry1, geometry2,
+                                               max_distance, strategy_type());
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DISCRETE_FRECHET_DISTANCE_HPP
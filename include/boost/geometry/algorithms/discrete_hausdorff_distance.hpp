@@ -21,18 +21,35 @@
 #include <iostream>
 #endif
 
+#include <cstddef>
 #include <iterator>
+#include <mutex>
 #include <utility>
 #include <vector>
 #include <limits>
 
+#include <boost/core/ignore_unused.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/algorithms/detail/distance/is_comparable.hpp>
+#include <boost/geometry/algorithms/detail/for_each_range.hpp>
 #include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
 #include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/exception.hpp>
 #include <boost/geometry/core/point_type.hpp>
 #include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/distance_result.hpp>
+#include <boost/geometry/util/executor.hpp>
 #include <boost/geometry/util/range.hpp>
 
 #ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
@@ -81,8 +98,155 @@ struct point_range
         }
         return dis_min;
     }
+
+    template <typename Point, typename Range, typename Strategy, typename Executor>
+    static inline
+    typename distance_result
+        <
+            typename point_type<Point>::type,
+            typename point_type<Range>::type,
+            Strategy
+        >::type
+    apply(Point const& pnt, Range const& rng, Strategy const& strategy,
+          Executor const& )
+    {
+        return apply(pnt, rng, strategy);
+    }
 };
 
+// Deterministic pseudo-random numbers (xorshift), the results do not depend
+// on them but the running times are reproducible
+class pseudo_random
+{
+public:
+    inline pseudo_random()
+        : m_state(2463534242u)
+    {}
+
+    // Returns a number in [0, n)
+    inline std::size_t operator()(std::size_t n)
+    {
+        m_state ^= m_state << 13;
+        m_state ^= m_state >> 17;
+        m_state ^= m_state << 5;
+        return std::size_t(m_state) % n;
+    }
+
+private:
+    boost::uint32_t m_state;
+};
+
+/*!
+\brief Internal, points of the range the distances are calculated to. It is
+    prepared once and reused for all ranges the distance is calculated from.
+*/
+template <typename Point>
+class prepared_range
+{
+#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
+    typedef std::pair<Point, std::size_t> value_type;
+    typedef index::rtree<value_type, index::linear<16> > rtree_type;
+#endif
+
+public:
+    template <typename Range>
+    explicit inline prepared_range(Range const& rng)
+        : m_points(boost::begin(rng), boost::end(rng))
+    {
+#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
+        // Packed by the range constructor
+        std::vector<value_type> values;
+        values.reserve(m_points.size());
+        for (std::size_t i = 0 ; i < m_points.size() ; ++i)
+        {
+            values.push_back(value_type(m_points[i], i));
+        }
+        rtree_type(values).swap(m_rtree);
+#endif
+    }
+
+    inline std::vector<Point> const& points() const
+    {
+        return m_points;
+    }
+
+    // Sets the index of the nearest point of the range and the distance to
+    // it. Stops and returns false as soon as a point not further than limit
+    // is found, then the point can not be the farthest one (early break).
+    // The points are checked starting at hint, in both directions, so for
+    // similar trajectories a close point is found after a few steps.
+    template <typename Point1, typename ComparableStrategy, typename Distance>
+    inline bool nearest(Point1 const& point, ComparableStrategy const& strategy,
+                        bool is_limited, Distance const& limit,
+                        std::size_t hint,
+                        Distance& distance, std::size_t& nearest_index) const
+    {
+#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
+        boost::ignore_unused(hint);
+        value_type result;
+        m_rtree.query(index::nearest(point, 1), &result);
+        nearest_index = result.second;
+        distance = strategy.apply(point, m_points[nearest_index]);
+        return ! is_limited || distance > limit;
+#else
+        std::size_t const n = m_points.size();
+        distance = strategy.apply(point, m_points[hint]);
+        nearest_index = hint;
+        if (is_limited && distance <= limit)
+        {
+            return false;
+        }
+
+        for (std::size_t k = 1 ; k <= hint || hint + k < n ; ++k)
+        {
+            if (hint + k < n
+                && ! check(point, strategy, is_limited, limit, hint + k,
+                           distance, nearest_index))
+            {
+                return false;
+            }
+            if (k <= hint
+                && ! check(point, strategy, is_limited, limit, hint - k,
+                           distance, nearest_index))
+            {
+                return false;
+            }
+        }
+        return true;
+#endif
+    }
+
+private:
+    template <typename Point1, typename ComparableStrategy, typename Distance>
+    inline bool check(Point1 const& point, ComparableStrategy const& strategy,
+                      bool is_limited, Distance const& limit, std::size_t i,
+                      Distance& distance, std::size_t& nearest_index) const
+    {
+        Distance const d = strategy.apply(point, m_points[i]);
+        if (d < distance)
+        {
+            distance = d;
+            nearest_index = i;
+            return ! is_limited || distance > limit;
+        }
+        return true;
+    }
+
+    std::vector<Point> m_points;
+#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
+    rtree_type m_rtree;
+#endif
+};
+
+template <typename Range>
+struct prepared_range_type
+{
+    typedef prepared_range<typename point_type<Range>::type> type;
+};
+
+// Number of points of the first range handled by one task
+static const std::size_t hausdorff_chunk_size = 256;
+
 struct range_range
 {
     template <typename Range1, typename Range2, typename Strategy>
@@ -95,44 +259,124 @@ struct range_range
         >::type
     apply(Range1 const& r1, Range2 const& r2, Strategy const& strategy)
     {
+        return apply(r1, r2, strategy, sequential_executor());
+    }
 
-        typedef typename distance_result
-            <
-                typename point_type<Range1>::type,
-                typename point_type<Range2>::type,
-                Strategy
-            >::type result_type;
-
-        typedef typename boost::range_size<Range1>::type size_type;
-
+    template <typename Range1, typename Range2, typename Strategy, typename Executor>
+    static inline
+    typename distance_result
+        <
+            typename point_type<Range1>::type,
+            typename point_type<Range2>::type,
+            Strategy
+        >::type
+    apply(Range1 const& r1, Range2 const& r2, Strategy const& strategy,
+          Executor const& executor)
+    {
         boost::geometry::detail::throw_on_empty_input(r1);
         boost::geometry::detail::throw_on_empty_input(r2);
 
-        size_type const n = boost::size(r1);
-        result_type dis_max = 0;
+        typename prepared_range_type<Range2>::type const prepared(r2);
+        return apply_prepared(r1, prepared, strategy, executor);
+    }
 
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-        namespace bgi = boost::geometry::index;
-        typedef typename point_type<Range1>::type point_t;
-        typedef bgi::rtree<point_t, bgi::linear<4> > rtree_type;
-        rtree_type rtree(boost::begin(r2), boost::end(r2));
-        point_t res;
-#endif
+    // The farthest point of r1 is searched with comparable distances, the
+    // scan for the nearest point of r2 stops as soon as a point not further
+    // than the current maximum is found.
+    template <typename Range1, typename Point2, typename Strategy, typename Executor>
+    static inline
+    typename distance_result
+        <
+            typename boost::range_value<Range1>::type,
+            Point2,
+            Strategy
+        >::type
+    apply_prepared(Range1 const& r1, prepared_range<Point2> const& r2,
+                   Strategy const& strategy, Executor const& executor)
+    {
+        namespace sds = strategy::distance::services;
 
-        for (size_type i = 0 ; i < n ; i++)
+        typedef typename boost::range_value<Range1>::type point1_type;
+        typedef typename sds::comparable_type<Strategy>::type comparable_strategy;
+        typedef typename sds::return_type
+            <
+                comparable_strategy, point1_type, Point2
+            >::type comparable_type;
+
+        comparable_strategy const cstrategy
+            = sds::get_comparable<Strategy>::apply(strategy);
+
+        std::size_t const n = boost::size(r1);
+        std::size_t const m = r2.points().size();
+
+        bool is_max_set = false;
+        comparable_type max_distance = comparable_type();
+        std::size_t max_index1 = 0;
+        std::size_t max_index2 = 0;
+
+        // The maximum is initialized by the points of a random sample, so
+        // the scans of most of the other points stop early
+        pseudo_random random;
+        std::size_t const sample = (std::min)(n, std::size_t(16));
+        for (std::size_t k = 0 ; k < sample ; ++k)
         {
-#ifdef BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE
-            size_type found = rtree.query(bgi::nearest(range::at(r1, i), 1), &res);
-            result_type dis_min = strategy.apply(range::at(r1,i), res);
-#else
-            result_type dis_min = point_range::apply(range::at(r1, i), r2, strategy);
-#endif
-            if (dis_min > dis_max )
+            std::size_t const i = random(n);
+            comparable_type d;
+            std::size_t j;
+            if (r2.nearest(range::at(r1, i), cstrategy, is_max_set, max_distance,
+                           i * (m - 1) / (std::max)(n - 1, std::size_t(1)), d, j))
             {
-                dis_max = dis_min;
+                is_max_set = true;
+                max_distance = d;
+                max_index1 = i;
+                max_index2 = j;
             }
         }
-        return dis_max;
+
+        // The maximum is shared by the tasks, read at the beginning and
+        // updated at the end of every chunk. The points are processed in
+        // their order, the scan of a point starts at the nearest point of
+        // the previous one.
+        std::mutex mutex;
+        geometry::detail::for_each_chunk(executor, n, hausdorff_chunk_size,
+            [&](std::size_t first, std::size_t last)
+            {
+                bool is_set;
+                comparable_type local_max;
+                std::size_t index1 = 0, index2 = 0;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    is_set = is_max_set;
+                    local_max = max_distance;
+                }
+
+                std::size_t hint = first * (m - 1) / (std::max)(n - 1, std::size_t(1));
+                for (std::size_t i = first ; i < last ; ++i)
+                {
+                    comparable_type d;
+                    if (r2.nearest(range::at(r1, i), cstrategy, is_set, local_max,
+                                   hint, d, hint))
+                    {
+                        is_set = true;
+                        local_max = d;
+                        index1 = i;
+                        index2 = hint;
+                    }
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+                if (is_set && (! is_max_set || local_max > max_distance))
+                {
+                    is_max_set = true;
+                    max_distance = local_max;
+                    max_index1 = index1;
+                    max_index2 = index2;
+                }
+            });
+
+        return geometry::detail::distance::is_comparable<Strategy>::value
+             ? max_distance
+             : strategy.apply(range::at(r1, max_index1), r2.points()[max_index2]);
     }
 };
 
@@ -148,6 +392,20 @@ struct range_multi_range
             Strategy
         >::type
     apply(Range const& rng, Multi_range const& mrng, Strategy const& strategy)
+    {
+        return apply(rng, mrng, strategy, sequential_executor());
+    }
+
+    template <typename Range, typename Multi_range, typename Strategy, typename Executor>
+    static inline
+    typename distance_result
+        <
+            typename point_type<Range>::type,
+            typename point_type<Multi_range>::type,
+            Strategy
+        >::type
+    apply(Range const& rng, Multi_range const& mrng, Strategy const& strategy,
+          Executor const& executor)
     {
         typedef typename distance_result
             <
@@ -165,7 +423,8 @@ struct range_multi_range
 
         for (size_type j = 0 ; j < b ; j++)
         {
-            result_type dis_max = range_range::apply(rng, range::at(mrng, j), strategy);
+            result_type dis_max = range_range::apply(rng, range::at(mrng, j),
+                                                     strategy, executor);
             if (dis_max > haus_dis)
             {
                 haus_dis = dis_max;
@@ -188,6 +447,20 @@ struct multi_range_multi_range
             Strategy
         >::type
     apply(Multi_Range1 const& mrng1, Multi_range2 const& mrng2, Strategy const& strategy)
+    {
+        return apply(mrng1, mrng2, strategy, sequential_executor());
+    }
+
+    template <typename Multi_Range1, typename Multi_range2, typename Strategy, typename Executor>
+    static inline
+    typename distance_result
+        <
+            typename point_type<Multi_Range1>::type,
+            typename point_type<Multi_range2>::type,
+            Strategy
+        >::type
+    apply(Multi_Range1 const& mrng1, Multi_range2 const& mrng2, Strategy const& strategy,
+          Executor const& executor)
     {
         typedef typename distance_result
             <
@@ -196,19 +469,36 @@ struct multi_range_multi_range
                 Strategy
             >::type result_type;
         typedef typename boost::range_size<Multi_Range1>::type size_type;
+        typedef typename prepared_range_type<Multi_range2>::type prepared_type;
 
         boost::geometry::detail::throw_on_empty_input(mrng1);
         boost::geometry::detail::throw_on_empty_input(mrng2);
-        
+
+        // The ranges of mrng2 are prepared once, not for every range of mrng1
+        std::vector<prepared_type> prepared;
+        prepared.reserve(boost::size(mrng2));
+        for (typename boost::range_iterator<Multi_range2 const>::type
+                it = boost::begin(mrng2) ; it != boost::end(mrng2) ; ++it)
+        {
+            boost::geometry::detail::throw_on_empty_input(*it);
+            prepared.push_back(prepared_type(*it));
+        }
+
         size_type n = boost::size(mrng1);
         result_type haus_dis = 0;
 
         for (size_type i = 0 ; i < n ; i++)
         {
-            result_type dis_max = range_multi_range::apply(range::at(mrng1, i), mrng2, strategy);
-            if (dis_max > haus_dis)
+            boost::geometry::detail::throw_on_empty_input(range::at(mrng1, i));
+            for (std::size_t j = 0 ; j < prepared.size() ; j++)
             {
-                haus_dis = dis_max;
+                result_type dis_max = range_range::apply_prepared(range::at(mrng1, i),
+                                                                  prepared[j],
+                                                                  strategy, executor);
+                if (dis_max > haus_dis)
+                {
+                    haus_dis = dis_max;
+                }
             }
         }
         return haus_dis;
@@ -310,6 +600,41 @@ discrete_hausdorff_distance(Geometry1 const& geometry1,
         >::apply(geometry1, geometry2, strategy);
 }
 
+/*!
+\brief Calculate discrete Hausdorff distance between two geometries using
+    specified strategy, the points of the first geometry are processed in
+    parallel by the executor
+\ingroup discrete_hausdorff_distance
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam Strategy A type fulfilling a DistanceStrategy concept
+\tparam Executor executor, e.g. thread_executor
+\param geometry1 Input geometry
+\param geometry2 Input geometry
+\param strategy Distance strategy to be used to calculate Pt-Pt distance
+\param executor Executor running the tasks
+
+\qbk{distinguish,with strategy and executor}
+*/
+template <typename Geometry1, typename Geometry2, typename Strategy, typename Executor>
+inline
+typename distance_result
+    <
+        typename point_type<Geometry1>::type,
+        typename point_type<Geometry2>::type,
+        Strategy
+    >::type
+discrete_hausdorff_distance(Geometry1 const& geometry1,
+                            Geometry2 const& geometry2,
+                            Strategy const& strategy,
+                            Executor const& executor)
+{
+    return dispatch::discrete_hausdorff_distance
+        <
+            Geometry1, Geometry2
+        >::apply(geometry1, geometry2, strategy, executor);
+}
+
 /*!
 \brief Calculate discrete Hausdorff distance between two geometries (currently
     works for LineString-LineString, MultiPoint-MultiPoint, Point-MultiPoint,
@@ -348,6 +673,211 @@ discrete_hausdorff_distance(Geometry1 const& geometry1,
     return discrete_hausdorff_distance(geometry1, geometry2, strategy_type());
 }
 
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace discrete_hausdorff_distance
+{
+
+// Calls the function for the points of a Point, of a Linestring or
+// MultiPoint, or of each Linestring of a MultiLinestring
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct for_each_range
+    : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct for_each_range<Point, point_tag>
+    : dispatch::for_each_range<Point const>
+{};
+
+template <typename Linestring>
+struct for_each_range<Linestring, linestring_tag>
+    : dispatch::for_each_range<Linestring const>
+{};
+
+template <typename MultiPoint>
+struct for_each_range<MultiPoint, multi_point_tag>
+    : dispatch::for_each_range<MultiPoint const>
+{};
+
+template <typename MultiLinestring>
+struct for_each_range<MultiLinestring, multi_linestring_tag>
+    : dispatch::for_each_range<MultiLinestring const>
+{};
+
+// Like throw_on_empty_input, for the ranges passed by for_each_range which
+// can be views of a point, returns false if the range is empty
+template <typename Range>
+inline bool check_range(Range const& range)
+{
+    if (boost::empty(range))
+    {
+#if ! defined(BOOST_GEOMETRY_EMPTY_INPUT_NO_THROW)
+        BOOST_THROW_EXCEPTION(empty_input_exception());
+#endif
+        return false;
+    }
+    return true;
+}
+
+}} // namespace detail::discrete_hausdorff_distance
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Geometry prepared once to calculate the discrete Hausdorff distances
+    of many geometries to it
+\details The points of the geometry, or of each Linestring of a
+    MultiLinestring, are copied once when the object is constructed (and
+    packed into an rtree if BOOST_GEOMETRY_ENABLE_SIMILARITY_RTREE is
+    defined). Every call of distance() then reuses them, instead of
+    preparing the geometry again like discrete_hausdorff_distance() does.
+    The object can be used by several threads at the same time.
+\ingroup discrete_hausdorff_distance
+\tparam Geometry Prepared geometry, a Linestring, a MultiPoint or
+    a MultiLinestring
+*/
+template <typename Geometry>
+class discrete_hausdorff_prepared
+{
+    typedef typename point_type<Geometry>::type prepared_point_type;
+    typedef detail::discrete_hausdorff_distance::prepared_range
+        <
+            prepared_point_type
+        > prepared_range_type;
+
+public:
+    template
+    <
+        typename Geometry1,
+        typename Strategy = typename strategy::distance::services::default_strategy
+            <
+                point_tag, point_tag,
+                typename point_type<Geometry1>::type,
+                prepared_point_type
+            >::type
+    >
+    struct return_type
+        : distance_result
+            <
+                typename point_type<Geometry1>::type,
+                prepared_point_type,
+                Strategy
+            >
+    {};
+
+    /*!
+    \brief Copies the points of the geometry
+    \param geometry Prepared geometry
+    */
+    explicit discrete_hausdorff_prepared(Geometry const& geometry)
+    {
+        concepts::check<Geometry const>();
+        detail::throw_on_empty_input(geometry);
+
+        detail::discrete_hausdorff_distance::for_each_range
+            <
+                Geometry
+            >::apply(geometry, [&](auto const& range)
+            {
+                if (detail::discrete_hausdorff_distance::check_range(range))
+                {
+                    m_ranges.push_back(prepared_range_type(range));
+                }
+                return true;
+            });
+    }
+
+    /*!
+    \brief Calculates the discrete Hausdorff distance of a geometry to the
+        prepared geometry, using specified strategy, the points of the
+        geometry are processed in parallel by the executor
+    \param geometry1 Input geometry, a Point, a Linestring, a MultiPoint or
+        a MultiLinestring
+    \param strategy Distance strategy to be used to calculate Pt-Pt distance
+    \param executor Executor running the tasks, e.g. thread_executor
+    */
+    template <typename Geometry1, typename Strategy, typename Executor>
+    typename return_type<Geometry1, Strategy>::type
+    distance(Geometry1 const& geometry1, Strategy const& strategy,
+             Executor const& executor) const
+    {
+        typedef typename return_type<Geometry1, Strategy>::type result_type;
+        typedef detail::discrete_hausdorff_distance::range_range range_range;
+
+        concepts::check<Geometry1 const>();
+        detail::throw_on_empty_input(geometry1);
+
+        // Like the dispatched algorithm, the maximum of the distances of the
+        // ranges of geometry1 to the prepared ranges
+        result_type haus_dis = 0;
+        detail::discrete_hausdorff_distance::for_each_range
+            <
+                Geometry1
+            >::apply(geometry1, [&](auto const& range)
+            {
+                if (! detail::discrete_hausdorff_distance::check_range(range))
+                {
+                    return true;
+                }
+                for (std::size_t j = 0 ; j < m_ranges.size() ; j++)
+                {
+                    result_type dis_max = range_range::apply_prepared(range,
+                                                                      m_ranges[j],
+                                                                      strategy,
+                                                                      executor);
+                    if (dis_max > haus_dis)
+                    {
+                        haus_dis = dis_max;
+                    }
+                }
+                return true;
+            });
+        return haus_dis;
+    }
+
+    /*!
+    \brief Calculates the discrete Hausdorff distance of a geometry to the
+        prepared geometry, using specified strategy
+    \param geometry1 Input geometry, a Point, a Linestring, a MultiPoint or
+        a MultiLinestring
+    \param strategy Distance strategy to be used to calculate Pt-Pt distance
+    */
+    template <typename Geometry1, typename Strategy>
+    typename return_type<Geometry1, Strategy>::type
+    distance(Geometry1 const& geometry1, Strategy const& strategy) const
+    {
+        return distance(geometry1, strategy, sequential_executor());
+    }
+
+    /*!
+    \brief Calculates the discrete Hausdorff distance of a geometry to the
+        prepared geometry
+    \param geometry1 Input geometry, a Point, a Linestring, a MultiPoint or
+        a MultiLinestring
+    */
+    template <typename Geometry1>
+    typename return_type<Geometry1>::type
+    distance(Geometry1 const& geometry1) const
+    {
+        typedef typename strategy::distance::services::default_strategy
+            <
+                point_tag, point_tag,
+                typename point_type<Geometry1>::type,
+                prepared_point_type
+            >::type strategy_type;
+
+        return distance(geometry1, strategy_type());
+    }
+
+private:
+    std::vector<prepared_range_type> m_ranges;
+};
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DISCRETE_HAUSDORFF_DISTANCE_HPP
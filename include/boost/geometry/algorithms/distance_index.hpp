@@ -0,0 +1,267 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
+
+
+#include <iterator>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/mpl/assert.hpp>
+
+#include <boost/geometry/algorithms/detail/closest_feature/range_to_range.hpp>
+#include <boost/geometry/algorithms/detail/distance/default_strategies.hpp>
+#include <boost/geometry/algorithms/detail/distance/is_comparable.hpp>
+#include <boost/geometry/algorithms/detail/distance/iterator_selector.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/algorithms/dispatch/distance.hpp>
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace distance_index
+{
+
+// The features of the indexed geometry, its points or segments
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct indexed_features
+{
+    BOOST_MPL_ASSERT_MSG
+        (
+            false, NOT_IMPLEMENTED_FOR_THIS_GEOMETRY_TYPE, (types<Geometry>)
+        );
+};
+
+template <typename Geometry>
+struct indexed_features<Geometry, multi_point_tag>
+    : detail::distance::iterator_selector<Geometry const>
+{};
+
+template <typename Geometry>
+struct indexed_features<Geometry, linestring_tag>
+    : detail::distance::iterator_selector<Geometry const>
+{};
+
+template <typename Geometry>
+struct indexed_features<Geometry, multi_linestring_tag>
+    : detail::distance::iterator_selector<Geometry const>
+{};
+
+// The strategy calculating the distances of the features, a point-point
+// strategy is replaced by the point-segment strategy based on it for the
+// segments of linear geometries, as distance() does
+template
+<
+    typename Geometry,
+    typename Strategy,
+    typename Tag = typename tag_cast
+        <
+            typename tag<Geometry>::type, linear_tag
+        >::type,
+    typename StrategyTag = typename strategy::distance::services::tag
+        <
+            Strategy
+        >::type
+>
+struct features_strategy
+{
+    typedef Strategy type;
+
+    static inline type const& get(Strategy const& strategy)
+    {
+        return strategy;
+    }
+};
+
+template <typename Geometry, typename Strategy>
+struct features_strategy
+    <
+        Geometry, Strategy, linear_tag, strategy_tag_distance_point_point
+    >
+{
+    typedef typename detail::distance::default_ps_strategy
+        <
+            Geometry, Geometry, Strategy
+        >::type type;
+
+    static inline type get(Strategy const& )
+    {
+        return type();
+    }
+};
+
+// The features of a query, the point itself or its points or segments
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct query_features
+    : indexed_features<Geometry>
+{};
+
+template <typename Point>
+struct query_features<Point, point_tag>
+{
+    typedef Point const* iterator_type;
+
+    static inline iterator_type begin(Point const& point)
+    {
+        return &point;
+    }
+
+    static inline iterator_type end(Point const& point)
+    {
+        return &point + 1;
+    }
+};
+
+}} // namespace detail::distance_index
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Index of a geometry calculating the distances of many geometries to it
+\details The points or segments of the geometry are packed into an rtree
+    once, when the index is constructed. Every call of distance() then
+    searches the closest feature of the query in the rtree, bounding each
+    nearest search by the closest distance found so far, and stops as soon
+    as the geometries intersect. The index can be used by several threads
+    at the same time.
+\ingroup distance
+\tparam Geometry Indexed geometry, a MultiPoint, a Linestring or
+    a MultiLinestring
+\tparam Strategy A type fulfilling a DistanceStrategy concept, a point-point
+    strategy is replaced by the point-segment strategy based on it for linear
+    geometries. The queries of a MultiPoint have to be pointlike.
+\note The segments stored in the index refer to the points of the geometry,
+    the geometry has to outlive the index and must not be modified.
+*/
+template
+<
+    typename Geometry,
+    typename Strategy = typename detail::distance::default_strategy
+        <
+            Geometry, Geometry
+        >::type
+>
+class distance_index
+{
+    typedef detail::distance_index::indexed_features<Geometry> indexed_features;
+    typedef typename std::iterator_traits
+        <
+            typename indexed_features::iterator_type
+        >::value_type feature_type;
+
+    typedef detail::distance_index::features_strategy
+        <
+            Geometry, Strategy
+        > features_strategy;
+    typedef typename features_strategy::type strategy_type;
+    typedef typename strategy::distance::services::comparable_type
+        <
+            strategy_type
+        >::type comparable_strategy;
+
+    typedef detail::closest_feature::range_rtree
+        <
+            feature_type, comparable_strategy
+        > rtree_type;
+
+public:
+    template <typename Query>
+    struct return_type
+        : strategy::distance::services::return_type
+            <
+                strategy_type,
+                typename point_type<Query>::type,
+                typename point_type<Geometry>::type
+            >
+    {};
+
+    /*!
+    \brief Packs the points or segments of the geometry into the index
+    \param geometry Indexed geometry
+    \param strategy Distance strategy used by distance()
+    */
+    explicit distance_index(Geometry const& geometry,
+                            Strategy const& strategy = Strategy())
+        : m_strategy(features_strategy::get(strategy))
+        , m_comparable_strategy(strategy::distance::services::get_comparable
+                                    <
+                                        strategy_type
+                                    >::apply(m_strategy))
+        , m_rtree(indexed_features::begin(geometry),
+                  indexed_features::end(geometry),
+                  m_comparable_strategy)
+    {
+        concepts::check<Geometry const>();
+        detail::throw_on_empty_input(geometry);
+    }
+
+    /*!
+    \brief Calculates the distance of a Point, MultiPoint, Linestring or
+        MultiLinestring to the indexed geometry
+    \param query Geometry the distance of which is calculated
+    \return The distance, comparable if the strategy is comparable
+    */
+    template <typename Query>
+    typename return_type<Query>::type distance(Query const& query) const
+    {
+        typedef detail::distance_index::query_features<Query> query_features;
+        typedef typename query_features::iterator_type query_iterator;
+        typedef typename std::iterator_traits
+            <
+                query_iterator
+            >::value_type query_feature_type;
+        typedef typename strategy::distance::services::return_type
+            <
+                comparable_strategy,
+                typename point_type<Query>::type,
+                typename point_type<Geometry>::type
+            >::type comparable_return_type;
+
+        concepts::check<Query const>();
+        detail::throw_on_empty_input(query);
+
+        feature_type closest_feature;
+        query_iterator closest_query;
+        comparable_return_type cd_min;
+        bool const found = m_rtree.apply(query_features::begin(query),
+                                         query_features::end(query),
+                                         m_comparable_strategy,
+                                         closest_feature, closest_query,
+                                         cd_min);
+        BOOST_GEOMETRY_ASSERT(found);
+        boost::ignore_unused(found);
+
+        return
+            detail::distance::is_comparable<strategy_type>::value
+            ?
+            cd_min
+            :
+            dispatch::distance
+                <
+                    feature_type, query_feature_type, strategy_type
+                >::apply(closest_feature, *closest_query, m_strategy);
+    }
+
+private:
+    strategy_type m_strategy;
+    comparable_strategy m_comparable_strategy;
+    rtree_type m_rtree;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DISTANCE_INDEX_HPP
@@ -0,0 +1,690 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_GEOMETRY_STATS_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_GEOMETRY_STATS_HPP
+
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/algorithms/area_result.hpp>
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/detail/centroid/translating_transformer.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/point_on_border.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/strategies/area/services.hpp>
+#include <boost/geometry/strategies/centroid.hpp>
+#include <boost/geometry/strategies/default_length_result.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/util/executor.hpp>
+#include <boost/geometry/util/order_as_direction.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/views/closeable_view.hpp>
+#include <boost/geometry/views/reversible_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Metrics calculated by geometry_stats(), they can be combined
+\ingroup geometry_stats
+*/
+enum stats_selector
+{
+    stats_area = 1,
+    stats_perimeter = 2,
+    stats_centroid = 4,
+    stats_envelope = 8,
+    stats_num_points = 16,
+    stats_all = 31
+};
+
+
+/*!
+\brief Strategies used by geometry_stats()
+\ingroup geometry_stats
+\tparam AreaStrategies umbrella area strategy, as passed to area()
+\tparam LengthStrategy point-point distance strategy, as passed to
+    perimeter()
+\tparam CentroidStrategy centroid strategy for areal geometries, as passed
+    to centroid(), only used if the centroid is selected
+*/
+template <typename AreaStrategies, typename LengthStrategy, typename CentroidStrategy>
+struct stats_strategies
+{
+    typedef AreaStrategies area_strategies_type;
+    typedef LengthStrategy length_strategy_type;
+    typedef CentroidStrategy centroid_strategy_type;
+
+    explicit stats_strategies(AreaStrategies const& area = AreaStrategies(),
+                              LengthStrategy const& length = LengthStrategy(),
+                              CentroidStrategy const& centroid = CentroidStrategy())
+        : area_strategies(area)
+        , length_strategy(length)
+        , centroid_strategy(centroid)
+    {}
+
+    AreaStrategies area_strategies;
+    LengthStrategy length_strategy;
+    CentroidStrategy centroid_strategy;
+};
+
+
+/*!
+\brief The strategies used by area(), perimeter() and centroid() by default
+\ingroup geometry_stats
+*/
+template <typename Geometry>
+struct default_stats_strategies
+{
+    typedef typename geometry::point_type<Geometry>::type point_type;
+
+    typedef stats_strategies
+        <
+            typename strategies::area::services::default_strategy
+                <
+                    Geometry
+                >::type,
+            typename strategy::distance::services::default_strategy
+                <
+                    point_tag, point_tag, point_type
+                >::type,
+            typename strategy::centroid::services::default_strategy
+                <
+                    typename cs_tag<Geometry>::type,
+                    areal_tag,
+                    dimension<Geometry>::type::value,
+                    point_type,
+                    Geometry
+                >::type
+        > type;
+};
+
+
+/*!
+\brief Metrics of a geometry calculated by geometry_stats()
+\ingroup geometry_stats
+\details The metrics which are not selected are value-initialized.
+*/
+template
+<
+    typename Geometry,
+    typename Strategies = typename default_stats_strategies<Geometry>::type
+>
+struct geometry_stats_result
+{
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef typename area_result
+        <
+            Geometry, typename Strategies::area_strategies_type
+        >::type area_type;
+    typedef typename default_length_result<Geometry>::type length_type;
+    typedef model::box<point_type> box_type;
+
+    geometry_stats_result()
+        : area()
+        , perimeter()
+        , centroid()
+        , envelope()
+        , num_points(0)
+    {}
+
+    area_type area;
+    length_type perimeter;
+    point_type centroid;
+    box_type envelope;
+    std::size_t num_points;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geometry_stats
+{
+
+// Number of geometries of a range handled by one task of an executor
+static const std::size_t chunk_size = 64;
+
+// Each metric has a state for the geometry, it is passed every segment of
+// the rings, in the direction used by area(). The metrics which are not
+// selected do nothing.
+
+template <typename Geometry, typename Strategies, bool Selected>
+struct area_metric
+{
+    explicit area_metric(Geometry const&, Strategies const&) {}
+
+    template <typename Ring>
+    inline void begin_ring(Ring const&) {}
+
+    template <typename Point>
+    inline void apply(Point const&, Point const&) {}
+
+    inline void end_ring() {}
+
+    template <typename Result>
+    inline void result(Geometry const&, Result&) const {}
+};
+
+template <typename Geometry, typename Strategies>
+struct area_metric<Geometry, Strategies, true>
+{
+    typedef typename ring_type<Geometry>::type ring_type;
+    typedef decltype(std::declval<typename Strategies::area_strategies_type const&>()
+                        .area(std::declval<ring_type const&>())) strategy_type;
+    typedef typename strategy_type::template state<ring_type> state_type;
+    typedef typename area_result
+        <
+            Geometry, typename Strategies::area_strategies_type
+        >::type area_type;
+
+    explicit area_metric(Geometry const&, Strategies const& strategies)
+        : m_strategies(strategies.area_strategies)
+        , m_enabled(false)
+        , m_sum()
+    {}
+
+    // Rings without an area are skipped, as by area()
+    template <typename Ring>
+    inline void begin_ring(Ring const& ring)
+    {
+        m_strategy = m_strategies.area(ring);
+        m_enabled = boost::size(ring) >= core_detail::closure::minimum_ring_size
+            <
+                geometry::closure<Ring>::value
+            >::value;
+        m_state = state_type();
+    }
+
+    template <typename Point>
+    inline void apply(Point const& p1, Point const& p2)
+    {
+        if (m_enabled)
+        {
+            m_strategy.apply(p1, p2, m_state);
+        }
+    }
+
+    inline void end_ring()
+    {
+        if (m_enabled)
+        {
+            m_sum += m_strategy.result(m_state);
+        }
+    }
+
+    template <typename Result>
+    inline void result(Geometry const&, Result& result) const
+    {
+        result.area = m_sum;
+    }
+
+    typename Strategies::area_strategies_type m_strategies;
+    strategy_type m_strategy;
+    state_type m_state;
+    bool m_enabled;
+    area_type m_sum;
+};
+
+
+template <typename Geometry, typename Strategies, bool Selected>
+struct perimeter_metric
+{
+    explicit perimeter_metric(Geometry const&, Strategies const&) {}
+
+    template <typename Point>
+    inline void apply(Point const&, Point const&) {}
+
+    template <typename Result>
+    inline void result(Geometry const&, Result&) const {}
+};
+
+template <typename Geometry, typename Strategies>
+struct perimeter_metric<Geometry, Strategies, true>
+{
+    explicit perimeter_metric(Geometry const&, Strategies const& strategies)
+        : m_strategy(strategies.length_strategy)
+        , m_sum()
+    {}
+
+    template <typename Point>
+    inline void apply(Point const& p1, Point const& p2)
+    {
+        m_sum += m_strategy.apply(p1, p2);
+    }
+
+    template <typename Result>
+    inline void result(Geometry const&, Result& result) const
+    {
+        result.perimeter = m_sum;
+    }
+
+    typename Strategies::length_strategy_type m_strategy;
+    typename default_length_result<Geometry>::type m_sum;
+};
+
+
+template <typename Geometry, typename Strategies, bool Selected>
+struct centroid_metric
+{
+    explicit centroid_metric(Geometry const&, Strategies const&) {}
+
+    template <typename Point>
+    inline void apply(Point const&, Point const&) {}
+
+    template <typename Result>
+    inline void result(Geometry const&, Result&) const {}
+};
+
+// The points are translated to the first point, as by centroid()
+template <typename Geometry, typename Strategies>
+struct centroid_metric<Geometry, Strategies, true>
+{
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef typename Strategies::centroid_strategy_type strategy_type;
+    typedef detail::centroid::translating_transformer<Geometry> transformer_type;
+
+    explicit centroid_metric(Geometry const& geometry, Strategies const& strategies)
+        : m_strategy(strategies.centroid_strategy)
+        , m_transformer(geometry)
+    {}
+
+    template <typename Point>
+    inline void apply(Point const& p1, Point const& p2)
+    {
+        typename transformer_type::result_type const t1 = m_transformer.apply(p1);
+        typename transformer_type::result_type const t2 = m_transformer.apply(p2);
+        m_strategy.apply(static_cast<point_type const&>(t1),
+                         static_cast<point_type const&>(t2),
+                         m_state);
+    }
+
+    // Falls back to a point on the border if the area is zero, as
+    // centroid() does
+    template <typename Result>
+    inline void result(Geometry const& geometry, Result& result) const
+    {
+#if ! defined(BOOST_GEOMETRY_CENTROID_NO_THROW)
+        if (geometry::is_empty(geometry))
+        {
+            BOOST_THROW_EXCEPTION(centroid_exception());
+        }
+#endif
+
+        if (m_strategy.result(m_state, result.centroid))
+        {
+            m_transformer.apply_reverse(result.centroid);
+        }
+        else
+        {
+            geometry::point_on_border(result.centroid, geometry);
+        }
+    }
+
+    strategy_type m_strategy;
+    transformer_type m_transformer;
+    typename strategy_type::state_type m_state;
+};
+
+
+template
+<
+    typename Geometry,
+    typename Strategies,
+    bool Selected,
+    typename CsTag = typename cs_tag<Geometry>::type
+>
+struct envelope_metric
+{
+    explicit envelope_metric(Geometry const&, Strategies const&) {}
+
+    template <typename Ring>
+    inline void begin_ring(Ring const&, bool) {}
+
+    template <typename Point>
+    inline void apply(Point const&) {}
+
+    template <typename Result>
+    inline void result(Geometry const& geometry, Result& result) const
+    {
+        // The envelope of a ring in other coordinate systems depends on
+        // its segments, so it is calculated separately
+        if (Selected)
+        {
+            geometry::envelope(geometry, result.envelope);
+        }
+    }
+};
+
+// The envelope of the exterior rings, or of the interior rings of
+// a polygon without exterior ring, as by envelope()
+template <typename Geometry, typename Strategies>
+struct envelope_metric<Geometry, Strategies, true, cartesian_tag>
+{
+    typedef model::box<typename geometry::point_type<Geometry>::type> box_type;
+
+    explicit envelope_metric(Geometry const&, Strategies const&)
+        : m_enabled(false)
+        , m_exterior_empty(false)
+    {
+        geometry::assign_inverse(m_box);
+    }
+
+    template <typename Ring>
+    inline void begin_ring(Ring const& ring, bool exterior)
+    {
+        if (exterior)
+        {
+            m_exterior_empty = boost::size(ring) == 0;
+        }
+        m_enabled = exterior || m_exterior_empty;
+    }
+
+    template <typename Point>
+    inline void apply(Point const& point)
+    {
+        if (m_enabled)
+        {
+            geometry::expand(m_box, point);
+        }
+    }
+
+    template <typename Result>
+    inline void result(Geometry const&, Result& result) const
+    {
+        result.envelope = m_box;
+    }
+
+    box_type m_box;
+    bool m_enabled;
+    bool m_exterior_empty;
+};
+
+
+// Calculates the selected metrics visiting every point of the rings once
+template <unsigned Metrics, typename Geometry, typename Strategies>
+class stats_calculator
+{
+    static const bool selected_area = (Metrics & stats_area) != 0;
+    static const bool selected_perimeter = (Metrics & stats_perimeter) != 0;
+    static const bool selected_centroid = (Metrics & stats_centroid) != 0;
+    static const bool selected_envelope = (Metrics & stats_envelope) != 0;
+    static const bool selected_num_points = (Metrics & stats_num_points) != 0;
+
+public :
+    inline stats_calculator(Geometry const& geometry, Strategies const& strategies)
+        : m_geometry(geometry)
+        , m_area(geometry, strategies)
+        , m_perimeter(geometry, strategies)
+        , m_centroid(geometry, strategies)
+        , m_envelope(geometry, strategies)
+        , m_num_points(0)
+    {}
+
+    template <typename Ring>
+    inline void apply_ring(Ring const& ring, bool exterior)
+    {
+        typedef typename reversible_view
+            <
+                Ring const,
+                order_as_direction<geometry::point_order<Ring>::value>::value
+            >::type rview_type;
+        typedef typename closeable_view
+            <
+                rview_type const, geometry::closure<Ring>::value
+            >::type view_type;
+        typedef typename boost::range_iterator<view_type const>::type iterator_type;
+
+        // The metrics are copied, so their states are not written through
+        // this and can be kept in registers
+        area_type area = m_area;
+        perimeter_type perimeter = m_perimeter;
+        centroid_type centroid = m_centroid;
+        envelope_type envelope = m_envelope;
+
+        m_num_points += boost::size(ring);
+        area.begin_ring(ring);
+        envelope.begin_ring(ring, exterior);
+
+        rview_type rview(ring);
+        view_type view(rview);
+        iterator_type it = boost::begin(view);
+        iterator_type const end = boost::end(view);
+        if (it != end)
+        {
+            envelope.apply(*it);
+            for (iterator_type previous = it++; it != end; ++previous, ++it)
+            {
+                area.apply(*previous, *it);
+                perimeter.apply(*previous, *it);
+                centroid.apply(*previous, *it);
+                envelope.apply(*it);
+            }
+        }
+
+        area.end_ring();
+
+        m_area = area;
+        m_perimeter = perimeter;
+        m_centroid = centroid;
+        m_envelope = envelope;
+    }
+
+    template <typename Result>
+    inline void result(Result& result) const
+    {
+        m_area.result(m_geometry, result);
+        m_perimeter.result(m_geometry, result);
+        m_centroid.result(m_geometry, result);
+        m_envelope.result(m_geometry, result);
+        if (selected_num_points)
+        {
+            result.num_points = m_num_points;
+        }
+    }
+
+private :
+    typedef area_metric<Geometry, Strategies, selected_area> area_type;
+    typedef perimeter_metric<Geometry, Strategies, selected_perimeter> perimeter_type;
+    typedef centroid_metric<Geometry, Strategies, selected_centroid> centroid_type;
+    typedef envelope_metric<Geometry, Strategies, selected_envelope> envelope_type;
+
+    Geometry const& m_geometry;
+    area_type m_area;
+    perimeter_type m_perimeter;
+    centroid_type m_centroid;
+    envelope_type m_envelope;
+    std::size_t m_num_points;
+};
+
+
+struct stats_polygon
+{
+    template <typename Polygon, typename Calculator>
+    static inline void apply(Polygon const& polygon, Calculator& calculator)
+    {
+        calculator.apply_ring(exterior_ring(polygon), true);
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            calculator.apply_ring(*it, false);
+        }
+    }
+};
+
+
+}} // namespace detail::geometry_stats
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct geometry_stats : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct geometry_stats<Ring, ring_tag>
+{
+    template <typename Calculator>
+    static inline void apply(Ring const& ring, Calculator& calculator)
+    {
+        calculator.apply_ring(ring, true);
+    }
+};
+
+template <typename Polygon>
+struct geometry_stats<Polygon, polygon_tag>
+    : detail::geometry_stats::stats_polygon
+{};
+
+template <typename MultiPolygon>
+struct geometry_stats<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Calculator>
+    static inline void apply(MultiPolygon const& multi, Calculator& calculator)
+    {
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            detail::geometry_stats::stats_polygon::apply(*it, calculator);
+        }
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Calculates several metrics of an areal geometry in one pass,
+    using the specified strategies
+\ingroup geometry_stats
+\details The area, the perimeter, the centroid, the envelope and the number
+    of points of a Ring, Polygon or MultiPolygon are calculated visiting
+    every point once, instead of once for every metric. The results are
+    the same as those of area(), perimeter(), centroid(), envelope() and
+    num_points(). Only the metrics selected at compile time are calculated.
+    The envelope of non-cartesian geometries is calculated separately.
+\tparam Metrics the selected metrics, a combination of stats_selector values
+\tparam Geometry \tparam_geometry
+\tparam Strategies stats_strategies
+\param geometry \param_geometry
+\param result the calculated metrics
+\param strategies the strategies calculating the metrics
+
+\qbk{distinguish,with strategies}
+*/
+template <unsigned Metrics = stats_all, typename Geometry, typename Strategies>
+inline void geometry_stats(Geometry const& geometry,
+                           geometry_stats_result<Geometry, Strategies>& result,
+                           Strategies const& strategies)
+{
+    concepts::check<Geometry const>();
+
+    detail::geometry_stats::stats_calculator
+        <
+            Metrics, Geometry, Strategies
+        > calculator(geometry, strategies);
+    dispatch::geometry_stats<Geometry>::apply(geometry, calculator);
+    calculator.result(result);
+}
+
+/*!
+\brief Calculates several metrics of an areal geometry in one pass
+\ingroup geometry_stats
+\tparam Metrics the selected metrics, a combination of stats_selector values
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param result the calculated metrics
+*/
+template <unsigned Metrics = stats_all, typename Geometry>
+inline void geometry_stats(Geometry const& geometry,
+                           geometry_stats_result<Geometry>& result)
+{
+    geometry_stats<Metrics>(geometry, result,
+                            typename default_stats_strategies<Geometry>::type());
+}
+
+/*!
+\brief Calculates several metrics of every geometry of a range, using
+    an executor
+\ingroup geometry_stats
+\details The geometries are distributed over the tasks of the executor in
+    chunks, every geometry is visited once.
+\tparam Metrics the selected metrics, a combination of stats_selector values
+\tparam Geometries random access range of Rings, Polygons or MultiPolygons
+\tparam Results resizable random access range of geometry_stats_result
+\tparam Strategies stats_strategies
+\tparam Executor executor, e.g. thread_executor
+\param geometries the geometries
+\param results the calculated metrics, in the order of the geometries
+\param strategies the strategies calculating the metrics
+\param executor Executor running the tasks
+
+\qbk{distinguish,with executor}
+*/
+template
+<
+    unsigned Metrics = stats_all,
+    typename Geometries,
+    typename Results,
+    typename Strategies,
+    typename Executor
+>
+inline void geometry_stats(Geometries const& geometries, Results& results,
+                           Strategies const& strategies,
+                           Executor const& executor)
+{
+    std::size_t const size = boost::size(geometries);
+    range::resize(results, size);
+
+    detail::for_each_chunk(executor, size, detail::geometry_stats::chunk_size,
+        [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                geometry_stats<Metrics>(range::at(geometries, i),
+                                        range::at(results, i),
+                                        strategies);
+            }
+        });
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_GEOMETRY_STATS_HPP
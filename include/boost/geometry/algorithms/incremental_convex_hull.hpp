@@ -0,0 +1,202 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
+
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/strategies/convex_hull.hpp>
+#include <boost/geometry/strategies/agnostic/hull_graham_andrew.hpp>
+#include <boost/geometry/strategies/side.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace convex_hull
+{
+
+// Returns true if the point is strictly inside the convex polygon, given
+// by its vertices in counterclockwise order, in O(log n). The triangle of
+// the fan around the first vertex containing the point is searched.
+template <typename Points, typename Point, typename SideStrategy>
+inline bool is_inside_convex(Points const& vertices, Point const& point,
+                             SideStrategy const& side)
+{
+    std::size_t const count = vertices.size();
+    if (count < 3
+        || side.apply(vertices[0], vertices[1], point) <= 0
+        || side.apply(vertices[0], vertices[count - 1], point) >= 0)
+    {
+        return false;
+    }
+
+    std::size_t low = 1;
+    std::size_t high = count - 1;
+    while (high - low > 1)
+    {
+        std::size_t const middle = low + (high - low) / 2;
+        if (side.apply(vertices[0], vertices[middle], point) > 0)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return side.apply(vertices[low], vertices[high], point) > 0;
+}
+
+}} // namespace detail::convex_hull
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Convex hull of points arriving one by one
+\details Points strictly inside the current hull are discarded in
+    logarithmic time, most of them in constant time by the rectangle
+    inscribed in the hull. The other points are buffered and the hull is
+    recalculated from its vertices and the buffer when the buffer is
+    larger than the hull, so the points of a stream are processed in
+    amortized O(log n) time and the memory used is proportional to the
+    size of the hull.
+\ingroup convex_hull
+\tparam Point Type of the points, the coordinate system has to be
+    supported by convex_hull()
+*/
+template <typename Point>
+class incremental_convex_hull
+{
+    typedef model::multi_point<Point> multi_point_type;
+    typedef typename strategy_convex_hull
+        <
+            multi_point_type, Point
+        >::type strategy_type;
+    typedef typename strategy::side::services::default_strategy
+        <
+            typename cs_tag<Point>::type
+        >::type side_strategy_type;
+    typedef strategy::convex_hull::detail::interior_filter
+        <
+            Point, typename cs_tag<Point>::type
+        > filter_type;
+
+    // Minimal number of buffered points before the hull is recalculated
+    static const std::size_t min_buffer_size = 256;
+
+public:
+    incremental_convex_hull()
+    {
+        concepts::check<Point const>();
+    }
+
+    /*!
+    \brief Adds a point to the hull
+    */
+    inline void insert(Point const& point)
+    {
+        if (m_filter.discards(point)
+            || detail::convex_hull::is_inside_convex(m_vertices, point, m_side))
+        {
+            return;
+        }
+
+        m_buffer.push_back(point);
+        if (m_buffer.size() >= min_buffer_size
+            && m_buffer.size() >= m_vertices.size())
+        {
+            update();
+        }
+    }
+
+    /*!
+    \brief Adds the points of a range to the hull
+    */
+    template <typename Range>
+    inline void insert_range(Range const& range)
+    {
+        for (typename boost::range_iterator<Range const>::type it
+                = boost::begin(range); it != boost::end(range); ++it)
+        {
+            insert(*it);
+        }
+    }
+
+    /*!
+    \brief Assigns the hull of the points added so far to hull
+    \param hull \param_geometry \param_set{convex hull}
+    */
+    template <typename OutputGeometry>
+    inline void get(OutputGeometry& hull)
+    {
+        update();
+        geometry::clear(hull);
+        geometry::convex_hull(m_vertices, hull, m_strategy);
+    }
+
+    /*!
+    \brief Removes all points
+    */
+    inline void clear()
+    {
+        m_vertices.clear();
+        m_buffer.clear();
+        m_filter = filter_type();
+    }
+
+private:
+    // Replaces the vertices by the counterclockwise open hull of the
+    // vertices and of the buffered points
+    inline void update()
+    {
+        if (m_buffer.empty())
+        {
+            return;
+        }
+
+        m_buffer.insert(m_buffer.end(), m_vertices.begin(), m_vertices.end());
+        m_vertices.clear();
+
+        typename strategy_type::state_type state;
+        m_strategy.apply(m_buffer, state);
+        m_strategy.result(state, std::back_inserter(m_vertices), false, false);
+
+        m_buffer.clear();
+
+        m_filter = filter_type();
+        for (std::size_t i = 0 ; i < m_vertices.size() ; ++i)
+        {
+            m_filter.apply(m_vertices[i]);
+        }
+        m_filter.finish(m_side);
+    }
+
+    strategy_type m_strategy;
+    side_strategy_type m_side;
+    filter_type m_filter;
+    multi_point_type m_vertices;
+    multi_point_type m_buffer;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_INCREMENTAL_CONVEX_HULL_HPP
@@ -35,13 +35,16 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
 #include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
 #include <boost/range/value_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <boost/variant/apply_visitor.hpp>
 #include <boost/variant/static_visitor.hpp>
 #include <boost/variant/variant_fwd.hpp>
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 #include <boost/geometry/core/tags.hpp>
 
 #include <boost/geometry/geometries/concepts/check.hpp>
@@ -55,6 +58,9 @@
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/default_length_result.hpp>
 
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/range.hpp>
+
 
 namespace boost { namespace geometry
 {
@@ -95,6 +101,22 @@ struct range_length
     template <typename Strategy>
     static inline return_type apply(
             Range const& range, Strategy const& strategy)
+    {
+        return apply(range, strategy,
+                     boost::integral_constant
+                        <
+                            bool,
+                            strategy::distance::detail::contiguous_kernel
+                                <
+                                    Strategy, Range
+                                >::value
+                        >());
+    }
+
+private :
+    template <typename Strategy>
+    static inline return_type apply(
+            Range const& range, Strategy const& strategy, boost::false_type)
     {
         boost::ignore_unused(strategy);
         typedef typename closeable_view<Range const, Closure>::type view_type;
@@ -120,6 +142,27 @@ struct range_length
 
         return sum;
     }
+
+    // The coordinates are stored contiguously, all segments are added by
+    // one kernel
+    template <typename Strategy>
+    static inline return_type apply(
+            Range const& range, Strategy const& strategy, boost::true_type)
+    {
+        std::size_t const count = boost::size(range);
+        if (count < 2)
+        {
+            return return_type();
+        }
+
+        return_type sum = strategy.apply_contiguous(
+                geometry::detail::coordinates_begin<double>(range), count);
+        if (BOOST_GEOMETRY_CONDITION(Closure == open))
+        {
+            sum += strategy.apply(range::back(range), range::front(range));
+        }
+        return sum;
+    }
 };
 
 
@@ -0,0 +1,466 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_LINEAR_REFERENCE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_LINEAR_REFERENCE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/densify.hpp>
+#include <boost/geometry/algorithms/detail/throw_on_empty_input.hpp>
+#include <boost/geometry/arithmetic/arithmetic.hpp>
+#include <boost/geometry/arithmetic/dot_product.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/pointing_segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/strategies/densify.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/index.hpp>
+#include <boost/geometry/strategies/line_interpolate.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace linear_reference
+{
+
+// Returns the fraction of the segment p0-p1 at which it is closest to point.
+// Along a geodesic the distance to a point has one minimum, which is
+// searched by golden section, interpolating with the strategy.
+template <typename CSTag>
+struct closest_fraction
+{
+    template
+    <
+        typename Point,
+        typename SegmentPoint,
+        typename Distance,
+        typename Strategy
+    >
+    static inline Distance apply(Point const& point,
+                                 SegmentPoint const& p0,
+                                 SegmentPoint const& p1,
+                                 Distance const& length,
+                                 Strategy const& strategy)
+    {
+        Distance const zero = 0;
+        Distance const one = 1;
+        if (! (length > zero))
+        {
+            return zero;
+        }
+
+        // Near the minimum the distance changes with the square of the
+        // fraction, it can not be found more precisely than this
+        Distance const tolerance = 1.0e-9;
+        Distance const ratio = 0.6180339887498949;
+
+        Distance a = zero;
+        Distance b = one;
+        Distance c = b - ratio * (b - a);
+        Distance d = a + ratio * (b - a);
+        Distance fc = distance(point, p0, p1, c, length, strategy);
+        Distance fd = distance(point, p0, p1, d, length, strategy);
+        while (b - a > tolerance)
+        {
+            if (fc < fd)
+            {
+                b = d;
+                d = c;
+                fd = fc;
+                c = b - ratio * (b - a);
+                fc = distance(point, p0, p1, c, length, strategy);
+            }
+            else
+            {
+                a = c;
+                c = d;
+                fc = fd;
+                d = a + ratio * (b - a);
+                fd = distance(point, p0, p1, d, length, strategy);
+            }
+        }
+
+        // The minimum can be at an end of the segment
+        Distance const middle = (a + b) / 2;
+        Distance const f0 = distance(point, p0, p1, zero, length, strategy);
+        Distance const f1 = distance(point, p0, p1, one, length, strategy);
+        Distance const fm = distance(point, p0, p1, middle, length, strategy);
+        return f0 <= fm && f0 <= f1 ? zero
+             : f1 < fm ? one
+             : middle;
+    }
+
+private :
+    template
+    <
+        typename Point,
+        typename SegmentPoint,
+        typename Distance,
+        typename Strategy
+    >
+    static inline Distance distance(Point const& point,
+                                     SegmentPoint const& p0,
+                                     SegmentPoint const& p1,
+                                     Distance const& fraction,
+                                     Distance const& length,
+                                     Strategy const& strategy)
+    {
+        SegmentPoint p;
+        strategy.apply(p0, p1, fraction, p, length);
+        return strategy.get_distance_pp_strategy().apply(point, p);
+    }
+};
+
+// The projection of the point on the segment
+template <>
+struct closest_fraction<cartesian_tag>
+{
+    template
+    <
+        typename Point,
+        typename SegmentPoint,
+        typename Distance,
+        typename Strategy
+    >
+    static inline Distance apply(Point const& point,
+                                 SegmentPoint const& p0,
+                                 SegmentPoint const& p1,
+                                 Distance const& length,
+                                 Strategy const& )
+    {
+        typedef model::point
+            <
+                Distance,
+                geometry::dimension<SegmentPoint>::value,
+                cs::cartesian
+            > calc_point_type;
+
+        Distance const zero = 0;
+        Distance const one = 1;
+        if (! (length > zero))
+        {
+            return zero;
+        }
+
+        calc_point_type v, w;
+        geometry::convert(p1, v);
+        geometry::convert(point, w);
+        calc_point_type c0;
+        geometry::convert(p0, c0);
+        geometry::subtract_point(v, c0);
+        geometry::subtract_point(w, c0);
+
+        Distance const fraction = geometry::dot_product(v, w)
+                                / geometry::dot_product(v, v);
+        return fraction < zero ? zero
+             : fraction > one ? one
+             : fraction;
+    }
+};
+
+}} // namespace detail::linear_reference
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Index of a linestring answering many linear referencing queries
+\details The cumulative lengths of the segments are calculated once, when
+    the index is constructed, and the segments are packed into an rtree.
+    Then the point at a distance along the linestring is found by a binary
+    search, in O(log n), and the distance along the linestring of the
+    projection of a point by a nearest query. Many points at sorted
+    distances are interpolated in one pass and the linestring is densified
+    without calculating the lengths of the short segments again. The index
+    can be used by several threads at the same time.
+\ingroup line_interpolate
+\tparam Linestring A type fulfilling the Linestring concept
+\tparam Strategy A type fulfilling a LineInterpolatePointStrategy concept,
+    its point-point distance strategy calculates the lengths
+\note The linestring has to outlive the index and must not be modified.
+*/
+template
+<
+    typename Linestring,
+    typename Strategy = typename strategy::line_interpolate::services::default_strategy
+        <
+            typename cs_tag<Linestring>::type
+        >::type
+>
+class linear_reference
+{
+    typedef typename geometry::point_type<Linestring>::type point_type;
+    typedef typename Strategy::distance_pp_strategy::type distance_strategy_type;
+    typedef typename strategy::distance::services::comparable_type
+        <
+            distance_strategy_type
+        >::type comparable_strategy_type;
+    typedef strategy::index::services::from_strategy
+        <
+            comparable_strategy_type
+        > index_strategy_from;
+    typedef index::parameters
+        <
+            index::linear<8>, typename index_strategy_from::type
+        > index_parameters_type;
+
+    typedef model::pointing_segment<point_type const> segment_type;
+    typedef std::pair<segment_type, std::size_t> value_type;
+    typedef index::rtree<value_type, index_parameters_type> rtree_type;
+
+public:
+    typedef typename strategy::distance::services::return_type
+        <
+            distance_strategy_type, point_type, point_type
+        >::type distance_type;
+
+    /*!
+    \brief Calculates the cumulative lengths and indexes the segments
+    \param linestring Indexed linestring, not empty
+    \param strategy Interpolation strategy
+    */
+    explicit linear_reference(Linestring const& linestring,
+                              Strategy const& strategy = Strategy())
+        : m_linestring(linestring)
+        , m_strategy(strategy)
+        , m_rtree(index_parameters_type(
+                      index::linear<8>(),
+                      index_strategy_from::get(
+                          strategy::distance::services::get_comparable
+                              <
+                                  distance_strategy_type
+                              >::apply(strategy.get_distance_pp_strategy()))))
+    {
+        concepts::check<Linestring const>();
+        detail::throw_on_empty_input(linestring);
+
+        distance_strategy_type const distance_strategy
+            = m_strategy.get_distance_pp_strategy();
+
+        std::size_t const size = boost::size(linestring);
+        m_lengths.reserve(size);
+        m_lengths.push_back(distance_type(0));
+
+        std::vector<value_type> segments;
+        segments.reserve(size - 1);
+        for (std::size_t i = 0; i + 1 < size; ++i)
+        {
+            point_type const& p0 = range::at(linestring, i);
+            point_type const& p1 = range::at(linestring, i + 1);
+            m_lengths.push_back(m_lengths.back()
+                                + distance_strategy.apply(p0, p1));
+            segments.push_back(value_type(segment_type(p0, p1), i));
+        }
+
+        // Packed like the other rtrees of segments
+        rtree_type(segments.begin(), segments.end(),
+                   m_rtree.parameters()).swap(m_rtree);
+    }
+
+    /*!
+    \brief Returns the length of the linestring
+    */
+    inline distance_type length() const
+    {
+        return m_lengths.back();
+    }
+
+    /*!
+    \brief Returns the point at a distance along the linestring, the first
+        or the last point if the distance is outside the linestring
+    \param distance Distance from the first point
+    \param point Output point
+    */
+    template <typename Point>
+    inline void interpolate(distance_type const& distance, Point& point) const
+    {
+        point_at(segment_index(distance), distance, point);
+    }
+
+    /*!
+    \brief Appends the points at ascending distances along the linestring
+        to a MultiPoint, in one pass over the linestring
+    \param distances Range of distances from the first point, a distance
+        smaller than its predecessor is searched again
+    \param multi_point Output MultiPoint, the points are appended
+    */
+    template <typename Distances, typename MultiPoint>
+    inline void interpolate_sorted(Distances const& distances,
+                                   MultiPoint& multi_point) const
+    {
+        typedef typename boost::range_value<MultiPoint>::type out_point_type;
+        typedef typename boost::range_iterator<Distances const>::type iterator;
+
+        std::size_t const count = m_lengths.size();
+        std::size_t i = 0;
+        distance_type previous = distance_type(0);
+        for (iterator it = boost::begin(distances);
+             it != boost::end(distances); ++it)
+        {
+            distance_type const distance = *it;
+            if (distance < previous)
+            {
+                i = segment_index(distance);
+            }
+            while (i + 1 < count && ! (distance < m_lengths[i + 1]))
+            {
+                ++i;
+            }
+
+            out_point_type point;
+            point_at(i, distance, point);
+            range::push_back(multi_point, point);
+            previous = distance;
+        }
+    }
+
+    /*!
+    \brief Returns the distance along the linestring of the point of the
+        linestring closest to a point
+    \param point Point which is projected on the linestring
+    */
+    template <typename Point>
+    inline distance_type locate(Point const& point) const
+    {
+        if (m_rtree.empty())
+        {
+            return distance_type(0);
+        }
+
+        value_type nearest;
+        m_rtree.query(index::nearest(point, 1), &nearest);
+        std::size_t const i = nearest.second;
+
+        typedef typename cs_tag<point_type>::type cs_tag_type;
+        distance_type const segment_length = m_lengths[i + 1] - m_lengths[i];
+        distance_type const fraction
+            = detail::linear_reference::closest_fraction
+                <
+                    cs_tag_type
+                >::apply(point,
+                         range::at(m_linestring, i),
+                         range::at(m_linestring, i + 1),
+                         segment_length, m_strategy);
+        return m_lengths[i] + fraction * segment_length;
+    }
+
+    /*!
+    \brief Densifies the linestring like densify(), the segments which are
+        not longer than max_distance are copied without calculating their
+        lengths again
+    \param out Output Linestring, cleared first
+    \param max_distance Maximal length of the segments of the output
+    \param strategy Densify strategy dividing the longer segments
+    */
+    template <typename OutLinestring, typename DensifyStrategy>
+    inline void densify(OutLinestring& out,
+                        distance_type const& max_distance,
+                        DensifyStrategy const& strategy) const
+    {
+        if (max_distance <= distance_type(0))
+        {
+            BOOST_THROW_EXCEPTION(geometry::invalid_input_exception());
+        }
+
+        geometry::clear(out);
+
+        detail::densify::push_back_policy<OutLinestring> policy(out);
+
+        std::size_t const size = m_lengths.size();
+        for (std::size_t i = 0; i + 1 < size; ++i)
+        {
+            point_type const& p0 = range::at(m_linestring, i);
+            detail::densify::convert_and_push_back(out, p0);
+            if (! (m_lengths[i + 1] - m_lengths[i] < max_distance))
+            {
+                strategy.apply(p0, range::at(m_linestring, i + 1),
+                               policy, max_distance);
+            }
+        }
+        detail::densify::convert_and_push_back(out, range::back(m_linestring));
+    }
+
+    /*!
+    \brief Densifies the linestring like densify(), with the default
+        densify strategy of the coordinate system
+    \param out Output Linestring, cleared first
+    \param max_distance Maximal length of the segments of the output
+    */
+    template <typename OutLinestring>
+    inline void densify(OutLinestring& out,
+                        distance_type const& max_distance) const
+    {
+        typedef typename strategy::densify::services::default_strategy
+            <
+                typename cs_tag<point_type>::type
+            >::type densify_strategy_type;
+
+        densify(out, max_distance, densify_strategy_type());
+    }
+
+private:
+    // The last index of which the distance is not larger than distance
+    inline std::size_t segment_index(distance_type const& distance) const
+    {
+        std::size_t const i = std::upper_bound(m_lengths.begin(),
+                                               m_lengths.end(),
+                                               distance)
+                            - m_lengths.begin();
+        return i == 0 ? 0 : i - 1;
+    }
+
+    // The point at distance on the segment i, or the point i if the
+    // distance is not larger than its distance, or the last point
+    template <typename Point>
+    inline void point_at(std::size_t i, distance_type const& distance,
+                         Point& point) const
+    {
+        if (i + 1 >= m_lengths.size() || ! (distance > m_lengths[i]))
+        {
+            geometry::convert(range::at(m_linestring, i), point);
+            return;
+        }
+
+        distance_type const segment_length = m_lengths[i + 1] - m_lengths[i];
+        point_type p;
+        m_strategy.apply(range::at(m_linestring, i),
+                         range::at(m_linestring, i + 1),
+                         (distance - m_lengths[i]) / segment_length,
+                         p, segment_length);
+        geometry::convert(p, point);
+    }
+
+    Linestring const& m_linestring;
+    Strategy m_strategy;
+    std::vector<distance_type> m_lengths;
+    rtree_type m_rtree;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_LINEAR_REFERENCE_HPP
@@ -0,0 +1,734 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/policies/compare.hpp>
+#include <boost/geometry/strategies/agnostic/simplify_douglas_peucker.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/util/executor.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify_coverage
+{
+
+// The boundaries of the polygons of a coverage are split into arcs at the
+// junctions, the vertices where more than two boundaries meet or where
+// a shared boundary ends. Each arc is stored once, a shared boundary
+// refers to the same arc from both sides.
+
+struct arc_use
+{
+    std::size_t arc;
+    bool reversed;
+};
+
+// Number of times the tolerance of an arc is halved before the original
+// arc is used, if the simplified arc conflicts with other arcs
+static const std::size_t max_arc_level = 4;
+
+template <typename Point>
+inline bool equal_points(Point const& p1, Point const& p2)
+{
+    geometry::less<Point> const less;
+    return ! less(p1, p2) && ! less(p2, p1);
+}
+
+template <typename Point>
+class coverage_arcs
+{
+    typedef std::vector<Point> points_type;
+
+    // The point is stored with its position, so the vertices are sorted
+    // without accessing the rings
+    struct vertex
+    {
+        Point point;
+        std::size_t ring;
+        std::size_t index;
+    };
+
+    struct edge_less
+    {
+        inline bool operator()(std::pair<Point, Point> const& left,
+                               std::pair<Point, Point> const& right) const
+        {
+            geometry::less<Point> const less;
+            return less(left.first, right.first)
+                || (! less(right.first, left.first)
+                    && less(left.second, right.second));
+        }
+    };
+
+public :
+    // The rings of the polygons, the exterior ring of each polygon is
+    // followed by its interior rings
+    template <typename Polygons>
+    explicit coverage_arcs(Polygons const& polygons)
+    {
+        typedef typename interior_type
+            <
+                typename boost::range_value<Polygons>::type
+            >::type interiors_type;
+
+        for (typename boost::range_iterator<Polygons const>::type
+                it = boost::begin(polygons); it != boost::end(polygons); ++it)
+        {
+            add_ring(exterior_ring(*it));
+            interiors_type const& interiors = interior_rings(*it);
+            for (typename boost::range_iterator<interiors_type const>::type
+                    rit = boost::begin(interiors);
+                 rit != boost::end(interiors); ++rit)
+            {
+                add_ring(*rit);
+            }
+        }
+
+        mark_junctions();
+
+        for (std::size_t r = 0; r < m_rings.size(); ++r)
+        {
+            split_ring(r);
+        }
+    }
+
+    inline std::size_t arcs_count() const
+    {
+        return m_arcs.size();
+    }
+
+    inline points_type const& arc(std::size_t i) const
+    {
+        return m_arcs[i];
+    }
+
+    inline std::size_t rings_count() const
+    {
+        return m_rings.size();
+    }
+
+    // The arcs of a ring, empty if the ring is degenerate
+    inline std::vector<arc_use> const& ring_arcs(std::size_t r) const
+    {
+        return m_ring_arcs[r];
+    }
+
+    // The points of a degenerate ring
+    inline points_type const& ring(std::size_t r) const
+    {
+        return m_rings[r];
+    }
+
+private :
+    // Stores the vertices without the closing point and without
+    // consecutive duplicates
+    template <typename Ring>
+    inline void add_ring(Ring const& ring)
+    {
+        m_rings.push_back(points_type());
+        points_type& points = m_rings.back();
+        for (typename boost::range_iterator<Ring const>::type
+                it = boost::begin(ring); it != boost::end(ring); ++it)
+        {
+            if (points.empty() || ! equal_points(points.back(), *it))
+            {
+                points.push_back(*it);
+            }
+        }
+        while (points.size() > 1 && equal_points(points.front(), points.back()))
+        {
+            points.pop_back();
+        }
+    }
+
+    inline Point const& neighbour(vertex const& v, bool next) const
+    {
+        points_type const& points = m_rings[v.ring];
+        std::size_t const n = points.size();
+        return points[next ? (v.index + 1) % n : (v.index + n - 1) % n];
+    }
+
+    // A vertex is a junction if the boundaries passing through its point
+    // have more than two different neighbours
+    inline void mark_junctions()
+    {
+        std::vector<vertex> vertices;
+        m_junctions.resize(m_rings.size());
+        std::size_t count = 0;
+        for (std::size_t r = 0; r < m_rings.size(); ++r)
+        {
+            count += m_rings[r].size();
+        }
+        vertices.reserve(count);
+        for (std::size_t r = 0; r < m_rings.size(); ++r)
+        {
+            m_junctions[r].assign(m_rings[r].size(), 0);
+            for (std::size_t i = 0; i < m_rings[r].size(); ++i)
+            {
+                vertex const v = { m_rings[r][i], r, i };
+                vertices.push_back(v);
+            }
+        }
+
+        geometry::less<Point> const less;
+        std::sort(vertices.begin(), vertices.end(),
+                  [&](vertex const& left, vertex const& right)
+                  {
+                      return less(left.point, right.point);
+                  });
+
+        std::vector<Point const*> neighbours;
+        for (std::size_t first = 0; first < vertices.size(); )
+        {
+            std::size_t last = first + 1;
+            while (last < vertices.size()
+                && ! less(vertices[first].point, vertices[last].point))
+            {
+                ++last;
+            }
+
+            neighbours.clear();
+            for (std::size_t i = first; i < last && neighbours.size() <= 2; ++i)
+            {
+                for (int next = 0; next < 2; ++next)
+                {
+                    Point const& n = neighbour(vertices[i], next != 0);
+                    bool found = false;
+                    for (std::size_t j = 0; j < neighbours.size() && ! found; ++j)
+                    {
+                        found = equal_points(*neighbours[j], n);
+                    }
+                    if (! found)
+                    {
+                        neighbours.push_back(&n);
+                    }
+                }
+            }
+
+            if (neighbours.size() > 2)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    m_junctions[vertices[i].ring][vertices[i].index] = 1;
+                }
+            }
+            first = last;
+        }
+    }
+
+    inline void split_ring(std::size_t r)
+    {
+        m_ring_arcs.push_back(std::vector<arc_use>());
+
+        points_type const& points = m_rings[r];
+        std::size_t const n = points.size();
+        if (n < 3)
+        {
+            return;
+        }
+
+        // A ring without junctions starts at its smallest point, which is
+        // also the start of another ring with the same boundary
+        std::size_t start = n;
+        for (std::size_t i = 0; i < n && start == n; ++i)
+        {
+            if (m_junctions[r][i])
+            {
+                start = i;
+            }
+        }
+        if (start == n)
+        {
+            start = std::min_element(points.begin(), points.end(),
+                                     geometry::less<Point>()) - points.begin();
+        }
+
+        points_type arc(1, points[start]);
+        for (std::size_t k = 1; k <= n; ++k)
+        {
+            std::size_t const i = (start + k) % n;
+            arc.push_back(points[i]);
+            if (i == start || m_junctions[r][i])
+            {
+                m_ring_arcs.back().push_back(add_arc(arc));
+                arc.assign(1, points[i]);
+            }
+        }
+    }
+
+    // Returns the arc stored before if the same boundary was found from
+    // the other side, otherwise stores the arc
+    inline arc_use add_arc(points_type const& arc)
+    {
+        typedef typename std::map
+            <
+                std::pair<Point, Point>, std::size_t, edge_less
+            >::const_iterator iterator_type;
+
+        iterator_type const reversed = m_first_edges.find(
+            std::make_pair(arc.back(), arc[arc.size() - 2]));
+        if (reversed != m_first_edges.end())
+        {
+            arc_use const use = { reversed->second, true };
+            return use;
+        }
+
+        iterator_type const same = m_first_edges.find(
+            std::make_pair(arc.front(), arc[1]));
+        if (same != m_first_edges.end())
+        {
+            arc_use const use = { same->second, false };
+            return use;
+        }
+
+        arc_use const use = { m_arcs.size(), false };
+        m_first_edges.insert(std::make_pair(std::make_pair(arc.front(), arc[1]),
+                                            m_arcs.size()));
+        m_arcs.push_back(arc);
+        return use;
+    }
+
+    std::vector<points_type> m_rings;
+    std::vector<std::vector<unsigned char> > m_junctions;
+    std::vector<std::vector<arc_use> > m_ring_arcs;
+    std::vector<points_type> m_arcs;
+    std::map<std::pair<Point, Point>, std::size_t, edge_less> m_first_edges;
+};
+
+// Simplifies an arc, both ends are kept. A closed arc is split at its
+// farthest point from its start, it keeps at least three points.
+template <typename Points, typename Distance, typename Strategy>
+inline void simplify_arc(Points const& arc, Points& result,
+                         Distance const& max_distance,
+                         Strategy const& strategy)
+{
+    result.clear();
+    if (arc.size() <= 2)
+    {
+        result = arc;
+        return;
+    }
+
+    std::size_t split = arc.size() - 1;
+    if (equal_points(arc.front(), arc.back()))
+    {
+        typename Strategy::distance_strategy_type const distance_strategy;
+        typename Strategy::distance_type max(-1);
+        for (std::size_t i = 1; i + 1 < arc.size(); ++i)
+        {
+            // This is a point-segment distance resulting in a point-point
+            // distance, as in simplify() for rings
+            typename Strategy::distance_type const dist
+                = distance_strategy.apply(arc[i], arc.front(), arc.front());
+            if (dist > max)
+            {
+                max = dist;
+                split = i;
+            }
+        }
+    }
+
+    strategy.apply(boost::make_iterator_range(arc.begin(), arc.begin() + split + 1),
+                   std::back_inserter(result), max_distance);
+    if (split + 1 < arc.size())
+    {
+        Points tail;
+        strategy.apply(boost::make_iterator_range(arc.begin() + split, arc.end()),
+                       std::back_inserter(tail), max_distance);
+        result.insert(result.end(), tail.begin() + 1, tail.end());
+    }
+}
+
+// Returns true if two segments of the arcs intersect in another way than
+// by sharing one endpoint
+template <typename Point>
+inline bool is_crossing(Point const& a1, Point const& a2,
+                        Point const& b1, Point const& b2)
+{
+    typedef model::referring_segment<Point const> segment_type;
+    segment_type const a(a1, a2);
+    segment_type const b(b1, b2);
+
+    bool const shared1 = equal_points(a1, b1) || equal_points(a1, b2);
+    bool const shared2 = equal_points(a2, b1) || equal_points(a2, b2);
+    if (shared1 && shared2)
+    {
+        return true;
+    }
+    if (shared1)
+    {
+        return geometry::intersects(a2, b)
+            || geometry::intersects(equal_points(a1, b1) ? b2 : b1, a);
+    }
+    if (shared2)
+    {
+        return geometry::intersects(a1, b)
+            || geometry::intersects(equal_points(a2, b1) ? b2 : b1, a);
+    }
+    return geometry::intersects(a, b);
+}
+
+// Returns the indexes of the points of a simplified arc in the original arc
+template <typename Points>
+inline void original_indexes(Points const& arc, Points const& simplified,
+                             std::vector<std::size_t>& indexes)
+{
+    indexes.clear();
+    std::size_t i = 0;
+    for (std::size_t j = 0; j < simplified.size(); ++j)
+    {
+        while (i + 1 < arc.size() && ! equal_points(arc[i], simplified[j]))
+        {
+            ++i;
+        }
+        indexes.push_back(i);
+    }
+}
+
+template <typename Ring, typename Points>
+inline void append_arc(Ring& ring, Points const& arc, bool reversed)
+{
+    // The first point of an arc is the last point of the previous one
+    std::size_t const skip = boost::size(ring) > 0 ? 1 : 0;
+    if (reversed)
+    {
+        std::for_each(arc.rbegin() + skip, arc.rend(),
+                      [&](typename Points::value_type const& p)
+                      {
+                          range::push_back(ring, p);
+                      });
+    }
+    else
+    {
+        std::for_each(arc.begin() + skip, arc.end(),
+                      [&](typename Points::value_type const& p)
+                      {
+                          range::push_back(ring, p);
+                      });
+    }
+}
+
+template <typename Ring, typename Point>
+inline void build_ring(coverage_arcs<Point> const& arcs,
+                       std::vector<std::vector<Point> > const& simplified,
+                       std::size_t r, Ring& ring)
+{
+    std::vector<arc_use> const& uses = arcs.ring_arcs(r);
+    if (uses.empty())
+    {
+        std::vector<Point> const& points = arcs.ring(r);
+        std::for_each(points.begin(), points.end(), [&](Point const& p)
+        {
+            range::push_back(ring, p);
+        });
+        if (! points.empty() && geometry::closure<Ring>::value == closed)
+        {
+            range::push_back(ring, points.front());
+        }
+        return;
+    }
+
+    for (std::size_t i = 0; i < uses.size(); ++i)
+    {
+        append_arc(ring, simplified[uses[i].arc], uses[i].reversed);
+    }
+
+    // The ring is closed by the arcs
+    if (geometry::closure<Ring>::value == open)
+    {
+        range::resize(ring, boost::size(ring) - 1);
+    }
+}
+
+template
+<
+    typename Polygons,
+    typename Distance,
+    typename Strategy,
+    typename Executor
+>
+inline void apply(Polygons const& coverage, Polygons& out,
+                  Distance const& max_distance,
+                  Strategy const& strategy,
+                  Executor const& executor)
+{
+    typedef typename boost::range_value<Polygons>::type polygon_type;
+    typedef typename geometry::point_type<polygon_type>::type point_type;
+    typedef model::box<point_type> box_type;
+    typedef std::pair<box_type, std::pair<std::size_t, std::size_t> > value_type;
+    typedef index::rtree<value_type, index::rstar<16> > rtree_type;
+    typedef index::rtree<point_type, index::rstar<16> > points_rtree_type;
+    typedef model::ring<point_type, true, false> swept_type;
+
+    coverage_arcs<point_type> const arcs(coverage);
+    std::size_t const count = arcs.arcs_count();
+
+    // Arcs are simplified with the tolerance halved for every level, the
+    // arcs of the last level are not simplified
+    std::vector<std::size_t> levels(count, 0);
+    std::vector<unsigned char> changed(count, 1);
+    std::vector<std::vector<point_type> > simplified(count);
+
+    while (true)
+    {
+        executor(count, [&](std::size_t i)
+        {
+            if (! changed[i])
+            {
+                return;
+            }
+            Distance distance = max_distance;
+            for (std::size_t level = 0; level < levels[i]; ++level)
+            {
+                distance /= 2;
+            }
+            if (levels[i] < max_arc_level)
+            {
+                simplify_arc(arcs.arc(i), simplified[i], distance, strategy);
+            }
+            else
+            {
+                simplified[i] = arcs.arc(i);
+            }
+        });
+
+        // Simplified arcs intersecting other arcs, or passing on the other
+        // side of their points, are simplified again
+        std::vector<value_type> segments;
+        std::vector<point_type> points;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            points.insert(points.end(), simplified[i].begin(),
+                          simplified[i].end());
+            for (std::size_t j = 0; j + 1 < simplified[i].size(); ++j)
+            {
+                box_type box;
+                geometry::envelope(model::referring_segment<point_type const>(
+                                        simplified[i][j], simplified[i][j + 1]),
+                                   box);
+                segments.push_back(value_type(box, std::make_pair(i, j)));
+            }
+        }
+        rtree_type const rtree(segments);
+        points_rtree_type const points_rtree(points);
+
+        std::vector<unsigned char> crossing(count, 0);
+        executor(count, [&](std::size_t i)
+        {
+            std::vector<point_type> const& arc = simplified[i];
+            std::vector<value_type> found;
+            std::vector<point_type> found_points;
+            std::vector<std::size_t> indexes;
+            original_indexes(arcs.arc(i), arc, indexes);
+            for (std::size_t j = 0; j + 1 < arc.size() && ! crossing[i]; ++j)
+            {
+                box_type box;
+                geometry::envelope(model::referring_segment<point_type const>(
+                                        arc[j], arc[j + 1]),
+                                   box);
+                found.clear();
+                rtree.query(index::intersects(box), std::back_inserter(found));
+                for (std::size_t k = 0; k < found.size() && ! crossing[i]; ++k)
+                {
+                    std::size_t const other = found[k].second.first;
+                    std::size_t const s = found[k].second.second;
+                    if ((other != i || s != j)
+                        && is_crossing(arc[j], arc[j + 1],
+                                       simplified[other][s],
+                                       simplified[other][s + 1]))
+                    {
+                        crossing[i] = 1;
+                    }
+                }
+
+                if (crossing[i] || indexes[j + 1] - indexes[j] < 2)
+                {
+                    continue;
+                }
+                // The area between the segment and the points it replaces,
+                // it may be self-intersecting, the winding number is used
+                swept_type const swept(arcs.arc(i).begin() + indexes[j],
+                                       arcs.arc(i).begin() + indexes[j + 1] + 1);
+                geometry::envelope(swept, box);
+                found_points.clear();
+                points_rtree.query(index::intersects(box),
+                                   std::back_inserter(found_points));
+                for (std::size_t k = 0; k < found_points.size() && ! crossing[i]; ++k)
+                {
+                    if (geometry::within(found_points[k], swept))
+                    {
+                        crossing[i] = 1;
+                    }
+                }
+            }
+        });
+
+        bool again = false;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            changed[i] = crossing[i] && levels[i] < max_arc_level;
+            if (changed[i])
+            {
+                ++levels[i];
+                again = true;
+            }
+        }
+        if (! again)
+        {
+            break;
+        }
+    }
+
+    range::clear(out);
+    std::size_t r = 0;
+    for (typename boost::range_iterator<Polygons const>::type
+            it = boost::begin(coverage); it != boost::end(coverage); ++it)
+    {
+        polygon_type polygon;
+        build_ring(arcs, simplified, r++, exterior_ring(polygon));
+
+        typename interior_type<polygon_type>::type& interiors
+            = interior_rings(polygon);
+        for (std::size_t i = 0; i < boost::size(interior_rings(*it)); ++i)
+        {
+            typename ring_type<polygon_type>::type ring;
+            build_ring(arcs, simplified, r++, ring);
+            range::push_back(interiors, ring);
+        }
+        range::push_back(out, polygon);
+    }
+}
+
+}} // namespace detail::simplify_coverage
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Simplifies the polygons of a coverage, keeping shared boundaries
+    shared, using a specified strategy and an executor
+\ingroup simplify
+\details The polygons of a coverage do not overlap, neighbours share
+    boundaries with the same vertices. The boundaries are split into arcs
+    where more than two polygons meet or where a shared boundary ends.
+    Each arc is simplified once by the executor, the polygons sharing it
+    get the same simplified boundary, so no gaps and no overlaps are
+    created. Simplified arcs intersecting other arcs, or passing on the
+    other side of their vertices, are simplified again with a smaller
+    tolerance, or not at all, so valid polygons stay valid.
+\tparam Polygons A MultiPolygon or a range of Polygons
+\tparam Distance A numerical distance measure
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\tparam Executor executor, e.g. thread_executor
+\param coverage input polygons
+\param out output polygons, in the same order as the input polygons
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification
+\param executor Executor running the tasks
+
+\qbk{distinguish,with strategy and executor}
+*/
+template
+<
+    typename Polygons,
+    typename Distance,
+    typename Strategy,
+    typename Executor
+>
+inline void simplify_coverage(Polygons const& coverage, Polygons& out,
+                              Distance const& max_distance,
+                              Strategy const& strategy,
+                              Executor const& executor)
+{
+    concepts::check
+        <
+            typename boost::range_value<Polygons>::type const
+        >();
+
+    detail::simplify_coverage::apply(coverage, out, max_distance,
+                                     strategy, executor);
+}
+
+/*!
+\brief Simplifies the polygons of a coverage, keeping shared boundaries
+    shared, using a specified strategy
+\ingroup simplify
+\qbk{distinguish,with strategy}
+*/
+template <typename Polygons, typename Distance, typename Strategy>
+inline void simplify_coverage(Polygons const& coverage, Polygons& out,
+                              Distance const& max_distance,
+                              Strategy const& strategy)
+{
+    geometry::simplify_coverage(coverage, out, max_distance, strategy,
+                                sequential_executor());
+}
+
+/*!
+\brief Simplifies the polygons of a coverage, keeping shared boundaries
+    shared
+\ingroup simplify
+*/
+template <typename Polygons, typename Distance>
+inline void simplify_coverage(Polygons const& coverage, Polygons& out,
+                              Distance const& max_distance)
+{
+    typedef typename geometry::point_type
+        <
+            typename boost::range_value<Polygons>::type
+        >::type point_type;
+
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, segment_tag, point_type
+        >::type ds_strategy_type;
+
+    geometry::simplify_coverage(coverage, out, max_distance,
+                                strategy::simplify::douglas_peucker
+                                    <
+                                        point_type, ds_strategy_type
+                                    >());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
@@ -0,0 +1,108 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_CORE_CONTIGUOUS_COORDINATES_HPP
+#define BOOST_GEOMETRY_CORE_CONTIGUOUS_COORDINATES_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/core/addressof.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/util/bare_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace traits
+{
+
+/*!
+\brief Traits class indicating if the coordinates of a point are stored
+    contiguously in memory
+\details If value is true, the coordinates of a point are an array of
+    dimension<Point> values of coordinate_type<Point>, starting at the
+    address of the point, and without padding between points stored in an
+    array. Algorithms can then process ranges of such points with kernels
+    reading the coordinates directly.
+\par Geometries:
+    - point
+\par Specializations should provide:
+    - value (should be derived from boost::true_type or boost::false_type)
+\ingroup traits
+*/
+template <typename Point, typename Enable = void>
+struct contiguous_coordinates
+    : boost::false_type
+{};
+
+} // namespace traits
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+template <typename Value, typename Allocator>
+boost::true_type is_std_vector(std::vector<Value, Allocator> const*);
+
+boost::false_type is_std_vector(...);
+
+// Indicates if the points of Range are stored contiguously, in a std::vector
+// or a type derived from it, with coordinates of CoordinateType stored
+// contiguously, such that the coordinates of the whole range can be read as
+// one array
+template
+<
+    typename Range,
+    typename CoordinateType,
+    std::size_t DimensionCount
+>
+struct has_contiguous_points
+{
+    typedef typename boost::range_value<Range>::type point_type;
+
+    static const bool value
+        = decltype(is_std_vector(static_cast<Range const*>(0)))::value
+        && traits::contiguous_coordinates
+            <
+                typename util::bare_type<point_type>::type
+            >::value
+        && boost::is_same
+            <
+                typename coordinate_type<point_type>::type,
+                CoordinateType
+            >::value
+        && dimension<point_type>::value == DimensionCount;
+};
+
+// Returns the first coordinate of the first point of a non-empty range for
+// which has_contiguous_points is true
+template <typename CoordinateType, typename Range>
+inline CoordinateType const* coordinates_begin(Range const& range)
+{
+    return reinterpret_cast<CoordinateType const*>
+        (
+            boost::addressof(*boost::begin(range))
+        );
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_CORE_CONTIGUOUS_COORDINATES_HPP
@@ -0,0 +1,247 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOARROW_ARRAYS_HPP
+#define BOOST_GEOMETRY_IO_GEOARROW_ARRAYS_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/extensions/gis/io/geoarrow/coordinates.hpp>
+#include <boost/geometry/extensions/gis/io/geoarrow/detail/index_range.hpp>
+#include <boost/geometry/extensions/gis/io/geoarrow/geometries.hpp>
+
+namespace boost { namespace geometry
+{
+
+namespace geoarrow
+{
+
+// The arrays are random access ranges of the geometries stored in the
+// buffers of GeoArrow arrays. The buffers are not copied, they have to be
+// valid as long as the arrays and the geometries are used. The offsets of
+// the geometries, of the parts and of the rings have size + 1 elements, the
+// i-th element is stored between offsets[i] and offsets[i+1] of the next
+// level. Null geometries are not handled, they are empty.
+
+/*!
+\brief Array of the points of the coordinates
+*/
+template <typename Coordinates>
+class point_array
+    : public detail::geoarrow::index_range<Coordinates>
+{
+public:
+    point_array()
+    {}
+
+    explicit point_array(Coordinates const& coordinates)
+        : detail::geoarrow::index_range<Coordinates>(coordinates, 0, coordinates.size())
+    {}
+};
+
+/*!
+\brief Array of linestrings, geometry_offsets index the points
+*/
+template <typename Coordinates, typename Offset = boost::int32_t>
+class linestring_array
+    : public detail::geoarrow::index_range
+        <
+            detail::geoarrow::offsets_generator
+                <
+                    linestring_view<Coordinates>, Coordinates, Offset
+                >
+        >
+{
+    typedef detail::geoarrow::offsets_generator
+        <
+            linestring_view<Coordinates>, Coordinates, Offset
+        > generator_type;
+
+public:
+    linestring_array()
+    {}
+
+    linestring_array(Coordinates const& coordinates,
+                     Offset const* geometry_offsets, std::size_t size)
+        : detail::geoarrow::index_range<generator_type>(
+            generator_type(coordinates, geometry_offsets), 0, size)
+    {}
+};
+
+/*!
+\brief Array of multi-points, geometry_offsets index the points
+*/
+template <typename Coordinates, typename Offset = boost::int32_t>
+class multi_point_array
+    : public detail::geoarrow::index_range
+        <
+            detail::geoarrow::offsets_generator
+                <
+                    multi_point_view<Coordinates>, Coordinates, Offset
+                >
+        >
+{
+    typedef detail::geoarrow::offsets_generator
+        <
+            multi_point_view<Coordinates>, Coordinates, Offset
+        > generator_type;
+
+public:
+    multi_point_array()
+    {}
+
+    multi_point_array(Coordinates const& coordinates,
+                      Offset const* geometry_offsets, std::size_t size)
+        : detail::geoarrow::index_range<generator_type>(
+            generator_type(coordinates, geometry_offsets), 0, size)
+    {}
+};
+
+/*!
+\brief Array of polygons, geometry_offsets index the rings and ring_offsets
+    index the points
+*/
+template
+<
+    typename Coordinates,
+    typename Offset = boost::int32_t,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class polygon_array
+    : public detail::geoarrow::index_range
+        <
+            detail::geoarrow::offsets_generator
+                <
+                    polygon_view<Coordinates, Offset, ClockWise, Closed>,
+                    typename polygon_view<Coordinates, Offset, ClockWise, Closed>::rings_generator,
+                    Offset
+                >
+        >
+{
+    typedef polygon_view<Coordinates, Offset, ClockWise, Closed> polygon_type;
+    typedef typename polygon_type::rings_generator rings_generator;
+    typedef detail::geoarrow::offsets_generator
+        <
+            polygon_type, rings_generator, Offset
+        > generator_type;
+
+public:
+    polygon_array()
+    {}
+
+    polygon_array(Coordinates const& coordinates,
+                  Offset const* geometry_offsets, Offset const* ring_offsets,
+                  std::size_t size)
+        : detail::geoarrow::index_range<generator_type>(
+            generator_type(rings_generator(coordinates, ring_offsets), geometry_offsets),
+            0, size)
+    {}
+};
+
+/*!
+\brief Array of multi-linestrings, geometry_offsets index the linestrings
+    and part_offsets index the points
+*/
+template <typename Coordinates, typename Offset = boost::int32_t>
+class multi_linestring_array
+    : public detail::geoarrow::index_range
+        <
+            detail::geoarrow::offsets_generator
+                <
+                    multi_linestring_view<Coordinates, Offset>,
+                    detail::geoarrow::offsets_generator
+                        <
+                            linestring_view<Coordinates>, Coordinates, Offset
+                        >,
+                    Offset
+                >
+        >
+{
+    typedef detail::geoarrow::offsets_generator
+        <
+            linestring_view<Coordinates>, Coordinates, Offset
+        > parts_generator;
+    typedef detail::geoarrow::offsets_generator
+        <
+            multi_linestring_view<Coordinates, Offset>, parts_generator, Offset
+        > generator_type;
+
+public:
+    multi_linestring_array()
+    {}
+
+    multi_linestring_array(Coordinates const& coordinates,
+                           Offset const* geometry_offsets, Offset const* part_offsets,
+                           std::size_t size)
+        : detail::geoarrow::index_range<generator_type>(
+            generator_type(parts_generator(coordinates, part_offsets), geometry_offsets),
+            0, size)
+    {}
+};
+
+/*!
+\brief Array of multi-polygons, geometry_offsets index the polygons,
+    part_offsets index the rings and ring_offsets index the points
+*/
+template
+<
+    typename Coordinates,
+    typename Offset = boost::int32_t,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class multi_polygon_array
+    : public detail::geoarrow::index_range
+        <
+            detail::geoarrow::offsets_generator
+                <
+                    multi_polygon_view<Coordinates, Offset, ClockWise, Closed>,
+                    detail::geoarrow::offsets_generator
+                        <
+                            polygon_view<Coordinates, Offset, ClockWise, Closed>,
+                            typename polygon_view<Coordinates, Offset, ClockWise, Closed>::rings_generator,
+                            Offset
+                        >,
+                    Offset
+                >
+        >
+{
+    typedef polygon_view<Coordinates, Offset, ClockWise, Closed> polygon_type;
+    typedef typename polygon_type::rings_generator rings_generator;
+    typedef detail::geoarrow::offsets_generator
+        <
+            polygon_type, rings_generator, Offset
+        > parts_generator;
+    typedef detail::geoarrow::offsets_generator
+        <
+            multi_polygon_view<Coordinates, Offset, ClockWise, Closed>,
+            parts_generator,
+            Offset
+        > generator_type;
+
+public:
+    multi_polygon_array()
+    {}
+
+    multi_polygon_array(Coordinates const& coordinates,
+                        Offset const* geometry_offsets, Offset const* part_offsets,
+                        Offset const* ring_offsets, std::size_t size)
+        : detail::geoarrow::index_range<generator_type>(
+            generator_type(
+                parts_generator(rings_generator(coordinates, ring_offsets), part_offsets),
+                geometry_offsets),
+            0, size)
+    {}
+};
+
+} // namespace geoarrow
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_GEOARROW_ARRAYS_HPP
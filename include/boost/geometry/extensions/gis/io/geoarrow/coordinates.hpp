@@ -0,0 +1,190 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOARROW_COORDINATES_HPP
+#define BOOST_GEOMETRY_IO_GEOARROW_COORDINATES_HPP
+
+#include <cstddef>
+
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geoarrow
+{
+
+template
+<
+    typename Point,
+    std::size_t I = 0,
+    std::size_t N = geometry::dimension<Point>::value
+>
+struct assign_coordinates
+{
+    template <typename CoordinateType>
+    static inline void apply(Point & point, CoordinateType const* const* arrays,
+                             std::size_t index)
+    {
+        geometry::set<I>(point, arrays[I][index]);
+        assign_coordinates<Point, I + 1, N>::apply(point, arrays, index);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct assign_coordinates<Point, N, N>
+{
+    template <typename CoordinateType>
+    static inline void apply(Point & , CoordinateType const* const* , std::size_t )
+    {}
+};
+
+}} // namespace detail::geoarrow
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace geoarrow
+{
+
+/*!
+\brief Coordinates stored in one buffer, the coordinates of a point one
+    after another (xyxy...), like the interleaved GeoArrow encoding
+\details The buffer is not copied and has to be valid as long as the
+    coordinates and the geometries created from them are used. The buffer
+    is accessed as an array of points so the geometries return references
+    to their points and all algorithms can be used.
+\tparam Point Type of the points, its dimension defines the number of
+    coordinates per point and its size has to be the size of these
+    coordinates, e.g. model::point
+*/
+template <typename Point>
+class interleaved_coordinates
+{
+public:
+    typedef Point value_type;
+    typedef Point const& reference;
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    BOOST_STATIC_ASSERT((sizeof(Point)
+        == geometry::dimension<Point>::value * sizeof(coordinate_type)));
+
+    interleaved_coordinates()
+        : m_points(0)
+        , m_size(0)
+    {}
+
+    //! Creates from the buffer of coordinates of size points
+    interleaved_coordinates(coordinate_type const* values, std::size_t size)
+        : m_points(reinterpret_cast<Point const*>(values))
+        , m_size(size)
+    {}
+
+    inline Point const& operator()(std::size_t i) const
+    {
+        return m_points[i];
+    }
+
+    //! Number of points
+    inline std::size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    Point const* m_points;
+    std::size_t m_size;
+};
+
+/*!
+\brief Coordinates stored in one buffer per dimension (xx..., yy...), like
+    the separated GeoArrow encoding
+\details The buffers are not copied and have to be valid as long as the
+    coordinates and the geometries created from them are used. The points
+    are created when accessed. The algorithms keeping references to the
+    points, the set operations and the relational operations of linear and
+    areal geometries, e.g. intersects() of two polygons, require
+    interleaved_coordinates.
+\tparam Point Type of the points created, its dimension defines the number
+    of buffers
+*/
+template <typename Point>
+class separated_coordinates
+{
+    static const std::size_t dimension = geometry::dimension<Point>::value;
+
+public:
+    typedef Point value_type;
+    typedef Point reference;
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    separated_coordinates()
+        : m_size(0)
+    {
+        for (std::size_t i = 0 ; i < dimension ; ++i)
+        {
+            m_arrays[i] = 0;
+        }
+    }
+
+    //! Creates from an array of pointers to the buffers of size coordinates
+    separated_coordinates(coordinate_type const* const* arrays, std::size_t size)
+        : m_size(size)
+    {
+        for (std::size_t i = 0 ; i < dimension ; ++i)
+        {
+            m_arrays[i] = arrays[i];
+        }
+    }
+
+    //! Creates from the buffers of x and y coordinates of size points
+    separated_coordinates(coordinate_type const* x, coordinate_type const* y,
+                          std::size_t size)
+        : m_size(size)
+    {
+        BOOST_STATIC_ASSERT(dimension == 2);
+        m_arrays[0] = x;
+        m_arrays[1] = y;
+    }
+
+    //! Creates from the buffers of x, y and z coordinates of size points
+    separated_coordinates(coordinate_type const* x, coordinate_type const* y,
+                          coordinate_type const* z, std::size_t size)
+        : m_size(size)
+    {
+        BOOST_STATIC_ASSERT(dimension == 3);
+        m_arrays[0] = x;
+        m_arrays[1] = y;
+        m_arrays[2] = z;
+    }
+
+    inline Point operator()(std::size_t i) const
+    {
+        Point point;
+        detail::geoarrow::assign_coordinates<Point>::apply(point, m_arrays, i);
+        return point;
+    }
+
+    //! Number of points
+    inline std::size_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    coordinate_type const* m_arrays[dimension];
+    std::size_t m_size;
+};
+
+} // namespace geoarrow
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_GEOARROW_COORDINATES_HPP
@@ -0,0 +1,182 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOARROW_DETAIL_INDEX_RANGE_HPP
+#define BOOST_GEOMETRY_IO_GEOARROW_DETAIL_INDEX_RANGE_HPP
+
+#include <cstddef>
+
+#include <boost/iterator/iterator_facade.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geoarrow
+{
+
+/*!
+\brief Iterator over indexes, returning the values created by the generator
+    for the indexes when dereferenced, or references if the generator
+    returns references
+*/
+template <typename Generator>
+class index_iterator
+    : public boost::iterator_facade
+        <
+            index_iterator<Generator>,
+            typename Generator::value_type const,
+            boost::random_access_traversal_tag,
+            typename Generator::reference
+        >
+{
+public:
+    index_iterator()
+        : m_index(0)
+    {}
+
+    index_iterator(Generator const& generator, std::size_t index)
+        : m_generator(generator)
+        , m_index(index)
+    {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline typename Generator::reference dereference() const
+    {
+        return m_generator(m_index);
+    }
+
+    inline bool equal(index_iterator const& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    inline void increment()
+    {
+        ++m_index;
+    }
+
+    inline void decrement()
+    {
+        --m_index;
+    }
+
+    inline void advance(std::ptrdiff_t n)
+    {
+        m_index += n;
+    }
+
+    inline std::ptrdiff_t distance_to(index_iterator const& other) const
+    {
+        return std::ptrdiff_t(other.m_index) - std::ptrdiff_t(m_index);
+    }
+
+    Generator m_generator;
+    std::size_t m_index;
+};
+
+/*!
+\brief Read-only random access range of the values created by the generator
+    for the indexes in [first, last)
+*/
+template <typename Generator>
+class index_range
+{
+public:
+    typedef typename Generator::value_type value_type;
+    typedef typename Generator::reference reference;
+    typedef typename Generator::reference const_reference;
+    typedef index_iterator<Generator> const_iterator;
+    typedef const_iterator iterator;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    index_range()
+        : m_first(0)
+        , m_last(0)
+    {}
+
+    index_range(Generator const& generator, std::size_t first, std::size_t last)
+        : m_generator(generator)
+        , m_first(first)
+        , m_last(last)
+    {}
+
+    inline const_iterator begin() const
+    {
+        return const_iterator(m_generator, m_first);
+    }
+
+    inline const_iterator end() const
+    {
+        return const_iterator(m_generator, m_last);
+    }
+
+    inline std::size_t size() const
+    {
+        return m_last - m_first;
+    }
+
+    inline bool empty() const
+    {
+        return m_last == m_first;
+    }
+
+    inline reference operator[](std::size_t i) const
+    {
+        return m_generator(m_first + i);
+    }
+
+    inline Generator const& generator() const
+    {
+        return m_generator;
+    }
+
+private:
+    Generator m_generator;
+    std::size_t m_first;
+    std::size_t m_last;
+};
+
+/*!
+\brief Generator of the elements stored between consecutive offsets, the
+    element i is created from the values of the inner generator between
+    offsets[i] and offsets[i+1]
+*/
+template <typename Element, typename InnerGenerator, typename Offset>
+class offsets_generator
+{
+public:
+    typedef Element value_type;
+    typedef Element reference;
+
+    offsets_generator()
+        : m_offsets(0)
+    {}
+
+    offsets_generator(InnerGenerator const& inner, Offset const* offsets)
+        : m_inner(inner)
+        , m_offsets(offsets)
+    {}
+
+    inline Element operator()(std::size_t i) const
+    {
+        return Element(m_inner, std::size_t(m_offsets[i]), std::size_t(m_offsets[i + 1]));
+    }
+
+private:
+    InnerGenerator m_inner;
+    Offset const* m_offsets;
+};
+
+}} // namespace detail::geoarrow
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_GEOARROW_DETAIL_INDEX_RANGE_HPP
@@ -0,0 +1,331 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_GEOARROW_GEOMETRIES_HPP
+#define BOOST_GEOMETRY_IO_GEOARROW_GEOMETRIES_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/geoarrow/coordinates.hpp>
+#include <boost/geometry/extensions/gis/io/geoarrow/detail/index_range.hpp>
+
+namespace boost { namespace geometry
+{
+
+namespace geoarrow
+{
+
+// The geometries are read-only views of the coordinates and the offsets,
+// they are small and created when accessed, e.g. the rings of a polygon
+// are created when the polygon is iterated.
+
+/*!
+\brief Linestring consisting of the points [first, last) of the coordinates
+\tparam Coordinates interleaved_coordinates or separated_coordinates
+*/
+template <typename Coordinates>
+class linestring_view
+    : public detail::geoarrow::index_range<Coordinates>
+{
+public:
+    linestring_view()
+    {}
+
+    linestring_view(Coordinates const& coordinates, std::size_t first, std::size_t last)
+        : detail::geoarrow::index_range<Coordinates>(coordinates, first, last)
+    {}
+};
+
+/*!
+\brief Ring consisting of the points [first, last) of the coordinates
+\tparam Coordinates interleaved_coordinates or separated_coordinates
+*/
+template
+<
+    typename Coordinates,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class ring_view
+    : public detail::geoarrow::index_range<Coordinates>
+{
+public:
+    ring_view()
+    {}
+
+    ring_view(Coordinates const& coordinates, std::size_t first, std::size_t last)
+        : detail::geoarrow::index_range<Coordinates>(coordinates, first, last)
+    {}
+};
+
+/*!
+\brief Multi-point consisting of the points [first, last) of the coordinates
+\tparam Coordinates interleaved_coordinates or separated_coordinates
+*/
+template <typename Coordinates>
+class multi_point_view
+    : public detail::geoarrow::index_range<Coordinates>
+{
+public:
+    multi_point_view()
+    {}
+
+    multi_point_view(Coordinates const& coordinates, std::size_t first, std::size_t last)
+        : detail::geoarrow::index_range<Coordinates>(coordinates, first, last)
+    {}
+};
+
+/*!
+\brief Polygon consisting of the rings [first, last), the ring i consists
+    of the points between ring_offsets[i] and ring_offsets[i+1]
+\tparam Coordinates interleaved_coordinates or separated_coordinates
+\tparam Offset Type of the offsets, boost::int32_t or boost::int64_t in Arrow
+*/
+template
+<
+    typename Coordinates,
+    typename Offset = boost::int32_t,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class polygon_view
+{
+public:
+    typedef ring_view<Coordinates, ClockWise, Closed> ring_type;
+    typedef detail::geoarrow::offsets_generator
+        <
+            ring_type, Coordinates, Offset
+        > rings_generator;
+    typedef detail::geoarrow::index_range<rings_generator> rings_type;
+
+    polygon_view()
+        : m_first(0)
+        , m_last(0)
+    {}
+
+    polygon_view(rings_generator const& rings, std::size_t first, std::size_t last)
+        : m_rings(rings)
+        , m_first(first)
+        , m_last(last)
+    {}
+
+    //! Returns the exterior ring, empty if the polygon has no rings
+    inline ring_type outer() const
+    {
+        return m_first == m_last ? ring_type() : m_rings(m_first);
+    }
+
+    inline rings_type inners() const
+    {
+        return rings_type(m_rings, m_first == m_last ? m_last : m_first + 1, m_last);
+    }
+
+private:
+    rings_generator m_rings;
+    std::size_t m_first;
+    std::size_t m_last;
+};
+
+/*!
+\brief Multi-linestring consisting of the linestrings [first, last), the
+    linestring i consists of the points between offsets[i] and offsets[i+1]
+\tparam Coordinates interleaved_coordinates or separated_coordinates
+\tparam Offset Type of the offsets, boost::int32_t or boost::int64_t in Arrow
+*/
+template <typename Coordinates, typename Offset = boost::int32_t>
+class multi_linestring_view
+    : public detail::geoarrow::index_range
+        <
+            detail::geoarrow::offsets_generator
+                <
+                    linestring_view<Coordinates>, Coordinates, Offset
+                >
+        >
+{
+    typedef detail::geoarrow::offsets_generator
+        <
+            linestring_view<Coordinates>, Coordinates, Offset
+        > generator_type;
+
+public:
+    multi_linestring_view()
+    {}
+
+    multi_linestring_view(generator_type const& linestrings,
+                          std::size_t first, std::size_t last)
+        : detail::geoarrow::index_range<generator_type>(linestrings, first, last)
+    {}
+};
+
+/*!
+\brief Multi-polygon consisting of the polygons [first, last), the polygon
+    i consists of the rings between offsets[i] and offsets[i+1]
+\tparam Coordinates interleaved_coordinates or separated_coordinates
+\tparam Offset Type of the offsets, boost::int32_t or boost::int64_t in Arrow
+*/
+template
+<
+    typename Coordinates,
+    typename Offset = boost::int32_t,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class multi_polygon_view
+    : public detail::geoarrow::index_range
+        <
+            detail::geoarrow::offsets_generator
+                <
+                    polygon_view<Coordinates, Offset, ClockWise, Closed>,
+                    typename polygon_view<Coordinates, Offset, ClockWise, Closed>::rings_generator,
+                    Offset
+                >
+        >
+{
+    typedef polygon_view<Coordinates, Offset, ClockWise, Closed> polygon_type;
+    typedef detail::geoarrow::offsets_generator
+        <
+            polygon_type, typename polygon_type::rings_generator, Offset
+        > generator_type;
+
+public:
+    multi_polygon_view()
+    {}
+
+    multi_polygon_view(generator_type const& polygons,
+                       std::size_t first, std::size_t last)
+        : detail::geoarrow::index_range<generator_type>(polygons, first, last)
+    {}
+};
+
+} // namespace geoarrow
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Coordinates>
+struct tag<geoarrow::linestring_view<Coordinates> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename Coordinates, bool ClockWise, bool Closed>
+struct tag<geoarrow::ring_view<Coordinates, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Coordinates, bool Closed>
+struct point_order<geoarrow::ring_view<Coordinates, false, Closed> >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template <typename Coordinates, bool ClockWise>
+struct closure<geoarrow::ring_view<Coordinates, ClockWise, false> >
+{
+    static const closure_selector value = open;
+};
+
+template <typename Coordinates>
+struct tag<geoarrow::multi_point_view<Coordinates> >
+{
+    typedef multi_point_tag type;
+};
+
+template <typename Coordinates, typename Offset, bool ClockWise, bool Closed>
+struct tag<geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Coordinates, typename Offset, bool ClockWise, bool Closed>
+struct ring_const_type<geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> >
+{
+    typedef typename geoarrow::polygon_view
+        <
+            Coordinates, Offset, ClockWise, Closed
+        >::ring_type type;
+};
+
+template <typename Coordinates, typename Offset, bool ClockWise, bool Closed>
+struct ring_mutable_type<geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> >
+{
+    typedef typename geoarrow::polygon_view
+        <
+            Coordinates, Offset, ClockWise, Closed
+        >::ring_type type;
+};
+
+template <typename Coordinates, typename Offset, bool ClockWise, bool Closed>
+struct interior_const_type<geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> >
+{
+    typedef typename geoarrow::polygon_view
+        <
+            Coordinates, Offset, ClockWise, Closed
+        >::rings_type type;
+};
+
+template <typename Coordinates, typename Offset, bool ClockWise, bool Closed>
+struct interior_mutable_type<geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> >
+{
+    typedef typename geoarrow::polygon_view
+        <
+            Coordinates, Offset, ClockWise, Closed
+        >::rings_type type;
+};
+
+template <typename Coordinates, typename Offset, bool ClockWise, bool Closed>
+struct exterior_ring<geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> >
+{
+    typedef geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::ring_type get(polygon_type const& p)
+    {
+        return p.outer();
+    }
+};
+
+template <typename Coordinates, typename Offset, bool ClockWise, bool Closed>
+struct interior_rings<geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> >
+{
+    typedef geoarrow::polygon_view<Coordinates, Offset, ClockWise, Closed> polygon_type;
+
+    static inline typename polygon_type::rings_type get(polygon_type const& p)
+    {
+        return p.inners();
+    }
+};
+
+template <typename Coordinates, typename Offset>
+struct tag<geoarrow::multi_linestring_view<Coordinates, Offset> >
+{
+    typedef multi_linestring_tag type;
+};
+
+template <typename Coordinates, typename Offset, bool ClockWise, bool Closed>
+struct tag<geoarrow::multi_polygon_view<Coordinates, Offset, ClockWise, Closed> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_GEOARROW_GEOMETRIES_HPP
@@ -0,0 +1,106 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_READER_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_READER_HPP
+
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <boost/geometry/extensions/gis/io/shapefile/reader.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace shapefile
+{
+
+// Path of the index file, the case of the extension is preserved
+inline std::string index_path(std::string const& path)
+{
+    std::string result = path;
+    std::size_t const size = result.size();
+    if (size >= 4 && result[size - 4] == '.')
+    {
+        result[size - 1] = result[size - 1] == 'P' ? 'X' : 'x';
+    }
+    else
+    {
+        result += ".shx";
+    }
+    return result;
+}
+
+// Files are mapped before the reader is constructed
+class mapped_files
+{
+protected:
+    explicit mapped_files(std::string const& path)
+        : m_shp_file(path.c_str(), interprocess::read_only)
+        , m_shp_region(m_shp_file, interprocess::read_only)
+    {
+        std::string const shx_path = index_path(path);
+        if (std::ifstream(shx_path.c_str()).good())
+        {
+            interprocess::file_mapping(shx_path.c_str(), interprocess::read_only).swap(m_shx_file);
+            interprocess::mapped_region(m_shx_file, interprocess::read_only).swap(m_shx_region);
+        }
+    }
+
+    inline const char* shp_data() const
+    {
+        return static_cast<const char*>(m_shp_region.get_address());
+    }
+
+    inline const char* shx_data() const
+    {
+        return static_cast<const char*>(m_shx_region.get_address());
+    }
+
+    interprocess::file_mapping m_shp_file;
+    interprocess::mapped_region m_shp_region;
+    interprocess::file_mapping m_shx_file;
+    interprocess::mapped_region m_shx_region;
+};
+
+}} // namespace detail::shapefile
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reader of the records of a shapefile mapped into memory
+\details The .shp file is mapped into memory and read like with
+    shapefile_memory_reader. If the .shx file exists next to it it is
+    mapped too and the records can be accessed directly.
+\note boost::interprocess::interprocess_exception is thrown if the file
+    can not be mapped.
+*/
+class shapefile_mapped_reader
+    : private detail::shapefile::mapped_files
+    , public shapefile_memory_reader
+{
+public:
+    explicit shapefile_mapped_reader(std::string const& path)
+        : detail::shapefile::mapped_files(path)
+        , shapefile_memory_reader(m_shx_region.get_size() > 0
+            ? shapefile_memory_reader(shp_data(), m_shp_region.get_size(),
+                                      shx_data(), m_shx_region.get_size())
+            : shapefile_memory_reader(shp_data(), m_shp_region.get_size()))
+    {}
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_MAPPED_READER_HPP
@@ -628,6 +628,23 @@ struct read_polygon_policy
                 range::push_back(inner_rings, ring);
         }
 
+        add_polygons(outer_rings, inner_rings, polygons, within_strategy);
+
+        if (! is.good())
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Read error"));
+        }
+    }
+
+    // Creates polygons from the exterior rings and assigns interior rings to them
+    template <typename Rings, typename Polygons, typename Strategy>
+    static inline void add_polygons(Rings const& outer_rings,
+                                    Rings const& inner_rings,
+                                    Polygons & polygons,
+                                    Strategy const& within_strategy)
+    {
+        typedef typename boost::range_value<Polygons>::type poly_type;
+
         if (inner_rings.empty()) // no inner rings
         {
             for (size_t i = 0; i < outer_rings.size(); ++i)
@@ -679,11 +696,6 @@ struct read_polygon_policy
             // unexpected, file corrupted, bug or numerical error
             BOOST_THROW_EXCEPTION(read_shapefile_exception("Exterior ring expected"));
         }
-        
-        if (! is.good())
-        {
-            BOOST_THROW_EXCEPTION(read_shapefile_exception("Read error"));
-        }
     }
 
     template <typename Ring, typename Strategy>
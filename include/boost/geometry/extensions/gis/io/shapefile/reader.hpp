@@ -0,0 +1,979 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_READER_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_READER_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/extensions/gis/io/shapefile/read.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace shapefile
+{
+
+static const std::size_t file_header_size = 100;
+static const std::size_t record_header_size = 8;
+
+// The values are read from contiguous buffers instead of the stream
+inline boost::int32_t get_big(const char* p)
+{
+    boost::int32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    boost::endian::big_to_native_inplace(v);
+    return v;
+}
+
+inline boost::int32_t get_little(const char* p)
+{
+    boost::int32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    boost::endian::little_to_native_inplace(v);
+    return v;
+}
+
+// See the note about endianness of double in read.hpp
+inline double get_little_double(const char* p)
+{
+    boost::int64_t i;
+    std::memcpy(&i, p, sizeof(i));
+    boost::endian::little_to_native_inplace(i);
+    double d;
+    std::memcpy(&d, &i, sizeof(d));
+    return d;
+}
+
+// Lengths and offsets are stored as numbers of 16-bit words
+inline std::size_t get_big_size(const char* p)
+{
+    boost::int32_t const words = get_big(p);
+    if (words < 0)
+    {
+        BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid length or offset"));
+    }
+    return 2 * std::size_t(words);
+}
+
+/*!
+\brief Source of a reader reading parts of a file from a stream into
+    a buffer reused for all records
+*/
+template <typename IStream>
+class stream_source
+{
+public:
+    explicit stream_source(IStream & is)
+        : m_is(&is)
+        , m_position(std::size_t(-1))
+    {}
+
+    // Returns a pointer to size bytes at offset or 0 if they are not available
+    inline const char* fetch(std::size_t offset, std::size_t size)
+    {
+        if (offset != m_position)
+        {
+            m_is->clear();
+            m_is->seekg(offset);
+        }
+
+        if (m_buffer.size() < size)
+        {
+            m_buffer.resize(size);
+        }
+
+        m_is->read(m_buffer.data(), size);
+        if (std::size_t(m_is->gcount()) != size)
+        {
+            m_position = std::size_t(-1);
+            return 0;
+        }
+
+        m_position = offset + size;
+        return m_buffer.data();
+    }
+
+private:
+    IStream * m_is;
+    std::vector<char> m_buffer;
+    std::size_t m_position;
+};
+
+/*!
+\brief Source of a reader referring to a file kept in memory,
+    e.g. mapped into memory
+*/
+class memory_source
+{
+public:
+    memory_source(const char* data, std::size_t size)
+        : m_data(data)
+        , m_size(size)
+    {}
+
+    inline const char* fetch(std::size_t offset, std::size_t size) const
+    {
+        return offset <= m_size && size <= m_size - offset
+             ? m_data + offset
+             : 0;
+    }
+
+private:
+    const char* m_data;
+    std::size_t m_size;
+};
+
+
+inline bool is_point_type(boost::int32_t type)
+{
+    return type == shape_type::point
+        || type == shape_type::point_z
+        || type == shape_type::point_m;
+}
+
+inline bool is_multipoint_type(boost::int32_t type)
+{
+    return type == shape_type::multipoint
+        || type == shape_type::multipoint_z
+        || type == shape_type::multipoint_m;
+}
+
+inline bool is_polyline_type(boost::int32_t type)
+{
+    return type == shape_type::polyline
+        || type == shape_type::polyline_z
+        || type == shape_type::polyline_m;
+}
+
+inline bool is_polygon_type(boost::int32_t type)
+{
+    return type == shape_type::polygon
+        || type == shape_type::polygon_z
+        || type == shape_type::polygon_m;
+}
+
+inline void check_size(std::size_t size, std::size_t expected)
+{
+    if (size < expected)
+    {
+        BOOST_THROW_EXCEPTION(read_shapefile_exception("Record too short"));
+    }
+}
+
+inline std::size_t get_count(const char* p, std::size_t size,
+                             std::size_t bytes_per_item)
+{
+    boost::int32_t const count = get_little(p);
+    if (count < 0)
+    {
+        BOOST_THROW_EXCEPTION(read_shapefile_exception("Parts or points number lesser than 0"));
+    }
+    check_size(size / bytes_per_item, std::size_t(count));
+    return std::size_t(count);
+}
+
+/*!
+\brief Content of a non-null record referring to the arrays of
+    the parts, the xy coordinates and optionally the z coordinates
+\details The sizes of the arrays are verified when the record is parsed so
+    the coordinates can be read in tight loops.
+*/
+struct record_shape
+{
+    boost::int32_t type;
+    std::size_t num_parts;
+    std::size_t num_points;
+    const char* parts;
+    const char* points;
+    const char* zs;
+
+    inline std::size_t part_begin(std::size_t i) const
+    {
+        return std::size_t(get_little(parts + 4 * i));
+    }
+
+    inline std::size_t part_end(std::size_t i) const
+    {
+        return i + 1 < num_parts
+             ? std::size_t(get_little(parts + 4 * (i + 1)))
+             : num_points;
+    }
+
+    inline void check_parts() const
+    {
+        std::size_t prev = 0;
+        for (std::size_t i = 0 ; i < num_parts ; ++i)
+        {
+            boost::int32_t const f = get_little(parts + 4 * i);
+            if (f < 0 || std::size_t(f) < prev || std::size_t(f) > num_points)
+            {
+                BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid part number"));
+            }
+            prev = std::size_t(f);
+        }
+    }
+};
+
+inline void parse_shape(const char* data, std::size_t size, record_shape & shape)
+{
+    check_size(size, 4);
+    shape.type = get_little(data);
+    shape.num_parts = 0;
+    shape.num_points = 0;
+    shape.parts = 0;
+    shape.points = 0;
+    shape.zs = 0;
+
+    bool const has_z = shape.type == shape_type::point_z
+                    || shape.type == shape_type::multipoint_z
+                    || shape.type == shape_type::polyline_z
+                    || shape.type == shape_type::polygon_z;
+
+    if (is_point_type(shape.type))
+    {
+        check_size(size, has_z ? 28 : 20);
+        shape.num_points = 1;
+        shape.points = data + 4;
+        shape.zs = has_z ? data + 20 : 0;
+        return;
+    }
+
+    // type, box (4 doubles) and the number of points or parts
+    std::size_t offset = 36;
+    check_size(size, offset + 4);
+
+    if (is_multipoint_type(shape.type))
+    {
+        shape.num_points = get_count(data + offset, size - offset - 4, 16);
+        offset += 4;
+    }
+    else if (is_polyline_type(shape.type) || is_polygon_type(shape.type))
+    {
+        check_size(size, offset + 8);
+        shape.num_parts = get_count(data + offset, size - offset - 8, 4);
+        shape.num_points = get_count(data + offset + 4, size - offset - 8, 16);
+        offset += 8;
+        check_size(size, offset + 4 * shape.num_parts + 16 * shape.num_points);
+        shape.parts = data + offset;
+        offset += 4 * shape.num_parts;
+        shape.check_parts();
+    }
+    else
+    {
+        BOOST_THROW_EXCEPTION(read_shapefile_exception("Unsupported shape type"));
+    }
+
+    shape.points = data + offset;
+    offset += 16 * shape.num_points;
+
+    if (has_z)
+    {
+        // z range and the array of z coordinates
+        offset += 16;
+        check_size(size, offset);
+        check_size((size - offset) / 8, shape.num_points);
+        shape.zs = data + offset;
+    }
+}
+
+
+template
+<
+    typename Point,
+    bool Enable = (geometry::dimension<Point>::value > 2)
+>
+struct set_z
+{
+    static inline void apply(Point & pt, const char* z)
+    {
+        geometry::set<2>(pt, z != 0 ? get_little_double(z) : 0.0);
+    }
+};
+
+template <typename Point>
+struct set_z<Point, false>
+{
+    static inline void apply(Point & , const char* )
+    {}
+};
+
+template <typename Point>
+inline void set_point(Point & pt, const char* xy, const char* z)
+{
+    geometry::set<0>(pt, get_little_double(xy));
+    geometry::set<1>(pt, get_little_double(xy + 8));
+    set_z<Point>::apply(pt, z);
+}
+
+// Sets the points of the range from the arrays of coordinates of
+// the record, the range has to be resized before
+template <typename Range>
+inline void set_points(Range & rng, const char* xy, const char* zs)
+{
+    typedef typename boost::range_iterator<Range>::type iterator_type;
+
+    for (iterator_type it = boost::begin(rng) ; it != boost::end(rng) ; ++it)
+    {
+        set_point(*it, xy, zs);
+        xy += 16;
+        if (zs != 0)
+        {
+            zs += 8;
+        }
+    }
+}
+
+template <typename Range>
+inline void set_part(Range & rng, record_shape const& shape, std::size_t i)
+{
+    std::size_t const f = shape.part_begin(i);
+    std::size_t const l = shape.part_end(i);
+    range::resize(rng, l - f);
+    set_points(rng, shape.points + 16 * f, shape.zs != 0 ? shape.zs + 8 * f : 0);
+}
+
+// Rings are closed and clockwise in shapefiles
+template <typename Ring>
+inline void set_ring(Ring & ring, record_shape const& shape, std::size_t i)
+{
+    static const bool is_ccw = geometry::point_order<Ring>::value == geometry::counterclockwise;
+    static const bool is_open = geometry::closure<Ring>::value == geometry::open;
+
+    std::size_t const f = shape.part_begin(i);
+    std::size_t l = shape.part_end(i);
+    if (is_open && l > f)
+    {
+        --l;
+    }
+
+    range::resize(ring, l - f);
+    set_points(ring, shape.points + 16 * f, shape.zs != 0 ? shape.zs + 8 * f : 0);
+
+    // if ring is ccw reverse leaving the first point untouched
+    if (is_ccw && boost::size(ring) > 2)
+    {
+        typename boost::range_iterator<Ring>::type
+            b = boost::begin(ring),
+            e = boost::end(ring);
+        std::reverse(++b, is_open ? e : (--e));
+    }
+}
+
+template <typename Polygons, typename Strategy>
+inline void set_polygons(Polygons & polygons, record_shape const& shape,
+                         Strategy const& strategy)
+{
+    typedef typename boost::range_value<Polygons>::type poly_type;
+    typedef typename geometry::ring_type<poly_type>::type ring_type;
+
+    typename Strategy::point_order_strategy_type
+        order_strategy = strategy.get_point_order_strategy();
+    typename Strategy::template point_in_geometry_strategy<ring_type, ring_type>::type
+        within_strategy = strategy.template get_point_in_geometry_strategy<ring_type, ring_type>();
+
+    std::vector<ring_type> outer_rings;
+    std::vector<ring_type> inner_rings;
+
+    for (std::size_t i = 0 ; i < shape.num_parts ; ++i)
+    {
+        ring_type ring;
+        set_ring(ring, shape, i);
+
+        // assume outer ring
+        if (shape.num_parts == 1
+            || read_polygon_policy::is_outer_ring(ring, order_strategy))
+        {
+            range::push_back(outer_rings, ring);
+        }
+        else
+        {
+            range::push_back(inner_rings, ring);
+        }
+    }
+
+    read_polygon_policy::add_polygons(outer_rings, inner_rings, polygons, within_strategy);
+}
+
+inline void check_shape_type(bool compatible)
+{
+    if (! compatible)
+    {
+        BOOST_THROW_EXCEPTION(read_shapefile_exception("Shape type not compatible with geometry type"));
+    }
+}
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct set_geometry
+    : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct set_geometry<Point, point_tag>
+{
+    template <typename Strategy>
+    static inline void apply(Point & point, record_shape const& shape, Strategy const&)
+    {
+        check_shape_type(is_point_type(shape.type));
+        set_point(point, shape.points, shape.zs);
+    }
+};
+
+template <typename MultiPoint>
+struct set_geometry<MultiPoint, multi_point_tag>
+{
+    template <typename Strategy>
+    static inline void apply(MultiPoint & multi_point, record_shape const& shape, Strategy const&)
+    {
+        check_shape_type(is_point_type(shape.type) || is_multipoint_type(shape.type));
+        range::resize(multi_point, shape.num_points);
+        set_points(multi_point, shape.points, shape.zs);
+    }
+};
+
+template <typename Linestring>
+struct set_geometry<Linestring, linestring_tag>
+{
+    template <typename Strategy>
+    static inline void apply(Linestring & linestring, record_shape const& shape, Strategy const&)
+    {
+        check_shape_type(is_polyline_type(shape.type));
+        if (shape.num_parts > 1)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Linestring expected, record has more than one part"));
+        }
+
+        if (shape.num_parts == 0)
+        {
+            range::clear(linestring);
+        }
+        else
+        {
+            set_part(linestring, shape, 0);
+        }
+    }
+};
+
+template <typename MultiLinestring>
+struct set_geometry<MultiLinestring, multi_linestring_tag>
+{
+    template <typename Strategy>
+    static inline void apply(MultiLinestring & multi_linestring, record_shape const& shape, Strategy const&)
+    {
+        check_shape_type(is_polyline_type(shape.type));
+        // the linestrings already stored are reused
+        range::resize(multi_linestring, shape.num_parts);
+        for (std::size_t i = 0 ; i < shape.num_parts ; ++i)
+        {
+            set_part(range::at(multi_linestring, i), shape, i);
+        }
+    }
+};
+
+template <typename Polygon>
+struct set_geometry<Polygon, polygon_tag>
+{
+    template <typename Strategy>
+    static inline void apply(Polygon & polygon, record_shape const& shape, Strategy const& strategy)
+    {
+        check_shape_type(is_polygon_type(shape.type));
+
+        geometry::clear(polygon);
+        if (shape.num_parts == 0)
+        {
+            return;
+        }
+
+        if (shape.num_parts == 1)
+        {
+            typename ring_return_type<Polygon>::type
+                exterior = geometry::exterior_ring(polygon);
+            set_ring(exterior, shape, 0);
+            return;
+        }
+
+        std::vector<Polygon> polygons;
+        set_polygons(polygons, shape, strategy);
+        if (polygons.size() > 1)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Polygon expected, record has more than one exterior ring"));
+        }
+        polygon = std::move(polygons.front());
+    }
+};
+
+template <typename MultiPolygon>
+struct set_geometry<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Strategy>
+    static inline void apply(MultiPolygon & multi_polygon, record_shape const& shape, Strategy const& strategy)
+    {
+        check_shape_type(is_polygon_type(shape.type));
+        range::clear(multi_polygon);
+        set_polygons(multi_polygon, shape, strategy);
+    }
+};
+
+
+/*!
+\brief Implementation of the shapefile readers, reading records from
+    a Source one at a time
+*/
+template <typename Source>
+class basic_reader
+{
+public:
+    //! Type of the shapes stored in the file, see shape_type
+    inline boost::int32_t shape_type() const
+    {
+        return m_type;
+    }
+
+    //! Sets the box to the bounding box stored in the header of the file
+    template <typename Box>
+    inline void envelope(Box & box) const
+    {
+        geometry::set<min_corner, 0>(box, m_bounds[0]);
+        geometry::set<min_corner, 1>(box, m_bounds[1]);
+        geometry::set<max_corner, 0>(box, m_bounds[2]);
+        geometry::set<max_corner, 1>(box, m_bounds[3]);
+    }
+
+    //! True if the offsets of the records are known, loaded from the index
+    //! file or gathered by size() or seek()
+    inline bool has_index() const
+    {
+        return m_indexed;
+    }
+
+    //! Number of records, if there is no index the records headers are read
+    inline std::size_t size()
+    {
+        build_index();
+        return m_offsets.size();
+    }
+
+    //! Index of the record read recently
+    inline std::size_t record_index() const
+    {
+        return m_record_index;
+    }
+
+    /*!
+    \brief Sets the box used by next() to skip the records without
+        decoding their points
+    \details The records are skipped if their bounding boxes, stored with
+        the records, are disjoint with the box. The coordinates are
+        compared as they are stored in the file.
+    */
+    template <typename Box>
+    inline void set_filter(Box const& box)
+    {
+        m_filter[0] = geometry::get<min_corner, 0>(box);
+        m_filter[1] = geometry::get<min_corner, 1>(box);
+        m_filter[2] = geometry::get<max_corner, 0>(box);
+        m_filter[3] = geometry::get<max_corner, 1>(box);
+        m_has_filter = true;
+    }
+
+    inline void reset_filter()
+    {
+        m_has_filter = false;
+    }
+
+    //! The next call of next() reads the record with the given index
+    inline void seek(std::size_t index)
+    {
+        if (index == 0)
+        {
+            m_next_offset = file_header_size;
+        }
+        else
+        {
+            build_index();
+            check_index(index, m_offsets.size() + 1);
+            m_next_offset = index < m_offsets.size()
+                          ? m_offsets[index]
+                          : m_file_size;
+        }
+        m_next_index = index;
+    }
+
+    /*!
+    \brief Reads the next record passing the filter into geometry
+    \details The null shapes are skipped. The containers of the geometry
+        are resized so their memory is reused.
+    \return false if there are no more records
+    */
+    template <typename Geometry>
+    inline bool next(Geometry & geometry)
+    {
+        return next(geometry, typename default_strategy<Geometry>::type());
+    }
+
+    template <typename Geometry, typename Strategy>
+    inline bool next(Geometry & geometry, Strategy const& strategy)
+    {
+        geometry::concepts::check<Geometry>();
+
+        while (m_next_offset + record_header_size <= m_file_size)
+        {
+            const char* header = m_shp.fetch(m_next_offset, record_header_size);
+            if (header == 0)
+            {
+                // the file is shorter than stated in the header
+                m_next_offset = m_file_size;
+                return false;
+            }
+
+            std::size_t const offset = m_next_offset + record_header_size;
+            std::size_t const size = get_big_size(header + 4);
+            std::size_t const index = m_next_index;
+
+            m_next_offset = offset + size;
+            ++m_next_index;
+
+            if (m_has_filter && ! is_in_filter(offset, size))
+            {
+                continue;
+            }
+
+            if (read_content(offset, size, index, geometry, strategy))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*!
+    \brief Reads the record with the given index into geometry, the filter
+        is not used
+    \details If the offsets of the records are not known the headers of
+        the records are read first.
+    \return false if the record is a null shape, in that case the geometry
+        is cleared
+    */
+    template <typename Geometry>
+    inline bool read(std::size_t index, Geometry & geometry)
+    {
+        return read(index, geometry, typename default_strategy<Geometry>::type());
+    }
+
+    template <typename Geometry, typename Strategy>
+    inline bool read(std::size_t index, Geometry & geometry, Strategy const& strategy)
+    {
+        geometry::concepts::check<Geometry>();
+
+        build_index();
+        check_index(index, m_offsets.size());
+
+        const char* header = m_shp.fetch(m_offsets[index], record_header_size);
+        if (header == 0)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Read error"));
+        }
+
+        std::size_t const size = get_big_size(header + 4);
+        return read_content(m_offsets[index] + record_header_size, size,
+                            index, geometry, strategy);
+    }
+
+protected:
+    explicit basic_reader(Source const& shp)
+        : m_shp(shp)
+        , m_indexed(false)
+        , m_has_filter(false)
+        , m_next_offset(file_header_size)
+        , m_next_index(0)
+        , m_record_index(0)
+    {
+        read_header();
+    }
+
+    basic_reader(Source const& shp, Source shx)
+        : m_shp(shp)
+        , m_indexed(false)
+        , m_has_filter(false)
+        , m_next_offset(file_header_size)
+        , m_next_index(0)
+        , m_record_index(0)
+    {
+        read_header();
+        load_index(shx);
+    }
+
+private:
+    template <typename Geometry>
+    struct default_strategy
+        : strategy::io::services::default_strategy
+            <
+                typename cs_tag<Geometry>::type
+            >
+    {};
+
+    inline void read_header()
+    {
+        double_endianness_check();
+
+        const char* header = m_shp.fetch(0, file_header_size);
+        if (header == 0)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Unreadable header"));
+        }
+        if (get_big(header) != 9994)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid header code"));
+        }
+
+        m_file_size = get_big_size(header + 24);
+        m_type = get_little(header + 32);
+        for (std::size_t i = 0 ; i < 4 ; ++i)
+        {
+            m_bounds[i] = get_little_double(header + 36 + 8 * i);
+        }
+    }
+
+    // Index file contains the offsets and the lengths of the records
+    inline void load_index(Source & shx)
+    {
+        const char* header = shx.fetch(0, file_header_size);
+        if (header == 0 || get_big(header) != 9994)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Invalid index header"));
+        }
+
+        std::size_t const size = get_big_size(header + 24);
+        std::size_t const count = size > file_header_size
+                                ? (size - file_header_size) / 8
+                                : 0;
+
+        const char* data = shx.fetch(file_header_size, 8 * count);
+        if (data == 0)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Unreadable index"));
+        }
+
+        m_offsets.resize(count);
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            m_offsets[i] = get_big_size(data + 8 * i);
+        }
+        m_indexed = true;
+    }
+
+    // Without the index file only the headers of the records are read
+    inline void build_index()
+    {
+        if (m_indexed)
+        {
+            return;
+        }
+
+        m_offsets.clear();
+        std::size_t offset = file_header_size;
+        while (offset + record_header_size <= m_file_size)
+        {
+            const char* header = m_shp.fetch(offset, record_header_size);
+            if (header == 0)
+            {
+                break;
+            }
+            m_offsets.push_back(offset);
+            offset += record_header_size + get_big_size(header + 4);
+        }
+        m_indexed = true;
+    }
+
+    static inline void check_index(std::size_t index, std::size_t size)
+    {
+        if (index >= size)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Record index out of range"));
+        }
+    }
+
+    // Only the type and the box of the record are read
+    inline bool is_in_filter(std::size_t offset, std::size_t size)
+    {
+        const char* data = m_shp.fetch(offset, (std::min)(size, std::size_t(36)));
+        if (data == 0)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Read error"));
+        }
+
+        check_size(size, 4);
+        boost::int32_t const type = get_little(data);
+        if (type == shape_type::null_shape)
+        {
+            return false;
+        }
+
+        double box[4];
+        if (is_point_type(type))
+        {
+            check_size(size, 20);
+            box[0] = box[2] = get_little_double(data + 4);
+            box[1] = box[3] = get_little_double(data + 12);
+        }
+        else
+        {
+            check_size(size, 36);
+            for (std::size_t i = 0 ; i < 4 ; ++i)
+            {
+                box[i] = get_little_double(data + 4 + 8 * i);
+            }
+        }
+
+        return box[0] <= m_filter[2] && box[2] >= m_filter[0]
+            && box[1] <= m_filter[3] && box[3] >= m_filter[1];
+    }
+
+    template <typename Geometry, typename Strategy>
+    inline bool read_content(std::size_t offset, std::size_t size, std::size_t index,
+                             Geometry & geometry, Strategy const& strategy)
+    {
+        // the whole content is read at once
+        const char* data = m_shp.fetch(offset, size);
+        if (data == 0)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Read error"));
+        }
+
+        m_record_index = index;
+
+        check_size(size, 4);
+        boost::int32_t const type = get_little(data);
+        if (type == shape_type::null_shape)
+        {
+            geometry::clear(geometry);
+            return false;
+        }
+        if (type != m_type)
+        {
+            BOOST_THROW_EXCEPTION(read_shapefile_exception("Record type different than file type"));
+        }
+
+        record_shape shape;
+        parse_shape(data, size, shape);
+        set_geometry<Geometry>::apply(geometry, shape, strategy);
+        return true;
+    }
+
+    Source m_shp;
+    boost::int32_t m_type;
+    std::size_t m_file_size;
+    double m_bounds[4];
+
+    std::vector<std::size_t> m_offsets;
+    bool m_indexed;
+
+    double m_filter[4];
+    bool m_has_filter;
+
+    std::size_t m_next_offset;
+    std::size_t m_next_index;
+    std::size_t m_record_index;
+};
+
+
+}} // namespace detail::shapefile
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reader of the records of a shapefile from a stream, one at a time
+\details The content of each record is read with one call into a buffer
+    reused for all records. If the stream of the index file (.shx) is
+    passed the records can be accessed directly, otherwise the headers of
+    all records are read the first time an index is needed.
+\note The streams should be opened in binary mode and has to be valid as
+    long as the reader is used.
+*/
+template <typename IStream>
+class shapefile_reader
+    : public detail::shapefile::basic_reader
+        <
+            detail::shapefile::stream_source<IStream>
+        >
+{
+    typedef detail::shapefile::stream_source<IStream> source_type;
+    typedef detail::shapefile::basic_reader<source_type> base_type;
+
+public:
+    explicit shapefile_reader(IStream & shp)
+        : base_type(source_type(shp))
+    {}
+
+    shapefile_reader(IStream & shp, IStream & shx)
+        : base_type(source_type(shp), source_type(shx))
+    {}
+};
+
+/*!
+\brief Reader of the records of a shapefile kept in memory, one at a time
+\details Nothing is copied, the coordinates are read directly from
+    the memory, e.g. from a file mapped into memory. If the content of
+    the index file (.shx) is passed the records can be accessed directly.
+\note The memory has to be valid as long as the reader is used.
+*/
+class shapefile_memory_reader
+    : public detail::shapefile::basic_reader<detail::shapefile::memory_source>
+{
+    typedef detail::shapefile::memory_source source_type;
+    typedef detail::shapefile::basic_reader<source_type> base_type;
+
+public:
+    shapefile_memory_reader(const char* shp, std::size_t shp_size)
+        : base_type(source_type(shp, shp_size))
+    {}
+
+    shapefile_memory_reader(const char* shp, std::size_t shp_size,
+                            const char* shx, std::size_t shx_size)
+        : base_type(source_type(shp, shp_size), source_type(shx, shx_size))
+    {}
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_SHAPEFILE_READER_HPP
@@ -0,0 +1,245 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_TWKB_DETAIL_ENCODING_HPP
+#define BOOST_GEOMETRY_IO_TWKB_DETAIL_ENCODING_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+
+namespace boost { namespace geometry
+{
+
+// Tiny well-known binary (TWKB) is a compact binary representation of
+// geometries. The coordinates are multiplied by 10^precision and rounded to
+// integers, each point is stored as the differences to the previous point
+// of the geometry, zigzag and varint encoded, so small differences take
+// one byte per coordinate.
+//
+// byte   : type (bits 0-3) and zigzag encoded precision of x and y (4-7)
+// byte   : metadata flags, bbox, size, idlist, extended dimensions, empty
+// [byte] : extended dimensions, z (bit 0), m (bit 1), precision of z (2-4)
+//          and of m (5-7)
+// [uvarint] : size in bytes of the rest of the geometry
+// [varint...] : bbox, minimum and delta to the maximum of each dimension
+// body:
+//   point            : varint coordinates
+//   linestring       : uvarint npoints, points
+//   polygon          : uvarint nrings, linestrings
+//   multi-geometries : uvarint ngeometries, [uvarint ids], bodies
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace twkb
+{
+
+struct geometry_type_twkb
+{
+    enum enum_t
+    {
+        point = 1,
+        linestring = 2,
+        polygon = 3,
+        multipoint = 4,
+        multilinestring = 5,
+        multipolygon = 6,
+        geometrycollection = 7
+    };
+};
+
+static const boost::uint8_t bbox_flag = 0x01;
+static const boost::uint8_t size_flag = 0x02;
+static const boost::uint8_t idlist_flag = 0x04;
+static const boost::uint8_t extended_dimensions_flag = 0x08;
+static const boost::uint8_t empty_flag = 0x10;
+
+static const boost::uint8_t z_flag = 0x01;
+static const boost::uint8_t m_flag = 0x02;
+
+static const int min_precision = -7;
+static const int max_precision = 7;
+
+inline boost::uint64_t zigzag_encode(boost::int64_t value)
+{
+    return (boost::uint64_t(value) << 1) ^ boost::uint64_t(value >> 63);
+}
+
+inline boost::int64_t zigzag_decode(boost::uint64_t value)
+{
+    return boost::int64_t(value >> 1) ^ -boost::int64_t(value & 1);
+}
+
+// Difference of quantized values, wrapping around like the sums of the
+// readers, so the difference of any two values is encoded without overflow
+inline boost::int64_t wrapping_difference(boost::int64_t a, boost::int64_t b)
+{
+    return boost::int64_t(boost::uint64_t(a) - boost::uint64_t(b));
+}
+
+template <typename OutputIterator>
+inline OutputIterator write_varint(boost::uint64_t value, OutputIterator out)
+{
+    while (value >= 0x80)
+    {
+        *out++ = boost::uint8_t(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = boost::uint8_t(value);
+    return out;
+}
+
+inline double power_of_ten(int exponent)
+{
+    double result = 1.0;
+    for (int i = 0 ; i < exponent ; ++i)
+    {
+        result *= 10.0;
+    }
+    for (int i = 0 ; i > exponent ; --i)
+    {
+        result /= 10.0;
+    }
+    return result;
+}
+
+// Maximal number of bytes of a varint of 64 bits
+static const std::size_t max_varint_size = 10;
+
+/*!
+\brief Output iterator only counting the bytes written to it
+*/
+class counting_iterator
+{
+public:
+    typedef std::output_iterator_tag iterator_category;
+    typedef void value_type;
+    typedef void difference_type;
+    typedef void pointer;
+    typedef void reference;
+
+    explicit counting_iterator(std::size_t& count)
+        : m_count(&count)
+    {}
+
+    inline counting_iterator& operator*() { return *this; }
+    inline counting_iterator& operator=(boost::uint8_t) { ++*m_count; return *this; }
+    inline counting_iterator& operator++() { return *this; }
+    inline counting_iterator& operator++(int) { return *this; }
+
+private:
+    std::size_t* m_count;
+};
+
+/*!
+\brief Reader of bytes and varints from a contiguous span of bytes,
+    checking the available size
+*/
+class byte_reader
+{
+public:
+    byte_reader(const boost::uint8_t* first, const boost::uint8_t* last)
+        : m_first(first)
+        , m_ptr(first)
+        , m_last(last)
+    {}
+
+    inline std::size_t consumed() const
+    {
+        return std::size_t(m_ptr - m_first);
+    }
+
+    inline std::size_t remaining() const
+    {
+        return std::size_t(m_last - m_ptr);
+    }
+
+    inline bool read(boost::uint8_t & value)
+    {
+        if (m_ptr == m_last)
+        {
+            return false;
+        }
+        value = *m_ptr++;
+        return true;
+    }
+
+    inline bool read_varint(boost::uint64_t & value)
+    {
+        value = 0;
+        for (unsigned shift = 0 ; shift < 64 && m_ptr != m_last ; shift += 7)
+        {
+            boost::uint8_t const byte = *m_ptr++;
+            value |= boost::uint64_t(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Reads a signed varint without checking the size, at least
+    // max_varint_size bytes have to remain
+    inline boost::int64_t read_signed_unchecked()
+    {
+        boost::uint64_t value = 0;
+        unsigned shift = 0;
+        boost::uint8_t byte = 0;
+        do
+        {
+            byte = *m_ptr++;
+            value |= boost::uint64_t(byte & 0x7f) << shift;
+            shift += 7;
+        } while ((byte & 0x80) != 0 && shift < 64);
+        return zigzag_decode(value);
+    }
+
+    inline bool read_signed(boost::int64_t & value)
+    {
+        boost::uint64_t encoded = 0;
+        if (! read_varint(encoded))
+        {
+            return false;
+        }
+        value = zigzag_decode(encoded);
+        return true;
+    }
+
+    // Reads a number of items, each taking at least min_item_size bytes
+    inline bool read_count(std::size_t & count, std::size_t min_item_size)
+    {
+        boost::uint64_t value = 0;
+        if (! read_varint(value) || value > remaining() / min_item_size)
+        {
+            return false;
+        }
+        count = std::size_t(value);
+        return true;
+    }
+
+    inline bool skip(std::size_t size)
+    {
+        if (remaining() < size)
+        {
+            return false;
+        }
+        m_ptr += size;
+        return true;
+    }
+
+private:
+    const boost::uint8_t* m_first;
+    const boost::uint8_t* m_ptr;
+    const boost::uint8_t* m_last;
+};
+
+}} // namespace detail::twkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_TWKB_DETAIL_ENCODING_HPP
@@ -0,0 +1,400 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_TWKB_DETAIL_PARSER_HPP
+#define BOOST_GEOMETRY_IO_TWKB_DETAIL_PARSER_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/detail/encoding.hpp>
+#include <boost/geometry/util/range.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace twkb
+{
+
+/*!
+\brief Header of a geometry, type, precisions, flags and dimensions
+*/
+struct header
+{
+    boost::uint8_t type;
+    boost::uint8_t flags;
+    int precision;
+    int z_precision;
+    bool has_z;
+    bool has_m;
+
+    // Number of coordinates of a point
+    inline std::size_t dimension() const
+    {
+        return 2 + (has_z ? 1 : 0) + (has_m ? 1 : 0);
+    }
+};
+
+inline bool read_header(byte_reader & reader, header & h)
+{
+    boost::uint8_t type_precision = 0;
+    if (! reader.read(type_precision) || ! reader.read(h.flags))
+    {
+        return false;
+    }
+
+    h.type = type_precision & 0x0f;
+    h.precision = int(zigzag_decode(type_precision >> 4));
+    h.z_precision = 0;
+    h.has_z = false;
+    h.has_m = false;
+
+    if (h.flags & extended_dimensions_flag)
+    {
+        boost::uint8_t dimensions = 0;
+        if (! reader.read(dimensions))
+        {
+            return false;
+        }
+        h.has_z = (dimensions & z_flag) != 0;
+        h.has_m = (dimensions & m_flag) != 0;
+        h.z_precision = (dimensions >> 2) & 0x07;
+    }
+    return true;
+}
+
+template
+<
+    typename Point,
+    bool Enable = (geometry::dimension<Point>::value > 2)
+>
+struct set_z
+{
+    static inline void apply(Point & point, double z)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        geometry::set<2>(point, static_cast<coordinate_type>(z));
+    }
+};
+
+template <typename Point>
+struct set_z<Point, false>
+{
+    static inline void apply(Point & , double )
+    {}
+};
+
+/*!
+\brief Decoder of the body of a geometry, the points are stored as the
+    deltas to the previous point of the geometry, M is read and ignored
+*/
+class decoder
+{
+public:
+    decoder(byte_reader & reader, header const& h)
+        : m_reader(reader)
+        , m_xy_scale(power_of_ten(h.precision))
+        , m_z_scale(power_of_ten(h.z_precision))
+        , m_dimension(h.dimension())
+        , m_has_z(h.has_z)
+    {
+        m_previous[0] = m_previous[1] = m_previous[2] = m_previous[3] = 0;
+    }
+
+    inline bool read_count(std::size_t & count, std::size_t min_item_size)
+    {
+        return m_reader.read_count(count, min_item_size);
+    }
+
+    inline bool read_id()
+    {
+        boost::uint64_t id = 0;
+        return m_reader.read_varint(id);
+    }
+
+    template <typename Point>
+    inline bool read_point(Point & point)
+    {
+        for (std::size_t i = 0 ; i < m_dimension ; ++i)
+        {
+            boost::int64_t delta = 0;
+            if (! m_reader.read_signed(delta))
+            {
+                return false;
+            }
+            m_previous[i] += boost::uint64_t(delta);
+        }
+
+        set_point(point);
+        return true;
+    }
+
+    // Decodes the number of points and the points into the resized range,
+    // the closing point of rings is not stored in open rings
+    template <typename Range>
+    inline bool read_points(Range & range, bool open)
+    {
+        std::size_t count = 0;
+        if (! read_count(count, m_dimension))
+        {
+            return false;
+        }
+
+        range::resize(range, count);
+
+        typedef typename boost::range_iterator<Range>::type iterator_type;
+        iterator_type it = boost::begin(range);
+
+        // The points which certainly fit in the remaining bytes are decoded
+        // without checking the size of each varint
+        std::size_t const point_size = m_dimension * max_varint_size;
+        while (it != boost::end(range))
+        {
+            std::size_t const safe = m_reader.remaining() / point_size;
+            if (safe == 0)
+            {
+                break;
+            }
+            for (std::size_t i = 0 ; i < safe && it != boost::end(range) ; ++i, ++it)
+            {
+                for (std::size_t d = 0 ; d < m_dimension ; ++d)
+                {
+                    m_previous[d] += boost::uint64_t(m_reader.read_signed_unchecked());
+                }
+                set_point(*it);
+            }
+        }
+        for ( ; it != boost::end(range) ; ++it)
+        {
+            if (! read_point(*it))
+            {
+                return false;
+            }
+        }
+
+        if (open && count > 1)
+        {
+            range::resize(range, count - 1);
+        }
+        return true;
+    }
+
+private:
+    template <typename Point>
+    inline void set_point(Point & point) const
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        geometry::set<0>(point, static_cast<coordinate_type>(value(0) / m_xy_scale));
+        geometry::set<1>(point, static_cast<coordinate_type>(value(1) / m_xy_scale));
+        set_z<Point>::apply(point, m_has_z ? value(2) / m_z_scale : 0.0);
+    }
+
+    inline double value(std::size_t i) const
+    {
+        return double(boost::int64_t(m_previous[i]));
+    }
+
+    byte_reader & m_reader;
+    double m_xy_scale;
+    double m_z_scale;
+    std::size_t m_dimension;
+    bool m_has_z;
+    // Sums of the deltas, wrapping around like the deltas of the writer so
+    // crafted deltas can not overflow
+    boost::uint64_t m_previous[4];
+};
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct parser
+    : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct parser<Point, point_tag>
+{
+    static const boost::uint8_t type = geometry_type_twkb::point;
+
+    static inline bool clear(Point & )
+    {
+        // Points can not be empty
+        return false;
+    }
+
+    static inline bool apply(decoder & dec, header const& , Point & point)
+    {
+        return dec.read_point(point);
+    }
+};
+
+template <typename Linestring>
+struct parser<Linestring, linestring_tag>
+{
+    static const boost::uint8_t type = geometry_type_twkb::linestring;
+
+    static inline bool clear(Linestring & linestring)
+    {
+        range::clear(linestring);
+        return true;
+    }
+
+    static inline bool apply(decoder & dec, header const& , Linestring & linestring)
+    {
+        return dec.read_points(linestring, false);
+    }
+};
+
+template <typename Polygon>
+struct parser<Polygon, polygon_tag>
+{
+    static const boost::uint8_t type = geometry_type_twkb::polygon;
+
+    typedef typename ring_return_type<Polygon>::type ring_type;
+    typedef typename interior_return_type<Polygon>::type interior_type;
+
+    static const bool open = geometry::closure
+        <
+            typename boost::remove_reference<ring_type>::type
+        >::value == geometry::open;
+
+    static inline bool clear(Polygon & polygon)
+    {
+        range::clear(geometry::exterior_ring(polygon));
+        range::clear(geometry::interior_rings(polygon));
+        return true;
+    }
+
+    static inline bool apply(decoder & dec, header const& , Polygon & polygon)
+    {
+        // each ring has at least the number of points
+        std::size_t num_rings = 0;
+        if (! dec.read_count(num_rings, 1))
+        {
+            return false;
+        }
+
+        interior_type interiors = geometry::interior_rings(polygon);
+        range::resize(interiors, num_rings > 0 ? num_rings - 1 : 0);
+
+        ring_type exterior = geometry::exterior_ring(polygon);
+        if (num_rings == 0)
+        {
+            range::clear(exterior);
+            return true;
+        }
+
+        if (! dec.read_points(exterior, open))
+        {
+            return false;
+        }
+
+        typedef typename boost::range_iterator
+            <
+                typename boost::remove_reference<interior_type>::type
+            >::type iterator_type;
+        for (iterator_type it = boost::begin(interiors) ; it != boost::end(interiors) ; ++it)
+        {
+            if (! dec.read_points(*it, open))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// The elements of the multi-geometries are stored without headers,
+// optionally preceded by their ids which are skipped
+template <typename MultiGeometry, boost::uint8_t Type>
+struct multi_parser
+{
+    static const boost::uint8_t type = Type;
+
+    static inline bool clear(MultiGeometry & multi)
+    {
+        range::clear(multi);
+        return true;
+    }
+
+    static inline bool apply(decoder & dec, header const& h, MultiGeometry & multi)
+    {
+        typedef typename boost::range_value<MultiGeometry>::type element_type;
+        typedef parser<element_type> element_parser;
+
+        std::size_t count = 0;
+        if (! dec.read_count(count, 1))
+        {
+            return false;
+        }
+
+        if (h.flags & idlist_flag)
+        {
+            for (std::size_t i = 0 ; i < count ; ++i)
+            {
+                if (! dec.read_id())
+                {
+                    return false;
+                }
+            }
+        }
+
+        range::resize(multi, count);
+
+        typedef typename boost::range_iterator<MultiGeometry>::type iterator_type;
+        for (iterator_type it = boost::begin(multi) ; it != boost::end(multi) ; ++it)
+        {
+            if (! element_parser::apply(dec, h, *it))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename MultiPoint>
+struct parser<MultiPoint, multi_point_tag>
+    : multi_parser<MultiPoint, geometry_type_twkb::multipoint>
+{};
+
+template <typename MultiLinestring>
+struct parser<MultiLinestring, multi_linestring_tag>
+    : multi_parser<MultiLinestring, geometry_type_twkb::multilinestring>
+{};
+
+template <typename MultiPolygon>
+struct parser<MultiPolygon, multi_polygon_tag>
+    : multi_parser<MultiPolygon, geometry_type_twkb::multipolygon>
+{};
+
+}} // namespace detail::twkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_TWKB_DETAIL_PARSER_HPP
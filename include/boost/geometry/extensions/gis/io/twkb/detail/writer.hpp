@@ -0,0 +1,477 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_TWKB_DETAIL_WRITER_HPP
+#define BOOST_GEOMETRY_IO_TWKB_DETAIL_WRITER_HPP
+
+#include <cmath>
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/detail/encoding.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace twkb
+{
+
+// True if the value multiplied by the scale is finite and its rounded
+// value fits into 64 bits
+inline bool is_quantizable(double value, double scale)
+{
+    // 2^63, NaN fails the comparison
+    return std::fabs(value * scale) < 9223372036854775808.0;
+}
+
+// Rounds half away from zero, like lround, without the range check of
+// math::rounding_cast which is noticeable per coordinate. The values are
+// checked with is_quantizable before.
+inline boost::int64_t quantize(double value, double scale)
+{
+    value *= scale;
+    return boost::int64_t(value < 0.0 ? value - 0.5 : value + 0.5);
+}
+
+template
+<
+    typename Point,
+    bool Enable = (geometry::dimension<Point>::value > 2)
+>
+struct quantize_z
+{
+    static inline bool is_valid(Point const& point, double scale)
+    {
+        return is_quantizable(double(geometry::get<2>(point)), scale);
+    }
+
+    static inline boost::int64_t apply(Point const& point, double scale)
+    {
+        return quantize(double(geometry::get<2>(point)), scale);
+    }
+};
+
+template <typename Point>
+struct quantize_z<Point, false>
+{
+    static inline bool is_valid(Point const& , double )
+    {
+        return true;
+    }
+
+    static inline boost::int64_t apply(Point const& , double )
+    {
+        return 0;
+    }
+};
+
+/*!
+\brief Quantizer of the points, the coordinates multiplied by the scales
+    and rounded, z is quantized if dimension is 3
+*/
+class quantizer
+{
+public:
+    quantizer(double xy_scale, double z_scale, std::size_t dimension)
+        : m_xy_scale(xy_scale)
+        , m_z_scale(z_scale)
+        , m_dimension(dimension)
+    {}
+
+    template <typename Point>
+    inline bool is_valid(Point const& point) const
+    {
+        return is_quantizable(double(geometry::get<0>(point)), m_xy_scale)
+            && is_quantizable(double(geometry::get<1>(point)), m_xy_scale)
+            && (m_dimension <= 2
+                || quantize_z<Point>::is_valid(point, m_z_scale));
+    }
+
+    template <typename Point>
+    inline void apply(Point const& point, boost::int64_t* values) const
+    {
+        values[0] = quantize(double(geometry::get<0>(point)), m_xy_scale);
+        values[1] = quantize(double(geometry::get<1>(point)), m_xy_scale);
+        if (m_dimension > 2)
+        {
+            values[2] = quantize_z<Point>::apply(point, m_z_scale);
+        }
+    }
+
+    inline std::size_t dimension() const
+    {
+        return m_dimension;
+    }
+
+private:
+    double m_xy_scale;
+    double m_z_scale;
+    std::size_t m_dimension;
+};
+
+/*!
+\brief Encoder of the body of a geometry, the points are written as the
+    deltas to the previous point of the geometry
+*/
+template <typename OutputIterator>
+class encoder
+{
+public:
+    encoder(OutputIterator out, quantizer const& q)
+        : m_out(out)
+        , m_quantizer(q)
+    {
+        m_previous[0] = m_previous[1] = m_previous[2] = 0;
+    }
+
+    inline void write_count(std::size_t count)
+    {
+        m_out = write_varint(boost::uint64_t(count), m_out);
+    }
+
+    template <typename Point>
+    inline void write_point(Point const& point)
+    {
+        m_out = encode(point, m_quantizer, m_previous, m_out);
+    }
+
+    // Writes the number of points and the points, open rings are closed
+    template <typename Range>
+    inline void write_points(Range const& range, bool close)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+        close = close && ! boost::empty(range);
+        write_count(boost::size(range) + (close ? 1 : 0));
+
+        // Encoded with local copies, the members could be aliased by the
+        // bytes written
+        OutputIterator out = m_out;
+        quantizer const q = m_quantizer;
+        boost::int64_t previous[3] = { m_previous[0], m_previous[1], m_previous[2] };
+        for (iterator_type it = boost::begin(range) ; it != boost::end(range) ; ++it)
+        {
+            out = encode(*it, q, previous, out);
+        }
+        if (close)
+        {
+            out = encode(*boost::begin(range), q, previous, out);
+        }
+
+        m_out = out;
+        m_previous[0] = previous[0];
+        m_previous[1] = previous[1];
+        m_previous[2] = previous[2];
+    }
+
+    inline OutputIterator out() const
+    {
+        return m_out;
+    }
+
+private:
+    template <typename Point>
+    static inline OutputIterator encode(Point const& point, quantizer const& q,
+                                        boost::int64_t* previous, OutputIterator out)
+    {
+        boost::int64_t values[3];
+        q.apply(point, values);
+        for (std::size_t i = 0 ; i < q.dimension() ; ++i)
+        {
+            out = write_varint(zigzag_encode(
+                    wrapping_difference(values[i], previous[i])), out);
+            previous[i] = values[i];
+        }
+        return out;
+    }
+
+    OutputIterator m_out;
+    quantizer m_quantizer;
+    boost::int64_t m_previous[3];
+};
+
+/*!
+\brief Bounding box of the quantized coordinates, also checking that all
+    coordinates can be quantized
+*/
+class quantized_box
+{
+public:
+    explicit quantized_box(quantizer const& q)
+        : m_quantizer(q)
+        , m_empty(true)
+        , m_valid(true)
+    {}
+
+    template <typename Point>
+    inline void apply(Point const& point)
+    {
+        if (! m_quantizer.is_valid(point))
+        {
+            m_valid = false;
+            return;
+        }
+
+        boost::int64_t values[3];
+        m_quantizer.apply(point, values);
+        for (std::size_t i = 0 ; i < m_quantizer.dimension() ; ++i)
+        {
+            if (m_empty || values[i] < m_min[i])
+            {
+                m_min[i] = values[i];
+            }
+            if (m_empty || values[i] > m_max[i])
+            {
+                m_max[i] = values[i];
+            }
+        }
+        m_empty = false;
+    }
+
+    template <typename Range>
+    inline void apply_range(Range const& range)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+        for (iterator_type it = boost::begin(range) ; it != boost::end(range) ; ++it)
+        {
+            apply(*it);
+        }
+    }
+
+    inline bool is_valid() const
+    {
+        return m_valid;
+    }
+
+    template <typename OutputIterator>
+    inline OutputIterator write(OutputIterator out) const
+    {
+        for (std::size_t i = 0 ; i < m_quantizer.dimension() ; ++i)
+        {
+            out = write_varint(zigzag_encode(m_min[i]), out);
+            out = write_varint(zigzag_encode(
+                    wrapping_difference(m_max[i], m_min[i])), out);
+        }
+        return out;
+    }
+
+private:
+    quantizer m_quantizer;
+    bool m_empty;
+    bool m_valid;
+    boost::int64_t m_min[3];
+    boost::int64_t m_max[3];
+};
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct writer
+    : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct writer<Point, point_tag>
+{
+    static const boost::uint8_t type = geometry_type_twkb::point;
+
+    static inline bool is_empty(Point const& )
+    {
+        return false;
+    }
+
+    template <typename OutputIterator>
+    static inline void apply(encoder<OutputIterator>& enc, Point const& point)
+    {
+        enc.write_point(point);
+    }
+
+    static inline std::size_t max_size(Point const& , std::size_t point_size)
+    {
+        return point_size;
+    }
+
+    static inline void expand(quantized_box& box, Point const& point)
+    {
+        box.apply(point);
+    }
+};
+
+template <typename Linestring>
+struct writer<Linestring, linestring_tag>
+{
+    static const boost::uint8_t type = geometry_type_twkb::linestring;
+
+    static inline bool is_empty(Linestring const& linestring)
+    {
+        return boost::empty(linestring);
+    }
+
+    template <typename OutputIterator>
+    static inline void apply(encoder<OutputIterator>& enc, Linestring const& linestring)
+    {
+        enc.write_points(linestring, false);
+    }
+
+    static inline std::size_t max_size(Linestring const& linestring, std::size_t point_size)
+    {
+        return max_varint_size + boost::size(linestring) * point_size;
+    }
+
+    static inline void expand(quantized_box& box, Linestring const& linestring)
+    {
+        box.apply_range(linestring);
+    }
+};
+
+template <typename Polygon>
+struct writer<Polygon, polygon_tag>
+{
+    static const boost::uint8_t type = geometry_type_twkb::polygon;
+
+    typedef typename ring_type<Polygon>::type ring_type;
+    typedef typename interior_type<Polygon>::type interiors_type;
+    typedef typename boost::range_iterator<interiors_type const>::type iterator_type;
+
+    static const bool close = geometry::closure<ring_type>::value == open;
+
+    template <typename Ring>
+    static inline std::size_t max_ring_size(Ring const& ring, std::size_t point_size)
+    {
+        return max_varint_size + (boost::size(ring) + (close ? 1 : 0)) * point_size;
+    }
+
+    static inline bool is_empty(Polygon const& polygon)
+    {
+        return boost::empty(geometry::exterior_ring(polygon))
+            && boost::empty(geometry::interior_rings(polygon));
+    }
+
+    template <typename OutputIterator>
+    static inline void apply(encoder<OutputIterator>& enc, Polygon const& polygon)
+    {
+        if (is_empty(polygon))
+        {
+            enc.write_count(0);
+            return;
+        }
+
+        interiors_type const& interiors = geometry::interior_rings(polygon);
+        enc.write_count(1 + boost::size(interiors));
+        enc.write_points(geometry::exterior_ring(polygon), close);
+        for (iterator_type it = boost::begin(interiors) ; it != boost::end(interiors) ; ++it)
+        {
+            enc.write_points(*it, close);
+        }
+    }
+
+    static inline std::size_t max_size(Polygon const& polygon, std::size_t point_size)
+    {
+        interiors_type const& interiors = geometry::interior_rings(polygon);
+        std::size_t result = max_varint_size
+            + max_ring_size(geometry::exterior_ring(polygon), point_size);
+        for (iterator_type it = boost::begin(interiors) ; it != boost::end(interiors) ; ++it)
+        {
+            result += max_ring_size(*it, point_size);
+        }
+        return result;
+    }
+
+    static inline void expand(quantized_box& box, Polygon const& polygon)
+    {
+        interiors_type const& interiors = geometry::interior_rings(polygon);
+        box.apply_range(geometry::exterior_ring(polygon));
+        for (iterator_type it = boost::begin(interiors) ; it != boost::end(interiors) ; ++it)
+        {
+            box.apply_range(*it);
+        }
+    }
+};
+
+// The elements of the multi-geometries are stored without headers
+template <typename MultiGeometry, boost::uint8_t Type>
+struct multi_writer
+{
+    static const boost::uint8_t type = Type;
+
+    typedef writer<typename boost::range_value<MultiGeometry>::type> element_writer;
+    typedef typename boost::range_iterator<MultiGeometry const>::type iterator_type;
+
+    static inline bool is_empty(MultiGeometry const& multi)
+    {
+        return boost::empty(multi);
+    }
+
+    template <typename OutputIterator>
+    static inline void apply(encoder<OutputIterator>& enc, MultiGeometry const& multi)
+    {
+        enc.write_count(boost::size(multi));
+        for (iterator_type it = boost::begin(multi) ; it != boost::end(multi) ; ++it)
+        {
+            element_writer::apply(enc, *it);
+        }
+    }
+
+    static inline std::size_t max_size(MultiGeometry const& multi, std::size_t point_size)
+    {
+        std::size_t result = max_varint_size;
+        for (iterator_type it = boost::begin(multi) ; it != boost::end(multi) ; ++it)
+        {
+            result += element_writer::max_size(*it, point_size);
+        }
+        return result;
+    }
+
+    static inline void expand(quantized_box& box, MultiGeometry const& multi)
+    {
+        for (iterator_type it = boost::begin(multi) ; it != boost::end(multi) ; ++it)
+        {
+            element_writer::expand(box, *it);
+        }
+    }
+};
+
+template <typename MultiPoint>
+struct writer<MultiPoint, multi_point_tag>
+    : multi_writer<MultiPoint, geometry_type_twkb::multipoint>
+{};
+
+template <typename MultiLinestring>
+struct writer<MultiLinestring, multi_linestring_tag>
+    : multi_writer<MultiLinestring, geometry_type_twkb::multilinestring>
+{};
+
+template <typename MultiPolygon>
+struct writer<MultiPolygon, multi_polygon_tag>
+    : multi_writer<MultiPolygon, geometry_type_twkb::multipolygon>
+{};
+
+}} // namespace detail::twkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_TWKB_DETAIL_WRITER_HPP
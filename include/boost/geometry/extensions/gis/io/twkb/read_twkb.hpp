@@ -0,0 +1,141 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_TWKB_READ_TWKB_HPP
+#define BOOST_GEOMETRY_IO_TWKB_READ_TWKB_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/detail/encoding.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/detail/parser.hpp>
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Properties of a geometry read by read_twkb()
+*/
+struct twkb_info
+{
+    twkb_info()
+        : precision(0)
+        , z_precision(0)
+        , has_z(false)
+        , has_m(false)
+        , has_bbox(false)
+        , size(0)
+    {}
+
+    int precision;
+    int z_precision;
+    bool has_z;
+    bool has_m;
+    bool has_bbox;
+    //! Number of bytes read, the next geometry stored in the same buffer
+    //! starts there
+    std::size_t size;
+};
+
+/*!
+\brief Reads a geometry from TWKB (tiny well-known binary) stored in
+    contiguous memory
+\details The points are decoded directly into the containers of the
+    geometry which are resized to the numbers stored in TWKB, so their
+    memory is reused if the geometry is reused. Z is set if the point has
+    3 dimensions, M and the ids of multi-geometries are skipped.
+\return false if the bytes are not a valid TWKB of the type of the geometry,
+    in that case the geometry may contain partial data
+*/
+template <typename ByteType, typename Geometry>
+inline bool read_twkb(ByteType const* bytes, std::size_t size,
+                      Geometry & geometry, twkb_info & info)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    geometry::concepts::check<Geometry>();
+
+    typedef detail::twkb::parser<Geometry> parser_type;
+
+    const boost::uint8_t* first = reinterpret_cast<const boost::uint8_t*>(bytes);
+    detail::twkb::byte_reader reader(first, first + size);
+    detail::twkb::header header;
+
+    if (! detail::twkb::read_header(reader, header)
+        || header.type != parser_type::type)
+    {
+        return false;
+    }
+
+    std::size_t end = 0;
+    if (header.flags & detail::twkb::size_flag)
+    {
+        boost::uint64_t body_size = 0;
+        if (! reader.read_varint(body_size) || body_size > reader.remaining())
+        {
+            return false;
+        }
+        end = reader.consumed() + std::size_t(body_size);
+    }
+
+    bool const empty = (header.flags & detail::twkb::empty_flag) != 0;
+    if (! empty && (header.flags & detail::twkb::bbox_flag))
+    {
+        boost::int64_t value = 0;
+        for (std::size_t i = 0 ; i < 2 * header.dimension() ; ++i)
+        {
+            if (! reader.read_signed(value))
+            {
+                return false;
+            }
+        }
+    }
+
+    if (empty)
+    {
+        if (! parser_type::clear(geometry))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        detail::twkb::decoder decoder(reader, header);
+        if (! parser_type::apply(decoder, header, geometry))
+        {
+            return false;
+        }
+    }
+
+    if ((header.flags & detail::twkb::size_flag) && reader.consumed() != end)
+    {
+        return false;
+    }
+
+    info.precision = header.precision;
+    info.z_precision = header.z_precision;
+    info.has_z = header.has_z;
+    info.has_m = header.has_m;
+    info.has_bbox = ! empty && (header.flags & detail::twkb::bbox_flag) != 0;
+    info.size = reader.consumed();
+    return true;
+}
+
+template <typename ByteType, typename Geometry>
+inline bool read_twkb(ByteType const* bytes, std::size_t size, Geometry & geometry)
+{
+    twkb_info info;
+    return read_twkb(bytes, size, geometry, info);
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_TWKB_READ_TWKB_HPP
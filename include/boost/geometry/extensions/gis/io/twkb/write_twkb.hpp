@@ -0,0 +1,265 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_TWKB_WRITE_TWKB_HPP
+#define BOOST_GEOMETRY_IO_TWKB_WRITE_TWKB_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/detail/encoding.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/detail/writer.hpp>
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Options of write_twkb()
+*/
+struct twkb_options
+{
+    explicit twkb_options(int precision_ = 0)
+        : precision(precision_)
+        , z_precision(0)
+        , bbox(false)
+        , size(false)
+    {}
+
+    //! Number of decimal digits of x and y kept, in [-7, 7], negative
+    //! values round to tens, hundreds...
+    int precision;
+    //! Number of decimal digits of z kept, in [0, 7], used for points
+    //! with 3 dimensions
+    int z_precision;
+    //! Flag indicating if the bounding box is stored
+    bool bbox;
+    //! Flag indicating if the size is stored, so readers can skip geometries
+    bool size;
+};
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace twkb
+{
+
+inline bool is_valid(twkb_options const& options)
+{
+    return options.precision >= min_precision
+        && options.precision <= max_precision
+        && options.z_precision >= 0
+        && options.z_precision <= max_precision;
+}
+
+template <typename Geometry>
+struct geometry_writer
+{
+    typedef writer<Geometry> writer_type;
+
+    static const std::size_t dimension
+        = geometry::dimension<Geometry>::value > 2 ? 3 : 2;
+
+    // Upper bound of the number of bytes written
+    static inline std::size_t max_size(Geometry const& geometry)
+    {
+        std::size_t const point_size = dimension * max_varint_size;
+        return 3 + max_varint_size + 2 * point_size
+            + writer_type::max_size(geometry, point_size);
+    }
+
+    // Writes the geometry if all its coordinates can be quantized,
+    // otherwise nothing is written
+    template <typename OutputIterator>
+    static inline bool apply(Geometry const& geometry,
+                             OutputIterator& out,
+                             twkb_options const& options)
+    {
+        quantizer const q(power_of_ten(options.precision),
+                          power_of_ten(options.z_precision),
+                          dimension);
+        bool const empty = writer_type::is_empty(geometry);
+
+        // The coordinates are checked before anything is written, the box
+        // is then written if requested
+        quantized_box box(q);
+        if (! empty)
+        {
+            writer_type::expand(box, geometry);
+            if (! box.is_valid())
+            {
+                return false;
+            }
+        }
+
+        boost::uint8_t flags = empty ? empty_flag : 0;
+        if (! empty && options.bbox)
+        {
+            flags |= bbox_flag;
+        }
+        if (options.size)
+        {
+            flags |= size_flag;
+        }
+        if (dimension > 2)
+        {
+            flags |= extended_dimensions_flag;
+        }
+
+        *out++ = boost::uint8_t(writer_type::type
+            | (zigzag_encode(options.precision) << 4));
+        *out++ = flags;
+        if (dimension > 2)
+        {
+            *out++ = boost::uint8_t(z_flag | (options.z_precision << 2));
+        }
+
+        if (flags & size_flag)
+        {
+            std::size_t size = 0;
+            if (flags & bbox_flag)
+            {
+                box.write(counting_iterator(size));
+            }
+            if (! empty)
+            {
+                encoder<counting_iterator> counter(counting_iterator(size), q);
+                writer_type::apply(counter, geometry);
+            }
+            out = write_varint(boost::uint64_t(size), out);
+        }
+
+        if (flags & bbox_flag)
+        {
+            out = box.write(out);
+        }
+
+        if (! empty)
+        {
+            encoder<OutputIterator> enc(out, q);
+            writer_type::apply(enc, geometry);
+            out = enc.out();
+        }
+        return true;
+    }
+};
+
+}} // namespace detail::twkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Writes a geometry as TWKB (tiny well-known binary)
+\details The coordinates are rounded to the precision, the points are
+    stored as zigzag and varint encoded differences to the previous point
+    so geometries with many close points take a few bytes per point. The
+    bytes are written directly to the output iterator, if the size or the
+    bounding box is stored the points are additionally traversed before.
+    Z is stored for points with 3 dimensions.
+\return false if the precisions are out of range, or if a coordinate
+    multiplied by 10^precision is not finite or does not fit into 64 bits,
+    in that case nothing is written
+*/
+template <typename Geometry, typename OutputIterator>
+inline bool write_twkb(Geometry const& geometry, OutputIterator out,
+                       twkb_options const& options = twkb_options())
+{
+    geometry::concepts::check<Geometry const>();
+
+    if (! detail::twkb::is_valid(options))
+    {
+        return false;
+    }
+
+    return detail::twkb::geometry_writer<Geometry>::apply(geometry, out, options);
+}
+
+/*!
+\brief Writes the TWKBs of a range of geometries one after another into
+    a contiguous buffer, like a binary column of Apache Arrow
+\details The TWKBs are appended to data. The offsets of the TWKBs in data
+    are appended to offsets, preceded by the offset of the first one if
+    offsets is empty, so the i-th TWKB is stored between offsets[i] and
+    offsets[i+1]. The bytes are written directly into data which grows
+    geometrically, which is faster than writing through a back inserter.
+\return false if the precisions are out of range, if a coordinate can not
+    be quantized (see write_twkb) or if the offsets can not be represented
+    by Offset, in that case nothing is appended
+*/
+template <typename Geometries, typename ByteType, typename Offset>
+inline bool write_twkb_batch(Geometries const& geometries,
+                             std::vector<ByteType>& data,
+                             std::vector<Offset>& offsets,
+                             twkb_options const& options = twkb_options())
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+    BOOST_STATIC_ASSERT((boost::is_integral<Offset>::value));
+
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef typename boost::range_iterator<Geometries const>::type iterator_type;
+    typedef detail::twkb::geometry_writer<geometry_type> writer_type;
+
+    geometry::concepts::check<geometry_type const>();
+
+    if (! detail::twkb::is_valid(options))
+    {
+        return false;
+    }
+
+    std::size_t const first_size = data.size();
+    std::size_t const first_offset = offsets.size();
+    bool const add_first = offsets.empty();
+    std::size_t const max_offset = std::size_t((std::numeric_limits<Offset>::max)());
+
+    std::size_t end = data.size();
+    if (end > max_offset)
+    {
+        return false;
+    }
+
+    offsets.reserve(offsets.size() + boost::size(geometries) + (add_first ? 1 : 0));
+    if (add_first)
+    {
+        offsets.push_back(Offset(end));
+    }
+    for (iterator_type it = boost::begin(geometries) ; it != boost::end(geometries) ; ++it)
+    {
+        std::size_t const max_size = writer_type::max_size(*it);
+        if (data.size() - end < max_size)
+        {
+            data.resize((std::max)(2 * data.size(), end + max_size));
+        }
+
+        boost::uint8_t* const first = reinterpret_cast<boost::uint8_t*>(data.data()) + end;
+        boost::uint8_t* last = first;
+        bool const written = writer_type::apply(*it, last, options);
+        end += std::size_t(last - first);
+        if (! written || end > max_offset)
+        {
+            data.resize(first_size);
+            offsets.resize(first_offset);
+            return false;
+        }
+        offsets.push_back(Offset(end));
+    }
+    data.resize(end);
+    return true;
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_TWKB_WRITE_TWKB_HPP
@@ -0,0 +1,430 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_SPAN_PARSER_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_SPAN_PARSER_HPP
+
+#include <cstddef>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/predef/other/endian.h>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/util/range.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Flags of EWKB geometry type
+static const boost::uint32_t ewkb_z_flag = 0x80000000;
+static const boost::uint32_t ewkb_m_flag = 0x40000000;
+static const boost::uint32_t ewkb_srid_flag = 0x20000000;
+
+// Number of coordinates decoded at once
+static const std::size_t span_block_size = 256;
+
+inline bool is_native_byte_order(boost::uint8_t order)
+{
+#if BOOST_ENDIAN_BIG_BYTE
+    return order == byte_order_type::xdr;
+#else
+    return order == byte_order_type::ndr;
+#endif
+}
+
+// Byte swapping written as a simple loop so the compilers can vectorize it
+inline void reverse_bytes(boost::uint64_t* values, std::size_t count)
+{
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        values[i] = boost::endian::endian_reverse(values[i]);
+    }
+}
+
+inline double to_double(boost::uint64_t value)
+{
+    double result;
+    std::memcpy(&result, &value, sizeof(double));
+    return result;
+}
+
+/*!
+\brief Reader of values from a contiguous span of bytes in a given
+    byte order, checking the available size
+*/
+class span_reader
+{
+public:
+    span_reader(const boost::uint8_t* first, const boost::uint8_t* last)
+        : m_first(first)
+        , m_ptr(first)
+        , m_last(last)
+        , m_swap(false)
+    {}
+
+    inline std::size_t consumed() const
+    {
+        return std::size_t(m_ptr - m_first);
+    }
+
+    inline std::size_t remaining() const
+    {
+        return std::size_t(m_last - m_ptr);
+    }
+
+    inline const boost::uint8_t* position() const
+    {
+        return m_ptr;
+    }
+
+    inline bool swap() const
+    {
+        return m_swap;
+    }
+
+    inline bool read_byte_order()
+    {
+        if (m_ptr == m_last || *m_ptr > byte_order_type::ndr)
+        {
+            return false;
+        }
+        m_swap = ! is_native_byte_order(*m_ptr);
+        ++m_ptr;
+        return true;
+    }
+
+    inline bool skip(std::size_t size)
+    {
+        if (remaining() < size)
+        {
+            return false;
+        }
+        m_ptr += size;
+        return true;
+    }
+
+    inline bool read(boost::uint32_t & value)
+    {
+        if (remaining() < sizeof(value))
+        {
+            return false;
+        }
+        std::memcpy(&value, m_ptr, sizeof(value));
+        if (m_swap)
+        {
+            value = boost::endian::endian_reverse(value);
+        }
+        m_ptr += sizeof(value);
+        return true;
+    }
+
+    // Reads count doubles, the size has to be checked before
+    inline void read(boost::uint64_t* values, std::size_t count)
+    {
+        std::memcpy(values, m_ptr, count * sizeof(boost::uint64_t));
+        if (m_swap)
+        {
+            reverse_bytes(values, count);
+        }
+        m_ptr += count * sizeof(boost::uint64_t);
+    }
+
+    inline bool read_count(boost::uint32_t & count, std::size_t min_item_size)
+    {
+        return read(count)
+            && std::size_t(count) <= remaining() / min_item_size;
+    }
+
+private:
+    const boost::uint8_t* m_first;
+    const boost::uint8_t* m_ptr;
+    const boost::uint8_t* m_last;
+    bool m_swap;
+};
+
+/*!
+\brief Header of a geometry, byte order, type and optional SRID,
+    Z and M are supported in EWKB and ISO WKB forms
+*/
+struct span_header
+{
+    boost::uint32_t type;
+    bool has_z;
+    bool has_m;
+    bool has_srid;
+    boost::uint32_t srid;
+
+    // Number of coordinates of a point
+    inline std::size_t stride() const
+    {
+        return 2 + (has_z ? 1 : 0) + (has_m ? 1 : 0);
+    }
+};
+
+inline bool read_header(span_reader & reader, span_header & header)
+{
+    boost::uint32_t type = 0;
+    if (! reader.read_byte_order() || ! reader.read(type))
+    {
+        return false;
+    }
+
+    header.has_z = (type & ewkb_z_flag) != 0;
+    header.has_m = (type & ewkb_m_flag) != 0;
+    header.has_srid = (type & ewkb_srid_flag) != 0;
+    header.srid = 0;
+    type &= 0x0fffffff;
+
+    if (type >= 1000 && type < 4000)
+    {
+        header.has_z = header.has_z || type / 1000 != 2;
+        header.has_m = header.has_m || type / 1000 != 1;
+        type %= 1000;
+    }
+    header.type = type;
+
+    return ! header.has_srid || reader.read(header.srid);
+}
+
+template
+<
+    typename Point,
+    bool Enable = (geometry::dimension<Point>::value > 2)
+>
+struct set_z
+{
+    static inline void apply(Point & point, boost::uint64_t const* coords, bool has_z)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        geometry::set<2>(point, has_z
+            ? static_cast<coordinate_type>(to_double(coords[2]))
+            : coordinate_type());
+    }
+};
+
+template <typename Point>
+struct set_z<Point, false>
+{
+    static inline void apply(Point & , boost::uint64_t const* , bool )
+    {}
+};
+
+template <typename Point>
+inline void set_point(Point & point, boost::uint64_t const* coords, bool has_z)
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+    geometry::set<0>(point, static_cast<coordinate_type>(to_double(coords[0])));
+    geometry::set<1>(point, static_cast<coordinate_type>(to_double(coords[1])));
+    set_z<Point>::apply(point, coords, has_z);
+}
+
+// Decodes count points into the resized range, the coordinates are copied
+// and byte swapped in blocks
+template <typename Range>
+inline bool read_points(span_reader & reader, span_header const& header,
+                        boost::uint32_t count, Range & range)
+{
+    std::size_t const stride = header.stride();
+    if (std::size_t(count) > reader.remaining() / (stride * sizeof(double)))
+    {
+        return false;
+    }
+
+    range::resize(range, count);
+
+    boost::uint64_t block[span_block_size];
+    std::size_t const points_per_block = span_block_size / stride;
+
+    typename boost::range_iterator<Range>::type it = boost::begin(range);
+    std::size_t left = count;
+    while (left > 0)
+    {
+        std::size_t const n = left < points_per_block ? left : points_per_block;
+        reader.read(block, n * stride);
+        for (std::size_t i = 0 ; i < n ; ++i, ++it)
+        {
+            set_point(*it, block + i * stride, header.has_z);
+        }
+        left -= n;
+    }
+    return true;
+}
+
+inline bool read_nested_header(span_reader & reader, span_header & header,
+                               boost::uint32_t expected_type)
+{
+    return read_header(reader, header) && header.type == expected_type;
+}
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct span_parser
+    : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct span_parser<Point, point_tag>
+{
+    static const boost::uint32_t type = geometry_type_ogc::point;
+
+    static inline bool apply(span_reader & reader, span_header const& header,
+                             Point & point)
+    {
+        std::size_t const stride = header.stride();
+        if (reader.remaining() < stride * sizeof(double))
+        {
+            return false;
+        }
+
+        boost::uint64_t coords[4];
+        reader.read(coords, stride);
+        set_point(point, coords, header.has_z);
+        return true;
+    }
+};
+
+template <typename Linestring>
+struct span_parser<Linestring, linestring_tag>
+{
+    static const boost::uint32_t type = geometry_type_ogc::linestring;
+
+    static inline bool apply(span_reader & reader, span_header const& header,
+                             Linestring & linestring)
+    {
+        boost::uint32_t count = 0;
+        return reader.read(count)
+            && read_points(reader, header, count, linestring);
+    }
+};
+
+template <typename Polygon>
+struct span_parser<Polygon, polygon_tag>
+{
+    static const boost::uint32_t type = geometry_type_ogc::polygon;
+
+    static inline bool apply(span_reader & reader, span_header const& header,
+                             Polygon & polygon)
+    {
+        typedef typename ring_return_type<Polygon>::type ring_type;
+        typedef typename interior_return_type<Polygon>::type interior_type;
+
+        // each ring has at least the number of points
+        boost::uint32_t num_rings = 0;
+        if (! reader.read_count(num_rings, sizeof(boost::uint32_t)))
+        {
+            return false;
+        }
+
+        interior_type interiors = geometry::interior_rings(polygon);
+        range::resize(interiors, num_rings > 0 ? num_rings - 1 : 0);
+
+        ring_type exterior = geometry::exterior_ring(polygon);
+        if (num_rings == 0)
+        {
+            range::clear(exterior);
+            return true;
+        }
+
+        boost::uint32_t count = 0;
+        if (! reader.read(count) || ! read_points(reader, header, count, exterior))
+        {
+            return false;
+        }
+
+        typedef typename boost::range_iterator
+            <
+                typename boost::remove_reference<interior_type>::type
+            >::type iterator_type;
+        for (iterator_type it = boost::begin(interiors) ; it != boost::end(interiors) ; ++it)
+        {
+            if (! reader.read(count) || ! read_points(reader, header, count, *it))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// The elements of the multi-geometries are stored with their headers
+template <typename MultiGeometry, boost::uint32_t Type>
+struct span_multi_parser
+{
+    static const boost::uint32_t type = Type;
+
+    static inline bool apply(span_reader & reader, span_header const& ,
+                             MultiGeometry & multi)
+    {
+        typedef typename boost::range_value<MultiGeometry>::type element_type;
+        typedef span_parser<element_type> element_parser;
+
+        // byte order and type
+        boost::uint32_t count = 0;
+        if (! reader.read_count(count, 5))
+        {
+            return false;
+        }
+
+        range::resize(multi, count);
+
+        typedef typename boost::range_iterator<MultiGeometry>::type iterator_type;
+        for (iterator_type it = boost::begin(multi) ; it != boost::end(multi) ; ++it)
+        {
+            span_header element_header;
+            if (! read_nested_header(reader, element_header, element_parser::type)
+                || ! element_parser::apply(reader, element_header, *it))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename MultiPoint>
+struct span_parser<MultiPoint, multi_point_tag>
+    : span_multi_parser<MultiPoint, geometry_type_ogc::multipoint>
+{};
+
+template <typename MultiLinestring>
+struct span_parser<MultiLinestring, multi_linestring_tag>
+    : span_multi_parser<MultiLinestring, geometry_type_ogc::multilinestring>
+{};
+
+template <typename MultiPolygon>
+struct span_parser<MultiPolygon, multi_polygon_tag>
+    : span_multi_parser<MultiPolygon, geometry_type_ogc::multipolygon>
+{};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_SPAN_PARSER_HPP
@@ -0,0 +1,364 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_DETAIL_SPAN_WRITER_HPP
+#define BOOST_GEOMETRY_IO_WKB_DETAIL_SPAN_WRITER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/util/bare_type.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/span_parser.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Size of the byte order and the geometry type
+static const std::size_t header_size = 1 + sizeof(boost::uint32_t);
+
+/*!
+\brief Writer of values into a preallocated buffer in a given byte order,
+    the size of the buffer has to be checked before
+*/
+class span_writer
+{
+public:
+    span_writer(boost::uint8_t* first, byte_order_type::enum_t byte_order)
+        : m_ptr(first)
+        , m_byte_order(byte_order)
+        , m_swap(! is_native_byte_order(boost::uint8_t(byte_order)))
+    {}
+
+    inline boost::uint8_t* position() const
+    {
+        return m_ptr;
+    }
+
+    inline bool swap() const
+    {
+        return m_swap;
+    }
+
+    inline void write(boost::uint32_t value)
+    {
+        if (m_swap)
+        {
+            value = boost::endian::endian_reverse(value);
+        }
+        std::memcpy(m_ptr, &value, sizeof(value));
+        m_ptr += sizeof(value);
+    }
+
+    inline void write_header(boost::uint32_t type)
+    {
+        *m_ptr++ = boost::uint8_t(m_byte_order);
+        write(type);
+    }
+
+    // Writes count doubles stored as their bits
+    inline void write(boost::uint64_t* values, std::size_t count)
+    {
+        if (m_swap)
+        {
+            reverse_bytes(values, count);
+        }
+        std::memcpy(m_ptr, values, count * sizeof(boost::uint64_t));
+        m_ptr += count * sizeof(boost::uint64_t);
+    }
+
+    // Writes count doubles stored contiguously in the native byte order
+    inline void write(double const* values, std::size_t count)
+    {
+        std::size_t const size = count * sizeof(double);
+        std::memcpy(m_ptr, values, size);
+        if (m_swap)
+        {
+            boost::uint64_t block[span_block_size];
+            for (std::size_t i = 0 ; i < size ; i += sizeof(block))
+            {
+                std::size_t const n = size - i < sizeof(block) ? size - i : sizeof(block);
+                std::memcpy(block, m_ptr + i, n);
+                reverse_bytes(block, n / sizeof(boost::uint64_t));
+                std::memcpy(m_ptr + i, block, n);
+            }
+        }
+        m_ptr += size;
+    }
+
+private:
+    boost::uint8_t* m_ptr;
+    byte_order_type::enum_t m_byte_order;
+    bool m_swap;
+};
+
+inline boost::uint64_t to_bits(double value)
+{
+    boost::uint64_t result;
+    std::memcpy(&result, &value, sizeof(double));
+    return result;
+}
+
+template
+<
+    typename Point,
+    std::size_t I = 0,
+    std::size_t N = geometry::dimension<Point>::value
+>
+struct get_coordinates
+{
+    static inline void apply(Point const& point, boost::uint64_t* coords)
+    {
+        // NOTE: coordinates of any type are converted to double
+        coords[I] = to_bits(static_cast<double>(geometry::get<I>(point)));
+        get_coordinates<Point, I + 1, N>::apply(point, coords);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct get_coordinates<Point, N, N>
+{
+    static inline void apply(Point const& , boost::uint64_t* )
+    {}
+};
+
+// True if the points of the range are stored in a vector or an array, and
+// declare their coordinates as consecutive doubles (see
+// traits::contiguous_coordinates), so they can be copied at once
+template <typename Range>
+struct is_contiguous_range
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+    static const bool value =
+        traits::contiguous_coordinates
+            <
+                typename util::bare_type<point_type>::type
+            >::value
+        && boost::is_same<typename coordinate_type<point_type>::type, double>::value
+        && (boost::is_same
+                <
+                    iterator_type,
+                    typename std::vector<point_type>::const_iterator
+                >::value
+            || boost::is_same<iterator_type, point_type const*>::value);
+};
+
+template <typename Range>
+inline void write_range_points(span_writer & writer, Range const& range,
+                               boost::mpl::true_ /*contiguous*/)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    if (boost::begin(range) != boost::end(range))
+    {
+        writer.write(reinterpret_cast<double const*>(&*boost::begin(range)),
+                     boost::size(range) * geometry::dimension<point_type>::value);
+    }
+}
+
+template <typename Range>
+inline void write_range_points(span_writer & writer, Range const& range,
+                               boost::mpl::false_ /*contiguous*/)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    std::size_t const stride = geometry::dimension<point_type>::value;
+    std::size_t const points_per_block = span_block_size / stride;
+
+    boost::uint64_t block[span_block_size];
+    std::size_t n = 0;
+    for (typename boost::range_iterator<Range const>::type it = boost::begin(range);
+         it != boost::end(range); ++it)
+    {
+        get_coordinates<point_type>::apply(*it, block + n * stride);
+        if (++n == points_per_block)
+        {
+            writer.write(block, n * stride);
+            n = 0;
+        }
+    }
+    writer.write(block, n * stride);
+}
+
+// Writes the number of points followed by the points
+template <typename Range>
+inline void write_points(span_writer & writer, Range const& range)
+{
+    writer.write(boost::uint32_t(boost::size(range)));
+    write_range_points(writer, range,
+        boost::mpl::bool_<is_contiguous_range<Range>::value>());
+}
+
+template <typename Range>
+inline std::size_t points_size(Range const& range)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    return sizeof(boost::uint32_t)
+         + boost::size(range) * geometry::dimension<point_type>::value * sizeof(double);
+}
+
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct span_writer_dispatch
+    : not_implemented<Tag>
+{};
+
+template <typename Point>
+struct span_writer_dispatch<Point, point_tag>
+{
+    static inline std::size_t size(Point const& )
+    {
+        return header_size + geometry::dimension<Point>::value * sizeof(double);
+    }
+
+    static inline void apply(span_writer & writer, Point const& point)
+    {
+        boost::uint64_t coords[geometry::dimension<Point>::value];
+        writer.write_header(geometry_type<Point>::get());
+        get_coordinates<Point>::apply(point, coords);
+        writer.write(coords, geometry::dimension<Point>::value);
+    }
+};
+
+template <typename Linestring>
+struct span_writer_dispatch<Linestring, linestring_tag>
+{
+    static inline std::size_t size(Linestring const& linestring)
+    {
+        return header_size + points_size(linestring);
+    }
+
+    static inline void apply(span_writer & writer, Linestring const& linestring)
+    {
+        writer.write_header(geometry_type<Linestring>::get());
+        write_points(writer, linestring);
+    }
+};
+
+template <typename Polygon>
+struct span_writer_dispatch<Polygon, polygon_tag>
+{
+    typedef typename interior_return_type<Polygon const>::type interior_type;
+    typedef typename boost::range_iterator
+        <
+            typename boost::remove_reference<interior_type>::type const
+        >::type iterator_type;
+
+    static inline std::size_t size(Polygon const& polygon)
+    {
+        std::size_t result = header_size + sizeof(boost::uint32_t)
+                           + points_size(geometry::exterior_ring(polygon));
+
+        interior_type interiors = geometry::interior_rings(polygon);
+        for (iterator_type it = boost::begin(interiors) ; it != boost::end(interiors) ; ++it)
+        {
+            result += points_size(*it);
+        }
+        return result;
+    }
+
+    static inline void apply(span_writer & writer, Polygon const& polygon)
+    {
+        interior_type interiors = geometry::interior_rings(polygon);
+
+        writer.write_header(geometry_type<Polygon>::get());
+        writer.write(boost::uint32_t(1 + boost::size(interiors)));
+        write_points(writer, geometry::exterior_ring(polygon));
+        for (iterator_type it = boost::begin(interiors) ; it != boost::end(interiors) ; ++it)
+        {
+            write_points(writer, *it);
+        }
+    }
+};
+
+// The elements of the multi-geometries are written with their headers
+template <typename MultiGeometry>
+struct span_multi_writer
+{
+    typedef typename boost::range_value<MultiGeometry>::type element_type;
+    typedef span_writer_dispatch<element_type> element_writer;
+    typedef typename boost::range_iterator<MultiGeometry const>::type iterator_type;
+
+    static inline std::size_t size(MultiGeometry const& multi)
+    {
+        std::size_t result = header_size + sizeof(boost::uint32_t);
+        for (iterator_type it = boost::begin(multi) ; it != boost::end(multi) ; ++it)
+        {
+            result += element_writer::size(*it);
+        }
+        return result;
+    }
+
+    static inline void apply(span_writer & writer, MultiGeometry const& multi)
+    {
+        writer.write_header(geometry_type<MultiGeometry>::get());
+        writer.write(boost::uint32_t(boost::size(multi)));
+        for (iterator_type it = boost::begin(multi) ; it != boost::end(multi) ; ++it)
+        {
+            element_writer::apply(writer, *it);
+        }
+    }
+};
+
+template <typename MultiPoint>
+struct span_writer_dispatch<MultiPoint, multi_point_tag>
+    : span_multi_writer<MultiPoint>
+{};
+
+template <typename MultiLinestring>
+struct span_writer_dispatch<MultiLinestring, multi_linestring_tag>
+    : span_multi_writer<MultiLinestring>
+{};
+
+template <typename MultiPolygon>
+struct span_writer_dispatch<MultiPolygon, multi_polygon_tag>
+    : span_multi_writer<MultiPolygon>
+{};
+
+inline byte_order_type::enum_t native_byte_order()
+{
+#if BOOST_ENDIAN_BIG_BYTE
+    return byte_order_type::xdr;
+#else
+    return byte_order_type::ndr;
+#endif
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_DETAIL_SPAN_WRITER_HPP
@@ -0,0 +1,95 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_READ_EWKB_HPP
+#define BOOST_GEOMETRY_IO_WKB_READ_EWKB_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/span_parser.hpp>
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Properties of a geometry read by read_ewkb()
+*/
+struct ewkb_info
+{
+    ewkb_info()
+        : srid(0)
+        , has_srid(false)
+        , has_z(false)
+        , has_m(false)
+        , size(0)
+    {}
+
+    //! SRID stored in EWKB, 0 if not stored
+    boost::uint32_t srid;
+    bool has_srid;
+    bool has_z;
+    bool has_m;
+    //! Number of bytes read
+    std::size_t size;
+};
+
+/*!
+\brief Reads a geometry from WKB or EWKB stored in contiguous memory
+\details The coordinates are copied from the memory and byte swapped in
+    blocks and the points are decoded directly into the containers of the
+    geometry which are resized to the numbers stored in WKB, so their
+    memory is reused if the geometry is reused. Z and M are supported in
+    EWKB and ISO WKB forms, Z is set if the point has 3 dimensions and M
+    is ignored.
+\return false if the bytes are not a valid WKB of the type of the geometry,
+    in that case the geometry may contain partial data
+*/
+template <typename ByteType, typename Geometry>
+inline bool read_ewkb(ByteType const* bytes, std::size_t size,
+                      Geometry & geometry, ewkb_info & info)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    geometry::concepts::check<Geometry>();
+
+    typedef detail::wkb::span_parser<Geometry> parser_type;
+
+    const boost::uint8_t* first = reinterpret_cast<const boost::uint8_t*>(bytes);
+    detail::wkb::span_reader reader(first, first + size);
+    detail::wkb::span_header header;
+
+    bool const result = detail::wkb::read_header(reader, header)
+                     && header.type == parser_type::type
+                     && parser_type::apply(reader, header, geometry);
+
+    if (result)
+    {
+        info.srid = header.srid;
+        info.has_srid = header.has_srid;
+        info.has_z = header.has_z;
+        info.has_m = header.has_m;
+        info.size = reader.consumed();
+    }
+    return result;
+}
+
+template <typename ByteType, typename Geometry>
+inline bool read_ewkb(ByteType const* bytes, std::size_t size, Geometry & geometry)
+{
+    ewkb_info info;
+    return read_ewkb(bytes, size, geometry, info);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_READ_EWKB_HPP
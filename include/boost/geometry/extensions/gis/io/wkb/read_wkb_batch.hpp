@@ -0,0 +1,237 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_READ_WKB_BATCH_HPP
+#define BOOST_GEOMETRY_IO_WKB_READ_WKB_BATCH_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/io/detail/bulk_read.hpp>
+#include <boost/geometry/util/executor.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_ewkb.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Number of geometries parsed by one task
+static const std::size_t batch_chunk_size = 1024;
+
+template <typename Geometry, typename Offset, typename Value, typename Executor>
+inline bool read_wkb_batch(const boost::uint8_t* data,
+                           Offset const* begins, Offset const* ends,
+                           std::size_t count,
+                           std::vector<Geometry>& geometries,
+                           std::vector<Value>* envelopes,
+                           Executor const& executor)
+{
+    std::size_t const start = geometries.size();
+    std::size_t const envelopes_start = envelopes ? envelopes->size() : 0;
+    std::size_t const chunks = (count + batch_chunk_size - 1) / batch_chunk_size;
+
+    // The number of geometries is known so they are parsed in place
+    geometries.resize(start + count);
+    if (envelopes)
+    {
+        envelopes->resize(envelopes_start + count);
+    }
+
+    std::vector<char> valid(chunks, 1);
+    geometry::detail::for_each_chunk(executor, count, batch_chunk_size,
+        [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                std::size_t const begin = std::size_t(begins[i]);
+                std::size_t const end = std::size_t(ends[i]);
+                Geometry& geometry = geometries[start + i];
+                ewkb_info info;
+                if (end < begin
+                    || ! geometry::read_ewkb(data + begin, end - begin, geometry, info)
+                    || info.size != end - begin)
+                {
+                    valid[first / batch_chunk_size] = 0;
+                    return;
+                }
+                if (envelopes)
+                {
+                    io::envelope_value<Value>::apply(geometry, start + i,
+                        (*envelopes)[envelopes_start + i]);
+                }
+            }
+        });
+
+    for (std::size_t i = 0 ; i < chunks ; ++i)
+    {
+        if (! valid[i])
+        {
+            geometries.resize(start);
+            if (envelopes)
+            {
+                envelopes->resize(envelopes_start);
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+// Computes the positions of the WKBs of the records prefixed by their sizes
+inline bool record_offsets(const boost::uint8_t* data, std::size_t size,
+                           std::vector<std::size_t>& begins,
+                           std::vector<std::size_t>& ends)
+{
+    std::size_t position = 0;
+    while (position < size)
+    {
+        if (size - position < 4)
+        {
+            return false;
+        }
+        std::size_t const length = std::size_t(data[position])
+                                 | std::size_t(data[position + 1]) << 8
+                                 | std::size_t(data[position + 2]) << 16
+                                 | std::size_t(data[position + 3]) << 24;
+        position += 4;
+        if (length > size - position)
+        {
+            return false;
+        }
+        begins.push_back(position);
+        position += length;
+        ends.push_back(position);
+    }
+    return true;
+}
+
+template <typename Geometry, typename Value, typename Executor>
+inline bool read_wkb_records(const boost::uint8_t* data, std::size_t size,
+                             std::vector<Geometry>& geometries,
+                             std::vector<Value>* envelopes,
+                             Executor const& executor)
+{
+    std::vector<std::size_t> begins, ends;
+    if (! record_offsets(data, size, begins, ends))
+    {
+        return false;
+    }
+    return begins.empty()
+        || read_wkb_batch(data, &begins[0], &ends[0], begins.size(),
+                          geometries, envelopes, executor);
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reads a batch of WKB or EWKB geometries stored one after another in
+    contiguous memory, like a binary column of Apache Arrow, using an
+    executor
+\details The i-th WKB is stored between offsets[i] and offsets[i+1], offsets
+    has count + 1 elements. The geometries are appended to geometries and
+    parsed in place in parallel, each WKB has to be of the type of Geometry.
+\return false if any of the WKBs is not valid or does not end at the next
+    offset, in that case nothing is appended
+*/
+template <typename ByteType, typename Offset, typename Geometry, typename Executor>
+inline bool read_wkb_batch(ByteType const* data, Offset const* offsets,
+                           std::size_t count,
+                           std::vector<Geometry>& geometries,
+                           Executor const& executor)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+    geometry::concepts::check<Geometry>();
+
+    return detail::wkb::read_wkb_batch(
+        reinterpret_cast<const boost::uint8_t*>(data), offsets, offsets + 1, count,
+        geometries, static_cast<std::vector<detail::io::no_envelopes>*>(0),
+        executor);
+}
+
+/*!
+\brief Reads a batch of WKB or EWKB geometries and computes their envelopes
+    using an executor
+\details The envelope of every geometry is computed after the geometry is
+    parsed, when its points are still in the cache, and appended to
+    envelopes. Value is either a box or a std::pair of a box and an integral
+    index which is set to the index of the geometry in geometries, so an
+    index::rtree of the geometries can be packed from envelopes directly.
+\return false if any of the WKBs is not valid, in that case nothing is
+    appended
+*/
+template
+<
+    typename ByteType, typename Offset, typename Geometry, typename Value,
+    typename Executor
+>
+inline bool read_wkb_batch(ByteType const* data, Offset const* offsets,
+                           std::size_t count,
+                           std::vector<Geometry>& geometries,
+                           std::vector<Value>& envelopes,
+                           Executor const& executor)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+    geometry::concepts::check<Geometry>();
+
+    return detail::wkb::read_wkb_batch(
+        reinterpret_cast<const boost::uint8_t*>(data), offsets, offsets + 1, count,
+        geometries, &envelopes, executor);
+}
+
+/*!
+\brief Reads WKB or EWKB geometries stored as records prefixed by their
+    sizes as 4-byte little endian unsigned integers using an executor
+\details The sizes are scanned first and then the geometries are read like
+    in read_wkb_batch().
+\return false if the records or any of the WKBs are not valid, in that case
+    nothing is appended
+*/
+template <typename ByteType, typename Geometry, typename Executor>
+inline bool read_wkb_records(ByteType const* data, std::size_t size,
+                             std::vector<Geometry>& geometries,
+                             Executor const& executor)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+    geometry::concepts::check<Geometry>();
+
+    return detail::wkb::read_wkb_records(
+        reinterpret_cast<const boost::uint8_t*>(data), size, geometries,
+        static_cast<std::vector<detail::io::no_envelopes>*>(0), executor);
+}
+
+//! Reads size prefixed WKB or EWKB geometries and computes their envelopes
+template <typename ByteType, typename Geometry, typename Value, typename Executor>
+inline bool read_wkb_records(ByteType const* data, std::size_t size,
+                             std::vector<Geometry>& geometries,
+                             std::vector<Value>& envelopes,
+                             Executor const& executor)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+    geometry::concepts::check<Geometry>();
+
+    return detail::wkb::read_wkb_records(
+        reinterpret_cast<const boost::uint8_t*>(data), size, geometries,
+        &envelopes, executor);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_READ_WKB_BATCH_HPP
@@ -0,0 +1,316 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
+#define BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
+
+#include <cstddef>
+#include <cstring>
+
+#include <boost/cstdint.hpp>
+#include <boost/endian/conversion.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/span_parser.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+/*!
+\brief Iterator decoding points from WKB when dereferenced
+*/
+template <typename Point>
+class point_span_iterator
+    : public boost::iterator_facade
+        <
+            point_span_iterator<Point>,
+            Point const,
+            boost::random_access_traversal_tag,
+            Point
+        >
+{
+public:
+    point_span_iterator()
+        : m_ptr(0)
+        , m_stride(0)
+        , m_swap(false)
+        , m_has_z(false)
+    {}
+
+    point_span_iterator(const boost::uint8_t* ptr, std::size_t stride,
+                        bool swap, bool has_z)
+        : m_ptr(ptr)
+        , m_stride(stride)
+        , m_swap(swap)
+        , m_has_z(has_z)
+    {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline Point dereference() const
+    {
+        boost::uint64_t coords[3];
+        std::size_t const count = m_has_z ? 3 : 2;
+        std::memcpy(coords, m_ptr, count * sizeof(boost::uint64_t));
+        if (m_swap)
+        {
+            reverse_bytes(coords, count);
+        }
+
+        Point point;
+        set_point(point, coords, m_has_z);
+        return point;
+    }
+
+    inline bool equal(point_span_iterator const& other) const
+    {
+        return m_ptr == other.m_ptr;
+    }
+
+    inline void increment()
+    {
+        m_ptr += m_stride;
+    }
+
+    inline void decrement()
+    {
+        m_ptr -= m_stride;
+    }
+
+    inline void advance(std::ptrdiff_t n)
+    {
+        m_ptr += n * std::ptrdiff_t(m_stride);
+    }
+
+    inline std::ptrdiff_t distance_to(point_span_iterator const& other) const
+    {
+        return (other.m_ptr - m_ptr) / std::ptrdiff_t(m_stride);
+    }
+
+    const boost::uint8_t* m_ptr;
+    std::size_t m_stride;
+    bool m_swap;
+    bool m_has_z;
+};
+
+/*!
+\brief Range of points stored in WKB, decoded when accessed
+*/
+template <typename Point>
+class point_span_view
+{
+public:
+    typedef point_span_iterator<Point> const_iterator;
+    typedef const_iterator iterator;
+
+    point_span_view()
+        : m_first(0)
+        , m_size(0)
+        , m_stride(0)
+        , m_swap(false)
+        , m_has_z(false)
+        , m_srid(0)
+    {}
+
+    inline const_iterator begin() const
+    {
+        return const_iterator(m_first, m_stride, m_swap, m_has_z);
+    }
+
+    inline const_iterator end() const
+    {
+        return const_iterator(m_first + m_size * m_stride, m_stride, m_swap, m_has_z);
+    }
+
+    inline std::size_t size() const
+    {
+        return m_size;
+    }
+
+    inline bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    //! SRID stored in EWKB, 0 if not stored
+    inline boost::uint32_t srid() const
+    {
+        return m_srid;
+    }
+
+protected:
+    template <typename ByteType>
+    inline bool assign(ByteType const* bytes, std::size_t size,
+                       boost::uint32_t type, std::size_t skipped_ranges)
+    {
+        BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+        BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+        *this = point_span_view();
+
+        const boost::uint8_t* first = reinterpret_cast<const boost::uint8_t*>(bytes);
+        span_reader reader(first, first + size);
+        span_header header;
+        if (! read_header(reader, header) || header.type != type)
+        {
+            return false;
+        }
+
+        std::size_t const stride = header.stride() * sizeof(double);
+        boost::uint32_t count = 0;
+        if (type == geometry_type_ogc::polygon)
+        {
+            boost::uint32_t num_rings = 0;
+            if (! reader.read(num_rings) || skipped_ranges >= num_rings)
+            {
+                return false;
+            }
+        }
+
+        for (std::size_t i = 0 ; i <= skipped_ranges ; ++i)
+        {
+            if (! reader.read(count)
+                || std::size_t(count) > reader.remaining() / stride
+                || (i < skipped_ranges && ! reader.skip(count * stride)))
+            {
+                return false;
+            }
+        }
+
+        m_first = reader.position();
+        m_size = count;
+        m_stride = stride;
+        m_swap = reader.swap();
+        m_has_z = header.has_z;
+        m_srid = header.srid;
+        return true;
+    }
+
+private:
+    const boost::uint8_t* m_first;
+    std::size_t m_size;
+    std::size_t m_stride;
+    bool m_swap;
+    bool m_has_z;
+    boost::uint32_t m_srid;
+};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Linestring adapting a WKB or EWKB LineString, the coordinates are
+    read from the memory when the points are accessed
+\details The view is read-only and refers to the memory which has to be
+    valid as long as the view is used.
+*/
+template <typename Point>
+class wkb_linestring_view
+    : public detail::wkb::point_span_view<Point>
+{
+public:
+    wkb_linestring_view()
+    {}
+
+    template <typename ByteType>
+    wkb_linestring_view(ByteType const* bytes, std::size_t size)
+    {
+        assign(bytes, size);
+    }
+
+    //! Returns false if the bytes are not a LineString, the view is empty then
+    template <typename ByteType>
+    inline bool assign(ByteType const* bytes, std::size_t size)
+    {
+        return detail::wkb::point_span_view<Point>::assign(bytes, size,
+                    detail::wkb::geometry_type_ogc::linestring, 0);
+    }
+};
+
+/*!
+\brief Ring adapting a ring of a WKB or EWKB Polygon, the coordinates are
+    read from the memory when the points are accessed
+\details The view is read-only and refers to the memory which has to be
+    valid as long as the view is used. The order and the closure of the
+    ring are not checked.
+*/
+template
+<
+    typename Point,
+    bool ClockWise = true,
+    bool Closed = true
+>
+class wkb_ring_view
+    : public detail::wkb::point_span_view<Point>
+{
+public:
+    wkb_ring_view()
+    {}
+
+    template <typename ByteType>
+    wkb_ring_view(ByteType const* bytes, std::size_t size, std::size_t ring_index = 0)
+    {
+        assign(bytes, size, ring_index);
+    }
+
+    //! Returns false if the bytes are not a Polygon having the ring with
+    //! the given index, the exterior ring has index 0
+    template <typename ByteType>
+    inline bool assign(ByteType const* bytes, std::size_t size, std::size_t ring_index = 0)
+    {
+        return detail::wkb::point_span_view<Point>::assign(bytes, size,
+                    detail::wkb::geometry_type_ogc::polygon, ring_index);
+    }
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename Point>
+struct tag<wkb_linestring_view<Point> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<wkb_ring_view<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool Closed>
+struct point_order<wkb_ring_view<Point, false, Closed> >
+{
+    static const order_selector value = counterclockwise;
+};
+
+template <typename Point, bool ClockWise>
+struct closure<wkb_ring_view<Point, ClockWise, false> >
+{
+    static const closure_selector value = open;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
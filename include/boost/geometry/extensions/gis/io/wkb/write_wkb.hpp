@@ -9,12 +9,24 @@
 #ifndef BOOST_GEOMETRY_IO_WKB_WRITE_WKB_HPP
 #define BOOST_GEOMETRY_IO_WKB_WRITE_WKB_HPP
 
+#include <cstddef>
 #include <iterator>
-
+#include <limits>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
 #include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_integral.hpp>
 #include <boost/static_assert.hpp>
 
 #include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/span_writer.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/writer.hpp>
 
 namespace boost { namespace geometry
@@ -77,7 +89,7 @@ inline bool write_wkb(const G& geometry, OutputIterator iter)
         >::value));
 
 // Will write in the native byte order
-#ifdef BOOST_BIG_ENDIAN
+#if BOOST_ENDIAN_BIG_BYTE
         detail::wkb::byte_order_type::enum_t byte_order =  detail::wkb::byte_order_type::xdr;
 #else
         detail::wkb::byte_order_type::enum_t byte_order =  detail::wkb::byte_order_type::ndr;
@@ -96,6 +108,120 @@ inline bool write_wkb(const G& geometry, OutputIterator iter)
     return true;
 }
 
+/*!
+\brief Returns the exact number of bytes of the WKB of a geometry
+*/
+template <typename Geometry>
+inline std::size_t wkb_size(Geometry const& geometry)
+{
+    geometry::concepts::check<Geometry const>();
+
+    return detail::wkb::span_writer_dispatch<Geometry>::size(geometry);
+}
+
+/*!
+\brief Writes the WKB of a geometry into a preallocated buffer
+\details The coordinates are written in blocks, the ones stored contiguously
+    as doubles in the requested byte order are copied at once.
+\return The number of bytes written, 0 if the buffer is too small, in that
+    case nothing is written
+*/
+template <typename Geometry, typename ByteType>
+inline std::size_t write_wkb(Geometry const& geometry, ByteType* buffer,
+                             std::size_t size,
+                             detail::wkb::byte_order_type::enum_t byte_order)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+
+    std::size_t const result = geometry::wkb_size(geometry);
+    if (result > size)
+    {
+        return 0;
+    }
+
+    detail::wkb::span_writer writer(reinterpret_cast<boost::uint8_t*>(buffer),
+                                    byte_order);
+    detail::wkb::span_writer_dispatch<Geometry>::apply(writer, geometry);
+    return result;
+}
+
+/*!
+\brief Writes the WKB of a geometry into a preallocated buffer in the
+    native byte order
+*/
+template <typename Geometry, typename ByteType>
+inline std::size_t write_wkb(Geometry const& geometry, ByteType* buffer,
+                             std::size_t size)
+{
+    return geometry::write_wkb(geometry, buffer, size,
+                               detail::wkb::native_byte_order());
+}
+
+/*!
+\brief Writes the WKBs of a range of geometries one after another into
+    a contiguous buffer, like a binary column of Apache Arrow
+\details The WKBs are appended to data. The offsets of the WKBs in data are
+    appended to offsets, preceded by the offset of the first one if offsets
+    is empty, so the i-th WKB is stored between offsets[i] and offsets[i+1].
+    The sizes are computed first and data is resized once.
+\return false if the offsets can not be represented by Offset, in that case
+    nothing is appended
+*/
+template <typename Geometries, typename ByteType, typename Offset>
+inline bool write_wkb_batch(Geometries const& geometries,
+                            std::vector<ByteType>& data,
+                            std::vector<Offset>& offsets,
+                            detail::wkb::byte_order_type::enum_t byte_order)
+{
+    BOOST_STATIC_ASSERT((boost::is_integral<ByteType>::value));
+    BOOST_STATIC_ASSERT((sizeof(boost::uint8_t) == sizeof(ByteType)));
+    BOOST_STATIC_ASSERT((boost::is_integral<Offset>::value));
+
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+    typedef typename boost::range_iterator<Geometries const>::type iterator_type;
+    typedef detail::wkb::span_writer_dispatch<geometry_type> writer_type;
+
+    geometry::concepts::check<geometry_type const>();
+
+    std::size_t const first_offset = offsets.size();
+    bool const add_first = offsets.empty();
+    std::size_t const max_offset = std::size_t((std::numeric_limits<Offset>::max)());
+
+    std::size_t end = data.size();
+    if (end > max_offset)
+    {
+        return false;
+    }
+
+    offsets.reserve(offsets.size() + boost::size(geometries) + (add_first ? 1 : 0));
+    if (add_first)
+    {
+        offsets.push_back(Offset(end));
+    }
+    for (iterator_type it = boost::begin(geometries) ; it != boost::end(geometries) ; ++it)
+    {
+        end += writer_type::size(*it);
+        if (end > max_offset)
+        {
+            offsets.resize(first_offset);
+            return false;
+        }
+        offsets.push_back(Offset(end));
+    }
+
+    std::size_t const start = data.size();
+    data.resize(end);
+
+    detail::wkb::span_writer writer(reinterpret_cast<boost::uint8_t*>(data.data()) + start,
+                                    byte_order);
+    for (iterator_type it = boost::begin(geometries) ; it != boost::end(geometries) ; ++it)
+    {
+        writer_type::apply(writer, *it);
+    }
+    return true;
+}
+
 // 	template <typename G, typename OutputIterator>
 // 	inline bool write_wkb(G& geometry, OutputIterator iter, 
 // 		detail::wkb::byte_order_type::enum_t source_byte_order, 
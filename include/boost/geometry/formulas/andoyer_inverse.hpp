@@ -62,6 +62,26 @@ public:
                                     T2 const& lon2,
                                     T2 const& lat2,
                                     Spheroid const& spheroid)
+    {
+        return apply(lon1, lat1, CT(sin(lat1)), CT(cos(lat1)),
+                     lon2, lat2, CT(sin(lat2)), CT(cos(lat2)),
+                     spheroid);
+    }
+
+    /*!
+    \brief The same as above but with the sines and cosines of the latitudes
+           calculated by the caller, e.g. once per point for many pairs.
+    */
+    template <typename T1, typename T2, typename Spheroid>
+    static inline result_type apply(T1 const& lon1,
+                                    T1 const& lat1,
+                                    CT const& sin_lat1,
+                                    CT const& cos_lat1,
+                                    T2 const& lon2,
+                                    T2 const& lat2,
+                                    CT const& sin_lat2,
+                                    CT const& cos_lat2,
+                                    Spheroid const& spheroid)
     {
         result_type result;
 
@@ -80,10 +100,6 @@ public:
         CT const dlon = lon2 - lon1;
         CT const sin_dlon = sin(dlon);
         CT const cos_dlon = cos(dlon);
-        CT const sin_lat1 = sin(lat1);
-        CT const cos_lat1 = cos(lat1);
-        CT const sin_lat2 = sin(lat2);
-        CT const cos_lat2 = cos(lat2);
 
         // H,G,T = infinity if cos_d = 1 or cos_d = -1
         // lat1 == +-90 && lat2 == +-90
@@ -12,6 +12,8 @@
 #ifndef BOOST_GEOMETRY_FORMULAS_AREA_FORMULAS_HPP
 #define BOOST_GEOMETRY_FORMULAS_AREA_FORMULAS_HPP
 
+#include <boost/static_assert.hpp>
+
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/formulas/flattening.hpp>
 #include <boost/geometry/util/math.hpp>
@@ -326,8 +328,9 @@ public:
         the set of coefficients coeffs2[]
     */
 
+    template <typename CoeffsType>
     static inline void evaluate_coeffs_var2(CT const& var2,
-                                            CT const coeffs1[],
+                                            CoeffsType const coeffs1[],
                                             CT coeffs2[])
     {
         std::size_t begin(0), end(0);
@@ -406,6 +409,8 @@ public:
 
     /*
         Compute the ellipsoidal correction of a geodesic (or shperical) segment
+        The values depending only on the spheroid are taken from
+        spheroid_const, see spheroid_coefficients
     */
     template <
                 template <typename, bool, bool, bool, bool, bool> class Inverse,
@@ -435,17 +440,18 @@ public:
         // Constants
 
         CT const ep = spheroid_const.m_ep;
-        CT const f = formula::flattening<CT>(spheroid_const.m_spheroid);
+        CT const f = spheroid_const.m_f;
         CT const one_minus_f = CT(1) - f;
         std::size_t const series_order_plus_one = SeriesOrder + 1;
         std::size_t const series_order_plus_two = SeriesOrder + 2;
 
         // Basic trigonometric computations
 
+        // cos(atan(x)) = 1 / sqrt(1 + x^2)
         CT tan_bet1 = tan(get_as_radian<1>(p1)) * one_minus_f;
         CT tan_bet2 = tan(get_as_radian<1>(p2)) * one_minus_f;
-        CT cos_bet1 = cos(atan(tan_bet1));
-        CT cos_bet2 = cos(atan(tan_bet2));
+        CT cos_bet1 = CT(1) / math::sqrt(CT(1) + math::sqr(tan_bet1));
+        CT cos_bet2 = CT(1) / math::sqrt(CT(1) + math::sqr(tan_bet2));
         CT sin_bet1 = tan_bet1 * cos_bet1;
         CT sin_bet2 = tan_bet2 * cos_bet2;
         CT sin_alp1 = sin(alp1);
@@ -505,33 +511,26 @@ public:
         CT coeffs[SeriesOrder + 1];
         const std::size_t coeffs_var_size = (series_order_plus_two
                                             * series_order_plus_one) / 2;
-        CT coeffs_var[coeffs_var_size];
+        BOOST_STATIC_ASSERT(SpheroidConst::area_coeffs_size == coeffs_var_size);
 
         if(ExpandEpsN){ // expand by eps and n
 
             CT k2 = math::sqr(ep * cos_alp0);
             CT sqrt_k2_plus_one = math::sqrt(CT(1) + k2);
             CT eps = (sqrt_k2_plus_one - CT(1)) / (sqrt_k2_plus_one + CT(1));
-            CT n = f / (CT(2) - f);
-
-            // Generate and evaluate the polynomials on n
-            // to get the series coefficients (that depend on eps)
-            evaluate_coeffs_n(n, coeffs_var);
 
-            // Generate and evaluate the polynomials on eps (i.e. var2 = eps)
+            // The polynomials on n are evaluated once per spheroid,
+            // evaluate the polynomials on eps (i.e. var2 = eps)
             // to get the final series coefficients
-            evaluate_coeffs_var2(eps, coeffs_var, coeffs);
+            evaluate_coeffs_var2(eps, spheroid_const.m_area_coeffs_n, coeffs);
 
         }else{ // expand by k2 and ep
 
             CT k2 = math::sqr(ep * cos_alp0);
-            CT ep2 = math::sqr(ep);
-
-            // Generate and evaluate the polynomials on ep2
-            evaluate_coeffs_ep(ep2, coeffs_var);
 
-            // Generate and evaluate the polynomials on k2 (i.e. var2 = k2)
-            evaluate_coeffs_var2(k2, coeffs_var, coeffs);
+            // The polynomials on ep2 are evaluated once per spheroid,
+            // evaluate the polynomials on k2 (i.e. var2 = k2)
+            evaluate_coeffs_var2(k2, spheroid_const.m_area_coeffs_ep, coeffs);
 
         }
 
@@ -0,0 +1,430 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
+#define BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/flattening.hpp>
+#include <boost/geometry/formulas/karney_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+
+#include <boost/geometry/util/executor.hpp>
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace inverse_batch
+{
+
+// Any inverse formula, only the coordinates are stored.
+template <typename CT, typename Inverse, typename Spheroid>
+struct generic_kernel
+{
+    struct points
+    {
+        std::vector<CT> lon;
+        std::vector<CT> lat;
+
+        void reserve(std::size_t n)
+        {
+            lon.reserve(n);
+            lat.reserve(n);
+        }
+
+        std::size_t size() const
+        {
+            return lon.size();
+        }
+    };
+
+    explicit inline generic_kernel(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    inline void push_back(points & pts, CT const& lon, CT const& lat) const
+    {
+        pts.lon.push_back(lon);
+        pts.lat.push_back(lat);
+    }
+
+    template <typename OutputIterator>
+    inline void apply(points const& pts1, std::size_t i,
+                      points const& pts2, std::size_t first, std::size_t last,
+                      OutputIterator out) const
+    {
+        CT const lon1 = pts1.lon[i];
+        CT const lat1 = pts1.lat[i];
+        CT const* const lon2 = pts2.lon.data();
+        CT const* const lat2 = pts2.lat.data();
+
+        for (std::size_t j = first ; j < last ; ++j, ++out)
+        {
+            *out = Inverse::apply(lon1, lat1, lon2[j], lat2[j], m_spheroid).distance;
+        }
+    }
+
+    Spheroid m_spheroid;
+};
+
+// Andoyer, sines and cosines of latitudes are calculated once per point.
+template <typename CT, typename Inverse, typename Spheroid>
+struct andoyer_kernel
+{
+    struct points
+    {
+        std::vector<CT> lon;
+        std::vector<CT> lat;
+        std::vector<CT> sin_lat;
+        std::vector<CT> cos_lat;
+
+        void reserve(std::size_t n)
+        {
+            lon.reserve(n);
+            lat.reserve(n);
+            sin_lat.reserve(n);
+            cos_lat.reserve(n);
+        }
+
+        std::size_t size() const
+        {
+            return lon.size();
+        }
+    };
+
+    explicit inline andoyer_kernel(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    inline void push_back(points & pts, CT const& lon, CT const& lat) const
+    {
+        pts.lon.push_back(lon);
+        pts.lat.push_back(lat);
+        pts.sin_lat.push_back(sin(lat));
+        pts.cos_lat.push_back(cos(lat));
+    }
+
+    template <typename OutputIterator>
+    inline void apply(points const& pts1, std::size_t i,
+                      points const& pts2, std::size_t first, std::size_t last,
+                      OutputIterator out) const
+    {
+        CT const lon1 = pts1.lon[i];
+        CT const lat1 = pts1.lat[i];
+        CT const sin_lat1 = pts1.sin_lat[i];
+        CT const cos_lat1 = pts1.cos_lat[i];
+        CT const* const lon2 = pts2.lon.data();
+        CT const* const lat2 = pts2.lat.data();
+        CT const* const sin_lat2 = pts2.sin_lat.data();
+        CT const* const cos_lat2 = pts2.cos_lat.data();
+
+        for (std::size_t j = first ; j < last ; ++j, ++out)
+        {
+            *out = Inverse::apply(lon1, lat1, sin_lat1, cos_lat1,
+                                  lon2[j], lat2[j], sin_lat2[j], cos_lat2[j],
+                                  m_spheroid).distance;
+        }
+    }
+
+    Spheroid m_spheroid;
+};
+
+// Thomas, reduced latitudes are calculated once per point.
+template <typename CT, typename Inverse, typename Spheroid>
+struct thomas_kernel
+{
+    struct points
+    {
+        std::vector<CT> lon;
+        std::vector<CT> lat;
+        std::vector<CT> theta;
+
+        void reserve(std::size_t n)
+        {
+            lon.reserve(n);
+            lat.reserve(n);
+            theta.reserve(n);
+        }
+
+        std::size_t size() const
+        {
+            return lon.size();
+        }
+    };
+
+    explicit inline thomas_kernel(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    inline void push_back(points & pts, CT const& lon, CT const& lat) const
+    {
+        pts.lon.push_back(lon);
+        pts.lat.push_back(lat);
+        pts.theta.push_back(Inverse::reduced_latitude(lat,
+                                formula::flattening<CT>(m_spheroid)));
+    }
+
+    template <typename OutputIterator>
+    inline void apply(points const& pts1, std::size_t i,
+                      points const& pts2, std::size_t first, std::size_t last,
+                      OutputIterator out) const
+    {
+        CT const lon1 = pts1.lon[i];
+        CT const lat1 = pts1.lat[i];
+        CT const theta1 = pts1.theta[i];
+        CT const* const lon2 = pts2.lon.data();
+        CT const* const lat2 = pts2.lat.data();
+        CT const* const theta2 = pts2.theta.data();
+
+        for (std::size_t j = first ; j < last ; ++j, ++out)
+        {
+            *out = Inverse::apply(lon1, lat1, theta1,
+                                  lon2[j], lat2[j], theta2[j],
+                                  m_spheroid).distance;
+        }
+    }
+
+    Spheroid m_spheroid;
+};
+
+// Vincenty, sines and cosines of reduced latitudes are calculated once
+// per point.
+template <typename CT, typename Inverse, typename Spheroid>
+struct vincenty_kernel
+{
+    struct points
+    {
+        std::vector<CT> lon;
+        std::vector<CT> lat;
+        std::vector<CT> sin_u;
+        std::vector<CT> cos_u;
+
+        void reserve(std::size_t n)
+        {
+            lon.reserve(n);
+            lat.reserve(n);
+            sin_u.reserve(n);
+            cos_u.reserve(n);
+        }
+
+        std::size_t size() const
+        {
+            return lon.size();
+        }
+    };
+
+    explicit inline vincenty_kernel(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    inline void push_back(points & pts, CT const& lon, CT const& lat) const
+    {
+        CT sin_u, cos_u;
+        Inverse::reduced_latitude(lat, formula::flattening<CT>(m_spheroid),
+                                  sin_u, cos_u);
+        pts.lon.push_back(lon);
+        pts.lat.push_back(lat);
+        pts.sin_u.push_back(sin_u);
+        pts.cos_u.push_back(cos_u);
+    }
+
+    template <typename OutputIterator>
+    inline void apply(points const& pts1, std::size_t i,
+                      points const& pts2, std::size_t first, std::size_t last,
+                      OutputIterator out) const
+    {
+        CT const lon1 = pts1.lon[i];
+        CT const lat1 = pts1.lat[i];
+        CT const sin_u1 = pts1.sin_u[i];
+        CT const cos_u1 = pts1.cos_u[i];
+        CT const* const lon2 = pts2.lon.data();
+        CT const* const lat2 = pts2.lat.data();
+        CT const* const sin_u2 = pts2.sin_u.data();
+        CT const* const cos_u2 = pts2.cos_u.data();
+
+        for (std::size_t j = first ; j < last ; ++j, ++out)
+        {
+            *out = Inverse::apply(lon1, lat1, sin_u1, cos_u1,
+                                  lon2[j], lat2[j], sin_u2[j], cos_u2[j],
+                                  m_spheroid).distance;
+        }
+    }
+
+    Spheroid m_spheroid;
+};
+
+// Karney, the coefficients of the series expansions are calculated once
+// per spheroid.
+template <typename CT, typename Inverse, typename Spheroid>
+struct karney_kernel
+    : generic_kernel<CT, Inverse, Spheroid>
+{
+    typedef typename generic_kernel<CT, Inverse, Spheroid>::points points;
+
+    explicit inline karney_kernel(Spheroid const& spheroid)
+        : generic_kernel<CT, Inverse, Spheroid>(spheroid)
+        , m_coefficients(spheroid)
+    {}
+
+    template <typename OutputIterator>
+    inline void apply(points const& pts1, std::size_t i,
+                      points const& pts2, std::size_t first, std::size_t last,
+                      OutputIterator out) const
+    {
+        CT const lon1 = pts1.lon[i];
+        CT const lat1 = pts1.lat[i];
+        CT const* const lon2 = pts2.lon.data();
+        CT const* const lat2 = pts2.lat.data();
+
+        for (std::size_t j = first ; j < last ; ++j, ++out)
+        {
+            *out = Inverse::apply(lon1, lat1, lon2[j], lat2[j], m_coefficients).distance;
+        }
+    }
+
+    typename Inverse::coefficients m_coefficients;
+};
+
+// The kernel is selected by overload resolution so formulas derived from
+// the formulas below (e.g. FormulaPolicy::inverse) are handled as well.
+template <typename CT, typename Inverse, typename Spheroid>
+generic_kernel<CT, Inverse, Spheroid> select_kernel(void const*);
+
+template
+<
+    typename CT, typename Inverse, typename Spheroid,
+    typename T, bool D, bool A, bool RA, bool RL, bool GS
+>
+andoyer_kernel<CT, Inverse, Spheroid> select_kernel(andoyer_inverse<T, D, A, RA, RL, GS> const*);
+
+template
+<
+    typename CT, typename Inverse, typename Spheroid,
+    typename T, bool D, bool A, bool RA, bool RL, bool GS
+>
+thomas_kernel<CT, Inverse, Spheroid> select_kernel(thomas_inverse<T, D, A, RA, RL, GS> const*);
+
+template
+<
+    typename CT, typename Inverse, typename Spheroid,
+    typename T, bool D, bool A, bool RA, bool RL, bool GS
+>
+vincenty_kernel<CT, Inverse, Spheroid> select_kernel(vincenty_inverse<T, D, A, RA, RL, GS> const*);
+
+template
+<
+    typename CT, typename Inverse, typename Spheroid,
+    typename T, bool D, bool A, bool RA, bool RL, bool GS, std::size_t O
+>
+karney_kernel<CT, Inverse, Spheroid> select_kernel(karney_inverse<T, D, A, RA, RL, GS, O> const*);
+
+}} // namespace detail::inverse_batch
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Calculates the distances of the inverse problem of geodesics for many
+       pairs of points, e.g. one-to-many distances or distance matrices.
+\details The points are prepared once. Besides the coordinates the values
+    which depend only on a single point and the spheroid (e.g. sines and
+    cosines of latitudes for Andoyer, reduced latitudes for Thomas and
+    Vincenty) are calculated at that time and stored as structure of arrays
+    so the inner loops only read contiguous memory. For Karney the
+    coefficients of the series expansions are calculated once per spheroid.
+    Any other inverse formula is called per pair with the stored
+    coordinates. The results are the same as the results of
+    Inverse::apply() called for every pair.
+\tparam CT Calculation type
+\tparam Inverse Inverse formula, e.g. andoyer_inverse<CT, true, false>
+\tparam Spheroid The spheroid model
+*/
+template <typename CT, typename Inverse, typename Spheroid>
+class inverse_batch
+{
+    typedef decltype(detail::inverse_batch::select_kernel
+        <
+            CT, Inverse, Spheroid
+        >(static_cast<Inverse const*>(0))) kernel_type;
+
+public:
+    //! The prepared points, must only be used with the batch which created them
+    typedef typename kernel_type::points points_type;
+
+    explicit inline inverse_batch(Spheroid const& spheroid)
+        : m_kernel(spheroid)
+    {}
+
+    //! Appends a point, coordinates in the units expected by Inverse
+    inline void push_back(points_type & points, CT const& lon, CT const& lat) const
+    {
+        m_kernel.push_back(points, lon, lat);
+    }
+
+    //! Stores distances between points1[i] and points2[first, last) in out
+    template <typename OutputIterator>
+    inline void apply(points_type const& points1, std::size_t i,
+                      points_type const& points2,
+                      std::size_t first, std::size_t last,
+                      OutputIterator out) const
+    {
+        m_kernel.apply(points1, i, points2, first, last, out);
+    }
+
+    //! Stores the row-major distance matrix, points1.size() x points2.size()
+    template <typename RandomAccessIterator>
+    inline void apply(points_type const& points1, points_type const& points2,
+                      RandomAccessIterator out) const
+    {
+        apply(points1, points2, out, sequential_executor());
+    }
+
+    //! Stores the row-major distance matrix, rows are calculated by executor
+    template <typename RandomAccessIterator, typename Executor>
+    inline void apply(points_type const& points1, points_type const& points2,
+                      RandomAccessIterator out, Executor const& executor) const
+    {
+        std::size_t const size2 = points2.size();
+        if (size2 == 0)
+        {
+            return;
+        }
+
+        // A few thousands of pairs per task
+        std::size_t const rows = (std::max)(std::size_t(1), std::size_t(4096) / size2);
+
+        geometry::detail::for_each_chunk(executor, points1.size(), rows,
+            [&](std::size_t first, std::size_t last)
+            {
+                for (std::size_t i = first ; i < last ; ++i)
+                {
+                    m_kernel.apply(points1, i, points2, 0, size2,
+                                   out + i * size2);
+                }
+            });
+    }
+
+    inline Spheroid const& model() const
+    {
+        return m_kernel.m_spheroid;
+    }
+
+private:
+    kernel_type m_kernel;
+};
+
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_INVERSE_BATCH_HPP
@@ -98,16 +98,64 @@ class karney_inverse
 public:
     typedef result_inverse<CT> result_type;
 
+    /*!
+    \brief The values depending only on the spheroid, including the
+           coefficients of the series expansions in the third flattening n.
+    \details They can be calculated once and passed to apply() for many
+        pairs of points.
+    */
+    struct coefficients
+    {
+        template <typename Spheroid>
+        explicit inline coefficients(Spheroid const& spheroid)
+            : a(get_radius<0>(spheroid))
+            , b(get_radius<2>(spheroid))
+            , f(formula::flattening<CT>(spheroid))
+            , n(f / (CT(2) - f))
+            , ep2(f * (CT(2) - f) / math::sqr(CT(1) - f))
+            , etol2(CT(0.1) * sqrt(std::numeric_limits<CT>::epsilon())
+                    / sqrt((std::max)(CT(0.001), std::abs(f))
+                           * (std::min)(CT(1), CT(1) - f / CT(2)) / CT(2)))
+            , coeffs_C1(n)
+            , coeffs_A3(n)
+            , coeffs_C3x(n)
+        {}
+
+        CT a;
+        CT b;
+        CT f;
+        CT n;
+        CT ep2;
+        CT etol2;
+
+        // Index zero element of coeffs_C1 is unused.
+        se::coeffs_C1<SeriesOrder, CT> coeffs_C1;
+        se::coeffs_A3<SeriesOrder, CT> coeffs_A3;
+        se::coeffs_C3x<SeriesOrder, CT> coeffs_C3x;
+    };
+
     template <typename T1, typename T2, typename Spheroid>
     static inline result_type apply(T1 const& lo1,
                                     T1 const& la1,
                                     T2 const& lo2,
                                     T2 const& la2,
                                     Spheroid const& spheroid)
+    {
+        return apply(lo1, la1, lo2, la2, coefficients(spheroid));
+    }
+
+    /*!
+    \brief The same as above but with the values depending on the spheroid
+           calculated by the caller, e.g. once for many pairs.
+    */
+    template <typename T1, typename T2>
+    static inline result_type apply(T1 const& lo1,
+                                    T1 const& la1,
+                                    T2 const& lo2,
+                                    T2 const& la2,
+                                    coefficients const& coeffs)
     {
         static CT const c0 = 0;
-        static CT const c0_001 = 0.001;
-        static CT const c0_1 = 0.1;
         static CT const c1 = 1;
         static CT const c2 = 2;
         static CT const c3 = 3;
@@ -128,11 +176,10 @@ public:
         CT lon1 = lo1;
         CT lon2 = lo2;
 
-        CT const a = CT(get_radius<0>(spheroid));
-        CT const b = CT(get_radius<2>(spheroid));
-        CT const f = formula::flattening<CT>(spheroid);
+        CT const a = coeffs.a;
+        CT const b = coeffs.b;
+        CT const f = coeffs.f;
         CT const one_minus_f = c1 - f;
-        CT const two_minus_f = c2 - f;
 
         CT const tol0 = std::numeric_limits<CT>::epsilon();
         CT const tol1 = c200 * tol0;
@@ -141,14 +188,13 @@ public:
         // Check on bisection interval.
         CT const tol_bisection = tol0 * tol2;
 
-        CT const etol2 = c0_1 * tol2 /
-            sqrt((std::max)(c0_001, std::abs(f)) * (std::min)(c1, c1 - f / c2) / c2);
+        CT const etol2 = coeffs.etol2;
 
         CT tiny = std::sqrt((std::numeric_limits<CT>::min)());
 
-        CT const n = f / two_minus_f;
-        CT const e2 = f * two_minus_f;
-        CT const ep2 = e2 / math::sqr(one_minus_f);
+        CT const n = coeffs.n;
+        CT const ep2 = coeffs.ep2;
+        se::coeffs_C1<SeriesOrder, CT> const& coeffs_C1 = coeffs.coeffs_C1;
 
         // Compute the longitudinal difference.
         CT lon12_error;
@@ -239,9 +285,6 @@ public:
         CT sigma12;
         CT m12x, s12x, M21;
 
-        // Index zero element of coeffs_C1 is unused.
-        se::coeffs_C1<SeriesOrder, CT> const coeffs_C1(n);
-
         bool meridian = lat1 == -90 || sin_lam12 == 0;
 
         CT cos_alpha1, sin_alpha1;
@@ -315,6 +358,9 @@ public:
             // If point1 and point2 belong within a hemisphere bounded by a
             // meridian and geodesic is neither meridional nor equatorial.
 
+            se::coeffs_A3<SeriesOrder, CT> const& coeffs_A3 = coeffs.coeffs_A3;
+            se::coeffs_C3x<SeriesOrder, CT> const& coeffs_C3x = coeffs.coeffs_C3x;
+
             // Find the starting point for Newton's method.
             CT dnm;
             sigma12 = newton_start(sin_beta1, cos_beta1, dn1,
@@ -322,7 +368,7 @@ public:
                                    lam12, sin_lam12, cos_lam12,
                                    sin_alpha1, cos_alpha1,
                                    sin_alpha2, cos_alpha2,
-                                   dnm, coeffs_C1, ep2,
+                                   dnm, coeffs_C1, coeffs_A3, ep2,
                                    tol1, tol2, etol2,
                                    n, f);
 
@@ -368,7 +414,8 @@ public:
                                     sin_sigma2, cos_sigma2,
                                     eps, diff_omega12,
                                     iteration < max_iterations,
-                                    dv, f, n, ep2, tiny, coeffs_C1);
+                                    dv, f, ep2, tiny, coeffs_C1,
+                                    coeffs_A3, coeffs_C3x);
 
                     // Reversed test to allow escape with NaNs.
                     if (tripb || !(std::abs(v) >= (tripn ? c8 : c1) * tol0))
@@ -576,13 +623,14 @@ public:
      doesn't need to be used, return also sin_alpha2 and
      cos_alpha2 and function value is sig12.
     */
-    template <typename CoeffsC1>
+    template <typename CoeffsC1, typename CoeffsA3>
     static inline CT newton_start(CT const& sin_beta1, CT const& cos_beta1, CT const& dn1,
                                   CT const& sin_beta2, CT const& cos_beta2, CT dn2,
                                   CT const& lam12, CT const& sin_lam12, CT const& cos_lam12,
                                   CT& sin_alpha1, CT& cos_alpha1,
                                   CT& sin_alpha2, CT& cos_alpha2,
-                                  CT& dnm, CoeffsC1 const& coeffs_C1, CT const& ep2,
+                                  CT& dnm, CoeffsC1 const& coeffs_C1,
+                                  CoeffsA3 const& coeffs_A3, CT const& ep2,
                                   CT const& tol1, CT const& tol2, CT const& etol2, CT const& n, CT const& f)
     {
         static CT const c0 = 0;
@@ -675,8 +723,6 @@ public:
                 CT k2 = math::sqr(sin_beta1) * ep2;
                 CT eps = k2 / (c2 * (c1 + sqrt(c1 + k2)) + k2);
 
-                se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
-
                 CT const A3 = math::horner_evaluate(eps, coeffs_A3.begin(), coeffs_A3.end());
 
                 lambda_scale = f * cos_beta1 * A3 * pi;
@@ -831,7 +877,7 @@ public:
         return k;
     }
 
-    template <typename CoeffsC1>
+    template <typename CoeffsC1, typename CoeffsA3, typename CoeffsC3x>
     static inline CT lambda12(CT const& sin_beta1, CT const& cos_beta1, CT const& dn1,
                               CT const& sin_beta2, CT const& cos_beta2, CT const& dn2,
                               CT const& sin_alpha1, CT cos_alpha1,
@@ -842,8 +888,10 @@ public:
                               CT& sin_sigma2, CT& cos_sigma2,
                               CT& eps, CT& diff_omega12,
                               bool diffp, CT& diff_lam12,
-                              CT const& f, CT const& n, CT const& ep2, CT const& tiny,
-                              CoeffsC1 const& coeffs_C1)
+                              CT const& f, CT const& ep2, CT const& tiny,
+                              CoeffsC1 const& coeffs_C1,
+                              CoeffsA3 const& coeffs_A3,
+                              CoeffsC3x const& coeffs_C3x)
     {
         static CT const c0 = 0;
         static CT const c1 = 1;
@@ -915,13 +963,11 @@ public:
 
         eps = k2 / (c2 * (c1 + std::sqrt(c1 + k2)) + k2);
 
-        se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(n, eps);
+        se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(coeffs_C3x, eps);
 
         B312 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C3)
              - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C3);
 
-        se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(n);
-
         CT const A3 = math::horner_evaluate(eps, coeffs_A3.begin(), coeffs_A3.end());
 
         diff_omega12 = -f * A3 * sin_alpha0 * (sigma12 + B312);
@@ -105,6 +105,37 @@ public :
         return res;
     }
 
+    // The same as apply() above but with the lengths of meridian arcs from the
+    // equator to the latitudes and to the pole, i.e. apply(lat, spheroid),
+    // calculated by the caller, e.g. once per point for many pairs.
+    template <typename T>
+    static result apply(T lon1, T lat1, CT const& arc1,
+                        T lon2, T lat2, CT const& arc2,
+                        CT const& quarter_arc)
+    {
+        result res;
+
+        CT diff = geometry::math::longitude_distance_signed<geometry::radian>(lon1, lon2);
+
+        if (lat1 > lat2)
+        {
+            std::swap(lat1, lat2);
+        }
+
+        if ( meridian_not_crossing_pole(lat1, lat2, diff) )
+        {
+            res.distance = math::abs(arc2 - arc1);
+            res.meridian = true;
+        }
+        else if ( meridian_crossing_pole(diff) )
+        {
+            CT const lat_sign = lat1 + lat2 < CT(0) ? CT(-1) : CT(1);
+            res.distance = math::abs(lat_sign * CT(2) * quarter_arc - arc1 - arc2);
+            res.meridian = true;
+        }
+        return res;
+    }
+
     // Distance computation on meridians using series approximations
     // to elliptic integrals. Formula to compute distance from lattitude 0 to lat
     // https://en.wikipedia.org/wiki/Meridian_arc
@@ -0,0 +1,78 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_FORMULAS_SPHEROID_COEFFICIENTS_HPP
+#define BOOST_GEOMETRY_FORMULAS_SPHEROID_COEFFICIENTS_HPP
+
+
+#include <cstddef>
+
+#include <boost/geometry/core/radius.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/formulas/area_formulas.hpp>
+#include <boost/geometry/formulas/authalic_radius_sqr.hpp>
+#include <boost/geometry/formulas/eccentricity_sqr.hpp>
+#include <boost/geometry/formulas/flattening.hpp>
+
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+/*!
+\brief Values depending only on the spheroid. They are calculated once, e.g.
+       when a strategy is created, and passed to the formulas instead of
+       being recalculated for every point or segment.
+\tparam CT Calculation type
+\tparam SeriesOrder The order of the series expansion of the geodesic area
+        integral (see area_formulas)
+*/
+template <typename CT, std::size_t SeriesOrder = 2>
+struct spheroid_coefficients
+{
+    static const std::size_t area_coeffs_size = ((SeriesOrder + 2) * (SeriesOrder + 1)) / 2;
+
+    template <typename Spheroid>
+    explicit inline spheroid_coefficients(Spheroid const& spheroid)
+        : m_a(get_radius<0>(spheroid))
+        , m_b(get_radius<2>(spheroid))
+        , m_f(formula::flattening<CT>(spheroid))
+        , m_n(m_f / (CT(2) - m_f))
+        , m_a2(math::sqr(get_radius<0>(spheroid)))
+        , m_e2(formula::eccentricity_sqr<CT>(spheroid))
+        , m_ep2(m_e2 / (CT(1) - m_e2))
+        , m_ep(math::sqrt(m_ep2))
+        , m_c2(formula_dispatch::authalic_radius_sqr
+                <
+                    CT, Spheroid, srs_spheroid_tag
+                >::apply(m_a2, m_e2))
+    {
+        area_formulas<CT, SeriesOrder, true>::evaluate_coeffs_n(m_n, m_area_coeffs_n);
+        area_formulas<CT, SeriesOrder, false>::evaluate_coeffs_ep(math::sqr(m_ep), m_area_coeffs_ep);
+    }
+
+    CT m_a;   // equatorial radius
+    CT m_b;   // polar radius
+    CT m_f;   // flattening
+    CT m_n;   // third flattening
+    CT m_a2;  // squared equatorial radius
+    CT m_e2;  // squared eccentricity
+    CT m_ep2; // squared second eccentricity
+    CT m_ep;  // second eccentricity
+    CT m_c2;  // squared authalic radius
+
+    // Polynomials of the area series evaluated on n and on ep2 respectively
+    CT m_area_coeffs_n[area_coeffs_size];
+    CT m_area_coeffs_ep[area_coeffs_size];
+};
+
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_SPHEROID_COEFFICIENTS_HPP
@@ -61,6 +61,41 @@ public:
                                     T2 const& lon2,
                                     T2 const& lat2,
                                     Spheroid const& spheroid)
+    {
+        CT const f = formula::flattening<CT>(spheroid);
+
+        return apply(lon1, lat1, reduced_latitude(lat1, f),
+                     lon2, lat2, reduced_latitude(lat2, f),
+                     spheroid);
+    }
+
+    //! Returns the reduced (parametric) latitude of lat, f is the flattening
+    template <typename T>
+    static inline CT reduced_latitude(T const& lat, CT const& f)
+    {
+        CT const pi_half = math::pi<CT>() / CT(2);
+        CT const one_minus_f = CT(1) - f;
+
+//        CT const tan_theta = one_minus_f * tan(lat);
+//        CT const theta = atan(tan_theta);
+
+        return math::equals(lat, pi_half) ? CT(lat) :
+               math::equals(lat, -pi_half) ? CT(lat) :
+               CT(atan(one_minus_f * tan(lat)));
+    }
+
+    /*!
+    \brief The same as above but with the reduced latitudes calculated
+           by the caller, e.g. once per point for many pairs.
+    */
+    template <typename T1, typename T2, typename Spheroid>
+    static inline result_type apply(T1 const& lon1,
+                                    T1 const& lat1,
+                                    CT const& theta1,
+                                    T2 const& lon2,
+                                    T2 const& lat2,
+                                    CT const& theta2,
+                                    Spheroid const& spheroid)
     {
         result_type result;
 
@@ -76,21 +111,7 @@ public:
         CT const c2 = 2;
         CT const c4 = 4;
 
-        CT const pi_half = math::pi<CT>() / c2;
         CT const f = formula::flattening<CT>(spheroid);
-        CT const one_minus_f = c1 - f;
-
-//        CT const tan_theta1 = one_minus_f * tan(lat1);
-//        CT const tan_theta2 = one_minus_f * tan(lat2);
-//        CT const theta1 = atan(tan_theta1);
-//        CT const theta2 = atan(tan_theta2);
-
-        CT const theta1 = math::equals(lat1, pi_half) ? lat1 :
-                          math::equals(lat1, -pi_half) ? lat1 :
-                          atan(one_minus_f * tan(lat1));
-        CT const theta2 = math::equals(lat2, pi_half) ? lat2 :
-                          math::equals(lat2, -pi_half) ? lat2 :
-                          atan(one_minus_f * tan(lat2));
 
         CT const theta_m = (theta1 + theta2) / c2;
         CT const d_theta_m = (theta2 - theta1) / c2;
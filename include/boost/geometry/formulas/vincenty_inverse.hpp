@@ -71,6 +71,55 @@ public:
                                     T2 const& lon2,
                                     T2 const& lat2,
                                     Spheroid const& spheroid)
+    {
+        CT const f = formula::flattening<CT>(spheroid);
+
+        CT sin_U1, cos_U1, sin_U2, cos_U2;
+        reduced_latitude(lat1, f, sin_U1, cos_U1);
+        reduced_latitude(lat2, f, sin_U2, cos_U2);
+
+        return apply(lon1, lat1, sin_U1, cos_U1,
+                     lon2, lat2, sin_U2, cos_U2,
+                     spheroid);
+    }
+
+    //! Calculates the sine and cosine of the reduced latitude U of lat,
+    //! defined by tan U = (1-f) tan lat, f is the flattening
+    template <typename T>
+    static inline void reduced_latitude(T const& lat, CT const& f,
+                                        CT & sin_U, CT & cos_U)
+    {
+        CT const c1 = 1;
+        CT const tan_U = (c1 - f) * tan(lat); // above (1)
+
+        // calculate sin U and cos U using trigonometric identities
+        // cos = 1 / sqrt(1 + tan^2)
+        cos_U = c1 / math::sqrt(c1 + math::sqr(tan_U));
+        // sin = tan / sqrt(1 + tan^2)
+        // sin = tan * cos
+        sin_U = tan_U * cos_U;
+
+        // calculate sin U and cos U directly
+        //CT const U = atan(tan_U);
+        //cos_U = cos(U);
+        //sin_U = tan_U * cos_U; // sin(U);
+    }
+
+    /*!
+    \brief The same as above but with the sines and cosines of the reduced
+           latitudes calculated by the caller, e.g. once per point for many
+           pairs, see reduced_latitude().
+    */
+    template <typename T1, typename T2, typename Spheroid>
+    static inline result_type apply(T1 const& lon1,
+                                    T1 const& lat1,
+                                    CT const& sin_U1,
+                                    CT const& cos_U1,
+                                    T2 const& lon2,
+                                    T2 const& lat2,
+                                    CT const& sin_U2,
+                                    CT const& cos_U2,
+                                    Spheroid const& spheroid)
     {
         result_type result;
 
@@ -101,30 +150,6 @@ public:
         CT const radius_b = CT(get_radius<2>(spheroid));
         CT const f = formula::flattening<CT>(spheroid);
 
-        // U: reduced latitude, defined by tan U = (1-f) tan phi
-        CT const one_min_f = c1 - f;
-        CT const tan_U1 = one_min_f * tan(lat1); // above (1)
-        CT const tan_U2 = one_min_f * tan(lat2); // above (1)
-
-        // calculate sin U and cos U using trigonometric identities
-        CT const temp_den_U1 = math::sqrt(c1 + math::sqr(tan_U1));
-        CT const temp_den_U2 = math::sqrt(c1 + math::sqr(tan_U2));
-        // cos = 1 / sqrt(1 + tan^2)
-        CT const cos_U1 = c1 / temp_den_U1;
-        CT const cos_U2 = c1 / temp_den_U2;
-        // sin = tan / sqrt(1 + tan^2)
-        // sin = tan * cos
-        CT const sin_U1 = tan_U1 * cos_U1;
-        CT const sin_U2 = tan_U2 * cos_U2;
-
-        // calculate sin U and cos U directly
-        //CT const U1 = atan(tan_U1);
-        //CT const U2 = atan(tan_U2);
-        //cos_U1 = cos(U1);
-        //cos_U2 = cos(U2);
-        //sin_U1 = tan_U1 * cos_U1; // sin(U1);
-        //sin_U2 = tan_U2 * cos_U2; // sin(U2);
-
         CT previous_lambda;
         CT sin_lambda;
         CT cos_lambda;
@@ -26,6 +26,7 @@
 #include <boost/type_traits/is_arithmetic.hpp>
 
 #include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
 #include <boost/geometry/core/coordinate_type.hpp>
@@ -100,6 +101,17 @@ struct access<std::array<CoordinateType, DimensionCount>, Dimension>
 };
 
 
+template <typename CoordinateType, std::size_t DimensionCount>
+struct contiguous_coordinates<std::array<CoordinateType, DimensionCount> >
+    : boost::integral_constant
+        <
+            bool,
+            sizeof(std::array<CoordinateType, DimensionCount>)
+                == DimensionCount * sizeof(CoordinateType)
+        >
+{};
+
+
 } // namespace traits
 #endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
 
@@ -32,6 +32,7 @@
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/coordinate_system.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 
 #if defined(BOOST_GEOMETRY_ENABLE_ACCESS_DEBUGGING)
 #include <algorithm>
@@ -262,6 +263,23 @@ struct access<model::point<CoordinateType, DimensionCount, CoordinateSystem>, Di
     }
 };
 
+// The coordinates are stored in an array, unless members are added for
+// debugging the access
+template
+<
+    typename CoordinateType,
+    std::size_t DimensionCount,
+    typename CoordinateSystem
+>
+struct contiguous_coordinates<model::point<CoordinateType, DimensionCount, CoordinateSystem> >
+    : boost::integral_constant
+        <
+            bool,
+            sizeof(model::point<CoordinateType, DimensionCount, CoordinateSystem>)
+                == DimensionCount * sizeof(CoordinateType)
+        >
+{};
+
 } // namespace traits
 #endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
 
@@ -121,6 +121,16 @@ struct access<model::d2::point_xy<CoordinateType, CoordinateSystem>, Dimension >
     }
 };
 
+template<typename CoordinateType, typename CoordinateSystem>
+struct contiguous_coordinates<model::d2::point_xy<CoordinateType, CoordinateSystem> >
+    : boost::integral_constant
+        <
+            bool,
+            sizeof(model::d2::point_xy<CoordinateType, CoordinateSystem>)
+                == 2 * sizeof(CoordinateType)
+        >
+{};
+
 } // namespace traits
 #endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
 
@@ -155,6 +155,25 @@ struct comparable_distance_call_base<G1, G2, Strategy, point_tag, box_tag>
     }
 };
 
+template
+<
+    typename G1, typename G2, typename Strategy
+>
+struct comparable_distance_call_base<G1, G2, Strategy, point_tag, segment_tag>
+{
+    typedef typename geometry::comparable_distance_result
+        <
+            G1, G2,
+            typename Strategy::comparable_distance_point_segment_strategy_type
+        >::type result_type;
+
+    static inline result_type apply(G1 const& g1, G2 const& g2, Strategy const& s)
+    {
+        return geometry::comparable_distance(g1, g2,
+                s.get_comparable_distance_point_segment_strategy());
+    }
+};
+
 template
 <
     typename G1, typename G2, typename Strategy
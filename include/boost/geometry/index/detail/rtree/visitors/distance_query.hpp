@@ -27,6 +27,18 @@ public:
 
     inline explicit distance_query_result(size_t k, OutIt out_it)
         : m_count(k), m_out_it(out_it)
+        , m_is_bounded(false), m_bound()
+    {
+        BOOST_GEOMETRY_INDEX_ASSERT(0 < m_count, "Number of neighbors should be greater than 0");
+
+        m_neighbors.reserve(m_count);
+    }
+
+    // Only the values closer than bound are stored, so the nodes not closer
+    // than bound are pruned before k neighbors are found
+    inline distance_query_result(size_t k, OutIt out_it, distance_type const& bound)
+        : m_count(k), m_out_it(out_it)
+        , m_is_bounded(true), m_bound(bound)
     {
         BOOST_GEOMETRY_INDEX_ASSERT(0 < m_count, "Number of neighbors should be greater than 0");
 
@@ -35,6 +47,9 @@ public:
 
     inline void store(Value const& val, distance_type const& curr_comp_dist)
     {
+        if ( m_is_bounded && !(curr_comp_dist < m_bound) )
+            return;
+
         if ( m_neighbors.size() < m_count )
         {
             m_neighbors.push_back(std::make_pair(curr_comp_dist, val));
@@ -56,7 +71,7 @@ public:
 
     inline bool has_enough_neighbors() const
     {
-        return m_count <= m_neighbors.size();
+        return m_is_bounded || m_count <= m_neighbors.size();
     }
 
     inline distance_type greatest_comparable_distance() const
@@ -66,7 +81,7 @@ public:
         // this is just for safety reasons since is_comparable_distance_valid() is checked earlier
         // TODO - may be replaced by ASSERT
         return m_neighbors.size() < m_count
-            ? (std::numeric_limits<distance_type>::max)()
+            ? (m_is_bounded ? m_bound : (std::numeric_limits<distance_type>::max)())
             : m_neighbors.front().first;
     }
 
@@ -89,6 +104,8 @@ private:
 
     size_t m_count;
     OutIt m_out_it;
+    bool m_is_bounded;
+    distance_type m_bound;
 
     std::vector< std::pair<distance_type, Value> > m_neighbors;
 };
@@ -134,6 +151,15 @@ public:
         , m_strategy(index::detail::get_strategy(parameters))
     {}
 
+    // Searches only the values closer than bound, a comparable distance
+    inline distance_query(parameters_type const& parameters, translator_type const& translator, Predicates const& pred, OutIter out_it,
+                          value_distance_type const& bound)
+        : m_parameters(parameters), m_translator(translator)
+        , m_pred(pred)
+        , m_result(nearest_predicate_access::get(m_pred).count, out_it, bound)
+        , m_strategy(index::detail::get_strategy(parameters))
+    {}
+
     inline void operator()(internal_node const& n)
     {
         typedef typename rtree::elements_type<internal_node>::type elements_type;
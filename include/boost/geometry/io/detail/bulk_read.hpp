@@ -0,0 +1,162 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_DETAIL_BULK_READ_HPP
+#define BOOST_GEOMETRY_IO_DETAIL_BULK_READ_HPP
+
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/util/executor.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace io
+{
+
+// The bulk readers parse many geometries in parallel. They can compute the
+// envelopes of the geometries directly after parsing each of them, while
+// its points are still in the cache, so an rtree can be packed from the
+// envelopes without reading the points again. The envelopes are stored
+// either as boxes or as pairs of a box and the index of the geometry,
+// the values of an rtree indexing the geometries.
+
+// Value type of the envelopes if they are not requested
+struct no_envelopes {};
+
+template <typename Value>
+struct envelope_value
+{
+    template <typename Geometry>
+    static inline void apply(Geometry const& geometry, std::size_t , Value& value)
+    {
+        geometry::envelope(geometry, value);
+    }
+};
+
+template <typename Box, typename Index>
+struct envelope_value<std::pair<Box, Index> >
+{
+    template <typename Geometry>
+    static inline void apply(Geometry const& geometry, std::size_t index,
+                             std::pair<Box, Index>& value)
+    {
+        geometry::envelope(geometry, value.first);
+        value.second = Index(index);
+    }
+};
+
+template <>
+struct envelope_value<no_envelopes>
+{
+    template <typename Geometry>
+    static inline void apply(Geometry const& , std::size_t , no_envelopes& )
+    {}
+};
+
+// The geometries parsed by one task when the number of geometries is not
+// known in advance, spliced into the output in the order of the tasks
+template <typename Geometry, typename Value>
+struct bulk_arena
+{
+    std::vector<Geometry> geometries;
+    std::vector<Value> envelopes;
+};
+
+// Computes the envelope of the last geometry of the arena, the index is
+// relative to the arena and corrected when spliced
+template <typename Geometry, typename Value>
+inline void add_envelope(bulk_arena<Geometry, Value>& arena)
+{
+    arena.envelopes.resize(arena.geometries.size());
+    envelope_value<Value>::apply(arena.geometries.back(),
+                                 arena.geometries.size() - 1,
+                                 arena.envelopes.back());
+}
+
+template <typename Geometry>
+inline void add_envelope(bulk_arena<Geometry, no_envelopes>& )
+{}
+
+// Number of bytes of text parsed by one task of the bulk readers
+static const std::size_t bulk_chunk_bytes = 1 << 18;
+
+template <typename Value>
+struct shift_index
+{
+    static inline void apply(Value& , std::size_t ) {}
+};
+
+template <typename Box, typename Index>
+struct shift_index<std::pair<Box, Index> >
+{
+    static inline void apply(std::pair<Box, Index>& value, std::size_t offset)
+    {
+        value.second = Index(std::size_t(value.second) + offset);
+    }
+};
+
+// Moves the geometries and envelopes of the arenas to the end of the output
+// ranges, in the order of the arenas. The elements are moved by the
+// executor, each arena by one task. Geometries is a random access mutable
+// range, e.g. a std::vector or a multi-geometry.
+template <typename Geometry, typename Value, typename Range, typename Executor>
+inline void splice(std::vector<bulk_arena<Geometry, Value> >& arenas,
+                   Range& geometries,
+                   std::vector<Value>* envelopes,
+                   Executor const& executor)
+{
+    std::size_t const start = boost::size(geometries);
+    std::vector<std::size_t> offsets(arenas.size() + 1, start);
+    for (std::size_t i = 0 ; i < arenas.size() ; ++i)
+    {
+        offsets[i + 1] = offsets[i] + arenas[i].geometries.size();
+    }
+
+    range::resize(geometries, offsets.back());
+    std::size_t const envelopes_start = envelopes ? envelopes->size() : 0;
+    if (envelopes)
+    {
+        envelopes->resize(envelopes_start + offsets.back() - start);
+    }
+
+    executor(arenas.size(), [&](std::size_t i)
+    {
+        std::vector<Geometry>& source = arenas[i].geometries;
+        for (std::size_t j = 0 ; j < source.size() ; ++j)
+        {
+            range::at(geometries, offsets[i] + j) = std::move(source[j]);
+        }
+        std::vector<Geometry>().swap(source);
+
+        if (envelopes)
+        {
+            std::vector<Value>& values = arenas[i].envelopes;
+            std::size_t const first = envelopes_start + offsets[i] - start;
+            for (std::size_t j = 0 ; j < values.size() ; ++j)
+            {
+                shift_index<Value>::apply(values[j], offsets[i]);
+                (*envelopes)[first + j] = values[j];
+            }
+        }
+    });
+}
+
+}} // namespace detail::io
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_DETAIL_BULK_READ_HPP
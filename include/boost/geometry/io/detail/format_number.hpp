@@ -0,0 +1,604 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_DETAIL_FORMAT_NUMBER_HPP
+#define BOOST_GEOMETRY_IO_DETAIL_FORMAT_NUMBER_HPP
+
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/config.hpp>
+#include <boost/type_traits/conditional.hpp>
+
+#include <boost/geometry/core/assert.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace io
+{
+
+// Shortest (in most cases) representation of floating point numbers which
+// is read back exactly, calculated with the Grisu2 algorithm:
+// Florian Loitsch, Printing Floating-Point Numbers Quickly and Accurately
+// with Integers, PLDI 2010.
+namespace grisu
+{
+
+// Floating point number f * 2^e without hidden bit
+struct diy_fp
+{
+    boost::uint64_t f;
+    int e;
+
+    diy_fp(boost::uint64_t f_, int e_) : f(f_), e(e_) {}
+
+    static inline diy_fp sub(diy_fp const& x, diy_fp const& y)
+    {
+        BOOST_GEOMETRY_ASSERT(x.e == y.e && x.f >= y.f);
+        return diy_fp(x.f - y.f, x.e);
+    }
+
+    // Upper 64 bits of the 128-bit product, rounded
+    static inline diy_fp mul(diy_fp const& x, diy_fp const& y)
+    {
+        boost::uint64_t const u_lo = x.f & 0xFFFFFFFFu;
+        boost::uint64_t const u_hi = x.f >> 32;
+        boost::uint64_t const v_lo = y.f & 0xFFFFFFFFu;
+        boost::uint64_t const v_hi = y.f >> 32;
+
+        boost::uint64_t const p0 = u_lo * v_lo;
+        boost::uint64_t const p1 = u_lo * v_hi;
+        boost::uint64_t const p2 = u_hi * v_lo;
+        boost::uint64_t const p3 = u_hi * v_hi;
+
+        boost::uint64_t q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+        q += boost::uint64_t(1) << 31;
+
+        return diy_fp(p3 + (p2 >> 32) + (p1 >> 32) + (q >> 32), x.e + y.e + 64);
+    }
+
+    static inline diy_fp normalize(diy_fp x)
+    {
+        BOOST_GEOMETRY_ASSERT(x.f != 0);
+        while ((x.f >> 63) == 0)
+        {
+            x.f <<= 1;
+            x.e--;
+        }
+        return x;
+    }
+
+    static inline diy_fp normalize_to(diy_fp const& x, int e)
+    {
+        int const delta = x.e - e;
+        BOOST_GEOMETRY_ASSERT(delta >= 0 && ((x.f << delta) >> delta) == x.f);
+        return diy_fp(x.f << delta, e);
+    }
+};
+
+template <typename T>
+struct float_bits {};
+
+template <>
+struct float_bits<double>
+{
+    typedef boost::uint64_t type;
+};
+
+template <>
+struct float_bits<float>
+{
+    typedef boost::uint32_t type;
+};
+
+// The value v and the boundaries m- and m+ of the interval of numbers
+// rounded to v, normalized to the same exponent
+struct boundaries
+{
+    diy_fp w, minus, plus;
+
+    boundaries(diy_fp const& w_, diy_fp const& minus_, diy_fp const& plus_)
+        : w(w_), minus(minus_), plus(plus_)
+    {}
+};
+
+// Finite and positive values only
+template <typename T>
+inline boundaries compute_boundaries(T value)
+{
+    typedef typename float_bits<T>::type bits_type;
+
+    static const int precision = std::numeric_limits<T>::digits; // including hidden bit
+    static const int bias = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+    static const int min_exp = 1 - bias;
+    static const boost::uint64_t hidden_bit = boost::uint64_t(1) << (precision - 1);
+
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    boost::uint64_t const e = boost::uint64_t(bits) >> (precision - 1);
+    boost::uint64_t const f = boost::uint64_t(bits) & (hidden_bit - 1);
+
+    diy_fp const v = e == 0
+        ? diy_fp(f, min_exp) // denormal
+        : diy_fp(f + hidden_bit, int(e) - bias);
+
+    // The lower boundary is closer if the significand is a power of 2
+    bool const lower_is_closer = f == 0 && e > 1;
+    diy_fp const m_plus(2 * v.f + 1, v.e - 1);
+    diy_fp const m_minus = lower_is_closer
+        ? diy_fp(4 * v.f - 1, v.e - 2)
+        : diy_fp(2 * v.f - 1, v.e - 1);
+
+    diy_fp const w_plus = diy_fp::normalize(m_plus);
+    diy_fp const w_minus = diy_fp::normalize_to(m_minus, w_plus.e);
+
+    return boundaries(diy_fp::normalize(v), w_minus, w_plus);
+}
+
+// The exponent of the products is kept in [min_exponent, max_exponent]
+// so the integral part of the scaled number fits in 32 bits
+static const int min_exponent = -60;
+static const int max_exponent = -32;
+
+struct cached_power
+{
+    boost::uint64_t f;
+    int e;
+    int k;
+};
+
+// Normalized c = f * 2^e ~= 10^k with
+// min_exponent <= e_c + e + 64 <= max_exponent
+inline cached_power get_cached_power(int e)
+{
+    static const int min_decimal_exponent = -300;
+    static const int decimal_step = 8;
+
+    // 10^k for k = -300, -292, ..., 340
+    static const cached_power powers[] =
+    {
+        { 0xAB70FE17C79AC6CA, -1060, -300 },
+        { 0xFF77B1FCBEBCDC4F, -1034, -292 },
+        { 0xBE5691EF416BD60C, -1007, -284 },
+        { 0x8DD01FAD907FFC3C,  -980, -276 },
+        { 0xD3515C2831559A83,  -954, -268 },
+        { 0x9D71AC8FADA6C9B5,  -927, -260 },
+        { 0xEA9C227723EE8BCB,  -901, -252 },
+        { 0xAECC49914078536D,  -874, -244 },
+        { 0x823C12795DB6CE57,  -847, -236 },
+        { 0xC21094364DFB5637,  -821, -228 },
+        { 0x9096EA6F3848984F,  -794, -220 },
+        { 0xD77485CB25823AC7,  -768, -212 },
+        { 0xA086CFCD97BF97F4,  -741, -204 },
+        { 0xEF340A98172AACE5,  -715, -196 },
+        { 0xB23867FB2A35B28E,  -688, -188 },
+        { 0x84C8D4DFD2C63F3B,  -661, -180 },
+        { 0xC5DD44271AD3CDBA,  -635, -172 },
+        { 0x936B9FCEBB25C996,  -608, -164 },
+        { 0xDBAC6C247D62A584,  -582, -156 },
+        { 0xA3AB66580D5FDAF6,  -555, -148 },
+        { 0xF3E2F893DEC3F126,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8,  -502, -132 },
+        { 0x87625F056C7C4A8B,  -475, -124 },
+        { 0xC9BCFF6034C13053,  -449, -116 },
+        { 0x964E858C91BA2655,  -422, -108 },
+        { 0xDFF9772470297EBD,  -396, -100 },
+        { 0xA6DFBD9FB8E5B88F,  -369,  -92 },
+        { 0xF8A95FCF88747D94,  -343,  -84 },
+        { 0xB94470938FA89BCF,  -316,  -76 },
+        { 0x8A08F0F8BF0F156B,  -289,  -68 },
+        { 0xCDB02555653131B6,  -263,  -60 },
+        { 0x993FE2C6D07B7FAC,  -236,  -52 },
+        { 0xE45C10C42A2B3B06,  -210,  -44 },
+        { 0xAA242499697392D3,  -183,  -36 },
+        { 0xFD87B5F28300CA0E,  -157,  -28 },
+        { 0xBCE5086492111AEB,  -130,  -20 },
+        { 0x8CBCCC096F5088CC,  -103,  -12 },
+        { 0xD1B71758E219652C,   -77,   -4 },
+        { 0x9C40000000000000,   -50,    4 },
+        { 0xE8D4A51000000000,   -24,   12 },
+        { 0xAD78EBC5AC620000,     3,   20 },
+        { 0x813F3978F8940984,    30,   28 },
+        { 0xC097CE7BC90715B3,    56,   36 },
+        { 0x8F7E32CE7BEA5C70,    83,   44 },
+        { 0xD5D238A4ABE98068,   109,   52 },
+        { 0x9F4F2726179A2245,   136,   60 },
+        { 0xED63A231D4C4FB27,   162,   68 },
+        { 0xB0DE65388CC8ADA8,   189,   76 },
+        { 0x83C7088E1AAB65DB,   216,   84 },
+        { 0xC45D1DF942711D9A,   242,   92 },
+        { 0x924D692CA61BE758,   269,  100 },
+        { 0xDA01EE641A708DEA,   295,  108 },
+        { 0xA26DA3999AEF774A,   322,  116 },
+        { 0xF209787BB47D6B85,   348,  124 },
+        { 0xB454E4A179DD1877,   375,  132 },
+        { 0x865B86925B9BC5C2,   402,  140 },
+        { 0xC83553C5C8965D3D,   428,  148 },
+        { 0x952AB45CFA97A0B3,   455,  156 },
+        { 0xDE469FBD99A05FE3,   481,  164 },
+        { 0xA59BC234DB398C25,   508,  172 },
+        { 0xF6C69A72A3989F5C,   534,  180 },
+        { 0xB7DCBF5354E9BECE,   561,  188 },
+        { 0x88FCF317F22241E2,   588,  196 },
+        { 0xCC20CE9BD35C78A5,   614,  204 },
+        { 0x98165AF37B2153DF,   641,  212 },
+        { 0xE2A0B5DC971F303A,   667,  220 },
+        { 0xA8D9D1535CE3B396,   694,  228 },
+        { 0xFB9B7CD9A4A7443C,   720,  236 },
+        { 0xBB764C4CA7A44410,   747,  244 },
+        { 0x8BAB8EEFB6409C1A,   774,  252 },
+        { 0xD01FEF10A657842C,   800,  260 },
+        { 0x9B10A4E5E9913129,   827,  268 },
+        { 0xE7109BFBA19C0C9D,   853,  276 },
+        { 0xAC2820D9623BF429,   880,  284 },
+        { 0x80444B5E7AA7CF85,   907,  292 },
+        { 0xBF21E44003ACDD2D,   933,  300 },
+        { 0x8E679C2F5E44FF8F,   960,  308 },
+        { 0xD433179D9C8CB841,   986,  316 },
+        { 0x9E19DB92B4E31BA9,  1013,  324 },
+        { 0xEB96BF6EBADF77D9,  1039,  332 },
+        { 0xAF87023B9BF0EE6B,  1066,  340 }
+    };
+
+    int const f = min_exponent - e - 1;
+    // ceil(f * log10(2))
+    int const k = (f * 78913) / (1 << 18) + (f > 0 ? 1 : 0);
+    int const index = (-min_decimal_exponent + k + (decimal_step - 1)) / decimal_step;
+    BOOST_GEOMETRY_ASSERT(index >= 0
+        && std::size_t(index) < sizeof(powers) / sizeof(powers[0]));
+
+    cached_power const cached = powers[index];
+    BOOST_GEOMETRY_ASSERT(min_exponent <= cached.e + e + 64 && cached.e + e + 64 <= max_exponent);
+    return cached;
+}
+
+// Number of digits of n and the largest power of 10 not greater than n
+inline int find_largest_pow10(boost::uint32_t n, boost::uint32_t& pow10)
+{
+    static const boost::uint32_t powers[] =
+    {
+        1u, 10u, 100u, 1000u, 10000u, 100000u,
+        1000000u, 10000000u, 100000000u, 1000000000u
+    };
+
+    int k = 9;
+    while (k > 0 && n < powers[k])
+    {
+        --k;
+    }
+    pow10 = powers[k];
+    return k + 1;
+}
+
+// Moves the last digit closer to w if it's still inside the interval
+inline void round_weed(char* buffer, int length, boost::uint64_t dist,
+                       boost::uint64_t delta, boost::uint64_t rest,
+                       boost::uint64_t ten_k)
+{
+    while (rest < dist
+        && delta - rest >= ten_k
+        && (rest + ten_k < dist || dist - rest > rest + ten_k - dist))
+    {
+        BOOST_GEOMETRY_ASSERT(buffer[length - 1] != '0');
+        buffer[length - 1]--;
+        rest += ten_k;
+    }
+}
+
+// Generates the digits of a number in (M-, M+), as few as possible
+inline void digit_gen(char* buffer, int& length, int& decimal_exponent,
+                      diy_fp const& m_minus, diy_fp const& w, diy_fp const& m_plus)
+{
+    BOOST_GEOMETRY_ASSERT(m_plus.e >= min_exponent && m_plus.e <= max_exponent);
+
+    boost::uint64_t delta = diy_fp::sub(m_plus, m_minus).f;
+    boost::uint64_t dist = diy_fp::sub(m_plus, w).f;
+
+    diy_fp const one(boost::uint64_t(1) << -m_plus.e, m_plus.e);
+
+    boost::uint32_t p1 = static_cast<boost::uint32_t>(m_plus.f >> -one.e);
+    boost::uint64_t p2 = m_plus.f & (one.f - 1);
+
+    // Integral part
+    boost::uint32_t pow10 = 0;
+    int n = find_largest_pow10(p1, pow10);
+    while (n > 0)
+    {
+        boost::uint32_t const d = p1 / pow10;
+        p1 %= pow10;
+        buffer[length++] = static_cast<char>('0' + d);
+        --n;
+
+        boost::uint64_t const rest = (boost::uint64_t(p1) << -one.e) + p2;
+        if (rest <= delta)
+        {
+            decimal_exponent += n;
+            round_weed(buffer, length, dist, delta, rest,
+                       boost::uint64_t(pow10) << -one.e);
+            return;
+        }
+        pow10 /= 10;
+    }
+
+    // Fractional part
+    int m = 0;
+    for (;;)
+    {
+        p2 *= 10;
+        buffer[length++] = static_cast<char>('0' + (p2 >> -one.e));
+        p2 &= one.f - 1;
+        ++m;
+
+        delta *= 10;
+        dist *= 10;
+        if (p2 <= delta)
+        {
+            break;
+        }
+    }
+    decimal_exponent -= m;
+    round_weed(buffer, length, dist, delta, p2, one.f);
+}
+
+// Writes the digits of a finite and positive value to buffer,
+// value == buffer * 10^decimal_exponent
+template <typename T>
+inline void grisu2(char* buffer, int& length, int& decimal_exponent, T value)
+{
+    boundaries const b = compute_boundaries(value);
+
+    cached_power const cached = get_cached_power(b.plus.e);
+    diy_fp const c_minus_k(cached.f, cached.e);
+
+    diy_fp const w = diy_fp::mul(b.w, c_minus_k);
+    diy_fp const w_minus = diy_fp::mul(b.minus, c_minus_k);
+    diy_fp const w_plus = diy_fp::mul(b.plus, c_minus_k);
+
+    // The products are not exact, the interval is shrunk by 1 ulp
+    // so all of the numbers in it are rounded to value
+    diy_fp const m_minus(w_minus.f + 1, w_minus.e);
+    diy_fp const m_plus(w_plus.f - 1, w_plus.e);
+
+    length = 0;
+    decimal_exponent = -cached.k;
+    digit_gen(buffer, length, decimal_exponent, m_minus, w, m_plus);
+}
+
+} // namespace grisu
+
+
+// Writes digits * 10^decimal_exponent, in fixed notation if the
+// decimal point is close to the digits, otherwise in scientific notation
+inline char* format_digits(char* out, const char* digits, int length,
+                           int decimal_exponent)
+{
+    int const n = length + decimal_exponent; // position of the decimal point
+
+    if (n > 0 && n <= 21)
+    {
+        if (length <= n)
+        {
+            // 12300
+            std::memcpy(out, digits, std::size_t(length));
+            out += length;
+            for (int i = length ; i < n ; ++i)
+            {
+                *out++ = '0';
+            }
+        }
+        else
+        {
+            // 12.3
+            std::memcpy(out, digits, std::size_t(n));
+            out += n;
+            *out++ = '.';
+            std::memcpy(out, digits + n, std::size_t(length - n));
+            out += length - n;
+        }
+        return out;
+    }
+
+    if (n <= 0 && n > -6)
+    {
+        // 0.00123
+        *out++ = '0';
+        *out++ = '.';
+        for (int i = n ; i < 0 ; ++i)
+        {
+            *out++ = '0';
+        }
+        std::memcpy(out, digits, std::size_t(length));
+        return out + length;
+    }
+
+    // 1.23e+25
+    *out++ = digits[0];
+    if (length > 1)
+    {
+        *out++ = '.';
+        std::memcpy(out, digits + 1, std::size_t(length - 1));
+        out += length - 1;
+    }
+    *out++ = 'e';
+    int exponent = n - 1;
+    if (exponent < 0)
+    {
+        *out++ = '-';
+        exponent = -exponent;
+    }
+    else
+    {
+        *out++ = '+';
+    }
+    if (exponent >= 100)
+    {
+        *out++ = static_cast<char>('0' + exponent / 100);
+        exponent %= 100;
+        *out++ = static_cast<char>('0' + exponent / 10);
+    }
+    else if (exponent >= 10)
+    {
+        *out++ = static_cast<char>('0' + exponent / 10);
+    }
+    *out++ = static_cast<char>('0' + exponent % 10);
+    return out;
+}
+
+// Maximum number of characters written by format_number()
+static const std::size_t max_number_size = 32;
+
+/*!
+\brief Writes the shortest representation of value which is read back exactly
+\details "nan", "inf" and "-inf" are written for not finite values
+    like std::ostream does. Returns the end of the written characters.
+*/
+template <typename T>
+inline char* format_float(char* out, T value)
+{
+    if (value != value)
+    {
+        std::memcpy(out, "nan", 3);
+        return out + 3;
+    }
+
+    if ((std::signbit)(value))
+    {
+        *out++ = '-';
+        value = -value;
+    }
+
+    if (value > (std::numeric_limits<T>::max)())
+    {
+        std::memcpy(out, "inf", 3);
+        return out + 3;
+    }
+
+    if (value == 0)
+    {
+        *out++ = '0';
+        return out;
+    }
+
+    char digits[24];
+    int length = 0;
+    int decimal_exponent = 0;
+    grisu::grisu2(digits, length, decimal_exponent, value);
+    return format_digits(out, digits, length, decimal_exponent);
+}
+
+template <typename T>
+inline char* format_integer(char* out, T value)
+{
+    typedef typename boost::conditional
+        <
+            std::numeric_limits<T>::is_signed, boost::intmax_t, boost::uintmax_t
+        >::type wide_type;
+
+    boost::uintmax_t u = static_cast<boost::uintmax_t>(value);
+    if (std::numeric_limits<T>::is_signed && wide_type(value) < 0)
+    {
+        *out++ = '-';
+        u = 0 - u;
+    }
+
+    char digits[24];
+    int length = 0;
+    do
+    {
+        digits[length++] = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while (u > 0);
+
+    while (length > 0)
+    {
+        *out++ = digits[--length];
+    }
+    return out;
+}
+
+/*!
+\brief Appends a number to an output having append(const char*, std::size_t)
+\details Types other than float, double and integers are streamed using
+    std::ostringstream with the classic locale.
+*/
+template <typename T>
+struct number_formatter
+{
+    template <typename Output>
+    static inline void apply(Output& out, T const& value)
+    {
+        std::ostringstream os;
+        os.imbue(std::locale::classic());
+        if (std::numeric_limits<T>::is_specialized
+            && std::numeric_limits<T>::max_digits10 > 0)
+        {
+            os.precision(std::numeric_limits<T>::max_digits10);
+        }
+        os << value;
+        std::string const str = os.str();
+        out.append(str.data(), str.size());
+    }
+};
+
+template <typename T>
+struct float_number_formatter
+{
+    template <typename Output>
+    static inline void apply(Output& out, T const& value)
+    {
+        char buffer[max_number_size];
+        char const* const end = format_float(buffer, value);
+        out.append(buffer, std::size_t(end - buffer));
+    }
+};
+
+template <typename T>
+struct integer_number_formatter
+{
+    template <typename Output>
+    static inline void apply(Output& out, T const& value)
+    {
+        char buffer[max_number_size];
+        char const* const end = format_integer(buffer, value);
+        out.append(buffer, std::size_t(end - buffer));
+    }
+};
+
+template <> struct number_formatter<float> : float_number_formatter<float> {};
+template <> struct number_formatter<double> : float_number_formatter<double> {};
+
+template <> struct number_formatter<short> : integer_number_formatter<short> {};
+template <> struct number_formatter<int> : integer_number_formatter<int> {};
+template <> struct number_formatter<long> : integer_number_formatter<long> {};
+template <> struct number_formatter<unsigned short> : integer_number_formatter<unsigned short> {};
+template <> struct number_formatter<unsigned int> : integer_number_formatter<unsigned int> {};
+template <> struct number_formatter<unsigned long> : integer_number_formatter<unsigned long> {};
+
+#if defined(BOOST_HAS_LONG_LONG)
+template <> struct number_formatter<boost::long_long_type> : integer_number_formatter<boost::long_long_type> {};
+template <> struct number_formatter<boost::ulong_long_type> : integer_number_formatter<boost::ulong_long_type> {};
+#endif
+
+
+}} // namespace detail::io
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_DETAIL_FORMAT_NUMBER_HPP
@@ -0,0 +1,131 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_DETAIL_OUTPUT_HPP
+#define BOOST_GEOMETRY_IO_DETAIL_OUTPUT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+#include <boost/geometry/io/detail/format_number.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace io
+{
+
+/*!
+\brief Base of the outputs which can be passed to the writers instead of
+    std::ostream, numbers are written with number_formatter
+\details Derived classes implement append(const char*, std::size_t).
+*/
+template <typename Derived>
+class output_base
+{
+public:
+    inline Derived& operator<<(const char* str)
+    {
+        derived().append(str, std::strlen(str));
+        return derived();
+    }
+
+    inline Derived& operator<<(std::string const& str)
+    {
+        derived().append(str.data(), str.size());
+        return derived();
+    }
+
+    inline Derived& operator<<(char c)
+    {
+        derived().append(&c, 1);
+        return derived();
+    }
+
+    template <typename T>
+    inline Derived& operator<<(T const& value)
+    {
+        number_formatter<T>::apply(derived(), value);
+        return derived();
+    }
+
+private:
+    inline Derived& derived()
+    {
+        return static_cast<Derived&>(*this);
+    }
+};
+
+/*!
+\brief Output appending to a std::string
+*/
+class string_output
+    : public output_base<string_output>
+{
+public:
+    explicit inline string_output(std::string& str)
+        : m_str(str)
+    {}
+
+    inline void append(const char* str, std::size_t size)
+    {
+        m_str.append(str, size);
+    }
+
+private:
+    std::string& m_str;
+};
+
+/*!
+\brief Output writing to a char buffer of a given size
+\details The characters not fitting in the buffer are counted but not
+    written, like std::snprintf does.
+*/
+class buffer_output
+    : public output_base<buffer_output>
+{
+public:
+    inline buffer_output(char* buffer, std::size_t size)
+        : m_buffer(buffer)
+        , m_size(size)
+        , m_count(0)
+    {}
+
+    inline void append(const char* str, std::size_t size)
+    {
+        if (m_count < m_size)
+        {
+            std::memcpy(m_buffer + m_count, str, (std::min)(size, m_size - m_count));
+        }
+        m_count += size;
+    }
+
+    //! Number of characters appended, including the ones not written
+    inline std::size_t count() const
+    {
+        return m_count;
+    }
+
+private:
+    char* m_buffer;
+    std::size_t m_size;
+    std::size_t m_count;
+};
+
+
+}} // namespace detail::io
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_DETAIL_OUTPUT_HPP
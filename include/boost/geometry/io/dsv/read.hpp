@@ -0,0 +1,380 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_DSV_READ_HPP
+#define BOOST_GEOMETRY_IO_DSV_READ_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/io/detail/bulk_read.hpp>
+#include <boost/geometry/util/coordinate_cast.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Exception thrown if a line of \ref DSV can not be read
+\ingroup dsv
+*/
+struct read_dsv_exception : public geometry::exception
+{
+    read_dsv_exception(std::string const& msg, const char* first, const char* last)
+        : line(first, last)
+    {
+        complete = msg + " in '" + line.substr(0, 100) + "'";
+    }
+
+    virtual ~read_dsv_exception() throw() {}
+
+    virtual const char* what() const throw()
+    {
+        return complete.c_str();
+    }
+
+    //! The line which can not be read
+    std::string line;
+
+private:
+    std::string complete;
+};
+
+/*!
+\brief Settings of read_dsv()
+\ingroup dsv
+*/
+struct dsv_read_options
+{
+    explicit dsv_read_options(std::string const& separators_ = ",",
+                              std::size_t skip_lines_ = 0)
+        : separators(separators_)
+        , skip_lines(skip_lines_)
+        , comment('#')
+    {}
+
+    //! Characters separating the coordinates, any of them separates
+    std::string separators;
+    //! Number of lines skipped at the beginning, e.g. a header
+    std::size_t skip_lines;
+    //! Lines starting with this character are skipped, '\0' for none
+    char comment;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace dsv
+{
+
+// Classes of characters: spaces (' ', '\t', '\r') around the coordinates
+// are skipped, separators end the coordinates. If a space is a separator
+// consecutive spaces separate once.
+class char_classes
+{
+public:
+    enum { other = 0, space = 1, separator = 2 };
+
+    explicit inline char_classes(std::string const& separators)
+    {
+        std::memset(m_classes, other, sizeof(m_classes));
+        m_classes[(unsigned char)' '] = space;
+        m_classes[(unsigned char)'\t'] = space;
+        m_classes[(unsigned char)'\r'] = space;
+        m_space_separates = false;
+        for (std::size_t i = 0 ; i < separators.size() ; ++i)
+        {
+            unsigned char const c = (unsigned char)separators[i];
+            if (m_classes[c] == space)
+            {
+                m_space_separates = true;
+            }
+            else
+            {
+                m_classes[c] = separator;
+            }
+        }
+    }
+
+    inline unsigned char operator()(char c) const
+    {
+        return m_classes[(unsigned char)c];
+    }
+
+    inline bool space_separates() const
+    {
+        return m_space_separates;
+    }
+
+private:
+    unsigned char m_classes[256];
+    bool m_space_separates;
+};
+
+inline const char* skip_spaces(const char* it, const char* last,
+                               char_classes const& classes)
+{
+    while (it != last && classes(*it) == char_classes::space)
+    {
+        ++it;
+    }
+    return it;
+}
+
+template
+<
+    typename Point,
+    std::size_t Dimension = 0,
+    std::size_t DimensionCount = geometry::dimension<Point>::value
+>
+struct parse_coordinates
+{
+    // Parses the coordinate starting at it, returns false if there is no
+    // coordinate or no separator after it
+    static inline bool apply(const char*& it, const char* last,
+                             char_classes const& classes, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        it = skip_spaces(it, last, classes);
+        const char* const first = it;
+        while (it != last && classes(*it) == char_classes::other)
+        {
+            ++it;
+        }
+        if (it == first)
+        {
+            return false;
+        }
+
+        geometry::set<Dimension>(point,
+            detail::coordinate_parser<coordinate_type>::apply(first, it));
+
+        if (Dimension + 1 < DimensionCount)
+        {
+            // Exactly one separator, or spaces if they separate
+            const char* const token_end = it;
+            it = skip_spaces(it, last, classes);
+            if (it != last && classes(*it) == char_classes::separator)
+            {
+                ++it;
+            }
+            else if (! classes.space_separates() || it == token_end)
+            {
+                return false;
+            }
+        }
+
+        return parse_coordinates
+            <
+                Point, Dimension + 1, DimensionCount
+            >::apply(it, last, classes, point);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct parse_coordinates<Point, DimensionCount, DimensionCount>
+{
+    static inline bool apply(const char*& , const char* ,
+                             char_classes const& , Point& )
+    {
+        return true;
+    }
+};
+
+// Returns the position after the first '\n' at or after it, or last.
+// memchr() is vectorized by the C library, the lines are found without
+// looking at every character separately.
+inline const char* next_line(const char* it, const char* last)
+{
+    const char* const eol = static_cast<const char*>(
+        std::memchr(it, '\n', std::size_t(last - it)));
+    return eol ? eol + 1 : last;
+}
+
+// Parses the lines starting in [first, last), the last line may continue
+// after last up to end. Columns after the coordinates are ignored.
+template <typename Point>
+inline void read_lines(const char* first, const char* last, const char* end,
+                       dsv_read_options const& options,
+                       char_classes const& classes,
+                       std::vector<Point>& points)
+{
+    while (first < last)
+    {
+        const char* const line_end = next_line(first, end);
+        const char* text_end = line_end;
+        if (text_end != first && text_end[-1] == '\n')
+        {
+            --text_end;
+        }
+
+        const char* it = skip_spaces(first, text_end, classes);
+        if (it != text_end && *it != options.comment)
+        {
+            points.push_back(Point());
+            bool valid = false;
+            try
+            {
+                valid = parse_coordinates<Point>::apply(it, text_end, classes,
+                                                        points.back());
+            }
+            catch (boost::bad_lexical_cast const& blc)
+            {
+                BOOST_THROW_EXCEPTION(read_dsv_exception(blc.what(), first, text_end));
+            }
+
+            if (! valid)
+            {
+                BOOST_THROW_EXCEPTION(read_dsv_exception("Missing coordinate",
+                                                         first, text_end));
+            }
+
+            it = skip_spaces(it, text_end, classes);
+            if (it != text_end && classes(*it) != char_classes::separator
+                && ! classes.space_separates())
+            {
+                BOOST_THROW_EXCEPTION(read_dsv_exception("Invalid coordinate",
+                                                         first, text_end));
+            }
+        }
+        first = line_end;
+    }
+}
+
+template <typename Range, typename Executor>
+inline void read_dsv(const char* first, const char* last, Range& points,
+                     dsv_read_options const& options,
+                     Executor const& executor)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+
+    for (std::size_t i = 0 ; i < options.skip_lines && first != last ; ++i)
+    {
+        first = next_line(first, last);
+    }
+
+    char_classes const classes(options.separators);
+
+    std::size_t const size = std::size_t(last - first);
+    std::size_t const chunk = io::bulk_chunk_bytes;
+    std::size_t const count = size == 0 ? 0 : (size + chunk - 1) / chunk;
+
+    // Each task parses the lines starting in its chunk of bytes
+    std::vector<io::bulk_arena<point_type, io::no_envelopes> > arenas(count);
+    executor(count, [&](std::size_t i)
+    {
+        const char* chunk_first = first + i * chunk;
+        const char* const chunk_last = i + 1 == count ? last : chunk_first + chunk;
+        if (i > 0 && chunk_first[-1] != '\n')
+        {
+            chunk_first = next_line(chunk_first, last);
+        }
+        arenas[i].geometries.reserve((chunk_last - chunk_first) / 16);
+        read_lines(chunk_first, chunk_last, last, options, classes,
+                   arenas[i].geometries);
+    });
+
+    io::splice(arenas, points,
+               static_cast<std::vector<io::no_envelopes>*>(0), executor);
+}
+
+template <typename Tag>
+struct check_dsv_output
+{
+    BOOST_MPL_ASSERT_MSG
+        (
+            false, NOT_IMPLEMENTED_FOR_THIS_GEOMETRY_TYPE, (types<Tag>)
+        );
+};
+
+template <>
+struct check_dsv_output<multi_point_tag>
+{};
+
+}} // namespace detail::dsv
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reads points stored as delimiter-separated values, one point per
+    line, using an executor
+\details The coordinates of a point are separated by any of the separators
+    of the options, spaces around them are ignored. Further columns are
+    ignored, e.g. the intensity of LIDAR points. Blank lines and lines
+    starting with the comment character are skipped. The text is split
+    into chunks read in parallel and the points are appended to points in
+    the order of the lines.
+\ingroup dsv
+\param first begin of the text
+\param last end of the text
+\param points std::vector of points the points are appended to
+\param options separators and lines to skip
+\param executor executor running the tasks, e.g. thread_executor
+\note If a line can not be read read_dsv_exception is thrown, in that case
+    the content of points is unspecified.
+*/
+template <typename Point, typename Executor>
+inline void read_dsv(const char* first, const char* last,
+                     std::vector<Point>& points,
+                     dsv_read_options const& options,
+                     Executor const& executor)
+{
+    concepts::check<Point>();
+    detail::dsv::read_dsv(first, last, points, options, executor);
+}
+
+/*!
+\brief Reads the points of a multi-point stored as delimiter-separated
+    values, one point per line, using an executor
+\ingroup dsv
+*/
+template <typename MultiPoint, typename Executor>
+inline void read_dsv(const char* first, const char* last,
+                     MultiPoint& multi_point,
+                     dsv_read_options const& options,
+                     Executor const& executor)
+{
+    concepts::check<MultiPoint>();
+    detail::dsv::check_dsv_output<typename tag<MultiPoint>::type>();
+    detail::dsv::read_dsv(first, last, multi_point, options, executor);
+}
+
+template <typename Output, typename Executor>
+inline void read_dsv(std::string const& text, Output& output,
+                     dsv_read_options const& options,
+                     Executor const& executor)
+{
+    geometry::read_dsv(text.data(), text.data() + text.size(), output,
+                       options, executor);
+}
+
+template <typename Output>
+inline void read_dsv(std::string const& text, Output& output,
+                     dsv_read_options const& options = dsv_read_options())
+{
+    geometry::read_dsv(text.data(), text.data() + text.size(), output,
+                       options, sequential_executor());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_DSV_READ_HPP
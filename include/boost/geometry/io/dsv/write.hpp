@@ -37,6 +37,8 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
+#include <boost/geometry/io/detail/output.hpp>
+
 namespace boost { namespace geometry
 {
 
@@ -78,8 +80,8 @@ struct dsv_settings
 template <typename Point, std::size_t Dimension, std::size_t Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Point const& point,
             dsv_settings const& settings)
     {
@@ -96,8 +98,8 @@ struct stream_coordinate
 template <typename Point, std::size_t Count>
 struct stream_coordinate<Point, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&,
+    template <typename OutputStream>
+    static inline void apply(OutputStream&,
             Point const&,
             dsv_settings const& )
     {
@@ -116,8 +118,8 @@ template
 >
 struct stream_indexed
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
@@ -133,8 +135,8 @@ struct stream_indexed
 template <typename Geometry, std::size_t Index, std::size_t Count>
 struct stream_indexed<Geometry, Index, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, Geometry const&,
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, Geometry const&,
             dsv_settings const& )
     {
     }
@@ -146,8 +148,8 @@ struct stream_indexed<Geometry, Index, Count, Count>
 template <typename Point>
 struct dsv_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Point const& p,
             dsv_settings const& settings)
     {
@@ -164,8 +166,8 @@ struct dsv_point
 template <typename Range>
 struct dsv_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Range const& range,
             dsv_settings const& settings)
     {
@@ -206,8 +208,8 @@ private:
 template <typename Polygon>
 struct dsv_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly,
                 dsv_settings const& settings)
     {
@@ -234,8 +236,8 @@ struct dsv_per_index
 {
     typedef typename point_type<Geometry>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
@@ -253,8 +255,8 @@ struct dsv_indexed
 {
     typedef typename point_type<Geometry>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
             Geometry const& geometry,
             dsv_settings const& settings)
     {
@@ -367,8 +369,8 @@ struct dsv_multi
         >::type iterator;
 
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 MultiGeometry const& multi,
                 dsv_settings const& settings)
     {
@@ -431,6 +433,44 @@ inline detail::dsv::dsv_manipulator<Geometry> dsv(Geometry const& geometry
             list_open, list_close, list_separator));
 }
 
+/*!
+\brief Appends the DSV of a geometry to a string
+\details The separators are the same as in dsv(). Coordinates are written
+    like in to_wkt(), independently of the locale and floating point numbers
+    in the shortest form which is read back exactly. The string is not
+    cleared so it can be reused for many geometries.
+\ingroup dsv
+*/
+template <typename Geometry>
+inline void to_dsv(Geometry const& geometry
+    , std::string& output
+    , std::string const& coordinate_separator = ", "
+    , std::string const& point_open = "("
+    , std::string const& point_close = ")"
+    , std::string const& point_separator = ", "
+    , std::string const& list_open = "("
+    , std::string const& list_close = ")"
+    , std::string const& list_separator = ", "
+    )
+{
+    concepts::check<Geometry const>();
+
+    detail::dsv::dsv_settings const settings(coordinate_separator,
+            point_open, point_close, point_separator,
+            list_open, list_close, list_separator);
+
+    detail::io::string_output out(output);
+    dispatch::dsv
+        <
+            typename tag_cast
+                <
+                    typename tag<Geometry>::type,
+                    multi_tag
+                >::type,
+            Geometry
+        >::apply(out, geometry, settings);
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_IO_DSV_WRITE_HPP
@@ -18,8 +18,11 @@
 #ifndef BOOST_GEOMETRY_IO_SVG_MAPPER_HPP
 #define BOOST_GEOMETRY_IO_SVG_MAPPER_HPP
 
+#include <cmath>
+#include <cstddef>
 #include <cstdio>
 
+#include <iterator>
 #include <vector>
 
 #include <boost/config.hpp>
@@ -36,10 +39,13 @@
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/core/tag_cast.hpp>
 
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_linestring.hpp>
 #include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/is_empty.hpp>
 #include <boost/geometry/algorithms/transform.hpp>
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
 #include <boost/geometry/strategies/transform/map_transformer.hpp>
 #include <boost/geometry/views/segment_view.hpp>
 
@@ -53,6 +59,308 @@ namespace boost { namespace geometry
 {
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace svg
+{
+
+
+/*!
+\brief Transformation strategy of svg_mapper, transforms like the wrapped
+    transformer and additionally culls the vertices mapped to the same pixel
+    and clips the mapped geometries to the viewport
+\details The culling is disabled if pixel_size is not positive, the clipping
+    if viewport is null.
+*/
+template <typename Transformer, typename Box>
+class map_strategy
+{
+public:
+    map_strategy(Transformer const& transformer, double pixel_size,
+                 Box const* viewport)
+        : m_transformer(transformer)
+        , m_pixel_size(pixel_size)
+        , m_viewport(viewport)
+    {}
+
+    template <typename Point1, typename Point2>
+    inline bool apply(Point1 const& p1, Point2& p2) const
+    {
+        return m_transformer.apply(p1, p2);
+    }
+
+    inline double pixel_size() const { return m_pixel_size; }
+    inline Box const* viewport() const { return m_viewport; }
+
+private:
+    Transformer const& m_transformer;
+    double m_pixel_size;
+    Box const* m_viewport;
+};
+
+
+template <typename Geometry>
+inline void write_mapped(std::ostream& stream, std::string const& style,
+                         double size, Geometry const& geometry)
+{
+    // Not streamed with the svg manipulator which flushes the stream
+    dispatch::devarianted_svg<Geometry>::apply(stream, geometry, style, size);
+    stream << '\n';
+}
+
+template <typename Point>
+inline bool same_pixel(Point const& p1, Point const& p2, double pixel_size)
+{
+    return std::floor(geometry::get<0>(p1) / pixel_size)
+                == std::floor(geometry::get<0>(p2) / pixel_size)
+        && std::floor(geometry::get<1>(p1) / pixel_size)
+                == std::floor(geometry::get<1>(p2) / pixel_size);
+}
+
+/*!
+\brief Removes the vertices mapped to the same pixel as the previous vertex
+    which is kept, the first and the last vertex are always kept
+*/
+template <typename Range>
+inline void cull_vertices(Range& range, double pixel_size)
+{
+    std::size_t const n = boost::size(range);
+    if (pixel_size <= 0.0 || n <= 2)
+    {
+        return;
+    }
+
+    std::size_t count = 1;
+    for (std::size_t i = 1; i + 1 < n; i++)
+    {
+        if (! same_pixel(range[count - 1], range[i], pixel_size))
+        {
+            range[count++] = range[i];
+        }
+    }
+    range[count++] = range[n - 1];
+    range.erase(boost::begin(range) + count, boost::end(range));
+}
+
+template <typename Point, typename Box>
+inline bool in_viewport(Point const& point, Box const& viewport)
+{
+    return geometry::get<0>(point) >= geometry::get<min_corner, 0>(viewport)
+        && geometry::get<0>(point) <= geometry::get<max_corner, 0>(viewport)
+        && geometry::get<1>(point) >= geometry::get<min_corner, 1>(viewport)
+        && geometry::get<1>(point) <= geometry::get<max_corner, 1>(viewport);
+}
+
+template <typename Box1, typename Box2>
+inline bool overlaps_viewport(Box1 const& box, Box2 const& viewport)
+{
+    return geometry::get<min_corner, 0>(box) <= geometry::get<max_corner, 0>(viewport)
+        && geometry::get<max_corner, 0>(box) >= geometry::get<min_corner, 0>(viewport)
+        && geometry::get<min_corner, 1>(box) <= geometry::get<max_corner, 1>(viewport)
+        && geometry::get<max_corner, 1>(box) >= geometry::get<min_corner, 1>(viewport);
+}
+
+// One step of the Sutherland-Hodgman algorithm, clips the closed ring to the
+// half-plane at the Min (or, if Max, the max) side of the viewport
+template <std::size_t Corner, std::size_t Dimension, typename Ring, typename Box>
+inline void clip_ring_side(Ring const& input, Ring& output, Box const& viewport)
+{
+    typedef typename point_type<Ring>::type point_type;
+
+    double const limit = geometry::get<Corner, Dimension>(viewport);
+    output.clear();
+
+    std::size_t const n = boost::size(input);
+    for (std::size_t i = 1; i < n; i++)
+    {
+        point_type const& p1 = input[i - 1];
+        point_type const& p2 = input[i];
+        double const c1 = geometry::get<Dimension>(p1);
+        double const c2 = geometry::get<Dimension>(p2);
+        bool const inside1 = Corner == min_corner ? c1 >= limit : c1 <= limit;
+        bool const inside2 = Corner == min_corner ? c2 >= limit : c2 <= limit;
+
+        if (inside1 != inside2)
+        {
+            double const fraction = (limit - c1) / (c2 - c1);
+            point_type ip;
+            geometry::set<0>(ip, geometry::get<0>(p1)
+                + fraction * (geometry::get<0>(p2) - geometry::get<0>(p1)));
+            geometry::set<1>(ip, geometry::get<1>(p1)
+                + fraction * (geometry::get<1>(p2) - geometry::get<1>(p1)));
+            geometry::set<Dimension>(ip, limit);
+            output.push_back(ip);
+        }
+        if (inside2)
+        {
+            output.push_back(p2);
+        }
+    }
+
+    if (! output.empty())
+    {
+        output.push_back(output.front());
+    }
+}
+
+template <typename Ring, typename Box>
+inline void clip_ring(Ring& ring, Box const& viewport)
+{
+    Ring temp;
+    clip_ring_side<min_corner, 0>(ring, temp, viewport);
+    clip_ring_side<max_corner, 0>(temp, ring, viewport);
+    clip_ring_side<min_corner, 1>(ring, temp, viewport);
+    clip_ring_side<max_corner, 1>(temp, ring, viewport);
+}
+
+// Culls and clips the ring, returns false if it is not visible
+template <typename Ring, typename Transformer, typename Box>
+inline bool reduce_ring(Ring& ring, map_strategy<Transformer, Box> const& strategy)
+{
+    cull_vertices(ring, strategy.pixel_size());
+    if (strategy.viewport() != NULL)
+    {
+        clip_ring(ring, *strategy.viewport());
+    }
+    // Closed rings collapsed within one or two pixels are not visible
+    return boost::size(ring) >= 4;
+}
+
+
+template <typename Tag>
+struct write_reduced
+{
+    // Points, boxes and segments are written if they overlap the viewport
+    template <typename Geometry, typename Transformer, typename Box>
+    static inline void apply(std::ostream& stream, std::string const& style,
+                             double size, Geometry& geometry,
+                             map_strategy<Transformer, Box> const& strategy)
+    {
+        if (strategy.viewport() == NULL
+            || overlaps_viewport(geometry::return_envelope<Box>(geometry),
+                                 *strategy.viewport()))
+        {
+            write_mapped(stream, style, size, geometry);
+        }
+    }
+};
+
+template <>
+struct write_reduced<point_tag>
+{
+    template <typename Point, typename Transformer, typename Box>
+    static inline void apply(std::ostream& stream, std::string const& style,
+                             double size, Point& point,
+                             map_strategy<Transformer, Box> const& strategy)
+    {
+        if (strategy.viewport() == NULL
+            || in_viewport(point, *strategy.viewport()))
+        {
+            write_mapped(stream, style, size, point);
+        }
+    }
+};
+
+template <>
+struct write_reduced<linestring_tag>
+{
+    template <typename Linestring, typename Transformer, typename Box>
+    static inline void apply(std::ostream& stream, std::string const& style,
+                             double size, Linestring& linestring,
+                             map_strategy<Transformer, Box> const& strategy)
+    {
+        cull_vertices(linestring, strategy.pixel_size());
+        if (strategy.viewport() == NULL)
+        {
+            write_mapped(stream, style, size, linestring);
+            return;
+        }
+
+        // The parts within the viewport are written as separate linestrings
+        typedef typename point_type<Linestring>::type point_type;
+        std::vector<Linestring> parts;
+        detail::intersection::clip_range_with_box<Linestring>(
+            *strategy.viewport(), linestring, detail::no_rescale_policy(),
+            std::back_inserter(parts),
+            geometry::strategy::intersection::liang_barsky<Box, point_type>());
+        for (std::size_t i = 0; i < parts.size(); i++)
+        {
+            write_mapped(stream, style, size, parts[i]);
+        }
+    }
+};
+
+template <>
+struct write_reduced<ring_tag>
+{
+    template <typename Ring, typename Transformer, typename Box>
+    static inline void apply(std::ostream& stream, std::string const& style,
+                             double size, Ring& ring,
+                             map_strategy<Transformer, Box> const& strategy)
+    {
+        if (reduce_ring(ring, strategy))
+        {
+            write_mapped(stream, style, size, ring);
+        }
+    }
+};
+
+template <>
+struct write_reduced<polygon_tag>
+{
+    template <typename Polygon, typename Transformer, typename Box>
+    static inline void apply(std::ostream& stream, std::string const& style,
+                             double size, Polygon& polygon,
+                             map_strategy<Transformer, Box> const& strategy)
+    {
+        if (! reduce_ring(polygon.outer(), strategy))
+        {
+            return;
+        }
+
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < polygon.inners().size(); i++)
+        {
+            if (reduce_ring(polygon.inners()[i], strategy))
+            {
+                if (count != i)
+                {
+                    polygon.inners()[count].swap(polygon.inners()[i]);
+                }
+                count++;
+            }
+        }
+        polygon.inners().resize(count);
+
+        write_mapped(stream, style, size, polygon);
+    }
+};
+
+// Writes the geometry mapped with a transformation strategy as it is
+template <typename Geometry, typename TransformStrategy>
+inline void write_mapped(std::ostream& stream, std::string const& style,
+                         double size, Geometry& geometry,
+                         TransformStrategy const& )
+{
+    write_mapped(stream, style, size, geometry);
+}
+
+// Writes the geometry mapped with svg_mapper, culled and clipped
+template <typename Geometry, typename Transformer, typename Box>
+inline void write_mapped(std::ostream& stream, std::string const& style,
+                         double size, Geometry& geometry,
+                         map_strategy<Transformer, Box> const& strategy)
+{
+    write_reduced
+        <
+            typename tag<Geometry>::type
+        >::apply(stream, style, size, geometry, strategy);
+}
+
+
+}} // namespace detail::svg
+#endif // DOXYGEN_NO_DETAIL
+
+
 #ifndef DOXYGEN_NO_DISPATCH
 namespace dispatch
 {
@@ -79,7 +387,7 @@ struct svg_map<point_tag, Point, SvgPoint>
     {
         SvgPoint ipoint;
         geometry::transform(point, ipoint, strategy);
-        stream << geometry::svg(ipoint, style, size) << std::endl;
+        detail::svg::write_mapped(stream, style, size, ipoint, strategy);
     }
 };
 
@@ -99,7 +407,7 @@ struct svg_map_box_seg
 #endif
         geometry::transform(box_seg, ibox_seg, strategy);
 
-        stream << geometry::svg(ibox_seg, style, size) << std::endl;
+        detail::svg::write_mapped(stream, style, size, ibox_seg, strategy);
     }
 };
 
@@ -124,7 +432,7 @@ struct svg_map_range
     {
         Range2 irange;
         geometry::transform(range, irange, strategy);
-        stream << geometry::svg(irange, style, size) << std::endl;
+        detail::svg::write_mapped(stream, style, size, irange, strategy);
     }
 };
 
@@ -150,7 +458,7 @@ struct svg_map<polygon_tag, Polygon, SvgPoint>
     {
         model::polygon<SvgPoint> ipoly;
         geometry::transform(polygon, ipoly, strategy);
-        stream << geometry::svg(ipoly, style, size) << std::endl;
+        detail::svg::write_mapped(stream, style, size, ipoly, strategy);
     }
 };
 
@@ -297,11 +605,21 @@ class svg_mapper : boost::noncopyable
             SameScale
         > transformer_type;
 
+    typedef model::box<svg_point_type> svg_box_type;
+
+    typedef detail::svg::map_strategy
+        <
+            transformer_type, svg_box_type
+        > map_strategy_type;
+
     model::box<Point> m_bounding_box;
     boost::scoped_ptr<transformer_type> m_matrix;
     std::ostream& m_stream;
     SvgCoordinateType m_width, m_height;
     std::string m_width_height; // for <svg> tag only, defaults to 2x 100%
+    double m_pixel_size; // culling disabled if not positive
+    bool m_clip;
+    svg_box_type m_viewport;
 
     void init_matrix()
     {
@@ -312,18 +630,18 @@ class svg_mapper : boost::noncopyable
 
 
             m_stream << "<?xml version=\"1.0\" standalone=\"no\"?>"
-                << std::endl
+                << '\n'
                 << "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\""
-                << std::endl
+                << '\n'
                 << "\"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">"
-                << std::endl
+                << '\n'
                 << "<svg " << m_width_height << " version=\"1.1\""
-                << std::endl
+                << '\n'
                 << "xmlns=\"http://www.w3.org/2000/svg\""
-                << std::endl
+                << '\n'
                 << "xmlns:xlink=\"http://www.w3.org/1999/xlink\""
                 << ">"
-                << std::endl;
+                << '\n';
         }
     }
 
@@ -345,6 +663,8 @@ public :
         , m_width(width)
         , m_height(height)
         , m_width_height(width_height)
+        , m_pixel_size(0.0)
+        , m_clip(false)
     {
         assign_inverse(m_bounding_box);
     }
@@ -376,6 +696,46 @@ public :
         }
     }
 
+    /*!
+    \brief Enables the level of detail reduction of the mapped linestrings,
+        rings and polygons: a vertex mapped to the same cell of pixel_size
+        SVG pixels as the previously written vertex is not written. The
+        first and the last vertex are always written, rings collapsing to
+        less than three distinct cells are not written.
+    \param pixel_size Size of the cells in SVG pixels, all vertices are
+        written if it is not positive (the default)
+    */
+    void set_vertex_culling(double pixel_size = 1.0)
+    {
+        m_pixel_size = pixel_size;
+    }
+
+    /*!
+    \brief Enables clipping the mapped geometries to the SVG map, extended
+        with margin SVG pixels at each side. Points, boxes and segments
+        outside are not written, linestrings are written as the parts inside
+        and rings are clipped. Geometries mapped outside the geometries added
+        before are not written therefore.
+    \param clip Flag indicating if the geometries are clipped
+    \param margin Margin in SVG pixels, should be larger than the widths
+        of the strokes
+    */
+    void set_clipping(bool clip, double margin = 10.0)
+    {
+        m_clip = clip;
+        assign_values(m_viewport, 0.0 - margin, 0.0 - margin,
+                      m_width + margin, m_height + margin);
+    }
+
+    /*!
+    \brief Flushes the stream. The geometries are written without flushing,
+        the stream is flushed when the SVG is closed
+    */
+    void flush()
+    {
+        m_stream.flush();
+    }
+
     /*!
     \brief Maps a geometry into the SVG map using the specified style
     \tparam Geometry \tparam_geometry
@@ -389,7 +749,16 @@ public :
                 double size = -1.0)
     {
         init_matrix();
-        svg_map<svg_point_type>(m_stream, style, size, geometry, *m_matrix);
+        if (m_pixel_size > 0.0 || m_clip)
+        {
+            map_strategy_type const strategy(*m_matrix, m_pixel_size,
+                                             m_clip ? &m_viewport : NULL);
+            svg_map<svg_point_type>(m_stream, style, size, geometry, strategy);
+        }
+        else
+        {
+            svg_map<svg_point_type>(m_stream, style, size, geometry, *m_matrix);
+        }
     }
 
     /*!
@@ -439,7 +808,7 @@ public :
                     << ">" << *it << "</tspan>";
             }
         }
-        m_stream << "</text>" << std::endl;
+        m_stream << "</text>" << '\n';
     }
 };
 
@@ -37,6 +37,8 @@
 
 #include <boost/geometry/geometries/concepts/check.hpp>
 
+#include <boost/geometry/io/detail/output.hpp>
+
 
 namespace boost { namespace geometry
 {
@@ -50,8 +52,8 @@ namespace detail { namespace svg
 template <typename Point>
 struct svg_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Point const& p, std::string const& style, double size)
     {
         os << "<circle cx=\"" << geometry::get<0>(p)
@@ -65,8 +67,8 @@ struct svg_point
 template <typename Box>
 struct svg_box
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box, std::string const& style, double)
     {
         // Prevent invisible boxes, making them >=1, using "max"
@@ -89,8 +91,8 @@ struct svg_box
 template <typename Segment>
 struct svg_segment
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
         Segment const& segment, std::string const& style, double)
     {
         typedef typename coordinate_type<Segment>::type ct;
@@ -112,8 +114,8 @@ struct svg_segment
 template <typename Range, typename Policy>
 struct svg_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
         Range const& range, std::string const& style, double)
     {
         typedef typename boost::range_iterator<Range const>::type iterator;
@@ -140,8 +142,8 @@ struct svg_range
 template <typename Polygon>
 struct svg_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
         Polygon const& polygon, std::string const& style, double)
     {
         typedef typename geometry::ring_type<Polygon>::type ring_type;
@@ -204,8 +206,8 @@ struct prefix_ring
 template <typename MultiGeometry, typename Policy>
 struct svg_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
         MultiGeometry const& multi, std::string const& style, double size)
     {
         for (typename boost::range_iterator<MultiGeometry const>::type
@@ -234,8 +236,8 @@ namespace dispatch
 \details Specializations should implement a static method "stream" to stream a geometry
 The static method should have the signature:
 
-template <typename Char, typename Traits>
-static inline void apply(std::basic_ostream<Char, Traits>& os, G const& geometry)
+template <typename OutputStream>
+static inline void apply(OutputStream& os, G const& geometry)
 */
 template <typename Geometry, typename Tag = typename tag<Geometry>::type>
 struct svg
@@ -413,6 +415,28 @@ inline svg_manipulator<Geometry> svg(Geometry const& geometry,
     return svg_manipulator<Geometry>(geometry, style, size);
 }
 
+/*!
+\brief Appends the SVG of a geometry to a string
+\details Coordinates are written like in to_wkt(), independently of the
+    locale and floating point numbers in the shortest form which is read
+    back exactly. The string is not cleared so it can be reused.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param output The string the SVG is appended to
+\param style String containing verbatim SVG style information
+\param size Optional size (used for SVG points) in SVG pixels
+\ingroup svg
+*/
+template <typename Geometry>
+inline void to_svg(Geometry const& geometry, std::string& output,
+            std::string const& style, double size = -1.0)
+{
+    concepts::check<Geometry const>();
+
+    detail::io::string_output out(output);
+    dispatch::devarianted_svg<Geometry>::apply(out, geometry, style, size);
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_IO_SVG_WRITE_HPP
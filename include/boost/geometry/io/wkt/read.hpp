@@ -21,12 +21,12 @@
 #define BOOST_GEOMETRY_IO_WKT_READ_HPP
 
 #include <cstddef>
+#include <cstring>
+#include <iterator>
 #include <string>
 
 #include <boost/lexical_cast.hpp>
-#include <boost/tokenizer.hpp>
 
-#include <boost/algorithm/string.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -35,6 +35,7 @@
 #include <boost/throw_exception.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/remove_reference.hpp>
+#include <boost/utility/string_view.hpp>
 
 #include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/algorithms/append.hpp>
@@ -55,6 +56,7 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 
 #include <boost/geometry/util/coordinate_cast.hpp>
+#include <boost/geometry/util/range.hpp>
 
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
 
@@ -78,7 +80,7 @@ struct read_wkt_exception : public geometry::exception
         if (it != end)
         {
             source = " at '";
-            source += it->c_str();
+            source.append(it->begin(), it->end());
             source += "'";
         }
         complete = message + source + " in '" + wkt.substr(0, 100) + "'";
@@ -110,7 +112,198 @@ private :
 namespace detail { namespace wkt
 {
 
-typedef boost::tokenizer<boost::char_separator<char> > tokenizer;
+/*!
+\brief Internal, splits WKT into tokens without copying them
+\details Spaces are dropped, "," "(" and ")" are tokens of their own, like
+    boost::tokenizer with char_separator<char>(" ", ",()") but the tokens are
+    string_views pointing into the source string.
+*/
+class tokenizer
+{
+public:
+    class iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef boost::string_view value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef boost::string_view const* pointer;
+        typedef boost::string_view const& reference;
+
+        inline iterator()
+            : m_last(0)
+        {}
+
+        inline iterator(const char* first, const char* last)
+            : m_token(first, 0)
+            , m_last(last)
+        {
+            next();
+        }
+
+        inline reference operator*() const { return m_token; }
+        inline pointer operator->() const { return &m_token; }
+
+        inline iterator& operator++()
+        {
+            next();
+            return *this;
+        }
+
+        inline iterator operator++(int)
+        {
+            iterator result = *this;
+            next();
+            return result;
+        }
+
+        inline bool operator==(iterator const& other) const
+        {
+            return m_token.data() == other.m_token.data();
+        }
+
+        inline bool operator!=(iterator const& other) const
+        {
+            return m_token.data() != other.m_token.data();
+        }
+
+        //! Position of the current token (or the end) in the source
+        inline const char* position() const
+        {
+            return m_token.data();
+        }
+
+    private:
+        static inline bool is_separator(char c)
+        {
+            return c == ' ' || c == ',' || c == '(' || c == ')';
+        }
+
+        inline void next()
+        {
+            const char* it = m_token.data() + m_token.size();
+            while (it != m_last && *it == ' ')
+            {
+                ++it;
+            }
+
+            const char* token_end = it;
+            if (it != m_last)
+            {
+                ++token_end;
+                if (*it != ',' && *it != '(' && *it != ')')
+                {
+                    while (token_end != m_last && ! is_separator(*token_end))
+                    {
+                        ++token_end;
+                    }
+                }
+            }
+
+            m_token = boost::string_view(it, static_cast<std::size_t>(token_end - it));
+        }
+
+        boost::string_view m_token;
+        const char* m_last;
+    };
+
+    explicit inline tokenizer(std::string const& wkt)
+        : m_first(wkt.data())
+        , m_last(wkt.data() + wkt.size())
+    {}
+
+    inline iterator begin() const
+    {
+        return iterator(m_first, m_last);
+    }
+
+    inline iterator end() const
+    {
+        return iterator(m_last, m_last);
+    }
+
+private:
+    const char* m_first;
+    const char* m_last;
+};
+
+// ASCII case insensitive comparison
+inline bool iequals(boost::string_view const& token, const char* value)
+{
+    std::size_t const size = std::strlen(value);
+    if (token.size() != size)
+    {
+        return false;
+    }
+    for (std::size_t i = 0 ; i < size ; ++i)
+    {
+        char c = token[i];
+        if (c >= 'a' && c <= 'z')
+        {
+            c = static_cast<char>(c - 'a' + 'A');
+        }
+        char v = value[i];
+        if (v >= 'a' && v <= 'z')
+        {
+            v = static_cast<char>(v - 'a' + 'A');
+        }
+        if (c != v)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+\brief Internal, counts the elements of a sequence like "x y,x y)" or
+    "(...),(...))" by counting the commas before the closing parenthesis
+\param it token-iterator, positioned after "("
+\note Used to reserve memory, the syntax is checked while parsing
+*/
+inline std::size_t count_elements(tokenizer::iterator const& it,
+                                  tokenizer::iterator const& end)
+{
+    const char* pos = it.position();
+    const char* const last = end.position();
+    std::size_t commas = 0;
+    bool has_element = false;
+    int depth = 0;
+    for ( ; pos != last ; ++pos)
+    {
+        char const c = *pos;
+        if (c == ')')
+        {
+            if (depth == 0)
+            {
+                break;
+            }
+            --depth;
+        }
+        else if (c == '(')
+        {
+            ++depth;
+        }
+        else if (c == ',' && depth == 0)
+        {
+            ++commas;
+        }
+        has_element = has_element || c != ' ';
+    }
+    return has_element ? commas + 1 : 0;
+}
+
+template <typename Range>
+inline void reserve_elements(Range& rng,
+                             tokenizer::iterator const& it,
+                             tokenizer::iterator const& end)
+{
+    std::size_t const count = count_elements(it, end);
+    if (count > 0)
+    {
+        range::reserve(rng, boost::size(rng) + count);
+    }
+}
 
 template <typename Point,
           std::size_t Dimension = 0,
@@ -131,13 +324,11 @@ struct parsing_assigner
         {
             // Initialize missing coordinates to default constructor (zero)
             // OR
-            // Use lexical_cast for conversion to double/int
-            // Note that it is much slower than atof. However, it is more standard
-            // and in parsing the change in performance falls probably away against
-            // the tokenizing
+            // Parse the token, numbers in unusual format are converted
+            // using lexical_cast
             set<Dimension>(point, finished
                     ? coordinate_type()
-                    : coordinate_cast<coordinate_type>::apply(*it));
+                    : coordinate_parser<coordinate_type>::apply(it->begin(), it->end()));
         }
         catch(boost::bad_lexical_cast const& blc)
         {
@@ -334,6 +525,8 @@ struct container_appender
     {
         handle_open_parenthesis(it, end, wkt);
 
+        reserve_elements(out, it, end);
+
         stateful_range_appender<Geometry> appender;
 
         // Parse points until closing parenthesis
@@ -425,6 +618,14 @@ struct polygon_parser
 
         handle_open_parenthesis(it, end, wkt);
 
+        std::size_t const count = count_elements(it, end);
+        if (count > 1)
+        {
+            typename interior_return_type<Polygon>::type
+                rings = interior_rings(poly);
+            range::reserve(rings, count - 1);
+        }
+
         int n = -1;
 
         // Stop at ")"
@@ -461,10 +662,10 @@ struct polygon_parser
 
 
 inline bool one_of(tokenizer::iterator const& it,
-                   std::string const& value,
+                   const char* value,
                    bool& is_present)
 {
-    if (boost::iequals(*it, value))
+    if (iequals(*it, value))
     {
         is_present = true;
         return true;
@@ -473,11 +674,11 @@ inline bool one_of(tokenizer::iterator const& it,
 }
 
 inline bool one_of(tokenizer::iterator const& it,
-                   std::string const& value,
+                   const char* value,
                    bool& present1,
                    bool& present2)
 {
-    if (boost::iequals(*it, value))
+    if (iequals(*it, value))
     {
         present1 = true;
         present2 = true;
@@ -521,7 +722,7 @@ inline void handle_empty_z_m(tokenizer::iterator& it,
 */
 template <typename Geometry>
 inline bool initialize(tokenizer const& tokens,
-                       std::string const& geometry_name,
+                       const char* geometry_name,
                        std::string const& wkt,
                        tokenizer::iterator& it,
                        tokenizer::iterator& end)
@@ -529,7 +730,7 @@ inline bool initialize(tokenizer const& tokens,
     it = tokens.begin();
     end = tokens.end();
 
-    if (it == end || ! boost::iequals(*it++, geometry_name))
+    if (it == end || ! iequals(*it++, geometry_name))
     {
         BOOST_THROW_EXCEPTION(read_wkt_exception(std::string("Should start with '") + geometry_name + "'", wkt));
     }
@@ -571,7 +772,7 @@ struct geometry_parser
     {
         geometry::clear(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
         if (initialize<Geometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
@@ -589,12 +790,14 @@ struct multi_parser
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
             handle_open_parenthesis(it, end, wkt);
 
+            reserve_elements(geometry, it, end);
+
             // Parse sub-geometries
             while(it != end && *it != ")")
             {
@@ -636,13 +839,15 @@ struct multi_point_parser
     {
         traits::clear<MultiGeometry>::apply(geometry);
 
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it, end;
 
         if (initialize<MultiGeometry>(tokens, PrefixPolicy::apply(), wkt, it, end))
         {
             handle_open_parenthesis(it, end, wkt);
 
+            reserve_elements(geometry, it, end);
+
             // If first point definition starts with "(" then parse points as (x y)
             // otherwise as "x y"
             bool using_brackets = (it != end && *it == "(");
@@ -695,10 +900,10 @@ struct box_parser
     static inline void apply(std::string const& wkt, Box& box)
     {
         bool should_close = false;
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
-        if (it != end && boost::iequals(*it, "POLYGON"))
+        if (it != end && iequals(*it, "POLYGON"))
         {
             ++it;
             bool has_empty, has_z, has_m;
@@ -711,7 +916,7 @@ struct box_parser
             handle_open_parenthesis(it, end, wkt);
             should_close = true;
         }
-        else if (it != end && boost::iequals(*it, "BOX"))
+        else if (it != end && iequals(*it, "BOX"))
         {
             ++it;
         }
@@ -764,12 +969,12 @@ struct segment_parser
 {
     static inline void apply(std::string const& wkt, Segment& segment)
     {
-        tokenizer tokens(wkt, boost::char_separator<char>(" ", ",()"));
+        tokenizer tokens(wkt);
         tokenizer::iterator it = tokens.begin();
         tokenizer::iterator end = tokens.end();
         if (it != end &&
-            (boost::iequals(*it, "SEGMENT")
-            || boost::iequals(*it, "LINESTRING") ))
+            (iequals(*it, "SEGMENT")
+            || iequals(*it, "LINESTRING") ))
         {
             ++it;
         }
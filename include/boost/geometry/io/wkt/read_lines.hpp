@@ -0,0 +1,184 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_READ_LINES_HPP
+#define BOOST_GEOMETRY_IO_WKT_READ_LINES_HPP
+
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <boost/geometry/io/detail/bulk_read.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+inline bool is_blank(const char* first, const char* last)
+{
+    for ( ; first != last ; ++first)
+    {
+        if (*first != ' ' && *first != '\t' && *first != '\r')
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the position after the first '\n' at or after it, or last
+inline const char* next_line(const char* it, const char* last)
+{
+    const char* const eol = static_cast<const char*>(
+        std::memchr(it, '\n', std::size_t(last - it)));
+    return eol ? eol + 1 : last;
+}
+
+// Parses the lines starting in [first, last), the last line may continue
+// after last up to end
+template <typename Geometry, typename Value>
+inline void read_lines(const char* first, const char* last, const char* end,
+                       io::bulk_arena<Geometry, Value>& arena)
+{
+    std::string line;
+    while (first < last)
+    {
+        const char* const line_end = next_line(first, end);
+        const char* text_end = line_end;
+        if (text_end != first && text_end[-1] == '\n')
+        {
+            --text_end;
+        }
+        if (text_end != first && text_end[-1] == '\r')
+        {
+            --text_end;
+        }
+
+        if (! is_blank(first, text_end))
+        {
+            line.assign(first, text_end);
+            arena.geometries.push_back(Geometry());
+            geometry::read_wkt(line, arena.geometries.back());
+            io::add_envelope(arena);
+        }
+        first = line_end;
+    }
+}
+
+template <typename Geometry, typename Value, typename Executor>
+inline void read_wkt_lines(const char* first, const char* last,
+                           std::vector<Geometry>& geometries,
+                           std::vector<Value>* envelopes,
+                           Executor const& executor)
+{
+    std::size_t const size = std::size_t(last - first);
+    std::size_t const chunk = io::bulk_chunk_bytes;
+    std::size_t const count = size == 0 ? 0 : (size + chunk - 1) / chunk;
+
+    // Each task parses the lines starting in its chunk of bytes, so lines
+    // crossing the boundaries of the chunks are parsed once
+    std::vector<io::bulk_arena<Geometry, Value> > arenas(count);
+    executor(count, [&](std::size_t i)
+    {
+        const char* chunk_first = first + i * chunk;
+        const char* const chunk_last = i + 1 == count ? last : chunk_first + chunk;
+        if (i > 0 && chunk_first[-1] != '\n')
+        {
+            chunk_first = next_line(chunk_first, last);
+        }
+        read_lines(chunk_first, chunk_last, last, arenas[i]);
+    });
+
+    io::splice(arenas, geometries, envelopes, executor);
+}
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Parses newline-delimited \ref WKT into a vector of geometries using
+    an executor
+\details The text is split into chunks parsed in parallel and the geometries
+    are appended to geometries in the order of the lines. Blank lines are
+    skipped, "\r\n" line endings are accepted.
+\ingroup wkt
+\tparam Geometry \tparam_geometry
+\param first begin of the text
+\param last end of the text
+\param geometries vector the geometries are appended to
+\param executor executor running the tasks, e.g. thread_executor
+\note If a line is not valid WKT the exception thrown by read_wkt is
+    rethrown, in that case the content of geometries is unspecified.
+*/
+template <typename Geometry, typename Executor>
+inline void read_wkt_lines(const char* first, const char* last,
+                           std::vector<Geometry>& geometries,
+                           Executor const& executor)
+{
+    geometry::concepts::check<Geometry>();
+    detail::wkt::read_wkt_lines(first, last, geometries,
+        static_cast<std::vector<detail::io::no_envelopes>*>(0), executor);
+}
+
+/*!
+\brief Parses newline-delimited \ref WKT into a vector of geometries and
+    computes their envelopes using an executor
+\details The envelope of every geometry is computed after the geometry is
+    parsed, when its points are still in the cache. The envelopes are
+    appended to envelopes in the order of the geometries. Value is either
+    a box or a std::pair of a box and an integral index which is set to the
+    index of the geometry in geometries, so an index::rtree of the geometries
+    can be packed from envelopes directly.
+\ingroup wkt
+\tparam Geometry \tparam_geometry
+\param first begin of the text
+\param last end of the text
+\param geometries vector the geometries are appended to
+\param envelopes vector the envelopes are appended to
+\param executor executor running the tasks, e.g. thread_executor
+*/
+template <typename Geometry, typename Value, typename Executor>
+inline void read_wkt_lines(const char* first, const char* last,
+                           std::vector<Geometry>& geometries,
+                           std::vector<Value>& envelopes,
+                           Executor const& executor)
+{
+    geometry::concepts::check<Geometry>();
+    detail::wkt::read_wkt_lines(first, last, geometries, &envelopes, executor);
+}
+
+template <typename Geometry, typename Executor>
+inline void read_wkt_lines(std::string const& text,
+                           std::vector<Geometry>& geometries,
+                           Executor const& executor)
+{
+    geometry::read_wkt_lines(text.data(), text.data() + text.size(),
+                             geometries, executor);
+}
+
+template <typename Geometry, typename Value, typename Executor>
+inline void read_wkt_lines(std::string const& text,
+                           std::vector<Geometry>& geometries,
+                           std::vector<Value>& envelopes,
+                           Executor const& executor)
+{
+    geometry::read_wkt_lines(text.data(), text.data() + text.size(),
+                             geometries, envelopes, executor);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_READ_LINES_HPP
@@ -21,6 +21,8 @@
 #ifndef BOOST_GEOMETRY_IO_WKT_WRITE_HPP
 #define BOOST_GEOMETRY_IO_WKT_WRITE_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <ostream>
 #include <string>
 
@@ -44,6 +46,7 @@
 #include <boost/geometry/geometries/concepts/check.hpp>
 #include <boost/geometry/geometries/ring.hpp>
 
+#include <boost/geometry/io/detail/output.hpp>
 #include <boost/geometry/io/wkt/detail/prefix.hpp>
 
 #include <boost/geometry/util/condition.hpp>
@@ -65,8 +68,8 @@ namespace detail { namespace wkt
 template <typename P, int I, int Count>
 struct stream_coordinate
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, P const& p)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, P const& p)
     {
         os << (I > 0 ? " " : "") << get<I>(p);
         stream_coordinate<P, I + 1, Count>::apply(os, p);
@@ -76,8 +79,8 @@ struct stream_coordinate
 template <typename P, int Count>
 struct stream_coordinate<P, Count, Count>
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>&, P const&)
+    template <typename OutputStream>
+    static inline void apply(OutputStream&, P const&)
     {}
 };
 
@@ -113,8 +116,8 @@ struct double_closing_parenthesis
 template <typename Point, typename Policy>
 struct wkt_point
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os, Point const& p, bool)
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os, Point const& p, bool)
     {
         os << Policy::apply() << "(";
         stream_coordinate<Point, 0, dimension<Point>::type::value>::apply(os, p);
@@ -135,8 +138,8 @@ template
 >
 struct wkt_range
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Range const& range, bool force_closure = ForceClosurePossible)
     {
         typedef typename boost::range_iterator<Range const>::type iterator_type;
@@ -208,8 +211,8 @@ struct wkt_sequence
 template <typename Polygon, typename PrefixPolicy>
 struct wkt_poly
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Polygon const& poly, bool force_closure)
     {
         typedef typename ring_type<Polygon const>::type ring;
@@ -235,8 +238,8 @@ struct wkt_poly
 template <typename Multi, typename StreamPolicy, typename PrefixPolicy>
 struct wkt_multi
 {
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Multi const& geometry, bool force_closure)
     {
         os << PrefixPolicy::apply();
@@ -264,8 +267,8 @@ struct wkt_box
 {
     typedef typename point_type<Box>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Box const& box, bool force_closure)
     {
         // Convert to a clockwire ring, then stream.
@@ -289,8 +292,8 @@ struct wkt_box
             //assert_dimension<B, 2>();
         }
 
-        template <typename RingType, typename Char, typename Traits>
-        static inline void do_apply(std::basic_ostream<Char, Traits>& os,
+        template <typename RingType, typename OutputStream>
+        static inline void do_apply(OutputStream& os,
                     Box const& box)
         {
             RingType ring;
@@ -308,8 +311,8 @@ struct wkt_segment
 {
     typedef typename point_type<Segment>::type point_type;
 
-    template <typename Char, typename Traits>
-    static inline void apply(std::basic_ostream<Char, Traits>& os,
+    template <typename OutputStream>
+    static inline void apply(OutputStream& os,
                 Segment const& segment, bool)
     {
         // Convert to two points, then stream
@@ -331,6 +334,17 @@ struct wkt_segment
         {}
 };
 
+// Boost.Geometry, by default, closes polygons explictly, but not rings
+// NOTE: this might change in the future!
+template <typename Geometry>
+struct default_force_closure
+{
+    static const bool value = ! boost::is_same
+        <
+            typename tag<Geometry>::type, ring_tag
+        >::value;
+};
+
 }} // namespace detail::wkt
 #endif // DOXYGEN_NO_DETAIL
 
@@ -509,14 +523,10 @@ Small example showing how to use the wkt class
 template <typename Geometry>
 class wkt_manipulator
 {
-    static const bool is_ring = boost::is_same<typename tag<Geometry>::type, ring_tag>::value;
-
 public:
 
-    // Boost.Geometry, by default, closes polygons explictly, but not rings
-    // NOTE: this might change in the future!
     inline wkt_manipulator(Geometry const& g,
-                           bool force_closure = ! is_ring)
+                           bool force_closure = detail::wkt::default_force_closure<Geometry>::value)
         : m_geometry(g)
         , m_force_closure(force_closure)
     {}
@@ -551,6 +561,70 @@ inline wkt_manipulator<Geometry> wkt(Geometry const& geometry)
     return wkt_manipulator<Geometry>(geometry);
 }
 
+/*!
+\brief Appends the \ref WKT of a geometry to a string
+\details Coordinates are written independently of the locale, floating point
+    numbers in the shortest form (except for rare cases where a digit more
+    is written) which is read back exactly. The string is not cleared so
+    the same string can be reused for many geometries without reallocations.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param output The string the WKT is appended to
+\ingroup wkt
+*/
+template <typename Geometry>
+inline void to_wkt(Geometry const& geometry, std::string& output)
+{
+    concepts::check<Geometry const>();
+
+    detail::io::string_output out(output);
+    dispatch::devarianted_wkt<Geometry>::apply(out, geometry,
+        detail::wkt::default_force_closure<Geometry>::value);
+}
+
+/*!
+\brief Returns the \ref WKT of a geometry, like to_wkt appending to a string
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\ingroup wkt
+*/
+template <typename Geometry>
+inline std::string to_wkt(Geometry const& geometry)
+{
+    std::string result;
+    geometry::to_wkt(geometry, result);
+    return result;
+}
+
+/*!
+\brief Writes the \ref WKT of a geometry to a buffer, like to_wkt appending
+    to a string
+\details At most size - 1 characters are written, followed by a terminating
+    null character if size is greater than 0.
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param buffer The buffer the WKT is written to
+\param size The size of the buffer
+\return The length of the WKT, if it is not less than size the output was
+    truncated
+\ingroup wkt
+*/
+template <typename Geometry>
+inline std::size_t to_wkt(Geometry const& geometry, char* buffer, std::size_t size)
+{
+    concepts::check<Geometry const>();
+
+    detail::io::buffer_output out(buffer, size > 0 ? size - 1 : 0);
+    dispatch::devarianted_wkt<Geometry>::apply(out, geometry,
+        detail::wkt::default_force_closure<Geometry>::value);
+
+    if (size > 0)
+    {
+        buffer[(std::min)(out.count(), size - 1)] = '\0';
+    }
+    return out.count();
+}
+
 #if defined(_MSC_VER)
 #pragma warning(pop)  
 #endif
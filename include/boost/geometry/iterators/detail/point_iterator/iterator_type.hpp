@@ -11,6 +11,8 @@
 #ifndef BOOST_GEOMETRY_ITERATORS_DETAIL_POINT_ITERATOR_ITERATOR_TYPE_HPP
 #define BOOST_GEOMETRY_ITERATORS_DETAIL_POINT_ITERATOR_ITERATOR_TYPE_HPP
 
+#include <iterator>
+
 #include <boost/range.hpp>
 
 #include <boost/geometry/core/interior_type.hpp>
@@ -65,6 +67,13 @@ class iterator_type<Polygon, polygon_tag>
 private:
     typedef typename inner_range_type<Polygon>::type inner_range;
 
+    // The reference of the iterators of the rings, it is not a reference
+    // if the rings create the points when they are accessed
+    typedef typename std::iterator_traits
+        <
+            typename iterator_type<inner_range>::type
+        >::reference reference_type;
+
 public:
     typedef concatenate_iterator
         <
@@ -78,9 +87,11 @@ public:
                     typename iterator_type<inner_range>::type,
                     typename value_type<Polygon>::type,
                     dispatch::points_begin<inner_range>,
-                    dispatch::points_end<inner_range>
+                    dispatch::points_end<inner_range>,
+                    reference_type
                 >,
-            typename value_type<Polygon>::type
+            typename value_type<Polygon>::type,
+            reference_type
         > type;
 };
 
@@ -105,7 +116,11 @@ public:
             typename iterator_type<inner_range>::type,
             typename value_type<MultiLinestring>::type,
             dispatch::points_begin<inner_range>,
-            dispatch::points_end<inner_range>
+            dispatch::points_end<inner_range>,
+            typename std::iterator_traits
+                <
+                    typename iterator_type<inner_range>::type
+                >::reference
         > type;
 };
 
@@ -123,7 +138,11 @@ public:
             typename iterator_type<inner_range>::type,
             typename value_type<MultiPolygon>::type,
             dispatch::points_begin<inner_range>,
-            dispatch::points_end<inner_range>
+            dispatch::points_end<inner_range>,
+            typename std::iterator_traits
+                <
+                    typename iterator_type<inner_range>::type
+                >::reference
         > type;
 };
 
@@ -14,12 +14,30 @@
 #define BOOST_GEOMETRY_SRS_PROJECTION_HPP
 
 
+#include <atomic>
+#include <cstddef>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include <boost/core/addressof.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
 
+#include <boost/geometry/core/closure.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
 
 #include <boost/geometry/srs/projections/dpar.hpp>
 #include <boost/geometry/srs/projections/exception.hpp>
@@ -31,6 +49,9 @@
 #include <boost/geometry/srs/projections/proj4.hpp>
 #include <boost/geometry/srs/projections/spar.hpp>
 
+#include <boost/geometry/util/executor.hpp>
+#include <boost/geometry/util/range.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
 #include <boost/mpl/assert.hpp>
@@ -289,6 +310,221 @@ struct project_geometry<MultiPolygon, PointPolicy, multi_polygon_tag>
 {};
 
 
+// Calls f(range_in, range_out) for all ranges of points of the geometries.
+// The output multi-geometries and interior rings are resized before.
+template
+<
+    typename Geometry,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct for_each_range_pair
+    : not_implemented<Tag>
+{};
+
+template <typename Range>
+struct for_each_range_pair_single
+{
+    typedef Range range_type;
+
+    template <typename G1, typename G2, typename F>
+    static inline void apply(G1 const& g1, G2 & g2, F & f)
+    {
+        f(g1, g2);
+    }
+};
+
+template <typename Geometry>
+struct for_each_range_pair<Geometry, multi_point_tag>
+    : for_each_range_pair_single<Geometry>
+{};
+
+template <typename Geometry>
+struct for_each_range_pair<Geometry, linestring_tag>
+    : for_each_range_pair_single<Geometry>
+{};
+
+template <typename Geometry>
+struct for_each_range_pair<Geometry, ring_tag>
+    : for_each_range_pair_single<Geometry>
+{};
+
+template <typename Policy>
+struct for_each_range_pair_multi
+{
+    typedef typename Policy::range_type range_type;
+
+    template <typename G1, typename G2, typename F>
+    static inline void apply(G1 const& g1, G2 & g2, F & f)
+    {
+        range::resize(g2, boost::size(g1));
+
+        typename boost::range_iterator<G1 const>::type it1 = boost::begin(g1);
+        typename boost::range_iterator<G2>::type it2 = boost::begin(g2);
+        for ( ; it1 != boost::end(g1) ; ++it1, ++it2)
+        {
+            Policy::apply(*it1, *it2, f);
+        }
+    }
+};
+
+template <typename Geometry>
+struct for_each_range_pair<Geometry, multi_linestring_tag>
+    : for_each_range_pair_multi
+        <
+            for_each_range_pair_single
+                <
+                    typename boost::range_value<Geometry>::type
+                >
+        >
+{};
+
+template <typename Geometry>
+struct for_each_range_pair<Geometry, polygon_tag>
+{
+    typedef typename geometry::ring_type<Geometry>::type range_type;
+
+    template <typename G1, typename G2, typename F>
+    static inline void apply(G1 const& g1, G2 & g2, F & f)
+    {
+        f(geometry::exterior_ring(g1), geometry::exterior_ring(g2));
+
+        typename geometry::interior_return_type<G2>::type rings2
+            = geometry::interior_rings(g2);
+        for_each_range_pair_multi
+            <
+                for_each_range_pair_single<range_type>
+            >::apply(geometry::interior_rings(g1), rings2, f);
+    }
+};
+
+template <typename Geometry>
+struct for_each_range_pair<Geometry, multi_polygon_tag>
+    : for_each_range_pair_multi
+        <
+            for_each_range_pair
+                <
+                    typename boost::range_value<Geometry>::type,
+                    polygon_tag
+                >
+        >
+{};
+
+
+// Parallel projection. The output ranges are resized sequentially, then
+// chunks of points are projected by the executor.
+template <typename RangeIn, typename RangeOut, typename PointPolicy>
+struct project_ranges
+{
+    static const bool reverse = geometry::point_order<RangeIn>::value
+                             != geometry::point_order<RangeOut>::value;
+
+    static const std::size_t chunk_size = 4096;
+
+    // The same points as in range_to_range, the input is considered closed
+    // and the last point is skipped for open output.
+    inline void operator()(RangeIn const& in, RangeOut & out)
+    {
+        std::size_t const size_in = boost::size(in);
+        std::size_t size_out = size_in;
+        if (size_in > 0)
+        {
+            if (geometry::closure<RangeIn>::value == geometry::open)
+            {
+                ++size_out;
+            }
+            if (geometry::closure<RangeOut>::value == geometry::open)
+            {
+                --size_out;
+            }
+        }
+
+        geometry::clear(out);
+        range::resize(out, size_out);
+
+        m_ranges.push_back(std::make_pair(boost::addressof(in), boost::addressof(out)));
+        m_sizes.push_back(size_out);
+    }
+
+    template <typename Proj, typename Executor>
+    inline bool apply(Proj const& proj, Executor const& executor) const
+    {
+        std::atomic<bool> result(true);
+
+        geometry::detail::for_each_chunk_of_ranges(executor, m_sizes, chunk_size,
+            [&](std::size_t r, std::size_t first, std::size_t last)
+            {
+                RangeIn const& in = *m_ranges[r].first;
+                RangeOut & out = *m_ranges[r].second;
+                std::size_t const size_in = boost::size(in);
+
+                bool res = true;
+                for (std::size_t i = first ; i < last ; ++i)
+                {
+                    // closing point of open input
+                    std::size_t const j = i < size_in ? i : 0;
+                    std::size_t const k = reverse ? size_in - 1 - j : j;
+                    if (! project_point<PointPolicy>::apply(range::at(in, k),
+                                                            range::at(out, i),
+                                                            proj))
+                    {
+                        res = false;
+                    }
+                }
+
+                if (! res)
+                {
+                    result = false;
+                }
+            });
+
+        return result;
+    }
+
+private:
+    std::vector<std::pair<RangeIn const*, RangeOut*> > m_ranges;
+    std::vector<std::size_t> m_sizes;
+};
+
+template
+<
+    typename Geometry,
+    typename PointPolicy,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct project_geometry_parallel
+{
+    template <typename G1, typename G2, typename Proj, typename Executor>
+    static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj,
+                             Executor const& executor)
+    {
+        project_ranges
+            <
+                typename for_each_range_pair<G1>::range_type,
+                typename for_each_range_pair<G2>::range_type,
+                PointPolicy
+            > ranges;
+        for_each_range_pair<G1>::apply(g1, g2, ranges);
+        return ranges.apply(proj, executor);
+    }
+};
+
+template <typename Geometry, typename PointPolicy>
+struct project_geometry_parallel<Geometry, PointPolicy, point_tag>
+{
+    template <typename G1, typename G2, typename Proj, typename Executor>
+    static inline bool apply(G1 const& g1, G2 & g2, Proj const& proj,
+                             Executor const& )
+    {
+        return project_geometry<Geometry, PointPolicy>::apply(g1, g2, proj);
+    }
+};
+
+template <typename Geometry, typename PointPolicy>
+struct project_geometry_parallel<Geometry, PointPolicy, segment_tag>
+    : project_geometry_parallel<Geometry, PointPolicy, point_tag>
+{};
+
+
 } // namespace detail
 #endif // DOXYGEN_NO_DETAIL
 
@@ -487,6 +723,40 @@ public:
                     projections::detail::inverse_point_projection_policy
                 >::apply(xy, ll, base_t::proj());
     }
+
+    /// Forward projection, chunks of points are projected by executor
+    template <typename LL, typename XY, typename Executor>
+    inline bool forward(LL const& ll, XY& xy, Executor const& executor) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<LL, XY>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (LL, XY));
+
+        concepts::check_concepts_and_equal_dimensions<LL const, XY>();
+
+        return projections::detail::project_geometry_parallel
+                <
+                    LL,
+                    projections::detail::forward_point_projection_policy
+                >::apply(ll, xy, base_t::proj(), executor);
+    }
+
+    /// Inverse projection, chunks of points are projected by executor
+    template <typename XY, typename LL, typename Executor>
+    inline bool inverse(XY const& xy, LL& ll, Executor const& executor) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<XY, LL>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (XY, LL));
+
+        concepts::check_concepts_and_equal_dimensions<XY const, LL>();
+
+        return projections::detail::project_geometry_parallel
+                <
+                    XY,
+                    projections::detail::inverse_point_projection_policy
+                >::apply(xy, ll, base_t::proj(), executor);
+    }
 };
 
 } // namespace projections
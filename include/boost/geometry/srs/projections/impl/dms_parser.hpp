@@ -136,8 +136,56 @@ struct dms_parser
     };
 
 
+    // Characters of the value being parsed, short values are not allocated
+    class value_buffer
+    {
+        static const std::size_t static_capacity = 32;
+
+    public:
+        value_buffer()
+            : m_size(0)
+        {
+            m_static[0] = '\0';
+        }
+
+        inline void push_back(char c)
+        {
+            if (m_dynamic.empty() && m_size + 1 < static_capacity)
+            {
+                m_static[m_size] = c;
+                m_static[m_size + 1] = '\0';
+            }
+            else
+            {
+                if (m_dynamic.empty())
+                {
+                    m_dynamic.assign(m_static, m_size);
+                }
+                m_dynamic += c;
+            }
+            ++m_size;
+        }
+
+        inline void clear()
+        {
+            m_size = 0;
+            m_static[0] = '\0';
+            m_dynamic.clear();
+        }
+
+        inline const char* c_str() const
+        {
+            return m_dynamic.empty() ? m_static : m_dynamic.c_str();
+        }
+
+    private:
+        char m_static[static_capacity];
+        std::size_t m_size;
+        std::string m_dynamic;
+    };
+
     template <size_t I>
-    static inline void assign_dms(dms_value& dms, std::string& value, bool& has_value)
+    static inline void assign_dms(dms_value& dms, value_buffer& value, bool& has_value)
     {
         dms.dms[I] = geometry::str_cast<T>(value);
         dms.has_dms[I] = true;
@@ -145,7 +193,7 @@ struct dms_parser
         value.clear();
     }
 
-    static inline void process(dms_value& dms, std::string& value, bool& has_value)
+    static inline void process(dms_value& dms, value_buffer& value, bool& has_value)
     {
         if (has_value)
         {
@@ -165,7 +213,7 @@ struct dms_parser
     {
         dms_value dms;
         bool has_value = false;
-        std::string value;
+        value_buffer value;
 
         T factor = 1.0; // + denotes N/E values, -1 denotes S/W values
         typename dms_result<T>::axis_selector axis = dms_result<T>::axis_lon; // true denotes N/S values
@@ -233,7 +281,7 @@ struct dms_parser
                     process(dms, value, has_value);
                     break;
                 default :
-                    value += *is;
+                    value.push_back(*is);
                     has_value = true;
                     break;
             }
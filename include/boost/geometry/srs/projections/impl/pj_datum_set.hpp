@@ -40,10 +40,11 @@
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_DATUM_SET_HPP
 
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
-#include <boost/algorithm/string.hpp>
+#include <boost/utility/string_view.hpp>
 
 #include <boost/geometry/srs/projections/dpar.hpp>
 #include <boost/geometry/srs/projections/exception.hpp>
@@ -70,7 +71,7 @@ inline T sec_to_rad() { return 4.84813681109535993589914102357e-6; }
 template <typename T>
 inline const pj_datums_type<T>* pj_datum_find_datum(srs::detail::proj4_parameters const& params)
 {
-    std::string name = pj_get_param_s(params, "datum");
+    boost::string_view name = pj_get_param_s(params, "datum", srs::dpar::datum);
     if(! name.empty())
     {
         /* find the datum definition */
@@ -177,20 +178,20 @@ inline const pj_datums_type<T>* pj_datum_find_datum(srs::spar::parameters<BOOST_
 inline bool pj_datum_find_nadgrids(srs::detail::proj4_parameters const& params,
                                    srs::detail::nadgrids & out)
 {
-    std::string snadgrids = pj_get_param_s(params, "nadgrids");
+    boost::string_view snadgrids = pj_get_param_s(params, "nadgrids", srs::dpar::nadgrids);
     if (! snadgrids.empty())
     {
-        for (std::string::size_type i = 0 ; i < snadgrids.size() ; )
+        for (boost::string_view::size_type i = 0 ; i < snadgrids.size() ; )
         {
-            std::string::size_type end = snadgrids.find(',', i);
-            std::string name = snadgrids.substr(i, end - i);
+            boost::string_view::size_type end = snadgrids.find(',', i);
+            boost::string_view name = snadgrids.substr(i, end - i);
                 
             i = end;
-            if (end != std::string::npos)
+            if (end != boost::string_view::npos)
                 ++i;
 
             if (! name.empty())
-                out.push_back(name);
+                out.push_back(std::string(name.begin(), name.end()));
         }
     }
 
@@ -251,23 +252,37 @@ inline bool pj_datum_find_nadgrids(srs::spar::parameters<BOOST_GEOMETRY_PROJECTI
 /*                        pj_datum_find_towgs84()                       */
 /************************************************************************/
 
+inline bool is_towgs84_separator(char c)
+{
+    return c == ' ' || c == ',';
+}
+
 template <typename T>
 inline bool pj_datum_find_towgs84(srs::detail::proj4_parameters const& params,
                                   srs::detail::towgs84<T> & out)
 {
-    std::string towgs84 = pj_get_param_s(params, "towgs84");
+    boost::string_view towgs84 = pj_get_param_s(params, "towgs84", srs::dpar::towgs84);
     if(! towgs84.empty())
     {
-        std::vector<std::string> parm;
-        boost::split(parm, towgs84, boost::is_any_of(" ,"));
-
-        std::size_t n = (std::min<std::size_t>)(parm.size(), 7);
+        // The value is split at ' ' and ',' without copying, each of the
+        // values is terminated by a separator or null character for strtod
+        std::size_t const count = std::count_if(towgs84.begin(), towgs84.end(),
+                                                is_towgs84_separator) + 1;
+        std::size_t n = (std::min<std::size_t>)(count, 7);
         std::size_t z = n <= 3 ? 3 : 7;
 
         /* parse out the pvalues */
+        const char* first = towgs84.data();
         for (std::size_t i = 0 ; i < n; ++i)
         {
-            out.push_back(geometry::str_cast<T>(parm[i]));
+            // Empty values are not accepted
+            if (is_towgs84_separator(*first) || *first == '\0')
+            {
+                BOOST_THROW_EXCEPTION( bad_str_cast() );
+            }
+            out.push_back(geometry::str_cast<T>(first));
+            first = std::find_if(first, towgs84.data() + towgs84.size(),
+                                 is_towgs84_separator) + 1;
         }
         for (std::size_t i = out.size() ; i < z; ++i)
         {
@@ -86,7 +86,7 @@ template <typename T>
 inline bool pj_ell_init_ellps(srs::detail::proj4_parameters const& params, T &a, T &b)
 {
     /* check if ellps present and temporarily append its values to pl */
-    std::string name = pj_get_param_s(params, "ellps");
+    boost::string_view name = pj_get_param_s(params, "ellps", srs::dpar::ellps);
     if (! name.empty())
     {
         const pj_ellps_type<T>* pj_ellps = pj_get_ellps<T>().first;
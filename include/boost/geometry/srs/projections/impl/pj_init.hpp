@@ -79,7 +79,8 @@ template <typename T>
 inline void pj_init_proj(srs::detail::proj4_parameters const& params,
                          parameters<T> & par)
 {
-    par.id = pj_get_param_s(params, "proj");
+    boost::string_view const proj = pj_get_param_s(params, "proj", srs::dpar::proj);
+    par.id = std::string(proj.begin(), proj.end());
 }
 
 template <typename T>
@@ -122,8 +123,9 @@ inline void pj_init_units(srs::detail::proj4_parameters const& params,
                           T const& default_to_meter,
                           T const& default_fr_meter)
 {
-    std::string s;
-    std::string units = pj_get_param_s(params, Vertical ? "vunits" : "units");
+    boost::string_view s;
+    boost::string_view units = pj_get_param_s(params, Vertical ? "vunits" : "units",
+                                                   Vertical ? srs::dpar::vunits : srs::dpar::units);
     if (! units.empty())
     {
         static const int n = sizeof(pj_units) / sizeof(pj_units[0]);
@@ -144,21 +146,24 @@ inline void pj_init_units(srs::detail::proj4_parameters const& params,
 
     if (s.empty())
     {
-        s = pj_get_param_s(params, Vertical ? "vto_meter" : "to_meter");
+        s = pj_get_param_s(params, Vertical ? "vto_meter" : "to_meter",
+                           Vertical ? srs::dpar::vto_meter : srs::dpar::to_meter);
     }
 
     // TODO: numerator and denominator could be taken from pj_units
     if (! s.empty())
     {
+        // Both the values from pj_units and parameters are null-terminated
+        // and the numerator is terminated by '/' for strtod
         std::size_t const pos = s.find('/');
-        if (pos == std::string::npos)
+        if (pos == boost::string_view::npos)
         {
-            to_meter = geometry::str_cast<T>(s);
+            to_meter = geometry::str_cast<T>(s.data());
         }
         else
         {
-            T const numerator = geometry::str_cast<T>(s.substr(0, pos));
-            T const denominator = geometry::str_cast<T>(s.substr(pos + 1));
+            T const numerator = geometry::str_cast<T>(s.data());
+            T const denominator = geometry::str_cast<T>(s.data() + pos + 1);
             if (numerator == 0.0 || denominator == 0.0)
             {
                 BOOST_THROW_EXCEPTION( projection_exception(error_unit_factor_less_than_0) );
@@ -328,7 +333,7 @@ inline void pj_init_units(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAI
 template <typename T>
 inline void pj_init_pm(srs::detail::proj4_parameters const& params, T& val)
 {
-    std::string pm = pj_get_param_s(params, "pm");
+    boost::string_view pm = pj_get_param_s(params, "pm", srs::dpar::pm);
     if (! pm.empty())
     {
         int n = sizeof(pj_prime_meridians) / sizeof(pj_prime_meridians[0]);
@@ -345,7 +350,7 @@ inline void pj_init_pm(srs::detail::proj4_parameters const& params, T& val)
         // In other cases the bad_str_cast exception is simply thrown
         BOOST_TRY
         {
-            val = dms_parser<T, true>::apply(pm).angle();
+            val = dms_parser<T, true>::apply(pm.data()).angle();
             return;
         }
         BOOST_CATCH(geometry::bad_str_cast const&)
@@ -62,11 +62,6 @@ namespace boost { namespace geometry { namespace projections {
 
 namespace detail {
 
-inline bool pj_param_pred(srs::detail::proj4_parameter const& p, std::string const& name)
-{
-    return p.name == name;
-}
-
 template <typename T, typename Id>
 inline bool pj_param_pred(srs::dpar::parameter<T> const& p, Id const& id,
                           typename boost::disable_if_c<boost::is_convertible<Id, std::string>::value>::type * = 0)
@@ -97,6 +92,24 @@ inline typename Params::const_iterator
     return params.end();
 }
 
+template <typename Name>
+inline srs::detail::proj4_parameters::const_iterator
+    pj_param_find(srs::detail::proj4_parameters const& params, Name const& name)
+{
+    srs::detail::proj4_parameter_key const key(name);
+
+    typedef srs::detail::proj4_parameters::const_iterator iterator;
+    for (iterator it = params.begin(); it != params.end(); it++)
+    {
+        if (it->is_same(key))
+        {
+            return it;
+        }
+    }
+
+    return params.end();
+}
+
 /*
 template
 <
@@ -161,7 +174,7 @@ inline bool pj_param_exists(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DET
 template <typename T>
 inline void set_value(T & val, srs::detail::proj4_parameter const& p)
 {
-    val = geometry::str_cast<T>(p.value);
+    val = geometry::str_cast<T>(p.value.data());
 }
 
 template <typename T, typename T2>
@@ -173,7 +186,7 @@ inline void set_value(T & val, srs::dpar::parameter<T2> const& p)
 template <typename T>
 inline void set_value_r(T & val, srs::detail::proj4_parameter const& p)
 {
-    val = dms_parser<T, true>::apply(p.value.c_str()).angle();
+    val = dms_parser<T, true>::apply(p.value.data()).angle();
 }
 
 template <typename T>
@@ -186,6 +199,7 @@ template <typename Name>
 inline void check_name(Name const&)
 {
     static const bool is_ok = boost::is_convertible<Name, std::string>::value
+                           || boost::is_same<Name, srs::detail::proj4_parameter_key>::value
                            || boost::is_same<Name, srs::dpar::name_i>::value
                            || boost::is_same<Name, srs::dpar::name_f>::value
                            || boost::is_same<Name, srs::dpar::name_r>::value;
@@ -236,12 +250,13 @@ inline bool _pj_param_r(Params const& params, Name const& name, T & par)
 }
 
 /* bool input */
-inline bool _pj_get_param_b(srs::detail::proj4_parameters const& pl, std::string const& name)
+inline bool _pj_get_param_b(srs::detail::proj4_parameters const& pl,
+                            srs::detail::proj4_parameter_key const& key)
 {
-    srs::detail::proj4_parameters::const_iterator it = pj_param_find(pl, name);        
+    srs::detail::proj4_parameters::const_iterator it = pj_param_find(pl, key);
     if (it != pl.end())
     {
-        switch (it->value[0])
+        switch (it->value.empty() ? '\0' : it->value[0])
         {
         case '\0': case 'T': case 't':
             return true;
@@ -265,10 +280,12 @@ inline bool _pj_get_param_b(srs::dpar::parameters<T> const& pl, srs::dpar::name_
     return result;
 }
 
-/* string input */
-inline bool pj_param_s(srs::detail::proj4_parameters const& pl, std::string const& name, std::string & par)
+/* string input, the view refers to the null-terminated value stored in pl */
+inline bool pj_param_s(srs::detail::proj4_parameters const& pl,
+                       srs::detail::proj4_parameter_key const& key,
+                       boost::string_view & par)
 {
-    srs::detail::proj4_parameters::const_iterator it = pj_param_find(pl, name);        
+    srs::detail::proj4_parameters::const_iterator it = pj_param_find(pl, key);
     if (it != pl.end())
     {
         par = it->value;
@@ -416,54 +433,63 @@ inline T _pj_get_param_r(Params const& pl)
     return res;
 }
 
-inline std::string pj_get_param_s(srs::detail::proj4_parameters const& pl, std::string const& name)
+inline boost::string_view pj_get_param_s(srs::detail::proj4_parameters const& pl,
+                                         srs::detail::proj4_parameter_key const& key)
 {
-    std::string res;
-    pj_param_s(pl, name, res);
+    boost::string_view res;
+    pj_param_s(pl, key, res);
     return res;
 }
 
+template <typename Name>
+inline boost::string_view pj_get_param_s(srs::detail::proj4_parameters const& pl,
+                                         const char* sn,
+                                         Name const& n)
+{
+    return pj_get_param_s(pl, srs::detail::proj4_parameter_key(sn, n));
+}
+
 
 // ------------------------------------------------------------------------- //
 
 template <typename Param, typename Name>
 inline bool pj_param_exists(srs::detail::proj4_parameters const& pl,
-                            std::string const& sn,
-                            Name const& )
+                            const char* sn,
+                            Name const& n)
 {
-    return pj_param_exists(pl, sn);
+    return pj_param_exists(pl, srs::detail::proj4_parameter_key(sn, n));
 }
 template <template <typename> class Param, typename Name>
 inline bool pj_param_exists(srs::detail::proj4_parameters const& pl,
-                            std::string const& sn,
-                            Name const& )
+                            const char* sn,
+                            Name const& n)
 {
-    return pj_param_exists(pl, sn);
+    return pj_param_exists(pl, srs::detail::proj4_parameter_key(sn, n));
 }
 template <typename Param, typename T, typename Name>
 inline bool pj_param_exists(srs::dpar::parameters<T> const& pl,
-                            std::string const& ,
+                            const char* ,
                             Name const& n)
 {
     return pj_param_exists(pl, n);
 }
 template <template <typename> class Param, typename T, typename Name>
 inline bool pj_param_exists(srs::dpar::parameters<T> const& pl,
-                            std::string const& ,
+                            const char* ,
                             Name const& n)
 {
     return pj_param_exists(pl, n);
 }
 template <typename Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX, typename Name>
 inline bool pj_param_exists(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                            std::string const& ,
+                            const char* ,
                             Name const& )
 {
     return pj_param_exists<Param>(pl);
 }
 template <template <typename> class Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX, typename Name>
 inline bool pj_param_exists(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                            std::string const& ,
+                            const char* ,
                             Name const& )
 {
     return pj_param_exists<Param>(pl);
@@ -471,21 +497,21 @@ inline bool pj_param_exists(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DET
 
 template <typename Param>
 inline bool pj_get_param_b(srs::detail::proj4_parameters const& pl,
-                           std::string const& sn,
-                           srs::dpar::name_be const& )
+                           const char* sn,
+                           srs::dpar::name_be const& n)
 {
-    return _pj_get_param_b(pl, sn);
+    return _pj_get_param_b(pl, srs::detail::proj4_parameter_key(sn, n));
 }
 template <typename Param, typename T>
 inline bool pj_get_param_b(srs::dpar::parameters<T> const& pl,
-                           std::string const& ,
+                           const char* ,
                            srs::dpar::name_be const& n)
 {
     return _pj_get_param_b(pl, n);
 }
 template <typename Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX>
 inline bool pj_get_param_b(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                           std::string const& ,
+                           const char* ,
                            srs::dpar::name_be const& )
 {
     return _pj_get_param_b<Param>(pl);
@@ -495,15 +521,15 @@ inline bool pj_get_param_b(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETA
 
 template <template <int> class Param>
 inline bool pj_param_i(srs::detail::proj4_parameters const& pl,
-                       std::string const& sn,
-                       srs::dpar::name_i const& ,
+                       const char* sn,
+                       srs::dpar::name_i const& n,
                        int & par)
 {
-    return _pj_param_i(pl, sn, par);
+    return _pj_param_i(pl, srs::detail::proj4_parameter_key(sn, n), par);
 }
 template <template <int> class Param, typename T>
 inline bool pj_param_i(srs::dpar::parameters<T> const& pl,
-                       std::string const& ,
+                       const char* ,
                        srs::dpar::name_i const& n,
                        int & par)
 {
@@ -511,7 +537,7 @@ inline bool pj_param_i(srs::dpar::parameters<T> const& pl,
 }
 template <template <int> class Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX>
 inline bool pj_param_i(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                       std::string const& ,
+                       const char* ,
                        srs::dpar::name_i const& ,
                        int & par)
 {
@@ -522,21 +548,21 @@ inline bool pj_param_i(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_P
 
 template <template <int> class Param>
 inline int pj_get_param_i(srs::detail::proj4_parameters const& pl,
-                          std::string const& sn,
-                          srs::dpar::name_i const& )
+                          const char* sn,
+                          srs::dpar::name_i const& n)
 {
-    return _pj_get_param_i(pl, sn);
+    return _pj_get_param_i(pl, srs::detail::proj4_parameter_key(sn, n));
 }
 template <template <int> class Param, typename T>
 inline int pj_get_param_i(srs::dpar::parameters<T> const& pl,
-                          std::string const& ,
+                          const char* ,
                           srs::dpar::name_i const& n)
 {
     return _pj_get_param_i(pl, n);
 }
 template <template <int> class Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX>
 inline bool pj_get_param_i(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                           std::string const& ,
+                           const char* ,
                            srs::dpar::name_i const& )
 {
     return _pj_get_param_i<Param>(pl);
@@ -546,15 +572,15 @@ inline bool pj_get_param_i(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETA
 
 template <template <typename> class Param, typename T>
 inline bool pj_param_f(srs::detail::proj4_parameters const& pl,
-                       std::string const& sn,
-                       srs::dpar::name_f const& ,
+                       const char* sn,
+                       srs::dpar::name_f const& n,
                        T & par)
 {
-    return _pj_param_f(pl, sn, par);
+    return _pj_param_f(pl, srs::detail::proj4_parameter_key(sn, n), par);
 }
 template <template <typename> class Param, typename T>
 inline bool pj_param_f(srs::dpar::parameters<T> const& pl,
-                       std::string const& ,
+                       const char* ,
                        srs::dpar::name_f const& n,
                        T & par)
 {
@@ -562,7 +588,7 @@ inline bool pj_param_f(srs::dpar::parameters<T> const& pl,
 }
 template <template <typename> class Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX, typename T>
 inline bool pj_param_f(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                       std::string const& ,
+                       const char* ,
                        srs::dpar::name_f const& ,
                        T & par)
 {
@@ -573,21 +599,21 @@ inline bool pj_param_f(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_P
 
 template <typename T, template <typename> class Param>
 inline T pj_get_param_f(srs::detail::proj4_parameters const& pl,
-                        std::string const& sn,
-                        srs::dpar::name_f const& )
+                        const char* sn,
+                        srs::dpar::name_f const& n)
 {
-    return _pj_get_param_f<T>(pl, sn);
+    return _pj_get_param_f<T>(pl, srs::detail::proj4_parameter_key(sn, n));
 }
 template <typename T, template <typename> class Param>
 inline T pj_get_param_f(srs::dpar::parameters<T> const& pl,
-                        std::string const& ,
+                        const char* ,
                         srs::dpar::name_f const& n)
 {
     return _pj_get_param_f<T>(pl, n);
 }
 template <typename T, template <typename> class Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX>
 inline T pj_get_param_f(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                        std::string const& ,
+                        const char* ,
                         srs::dpar::name_f const& )
 {
     return _pj_get_param_f<T, Param>(pl);
@@ -598,15 +624,15 @@ inline T pj_get_param_f(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_
 
 template <template <typename> class Param, typename T>
 inline bool pj_param_r(srs::detail::proj4_parameters const& pl,
-                       std::string const& sn,
-                       srs::dpar::name_r const& ,
+                       const char* sn,
+                       srs::dpar::name_r const& n,
                        T & par)
 {
-    return _pj_param_r(pl, sn, par);
+    return _pj_param_r(pl, srs::detail::proj4_parameter_key(sn, n), par);
 }
 template <template <typename> class Param, typename T>
 inline bool pj_param_r(srs::dpar::parameters<T> const& pl,
-                       std::string const& ,
+                       const char* ,
                        srs::dpar::name_r const& n,
                        T & par)
 {
@@ -614,7 +640,7 @@ inline bool pj_param_r(srs::dpar::parameters<T> const& pl,
 }
 template <template <typename> class Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX, typename T>
 inline bool pj_param_r(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                       std::string const& ,
+                       const char* ,
                        srs::dpar::name_r const& ,
                        T & par)
 {
@@ -625,21 +651,21 @@ inline bool pj_param_r(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_P
 
 template <typename T, template <typename> class Param>
 inline T pj_get_param_r(srs::detail::proj4_parameters const& pl,
-                        std::string const& sn,
-                        srs::dpar::name_r const& )
+                        const char* sn,
+                        srs::dpar::name_r const& n)
 {
-    return _pj_get_param_r<T>(pl, sn);
+    return _pj_get_param_r<T>(pl, srs::detail::proj4_parameter_key(sn, n));
 }
 template <typename T, template <typename> class Param>
 inline T pj_get_param_r(srs::dpar::parameters<T> const& pl,
-                        std::string const& ,
+                        const char* ,
                         srs::dpar::name_r const& n)
 {
     return _pj_get_param_r<T>(pl, n);
 }
 template <typename T, template <typename> class Param, BOOST_GEOMETRY_PROJECTIONS_DETAIL_TYPENAME_PX>
 inline T pj_get_param_r(srs::spar::parameters<BOOST_GEOMETRY_PROJECTIONS_DETAIL_PX> const& pl,
-                        std::string const& ,
+                        const char* ,
                         srs::dpar::name_r const& )
 {
     return _pj_get_param_r<T, Param>(pl);
@@ -235,11 +235,11 @@ namespace projections
 
             inline bool geos_flip_axis(srs::detail::proj4_parameters const& params)
             {
-                std::string sweep_axis = pj_get_param_s(params, "sweep");
+                boost::string_view sweep_axis = pj_get_param_s(params, "sweep", srs::dpar::sweep);
                 if (sweep_axis.empty())
                     return false;
                 else {
-                    if (sweep_axis[1] != '\0' || (sweep_axis[0] != 'x' && sweep_axis[0] != 'y'))
+                    if (sweep_axis.size() != 1 || (sweep_axis[0] != 'x' && sweep_axis[0] != 'y'))
                         BOOST_THROW_EXCEPTION( projection_exception(error_invalid_sweep_axis) );
 
                     if (sweep_axis[0] == 'x')
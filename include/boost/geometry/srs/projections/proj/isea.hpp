@@ -1147,11 +1147,11 @@ namespace projections
             inline void isea_orient_init(srs::detail::proj4_parameters const& params,
                                          par_isea<T>& proj_parm)
             {
-                std::string opt = pj_get_param_s(params, "orient");
+                boost::string_view opt = pj_get_param_s(params, "orient", srs::dpar::orient);
                 if (! opt.empty()) {
-                    if (opt == std::string("isea")) {
+                    if (opt == "isea") {
                         isea_orient_isea(&proj_parm.dgg);
-                    } else if (opt == std::string("pole")) {
+                    } else if (opt == "pole") {
                         isea_orient_pole(&proj_parm.dgg);
                     } else {
                         BOOST_THROW_EXCEPTION( projection_exception(error_ellipsoid_use_required) );
@@ -1181,15 +1181,15 @@ namespace projections
             inline void isea_mode_init(srs::detail::proj4_parameters const& params,
                                        par_isea<T>& proj_parm)
             {
-                std::string opt = pj_get_param_s(params, "mode");
+                boost::string_view opt = pj_get_param_s(params, "mode", srs::dpar::mode);
                 if (! opt.empty()) {
-                    if (opt == std::string("plane")) {
+                    if (opt == "plane") {
                         proj_parm.dgg.output = isea_addr_plane;
-                    } else if (opt == std::string("di")) {
+                    } else if (opt == "di") {
                         proj_parm.dgg.output = isea_addr_q2di;
-                    } else if (opt == std::string("dd")) {
+                    } else if (opt == "dd") {
                         proj_parm.dgg.output = isea_addr_q2dd;
-                    } else if (opt == std::string("hex")) {
+                    } else if (opt == "hex") {
                         proj_parm.dgg.output = isea_addr_hex;
                     } else {
                         BOOST_THROW_EXCEPTION( projection_exception(error_ellipsoid_use_required) );
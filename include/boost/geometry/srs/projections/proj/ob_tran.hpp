@@ -84,7 +84,8 @@ namespace projections
                 Parameters pj = par;
 
                 /* get name of projection to be translated */
-                pj.id = pj_get_param_s(params, "o_proj");
+                boost::string_view const o_proj = pj_get_param_s(params, "o_proj", srs::dpar::o_proj);
+                pj.id = std::string(o_proj.begin(), o_proj.end());
                 if (pj.id.is_unknown())
                     BOOST_THROW_EXCEPTION( projection_exception(error_no_rotation_proj) );
 
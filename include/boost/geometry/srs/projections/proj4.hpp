@@ -13,10 +13,16 @@
 #define BOOST_GEOMETRY_SRS_PROJECTIONS_PROJ4_HPP
 
 
+#include <algorithm>
+#include <cctype>
 #include <string>
 #include <vector>
 
-#include <boost/algorithm/string/trim.hpp>
+#include <boost/geometry/srs/projections/dpar.hpp>
+
+#include <boost/smart_ptr/make_shared.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+#include <boost/utility/string_view.hpp>
 
 
 namespace boost { namespace geometry
@@ -52,69 +58,277 @@ private:
 namespace detail
 {
 
+// Identifier of a proj4 parameter name not having a name in srs::dpar
+enum proj4_name_id
+{
+    proj4_name_unknown = -1,
+    proj4_name_upper_m = srs::dpar::vunits + 1 // M, dpar::m is used for m
+};
+
+// Name of the proj4 parameter with the identifier or NULL.
+// The identifiers of the names defined in srs::dpar are the same.
+inline const char* proj4_parameter_name(int id)
+{
+    static const char* const names[] = {
+        "a", "b", "e", "es", "f", "h", 0, "k", "k_0", "m",
+        "n", 0, 0, 0, "q", "R", "rf", "to_meter", "vto_meter", "W",
+        "x_0", "y_0", "alpha", "azi", "gamma", "lat_0", "lat_1", "lat_2", "lat_3", "lat_b",
+        "lat_ts", "lon_0", "lon_1", "lon_2", "lon_3", "lon_wrap", "lonc", "o_alpha", "o_lat_1", "o_lat_2",
+        "o_lat_c", "o_lat_p", "o_lon_1", "o_lon_2", "o_lon_c", "o_lon_p", "R_lat_a", "R_lat_g", "theta", "tilt",
+        "aperture", "lsat", "north_square", "path", "resolution", "south_square", "zone", "czech", "geoc", "guam",
+        "no_cut", "no_defs", "no_rot", "ns", "over", "R_A", "R_a", "R_g", "R_h", "R_V",
+        "rescale", "south", 0, 0, "datum", "ellps", 0, "mode", "nadgrids", "orient",
+        "pm", "o_proj", "proj", "sweep", "towgs84", "units", "vunits", "M"
+    };
+    static const int count = sizeof(names) / sizeof(names[0]);
+
+    return id >= 0 && id < count ? names[id] : 0;
+}
+
+// Identifier of the proj4 parameter name or proj4_name_unknown
+inline int proj4_parameter_id(boost::string_view name)
+{
+    struct entry
+    {
+        std::size_t size;
+        const char* name;
+        int id;
+    };
+
+    // Sorted by sizes and names so mostly sizes are compared
+    static const entry entries[] = {
+        {1, "M", proj4_name_upper_m}, {1, "R", srs::dpar::r}, {1, "W", srs::dpar::w},
+        {1, "a", srs::dpar::a}, {1, "b", srs::dpar::b}, {1, "e", srs::dpar::e},
+        {1, "f", srs::dpar::f}, {1, "h", srs::dpar::h}, {1, "k", srs::dpar::k},
+        {1, "m", srs::dpar::m}, {1, "n", srs::dpar::n}, {1, "q", srs::dpar::q},
+        {2, "es", srs::dpar::es}, {2, "ns", srs::dpar::ns}, {2, "pm", srs::dpar::pm},
+        {2, "rf", srs::dpar::rf}, {3, "R_A", srs::dpar::r_au}, {3, "R_V", srs::dpar::r_v},
+        {3, "R_a", srs::dpar::r_a}, {3, "R_g", srs::dpar::r_g}, {3, "R_h", srs::dpar::r_h},
+        {3, "azi", srs::dpar::azi}, {3, "k_0", srs::dpar::k_0}, {3, "x_0", srs::dpar::x_0},
+        {3, "y_0", srs::dpar::y_0}, {4, "geoc", srs::dpar::geoc}, {4, "guam", srs::dpar::guam},
+        {4, "lonc", srs::dpar::lonc}, {4, "lsat", srs::dpar::lsat}, {4, "mode", srs::dpar::mode},
+        {4, "over", srs::dpar::over}, {4, "path", srs::dpar::path}, {4, "proj", srs::dpar::proj},
+        {4, "tilt", srs::dpar::tilt}, {4, "zone", srs::dpar::zone}, {5, "alpha", srs::dpar::alpha},
+        {5, "czech", srs::dpar::czech}, {5, "datum", srs::dpar::datum}, {5, "ellps", srs::dpar::ellps},
+        {5, "gamma", srs::dpar::gamma}, {5, "lat_0", srs::dpar::lat_0}, {5, "lat_1", srs::dpar::lat_1},
+        {5, "lat_2", srs::dpar::lat_2}, {5, "lat_3", srs::dpar::lat_3}, {5, "lat_b", srs::dpar::lat_b},
+        {5, "lon_0", srs::dpar::lon_0}, {5, "lon_1", srs::dpar::lon_1}, {5, "lon_2", srs::dpar::lon_2},
+        {5, "lon_3", srs::dpar::lon_3}, {5, "south", srs::dpar::south}, {5, "sweep", srs::dpar::sweep},
+        {5, "theta", srs::dpar::theta}, {5, "units", srs::dpar::units}, {6, "lat_ts", srs::dpar::lat_ts},
+        {6, "no_cut", srs::dpar::no_cut}, {6, "no_rot", srs::dpar::no_rot}, {6, "o_proj", srs::dpar::o_proj},
+        {6, "orient", srs::dpar::orient}, {6, "vunits", srs::dpar::vunits}, {7, "R_lat_a", srs::dpar::r_lat_a},
+        {7, "R_lat_g", srs::dpar::r_lat_g}, {7, "no_defs", srs::dpar::no_defs}, {7, "o_alpha", srs::dpar::o_alpha},
+        {7, "o_lat_1", srs::dpar::o_lat_1}, {7, "o_lat_2", srs::dpar::o_lat_2}, {7, "o_lat_c", srs::dpar::o_lat_c},
+        {7, "o_lat_p", srs::dpar::o_lat_p}, {7, "o_lon_1", srs::dpar::o_lon_1}, {7, "o_lon_2", srs::dpar::o_lon_2},
+        {7, "o_lon_c", srs::dpar::o_lon_c}, {7, "o_lon_p", srs::dpar::o_lon_p}, {7, "rescale", srs::dpar::rescale},
+        {7, "towgs84", srs::dpar::towgs84}, {8, "aperture", srs::dpar::aperture}, {8, "lon_wrap", srs::dpar::lon_wrap},
+        {8, "nadgrids", srs::dpar::nadgrids}, {8, "to_meter", srs::dpar::to_meter}, {9, "vto_meter", srs::dpar::vto_meter},
+        {10, "resolution", srs::dpar::resolution}, {12, "north_square", srs::dpar::north_square}, {12, "south_square", srs::dpar::south_square}
+    };
+
+    std::size_t first = 0;
+    std::size_t count = sizeof(entries) / sizeof(entries[0]);
+    while (count > 0)
+    {
+        std::size_t const step = count / 2;
+        entry const& e = entries[first + step];
+        int const cmp = name.size() != e.size
+                      ? (name.size() < e.size ? -1 : 1)
+                      : name.compare(boost::string_view(e.name, e.size));
+        if (cmp == 0)
+        {
+            return e.id;
+        }
+        else if (cmp > 0)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+
+    return proj4_name_unknown;
+}
+
+// Name of the searched proj4 parameter together with its identifier,
+// parameters with known names are compared by identifiers.
+struct proj4_parameter_key
+{
+    proj4_parameter_key(const char* n)
+        : name(n), id(proj4_parameter_id(name))
+    {}
+
+    proj4_parameter_key(std::string const& n)
+        : name(n), id(proj4_parameter_id(name))
+    {}
+
+    proj4_parameter_key(boost::string_view n)
+        : name(n), id(proj4_parameter_id(n))
+    {}
+
+    // The identifier is used if the name is the same as in srs::dpar
+    proj4_parameter_key(boost::string_view n, int dpar_id)
+        : name(n)
+        , id(is_name_of(n, dpar_id) ? dpar_id : proj4_parameter_id(n))
+    {}
+
+    boost::string_view name;
+    int id;
+
+private:
+    static bool is_name_of(boost::string_view n, int i)
+    {
+        const char* name_i = proj4_parameter_name(i);
+        return name_i != 0 && n == name_i;
+    }
+};
+
+// Name and value are views of the buffer owned by proj4_parameters,
+// both of them are followed by the null character.
 struct proj4_parameter
 {
-    proj4_parameter() {}
-    proj4_parameter(std::string const& n, std::string const& v) : name(n), value(v) {}
-    std::string name;
-    std::string value;
+    proj4_parameter()
+        : id(proj4_name_unknown)
+    {}
+
+    proj4_parameter(boost::string_view n, boost::string_view v)
+        : name(n), value(v), id(proj4_parameter_id(n))
+    {}
+
+    bool is_same(proj4_parameter_key const& key) const
+    {
+        return key.id != proj4_name_unknown
+             ? id == key.id
+             : name == key.name;
+    }
+
+    boost::string_view name;
+    boost::string_view value;
+    int id;
 };
 
 struct proj4_parameters
     : std::vector<proj4_parameter>
 {
     // Initially implemented as part of pj_init_plus() and pj_init()
+    // Split into arguments at " +", trim white space and leading '+' of
+    // arguments and split them into names and values at the first '='.
+    // The string is parsed in one pass, copied once and the parameters
+    // are referring to the copy.
     proj4_parameters(std::string const& proj4_str)
+        : m_buffer(boost::make_shared<std::string>(proj4_str))
     {
-        const char* sep = " +";
+        typedef std::string::size_type size_type;
 
-        /* split into arguments based on '+' and trim white space */
+        const char* const str = proj4_str.c_str();
 
-        // boost::split splits on one character, here it should be on " +", so implementation below
-        // todo: put in different routine or sort out
-        std::string def = boost::trim_copy(proj4_str);
-        boost::trim_left_if(def, boost::is_any_of(sep));
+        size_type first = 0;
+        size_type last = proj4_str.size();
+        trim(str, first, last);
+        skip_separators(str, first, last);
 
-        std::string::size_type loc = def.find(sep);
-        while (loc != std::string::npos)
+        this->reserve(std::count(str + first, str + last, '+') + 1);
+
+        for (size_type loc = find_separator(str, first, last) ;
+             loc != std::string::npos ;
+             loc = find_separator(str, first, last))
         {
-            std::string par = def.substr(0, loc);
-            boost::trim(par);
-            if (! par.empty())
+            size_type par_first = first;
+            size_type par_last = loc;
+            trim(str, par_first, par_last);
+            if (par_first != par_last)
             {
-                this->add(par);
+                this->add(par_first, par_last);
             }
 
-            def.erase(0, loc);
-            boost::trim_left_if(def, boost::is_any_of(sep));
-            loc = def.find(sep);
+            first = loc;
+            skip_separators(str, first, last);
+        }
+
+        if (first != last)
+        {
+            this->add(first, last);
         }
+    }
+
+private:
+    static bool is_space(char c)
+    {
+        return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
 
-        if (! def.empty())
+    static void trim(const char* str, std::size_t & first, std::size_t & last)
+    {
+        while (first < last && is_space(str[first]))
+        {
+            ++first;
+        }
+        while (first < last && is_space(str[last - 1]))
         {
-            this->add(def);
+            --last;
         }
     }
 
-    void add(std::string const& str)
+    static void skip_separators(const char* str, std::size_t & first, std::size_t last)
     {
-        std::string name = str;
-        std::string value;
-        boost::trim_left_if(name, boost::is_any_of("+"));
-        std::string::size_type loc = name.find("=");
-        if (loc != std::string::npos)
+        while (first < last && (str[first] == ' ' || str[first] == '+'))
         {
-            value = name.substr(loc + 1);
-            name.erase(loc);
+            ++first;
         }
+    }
 
-        this->add(name, value);
+    static std::size_t find_separator(const char* str, std::size_t first, std::size_t last)
+    {
+        for (std::size_t i = first ; i + 1 < last ; ++i)
+        {
+            if (str[i] == ' ' && str[i + 1] == '+')
+            {
+                return i;
+            }
+        }
+        return std::string::npos;
     }
 
-    void add(std::string const& name, std::string const& value)
+    // Adds the parameter from the range of the buffer and terminates
+    // its name and value in the buffer
+    void add(std::size_t first, std::size_t last)
     {
-        this->push_back(proj4_parameter(name, value));
+        std::string & buf = *m_buffer;
+
+        while (first < last && buf[first] == '+')
+        {
+            ++first;
+        }
+
+        std::size_t name_last = last;
+        std::size_t value_first = last;
+        const char* const data = buf.c_str();
+        const char* const eq = std::find(data + first, data + last, '=');
+        if (eq != data + last)
+        {
+            name_last = eq - data;
+            value_first = name_last + 1;
+        }
+
+        // The parsed string is not modified, only the copy
+        if (name_last < buf.size())
+        {
+            buf[name_last] = '\0';
+        }
+        if (last < buf.size())
+        {
+            buf[last] = '\0';
+        }
+
+        this->push_back(proj4_parameter(
+            boost::string_view(data + first, name_last - first),
+            boost::string_view(data + value_first, last - value_first)));
     }
+
+    boost::shared_ptr<std::string> m_buffer;
 };
 
 }
@@ -146,6 +146,11 @@ struct str_cast_traits
     {
         return detail::str_cast_traits_generic<T>::apply(str.c_str());
     }
+
+    static inline T apply(const char* str)
+    {
+        return detail::str_cast_traits_generic<T>::apply(str);
+    }
 };
 
 template <typename T, typename String>
@@ -11,7 +11,16 @@
 #define BOOST_GEOMETRY_SRS_TRANSFORMATION_HPP
 
 
+#include <atomic>
+#include <cstddef>
+#include <deque>
 #include <string>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/size.hpp>
 
 #include <boost/geometry/algorithms/convert.hpp>
 
@@ -27,6 +36,8 @@
 #include <boost/geometry/srs/projections/grids.hpp>
 #include <boost/geometry/srs/projections/impl/pj_transform.hpp>
 
+#include <boost/geometry/util/executor.hpp>
+
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
 #include <boost/mpl/assert.hpp>
@@ -554,6 +565,148 @@ struct transform<MultiPolygon, CT, multi_polygon_tag>
 {};
 
 
+// Parallel transformation. The output ranges are prepared sequentially,
+// then chunks of points are transformed by the executor. pj_transform()
+// handles every point separately so the results are the same as if the
+// whole ranges were transformed at once.
+template <typename Range, typename CT>
+struct transform_ranges
+{
+    typedef transform_geometry_wrapper<Range, CT> wrapper_type;
+    typedef typename wrapper_type::type range_type;
+
+    static const std::size_t chunk_size = 4096;
+
+    explicit transform_ranges(bool input_angles)
+        : m_input_angles(input_angles)
+    {}
+
+    template <typename RangeIn>
+    inline void operator()(RangeIn const& in, Range & out)
+    {
+        m_wrappers.emplace_back(in, out, m_input_angles);
+    }
+
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename Grids,
+        typename Executor
+    >
+    inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                      Proj2 const& proj2, Par2 const& par2,
+                      Grids const& grids1, Grids const& grids2,
+                      Executor const& executor)
+    {
+        typedef typename boost::range_iterator<range_type>::type iterator;
+
+        std::vector<std::size_t> sizes;
+        sizes.reserve(m_wrappers.size());
+        for (std::size_t i = 0 ; i < m_wrappers.size() ; ++i)
+        {
+            sizes.push_back(boost::size(m_wrappers[i].get()));
+        }
+
+        std::atomic<bool> result(true);
+
+        geometry::detail::for_each_chunk_of_ranges(executor, sizes, chunk_size,
+            [&](std::size_t r, std::size_t first, std::size_t last)
+            {
+                iterator const it = boost::begin(m_wrappers[r].get());
+                boost::iterator_range<iterator> chunk(it + first, it + last);
+
+                try
+                {
+                    if (! pj_transform(proj1, par1, proj2, par2, chunk, grids1, grids2))
+                    {
+                        result = false;
+                    }
+                }
+                catch (projection_exception const&)
+                {
+                    result = false;
+                }
+            });
+
+        executor(m_wrappers.size(), [&](std::size_t i)
+        {
+            m_wrappers[i].finish();
+        });
+
+        return result;
+    }
+
+private:
+    // deque so the references to the wrapped ranges stay valid
+    std::deque<wrapper_type> m_wrappers;
+    bool m_input_angles;
+};
+
+template
+<
+    typename Geometry,
+    typename CT,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct transform_parallel
+{
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename GeometryIn, typename GeometryOut,
+        typename Grids,
+        typename Executor
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             GeometryIn const& in, GeometryOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             Executor const& executor)
+    {
+        // NOTE: this has to be consistent with pj_transform()
+        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+
+        transform_ranges
+            <
+                typename for_each_range_pair<GeometryOut>::range_type,
+                CT
+            > ranges(input_angles);
+        for_each_range_pair<GeometryOut>::apply(in, out, ranges);
+        return ranges.apply(proj1, par1, proj2, par2, grids1, grids2, executor);
+    }
+};
+
+template <typename Point, typename CT>
+struct transform_parallel<Point, CT, point_tag>
+{
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename GeometryIn, typename GeometryOut,
+        typename Grids,
+        typename Executor
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             GeometryIn const& in, GeometryOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             Executor const& )
+    {
+        return transform<Point, CT>::apply(proj1, par1, proj2, par2,
+                                           in, out, grids1, grids2);
+    }
+};
+
+template <typename Segment, typename CT>
+struct transform_parallel<Segment, CT, segment_tag>
+    : transform_parallel<Segment, CT, point_tag>
+{};
+
+
+
 }} // namespace projections::detail
     
 namespace srs
@@ -697,6 +850,81 @@ public:
                          grids.src_grids);
     }
 
+    /// Parallel forward transformation, chunks of points are transformed
+    /// by executor. The result and the invalid points are the same as in
+    /// the sequential version.
+    template <typename GeometryIn, typename GeometryOut, typename Executor>
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 Executor const& executor) const
+    {
+        return forward(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       executor);
+    }
+
+    /// Parallel inverse transformation, chunks of points are transformed
+    /// by executor
+    template <typename GeometryIn, typename GeometryOut, typename Executor>
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 Executor const& executor) const
+    {
+        return inverse(in, out, transformation_grids<detail::empty_grids_storage>(),
+                       executor);
+    }
+
+    /// Parallel forward transformation, the grids are read concurrently
+    /// so GridsStorage has to support it, e.g. shared_grids
+    template
+    <
+        typename GeometryIn, typename GeometryOut,
+        typename GridsStorage, typename Executor
+    >
+    bool forward(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 Executor const& executor) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (GeometryIn, GeometryOut));
+
+        return projections::detail::transform_parallel
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(m_proj1.proj(), m_proj1.proj().params(),
+                         m_proj2.proj(), m_proj2.proj().params(),
+                         in, out,
+                         grids.src_grids,
+                         grids.dst_grids,
+                         executor);
+    }
+
+    /// Parallel inverse transformation, the grids are read concurrently
+    /// so GridsStorage has to support it, e.g. shared_grids
+    template
+    <
+        typename GeometryIn, typename GeometryOut,
+        typename GridsStorage, typename Executor
+    >
+    bool inverse(GeometryIn const& in, GeometryOut & out,
+                 transformation_grids<GridsStorage> const& grids,
+                 Executor const& executor) const
+    {
+        BOOST_MPL_ASSERT_MSG((projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+                             NOT_SUPPORTED_COMBINATION_OF_GEOMETRIES,
+                             (GeometryIn, GeometryOut));
+
+        return projections::detail::transform_parallel
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(m_proj2.proj(), m_proj2.proj().params(),
+                         m_proj1.proj(), m_proj1.proj().params(),
+                         in, out,
+                         grids.dst_grids,
+                         grids.src_grids,
+                         executor);
+    }
+
     template <typename GridsStorage>
     inline transformation_grids<GridsStorage> initialize_grids(GridsStorage & grids_storage) const
     {
@@ -25,15 +25,23 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/empty.hpp>
 #include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <boost/range/size.hpp>
 
 #include <boost/geometry/algorithms/detail/for_each_range.hpp>
+#include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/policies/compare.hpp>
 #include <boost/geometry/strategies/convex_hull.hpp>
 #include <boost/geometry/strategies/side.hpp>
+#include <boost/geometry/util/executor.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
 #include <boost/geometry/views/detail/range_type.hpp>
 
 
@@ -48,13 +56,154 @@ namespace detail
 {
 
 
-template <typename Geometry, typename Point, typename Less>
-inline void get_extremes(Geometry const& geometry,
+// Number of points of which the hull is calculated by one task of the
+// parallel version, the vertices of these hulls are merged afterwards
+static const std::size_t graham_andrew_chunk_size = 1 << 16;
+
+
+// Akl-Toussaint heuristic. The extreme points in the directions of the axes
+// and of the diagonals are vertices of an octagon inside the hull. Points
+// strictly inside the axis-aligned rectangle inscribed in the octagon can
+// not be vertices of the hull, they are discarded before they are copied
+// and sorted. This is only done for cartesian coordinate systems.
+template <typename Point, typename CsTag>
+struct interior_filter
+{
+    inline void apply(Point const& ) {}
+
+    template <typename SideStrategy>
+    inline void finish(SideStrategy const& ) {}
+
+    inline bool discards(Point const& ) const
+    {
+        return false;
+    }
+};
+
+template <typename Point>
+class interior_filter<Point, cartesian_tag>
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+    typedef typename select_most_precise
+        <
+            coordinate_type, double
+        >::type calculation_type;
+
+    // The extremes in the directions W, SW, S, SE, E, NE, N, NW,
+    // the vertices of the octagon in counterclockwise order
+    static const std::size_t count = 8;
+
+public:
+    inline interior_filter()
+        : m_empty(true)
+        , m_enabled(false)
+    {}
+
+    inline void apply(Point const& point)
+    {
+        calculation_type const x = geometry::get<0>(point);
+        calculation_type const y = geometry::get<1>(point);
+        calculation_type const values[count]
+            = { -x, -x - y, -y, x - y, x, x + y, y, y - x };
+
+        // Branches are rarely taken, the loop is unrolled by the compiler
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            if (m_empty || values[i] > m_values[i])
+            {
+                m_values[i] = values[i];
+                m_vertices[i] = point;
+            }
+        }
+        m_empty = false;
+    }
+
+    template <typename SideStrategy>
+    inline void finish(SideStrategy const& side)
+    {
+        if (m_empty)
+        {
+            return;
+        }
+
+        m_min_x = (std::max)(x(0), (std::max)(x(1), x(7)));
+        m_max_x = (std::min)(x(3), (std::min)(x(4), x(5)));
+        m_min_y = (std::max)(y(1), (std::max)(y(2), y(3)));
+        m_max_y = (std::min)(y(5), (std::min)(y(6), y(7)));
+
+        if (! (m_min_x < m_max_x && m_min_y < m_max_y))
+        {
+            return;
+        }
+
+        // The rectangle is inside the octagon, but the diagonal extremes
+        // are found with rounded sums, so its corners are verified
+        Point corners[4];
+        set_corner(corners[0], m_min_x, m_min_y);
+        set_corner(corners[1], m_max_x, m_min_y);
+        set_corner(corners[2], m_max_x, m_max_y);
+        set_corner(corners[3], m_min_x, m_max_y);
+        for (std::size_t c = 0 ; c < 4 ; ++c)
+        {
+            for (std::size_t i = 0 ; i < count ; ++i)
+            {
+                if (side.apply(m_vertices[i], m_vertices[(i + 1) % count],
+                               corners[c]) < 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        m_enabled = true;
+    }
+
+    inline bool discards(Point const& point) const
+    {
+        coordinate_type const x = geometry::get<0>(point);
+        coordinate_type const y = geometry::get<1>(point);
+        return m_enabled
+            && m_min_x < x && x < m_max_x
+            && m_min_y < y && y < m_max_y;
+    }
+
+private:
+    inline coordinate_type x(std::size_t i) const
+    {
+        return geometry::get<0>(m_vertices[i]);
+    }
+
+    inline coordinate_type y(std::size_t i) const
+    {
+        return geometry::get<1>(m_vertices[i]);
+    }
+
+    static inline void set_corner(Point& corner,
+                                  coordinate_type const& x,
+                                  coordinate_type const& y)
+    {
+        geometry::set<0>(corner, x);
+        geometry::set<1>(corner, y);
+    }
+
+    calculation_type m_values[count];
+    Point m_vertices[count];
+    coordinate_type m_min_x, m_max_x, m_min_y, m_max_y;
+    bool m_empty;
+    bool m_enabled;
+};
+
+
+// ForEachRange calls a function for each range of points of the input,
+// e.g. for each range of a geometry or for a chunk of a range
+template <typename ForEachRange, typename Point, typename Less, typename Filter>
+inline void get_extremes(ForEachRange const& for_each_range,
                          Point& left, Point& right,
-                         Less const& less)
+                         Less const& less,
+                         Filter& filter)
 {
     bool first = true;
-    geometry::detail::for_each_range(geometry, [&](auto const& range)
+    for_each_range([&](auto const& range)
     {
         if (boost::empty(range))
         {
@@ -69,9 +218,12 @@ inline void get_extremes(Geometry const& geometry,
 
         auto left_it = boost::begin(range);
         auto right_it = boost::begin(range);
+        filter.apply(*left_it);
 
         for (auto it = ++boost::begin(range); it != boost::end(range); ++it)
         {
+            filter.apply(*it);
+
             if (less(*it, *left_it))
             {
                 left_it = it;
@@ -111,21 +263,28 @@ inline void get_extremes(Geometry const& geometry,
 
 template
 <
-    typename Geometry,
+    typename ForEachRange,
     typename Point,
     typename Container,
-    typename SideStrategy
+    typename SideStrategy,
+    typename Filter
 >
-inline void assign_ranges(Geometry const& geometry,
+inline void assign_ranges(ForEachRange const& for_each_range,
                           Point const& most_left, Point const& most_right,
                           Container& lower_points, Container& upper_points,
-                          SideStrategy const& side)
+                          SideStrategy const& side,
+                          Filter const& filter)
 {
-    geometry::detail::for_each_range(geometry, [&](auto const& range)
+    for_each_range([&](auto const& range)
     {
         // Put points in one of the two output sequences
         for (auto it = boost::begin(range); it != boost::end(range); ++it)
         {
+            if (filter.discards(*it))
+            {
+                continue;
+            }
+
             // check if it is lying most_left or most_right from the line
 
             int dir = side.apply(most_left, most_right, *it);
@@ -192,6 +351,127 @@ public:
 
 
     inline void apply(InputGeometry const& geometry, partitions& state) const
+    {
+        typedef typename geometry::point_type<InputGeometry>::type point_type;
+
+        apply_ranges<point_type>([&](auto const& function)
+        {
+            geometry::detail::for_each_range(geometry, function);
+        }, state);
+    }
+
+
+    /*!
+    \brief Calculates the hull using an executor
+    \details The points of a linestring, ring or multi-point are divided
+        into chunks, the hulls of the chunks are calculated by the executor
+        and the hull of their vertices is the hull of the geometry. Its
+        points have to be stored in a random access range. The hull of
+        other geometries is calculated sequentially.
+    */
+    template <typename Executor>
+    inline void apply(InputGeometry const& geometry, partitions& state,
+                      Executor const& executor) const
+    {
+        apply(geometry, state, executor,
+              typename geometry::tag<InputGeometry>::type());
+    }
+
+
+    template <typename OutputIterator>
+    inline void result(partitions const& state,
+                       OutputIterator out,
+                       bool clockwise,
+                       bool closed) const
+    {
+        if (clockwise)
+        {
+            output_ranges(state.m_upper_hull, state.m_lower_hull, out, closed);
+        }
+        else
+        {
+            output_ranges(state.m_lower_hull, state.m_upper_hull, out, closed);
+        }
+    }
+
+
+private:
+
+    template <typename Executor, typename Tag>
+    inline void apply(InputGeometry const& geometry, partitions& state,
+                      Executor const& , Tag) const
+    {
+        apply(geometry, state);
+    }
+
+    template <typename Executor>
+    inline void apply(InputGeometry const& geometry, partitions& state,
+                      Executor const& executor, linestring_tag) const
+    {
+        apply_chunks(geometry, state, executor);
+    }
+
+    template <typename Executor>
+    inline void apply(InputGeometry const& geometry, partitions& state,
+                      Executor const& executor, ring_tag) const
+    {
+        apply_chunks(geometry, state, executor);
+    }
+
+    template <typename Executor>
+    inline void apply(InputGeometry const& geometry, partitions& state,
+                      Executor const& executor, multi_point_tag) const
+    {
+        apply_chunks(geometry, state, executor);
+    }
+
+
+    template <typename Executor>
+    inline void apply_chunks(InputGeometry const& range, partitions& state,
+                             Executor const& executor) const
+    {
+        typedef typename geometry::point_type<InputGeometry>::type input_point_type;
+        typedef typename boost::range_iterator
+            <
+                InputGeometry const
+            >::type range_iterator;
+
+        std::size_t const chunk_size = detail::graham_andrew_chunk_size;
+        std::size_t const size = boost::size(range);
+        if (size <= chunk_size)
+        {
+            apply(range, state);
+            return;
+        }
+
+        std::vector<partitions> chunks((size + chunk_size - 1) / chunk_size);
+        geometry::detail::for_each_chunk(executor, size, chunk_size,
+            [&](std::size_t first, std::size_t last)
+            {
+                range_iterator const begin = boost::begin(range);
+                auto const chunk = boost::make_iterator_range(begin + first,
+                                                              begin + last);
+                apply_ranges<input_point_type>([&](auto const& function)
+                {
+                    function(chunk);
+                }, chunks[first / chunk_size]);
+            });
+
+        // Each vertex of the hull is a vertex of the hull of its chunk
+        apply_ranges<point_type>([&](auto const& function)
+        {
+            for (std::size_t i = 0 ; i < chunks.size() ; ++i)
+            {
+                function(chunks[i].m_lower_hull);
+                function(chunks[i].m_upper_hull);
+            }
+        }, state);
+    }
+
+
+    template <typename Point, typename ForEachRange>
+    inline void apply_ranges(ForEachRange const& for_each_range,
+                             partitions& state) const
     {
         // First pass.
         // Get min/max (in most cases left / right) points
@@ -205,26 +485,31 @@ public:
         // For symmetry and to get often more balanced lower/upper halves
         // we keep it.
 
-        typedef typename geometry::point_type<InputGeometry>::type point_type;
-
-        point_type most_left, most_right;
+        Point most_left, most_right;
 
         // TODO: User-defined CS-specific less-compare
-        geometry::less<point_type> less;
+        geometry::less<Point> less;
 
-        detail::get_extremes(geometry, most_left, most_right, less);
+        // The extremes of the interior filter are collected in the same pass
+        detail::interior_filter<Point, cs_tag> filter;
+
+        detail::get_extremes(for_each_range, most_left, most_right, less,
+                             filter);
 
         container_type lower_points, upper_points;
 
         // TODO: User-defiend CS-specific side strategy
         typename strategy::side::services::default_strategy<cs_tag>::type side;
 
+        filter.finish(side);
+
         // Bounding left/right points
         // Second pass, now that extremes are found, assign all points
-        // in either lower, either upper
-        detail::assign_ranges(geometry, most_left, most_right,
+        // in either lower, either upper, except the ones discarded by
+        // the filter
+        detail::assign_ranges(for_each_range, most_left, most_right,
                               lower_points, upper_points,
-                              side);
+                              side, filter);
 
         // Sort both collections, first on x(, then on y)
         detail::sort(lower_points, less);
@@ -240,25 +525,6 @@ public:
     }
 
 
-    template <typename OutputIterator>
-    inline void result(partitions const& state,
-                       OutputIterator out,
-                       bool clockwise,
-                       bool closed) const
-    {
-        if (clockwise)
-        {
-            output_ranges(state.m_upper_hull, state.m_lower_hull, out, closed);
-        }
-        else
-        {
-            output_ranges(state.m_lower_hull, state.m_upper_hull, out, closed);
-        }
-    }
-
-
-private:
-
     template <int Factor, typename SideStrategy>
     static inline void build_half_hull(container_type const& input,
             container_type& output,
@@ -23,6 +23,8 @@
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
 #include <iostream>
 #endif
+#include <functional>
+#include <utility>
 #include <vector>
 
 #include <boost/range.hpp>
@@ -43,33 +45,25 @@ namespace strategy { namespace simplify
 {
 
 
-#ifndef DOXYGEN_NO_DETAIL
-namespace detail
+/*!
+\brief Memory used by the Douglas-Peucker strategy
+\details Contains a flag for each point and the stack of the parts of the
+    range which are not yet simplified. If the same buffer is passed to
+    many calls the memory is allocated only once.
+\ingroup strategies
+*/
+struct douglas_peucker_buffer
 {
+    //! Non-zero for the points which are kept
+    std::vector<unsigned char> included;
+    //! Indexes of the first and the last point of the parts to simplify
+    std::vector<std::pair<std::size_t, std::size_t> > parts;
+};
 
-    /*!
-        \brief Small wrapper around a point, with an extra member "included"
-        \details
-            It has a const-reference to the original point (so no copy here)
-        \tparam the enclosed point type
-    */
-    template<typename Point>
-    struct douglas_peucker_point
-    {
-        Point const& p;
-        bool included;
-
-        inline douglas_peucker_point(Point const& ap)
-            : p(ap)
-            , included(false)
-        {}
 
-        // Necessary for proper compilation
-        inline douglas_peucker_point<Point> operator=(douglas_peucker_point<Point> const& )
-        {
-            return douglas_peucker_point<Point>(*this);
-        }
-    };
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
 
     template
     <
@@ -110,83 +104,94 @@ namespace detail
         {}
 
     private :
-        typedef detail::douglas_peucker_point<Point> dp_point_type;
-        typedef typename std::vector<dp_point_type>::iterator iterator_type;
-
 
         LessCompare const& less() const
         {
             return *this;
         }
 
-        inline void consider(iterator_type begin,
-                             iterator_type end,
-                             distance_type const& max_dist,
-                             int& n,
-                             distance_strategy_type const& ps_distance_strategy) const
+        // Sets the flags of the points which are kept. The parts of the
+        // range are handled using an explicit stack, long ranges can not
+        // overflow the call stack. The range has to be random access.
+        template <typename Range>
+        inline void select(Range const& range,
+                           distance_type const& max_dist,
+                           douglas_peucker_buffer& buffer) const
         {
-            std::size_t size = end - begin;
+            typedef typename boost::range_iterator
+                <
+                    Range const
+                >::type iterator_type;
 
-            // size must be at least 3
-            // because we want to consider a candidate point in between
-            if (size <= 2)
+            std::size_t const size = boost::size(range);
+            buffer.included.assign(size, 0);
+            buffer.parts.clear();
+            if (size == 0)
             {
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                if (begin != end)
-                {
-                    std::cout << "ignore between " << dsv(begin->p)
-                        << " and " << dsv((end - 1)->p)
-                        << " size=" << size << std::endl;
-                }
-                std::cout << "return because size=" << size << std::endl;
-#endif
                 return;
             }
 
-            iterator_type last = end - 1;
-
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "find between " << dsv(begin->p)
-                << " and " << dsv(last->p)
-                << " size=" << size << std::endl;
-#endif
+            // Include first and last point of line,
+            // they are always part of the line
+            buffer.included.front() = 1;
+            buffer.included.back() = 1;
+            if (size > 2)
+            {
+                buffer.parts.push_back(std::make_pair(std::size_t(0), size - 1));
+            }
 
+            distance_strategy_type const ps_distance_strategy;
+            iterator_type const begin = boost::begin(range);
 
-            // Find most far point, compare to the current segment
-            //geometry::segment<Point const> s(begin->p, last->p);
-            distance_type md(-1.0); // any value < 0
-            iterator_type candidate;
-            for(iterator_type it = begin + 1; it != last; ++it)
+            while (! buffer.parts.empty())
             {
-                distance_type dist = ps_distance_strategy.apply(it->p, begin->p, last->p);
+                std::size_t const first = buffer.parts.back().first;
+                std::size_t const last = buffer.parts.back().second;
+                buffer.parts.pop_back();
 
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "consider " << dsv(it->p)
-                    << " at " << double(dist)
-                    << ((dist > max_dist) ? " maybe" : " no")
-                    << std::endl;
+                Point const& first_point = *(begin + first);
+                Point const& last_point = *(begin + last);
 
+#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
+                std::cout << "find between " << dsv(first_point)
+                    << " and " << dsv(last_point)
+                    << " size=" << last - first + 1 << std::endl;
 #endif
-                if ( less()(md, dist) )
+
+                // Find most far point, compare to the current segment
+                distance_type md(-1.0); // any value < 0
+                std::size_t candidate = first;
+                iterator_type it = begin + first + 1;
+                for (std::size_t i = first + 1; i < last; ++i, ++it)
                 {
-                    md = dist;
-                    candidate = it;
+                    distance_type dist = ps_distance_strategy.apply(*it, first_point, last_point);
+                    if ( less()(md, dist) )
+                    {
+                        md = dist;
+                        candidate = i;
+                    }
                 }
-            }
 
-            // If a point is found, set the include flag
-            // and handle segments in between recursively
-            if ( less()(max_dist, md) )
-            {
+                // If a point is found, set the include flag
+                // and handle the parts in between later
+                if ( less()(max_dist, md) )
+                {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "use " << dsv(candidate->p) << std::endl;
+                    std::cout << "use " << dsv(*(begin + candidate)) << std::endl;
 #endif
 
-                candidate->included = true;
-                n++;
-
-                consider(begin, candidate + 1, max_dist, n, ps_distance_strategy);
-                consider(candidate, end, max_dist, n, ps_distance_strategy);
+                    buffer.included[candidate] = 1;
+
+                    // Parts of 2 points have nothing in between
+                    if (last - candidate > 1)
+                    {
+                        buffer.parts.push_back(std::make_pair(candidate, last));
+                    }
+                    if (candidate - first > 1)
+                    {
+                        buffer.parts.push_back(std::make_pair(first, candidate));
+                    }
+                }
             }
         }
 
@@ -198,38 +203,52 @@ namespace detail
                                     OutputIterator out,
                                     distance_type max_distance) const
         {
+            douglas_peucker_buffer buffer;
+            return apply(range, out, max_distance, buffer);
+        }
+
+        template <typename Range, typename OutputIterator>
+        inline OutputIterator apply(Range const& range,
+                                    OutputIterator out,
+                                    distance_type max_distance,
+                                    douglas_peucker_buffer& buffer) const
+        {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
                 std::cout << "max distance: " << max_distance
                           << std::endl << std::endl;
 #endif
-            distance_strategy_type strategy;
+            select(range, max_distance, buffer);
 
-            // Copy coordinates, a vector of references to all points
-            std::vector<dp_point_type> ref_candidates(boost::begin(range),
-                            boost::end(range));
-
-            // Include first and last point of line,
-            // they are always part of the line
-            int n = 2;
-            ref_candidates.front().included = true;
-            ref_candidates.back().included = true;
+            // Copy included elements to the output
+            std::size_t i = 0;
+            for (typename boost::range_iterator<Range const>::type
+                    it = boost::begin(range);
+                it != boost::end(range);
+                ++it, ++i)
+            {
+                if (buffer.included[i])
+                {
+                    *out = *it;
+                    out++;
+                }
+            }
+            return out;
+        }
 
-            // Get points, recursively, including them if they are further away
-            // than the specified distance
-            consider(boost::begin(ref_candidates), boost::end(ref_candidates), max_distance, n, strategy);
+        // Outputs the indexes of the points which are kept
+        template <typename Range, typename OutputIterator>
+        inline OutputIterator apply_indexes(Range const& range,
+                                            OutputIterator out,
+                                            distance_type max_distance,
+                                            douglas_peucker_buffer& buffer) const
+        {
+            select(range, max_distance, buffer);
 
-            // Copy included elements to the output
-            for(typename std::vector<dp_point_type>::const_iterator it
-                            = boost::begin(ref_candidates);
-                it != boost::end(ref_candidates);
-                ++it)
+            for (std::size_t i = 0; i < buffer.included.size(); ++i)
             {
-                if (it->included)
+                if (buffer.included[i])
                 {
-                    // copy-coordinates does not work because OutputIterator
-                    // does not model Point (??)
-                    //geometry::convert(it->p, *out);
-                    *out = it->p;
+                    *out = i;
                     out++;
                 }
             }
@@ -281,39 +300,65 @@ public :
                                        OutputIterator out,
                                        distance_type const& max_distance)
     {
-        namespace services = strategy::distance::services;
+        douglas_peucker_buffer buffer;
+        return apply(range, out, max_distance, buffer);
+    }
 
-        typedef typename services::comparable_type
-            <
-                PointDistanceStrategy
-            >::type comparable_distance_strategy_type;
+    /*!
+    \brief Simplifies a range using the memory of a buffer
+    \details The buffer can be reused to simplify many ranges without
+        allocations. The range has to be random access.
+    */
+    template <typename Range, typename OutputIterator>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       distance_type const& max_distance,
+                                       douglas_peucker_buffer& buffer)
+    {
+        return comparable_strategy().apply(range, out,
+                                           comparable_max_distance(max_distance),
+                                           buffer);
+    }
 
-        return detail::douglas_peucker
-            <
-                Point, comparable_distance_strategy_type
-            >().apply(range, out,
-                      services::result_from_distance
-                          <
-                              comparable_distance_strategy_type, Point, Point
-                          >::apply(comparable_distance_strategy_type(),
-                                   max_distance)
-                      );
+    /*!
+    \brief Outputs the indexes of the points of a range which are kept,
+        in increasing order, without copying the points
+    */
+    template <typename Range, typename OutputIterator>
+    static inline OutputIterator apply_indexes(Range const& range,
+                                               OutputIterator out,
+                                               distance_type const& max_distance,
+                                               douglas_peucker_buffer& buffer)
+    {
+        return comparable_strategy().apply_indexes(range, out,
+                                                   comparable_max_distance(max_distance),
+                                                   buffer);
     }
 
-};
+private :
 
-}} // namespace strategy::simplify
+    typedef typename strategy::distance::services::comparable_type
+        <
+            PointDistanceStrategy
+        >::type comparable_distance_strategy_type;
 
+    typedef detail::douglas_peucker
+        <
+            Point, comparable_distance_strategy_type
+        > comparable_strategy;
 
-namespace traits {
+    static inline typename comparable_strategy::distance_type
+        comparable_max_distance(distance_type const& max_distance)
+    {
+        return strategy::distance::services::result_from_distance
+            <
+                comparable_distance_strategy_type, Point, Point
+            >::apply(comparable_distance_strategy_type(), max_distance);
+    }
 
-template <typename P>
-struct point_type<geometry::strategy::simplify::detail::douglas_peucker_point<P> >
-{
-    typedef P type;
 };
 
-} // namespace traits
+}} // namespace strategy::simplify
 
 
 }} // namespace boost::geometry
@@ -0,0 +1,330 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+#define BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategy/area.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace simplify
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Binary min-heap of the indexes of points ordered by the areas of their
+// triangles. The position of each index in the heap is stored, so the area
+// of a point can change without adding another entry.
+template <typename Area>
+class visvalingam_whyatt_heap
+{
+public :
+    // Contains the indexes [1, size - 1) of the areas
+    explicit visvalingam_whyatt_heap(std::vector<Area> const& areas)
+        : m_areas(areas)
+        , m_positions(areas.size(), 0)
+    {
+        std::size_t const size = areas.size();
+        m_heap.reserve(size - 2);
+        for (std::size_t i = 1; i + 1 < size; ++i)
+        {
+            m_positions[i] = m_heap.size();
+            m_heap.push_back(i);
+        }
+        for (std::size_t i = m_heap.size() / 2; i > 0; --i)
+        {
+            sift_down(i - 1);
+        }
+    }
+
+    inline bool empty() const
+    {
+        return m_heap.empty();
+    }
+
+    inline std::size_t top() const
+    {
+        return m_heap.front();
+    }
+
+    inline void pop()
+    {
+        move(m_heap.back(), 0);
+        m_heap.pop_back();
+        if (! m_heap.empty())
+        {
+            sift_down(0);
+        }
+    }
+
+    // Restores the order after the area of the point i changed
+    inline void update(std::size_t i)
+    {
+        std::size_t const position = m_positions[i];
+        sift_up(position);
+        if (m_positions[i] == position)
+        {
+            sift_down(position);
+        }
+    }
+
+private :
+    inline bool less(std::size_t i, std::size_t j) const
+    {
+        return m_areas[i] < m_areas[j]
+            || (! (m_areas[j] < m_areas[i]) && i < j);
+    }
+
+    inline void move(std::size_t i, std::size_t position)
+    {
+        m_heap[position] = i;
+        m_positions[i] = position;
+    }
+
+    inline void sift_up(std::size_t position)
+    {
+        std::size_t const i = m_heap[position];
+        while (position > 0)
+        {
+            std::size_t const parent = (position - 1) / 2;
+            if (! less(i, m_heap[parent]))
+            {
+                break;
+            }
+            move(m_heap[parent], position);
+            position = parent;
+        }
+        move(i, position);
+    }
+
+    inline void sift_down(std::size_t position)
+    {
+        std::size_t const size = m_heap.size();
+        std::size_t const i = m_heap[position];
+        while (true)
+        {
+            std::size_t child = 2 * position + 1;
+            if (child >= size)
+            {
+                break;
+            }
+            if (child + 1 < size && less(m_heap[child + 1], m_heap[child]))
+            {
+                ++child;
+            }
+            if (! less(m_heap[child], i))
+            {
+                break;
+            }
+            move(m_heap[child], position);
+            position = child;
+        }
+        move(i, position);
+    }
+
+    std::vector<Area> const& m_areas;
+    std::vector<std::size_t> m_heap;
+    std::vector<std::size_t> m_positions;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Implements the simplify algorithm using the Visvalingam-Whyatt
+    algorithm.
+\ingroup strategies
+\details The visvalingam_whyatt strategy repeatedly removes the point
+    forming the triangle with the smallest area with its neighbours, until
+    all triangles are at least as large as the specified area. The area of
+    a triangle after a removal is at least the area of the removed
+    triangle, so the points are removed in the order of their significance.
+    The points are kept in a heap ordered by the areas of their triangles,
+    a range of n points is simplified in O(n log n). The first and the
+    last point are always kept. This often looks better than
+    Douglas-Peucker for the generalization of maps.
+\tparam Point the point type
+\tparam PointDistanceStrategy point-segment distance strategy, used by
+    simplify() for rings
+\tparam AreaStrategy area strategy calculating the areas of the triangles
+\note The value passed as max_distance to simplify() is the minimal area
+    of the triangles, in square units of the coordinates for cartesian
+    coordinate systems.
+*/
+
+/*
+For the algorithm, see:
+ - Visvalingam, M. and Whyatt, J. D. (1993), Line generalisation by
+   repeated elimination of points, The Cartographic Journal 30(1)
+*/
+template
+<
+    typename Point,
+    typename PointDistanceStrategy
+        = typename strategy::distance::services::default_strategy
+            <
+                point_tag, segment_tag, Point
+            >::type,
+    typename AreaStrategy
+        = typename strategy::area::services::default_strategy
+            <
+                typename cs_tag<Point>::type
+            >::type
+>
+class visvalingam_whyatt
+{
+public :
+
+    typedef PointDistanceStrategy distance_strategy_type;
+
+    typedef typename strategy::distance::services::return_type
+                     <
+                         distance_strategy_type,
+                         Point, Point
+                     >::type distance_type;
+
+    typedef typename AreaStrategy::template result_type<Point>::type area_type;
+
+    visvalingam_whyatt()
+    {}
+
+    explicit visvalingam_whyatt(AreaStrategy const& area_strategy)
+        : m_area_strategy(area_strategy)
+    {}
+
+    template <typename Range, typename OutputIterator>
+    inline OutputIterator apply(Range const& range,
+                                OutputIterator out,
+                                distance_type const& min_area) const
+    {
+        typedef typename boost::range_iterator
+            <
+                Range const
+            >::type iterator_type;
+
+        std::size_t const size = boost::size(range);
+        if (size <= 2)
+        {
+            return std::copy(boost::begin(range), boost::end(range), out);
+        }
+
+        iterator_type const begin = boost::begin(range);
+        area_type const threshold = min_area;
+
+        // The points which are not removed yet are linked to each other
+        std::vector<std::size_t> previous(size);
+        std::vector<std::size_t> next(size);
+        std::vector<area_type> areas(size, area_type(0));
+        std::vector<unsigned char> removed(size, 0);
+
+        for (std::size_t i = 1; i + 1 < size; ++i)
+        {
+            previous[i] = i - 1;
+            next[i] = i + 1;
+            areas[i] = triangle_area(*(begin + (i - 1)), *(begin + i),
+                                     *(begin + (i + 1)));
+        }
+        previous[size - 1] = size - 2;
+        next[0] = 1;
+
+        detail::visvalingam_whyatt_heap<area_type> heap(areas);
+        while (! heap.empty())
+        {
+            std::size_t const i = heap.top();
+            area_type const area = areas[i];
+            if (! (area < threshold))
+            {
+                break;
+            }
+
+            heap.pop();
+            removed[i] = 1;
+            std::size_t const p = previous[i];
+            std::size_t const n = next[i];
+            next[p] = n;
+            previous[n] = p;
+
+            // The neighbours get new triangles, at least as large as the
+            // removed one
+            if (p > 0)
+            {
+                update(p, previous[p], n, area, begin, areas);
+                heap.update(p);
+            }
+            if (n + 1 < size)
+            {
+                update(n, p, next[n], area, begin, areas);
+                heap.update(n);
+            }
+        }
+
+        std::size_t i = 0;
+        for (iterator_type it = begin; it != boost::end(range); ++it, ++i)
+        {
+            if (! removed[i])
+            {
+                *out = *it;
+                out++;
+            }
+        }
+        return out;
+    }
+
+private :
+
+    inline area_type triangle_area(Point const& p1, Point const& p2,
+                                   Point const& p3) const
+    {
+        typename AreaStrategy::template state<Point> state;
+        m_area_strategy.apply(p1, p2, state);
+        m_area_strategy.apply(p2, p3, state);
+        m_area_strategy.apply(p3, p1, state);
+        area_type const area = m_area_strategy.result(state);
+        return area < 0 ? -area : area;
+    }
+
+    template <typename Iterator>
+    inline void update(std::size_t i,
+                       std::size_t previous, std::size_t next,
+                       area_type const& removed_area,
+                       Iterator begin,
+                       std::vector<area_type>& areas) const
+    {
+        area_type const area = triangle_area(*(begin + previous),
+                                             *(begin + i),
+                                             *(begin + next));
+        areas[i] = (std::max)(area, removed_area);
+    }
+
+    AreaStrategy m_area_strategy;
+};
+
+
+}} // namespace strategy::simplify
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
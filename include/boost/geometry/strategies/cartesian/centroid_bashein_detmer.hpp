@@ -25,11 +25,15 @@
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/type_traits/is_void.hpp>
 
 #include <boost/geometry/arithmetic/determinant.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/strategies/cartesian/detail/contiguous_kernels.hpp>
 #include <boost/geometry/strategies/centroid.hpp>
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/select_coordinate_type.hpp>
@@ -127,6 +131,9 @@ template
 >
 class bashein_detmer
 {
+    template <typename Strategy, typename Range>
+    friend struct detail::contiguous_kernel;
+
 private :
     // If user specified a calculation type, use that type,
     //   whatever it is and whatever the point-type(s) are.
@@ -195,6 +202,25 @@ public :
         state.sum_y += ai * (y1 + y2);
     }
 
+    // Adds the segments between count points of which the coordinates are
+    // stored contiguously, translated by -origin like the points passed to
+    // apply, see detail::contiguous_kernel
+    static inline void apply_contiguous(double const* coordinates,
+                                        std::size_t count,
+                                        double origin_x, double origin_y,
+                                        sums& state)
+    {
+        if (count < 2)
+        {
+            return;
+        }
+        state.count += count - 1;
+        geometry::detail::contiguous::centroid_sum(coordinates, count,
+                                                   origin_x, origin_y,
+                                                   state.sum_a2,
+                                                   state.sum_x, state.sum_y);
+    }
+
     static inline bool result(sums const& state, Point& centroid)
     {
         calculation_type const zero = calculation_type();
@@ -227,6 +253,44 @@ public :
 
 };
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+template
+<
+    typename Point,
+    typename PointOfSegment,
+    typename CalculationType,
+    typename Range
+>
+struct contiguous_kernel
+    <
+        bashein_detmer<Point, PointOfSegment, CalculationType>,
+        Range
+    >
+{
+    static const bool value
+        = geometry::detail::contiguous::vectorized_sums::value
+        && geometry::detail::has_contiguous_points<Range, double, 2>::value
+        && boost::is_same
+            <
+                typename boost::range_value<Range>::type,
+                PointOfSegment
+            >::value
+        && boost::is_same
+            <
+                typename bashein_detmer
+                    <
+                        Point, PointOfSegment, CalculationType
+                    >::calculation_type,
+                double
+            >::value;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
 #ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
 
 namespace services
@@ -0,0 +1,391 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_DETAIL_CONTIGUOUS_KERNELS_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_DETAIL_CONTIGUOUS_KERNELS_HPP
+
+
+#include <cmath>
+#include <cstddef>
+
+// The kernels use AVX or SSE2 if the compiler targets it, unless
+// BOOST_GEOMETRY_NO_SIMD is defined. Otherwise they are plain loops.
+#if ! defined(BOOST_GEOMETRY_NO_SIMD)
+#  if defined(__AVX__)
+#    define BOOST_GEOMETRY_DETAIL_SIMD_AVX
+#  elif defined(__SSE2__) || defined(_M_X64) \
+     || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define BOOST_GEOMETRY_DETAIL_SIMD_SSE2
+#  endif
+#endif
+
+#if defined(BOOST_GEOMETRY_DETAIL_SIMD_AVX)
+#include <immintrin.h>
+#define BOOST_GEOMETRY_DETAIL_SIMD_NAMESPACE avx
+#elif defined(BOOST_GEOMETRY_DETAIL_SIMD_SSE2)
+#include <emmintrin.h>
+#define BOOST_GEOMETRY_DETAIL_SIMD_NAMESPACE sse2
+#else
+#define BOOST_GEOMETRY_DETAIL_SIMD_NAMESPACE scalar
+#endif
+
+#include <boost/type_traits/integral_constant.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace contiguous
+{
+
+// The kernels adding sums add them in another order than segment by
+// segment, so the results can differ in the last bits, depending on the
+// instruction set. Area, length and centroid use them only if
+// BOOST_GEOMETRY_ENABLE_VECTORIZED_SUMS is defined, so the signs and the
+// zero areas used by overlay and validity do not depend on the build.
+// The bounds are exact and are always calculated with the kernels.
+struct vectorized_sums
+#if defined(BOOST_GEOMETRY_ENABLE_VECTORIZED_SUMS)
+    : boost::true_type
+#else
+    : boost::false_type
+#endif
+{};
+
+// Each instruction set has its own namespace, so translation units compiled
+// for different instruction sets do not share definitions of the kernels
+inline namespace BOOST_GEOMETRY_DETAIL_SIMD_NAMESPACE
+{
+
+// Kernels over count points with double coordinates stored as
+// x0 y0 x1 y1 ... (see has_contiguous_points). They process the segments
+// between consecutive points with several independent sums, so the result
+// can differ in the last bits from adding the segments one by one.
+
+struct scalar_ops
+{
+    typedef double type;
+    static const std::size_t size = 1;
+
+    static inline type zero() { return 0.0; }
+    static inline type set(double value) { return value; }
+    static inline type add(type a, type b) { return a + b; }
+    static inline type sub(type a, type b) { return a - b; }
+    static inline type mul(type a, type b) { return a * b; }
+    static inline type sqrt(type a) { return std::sqrt(a); }
+    static inline type minimum(type a, type b) { return a < b ? a : b; }
+    static inline type maximum(type a, type b) { return a > b ? a : b; }
+    static inline double sum(type a) { return a; }
+
+    static inline void store(double* values, type a) { values[0] = a; }
+
+    static inline void load(double const* coordinates, type& x, type& y)
+    {
+        x = coordinates[0];
+        y = coordinates[1];
+    }
+};
+
+#if defined(BOOST_GEOMETRY_DETAIL_SIMD_AVX)
+
+struct packed_ops
+{
+    typedef __m256d type;
+    static const std::size_t size = 4;
+
+    static inline type zero() { return _mm256_setzero_pd(); }
+    static inline type set(double value) { return _mm256_set1_pd(value); }
+    static inline type add(type a, type b) { return _mm256_add_pd(a, b); }
+    static inline type sub(type a, type b) { return _mm256_sub_pd(a, b); }
+    static inline type mul(type a, type b) { return _mm256_mul_pd(a, b); }
+    static inline type sqrt(type a) { return _mm256_sqrt_pd(a); }
+    static inline type minimum(type a, type b) { return _mm256_min_pd(a, b); }
+    static inline type maximum(type a, type b) { return _mm256_max_pd(a, b); }
+
+    static inline double sum(type a)
+    {
+        double values[4];
+        _mm256_storeu_pd(values, a);
+        return (values[0] + values[1]) + (values[2] + values[3]);
+    }
+
+    static inline void store(double* values, type a)
+    {
+        _mm256_storeu_pd(values, a);
+    }
+
+    // Loads four points, as x0 x2 x1 x3 and y0 y2 y1 y3
+    static inline void load(double const* coordinates, type& x, type& y)
+    {
+        type const first = _mm256_loadu_pd(coordinates);
+        type const second = _mm256_loadu_pd(coordinates + 4);
+        x = _mm256_unpacklo_pd(first, second);
+        y = _mm256_unpackhi_pd(first, second);
+    }
+};
+
+#elif defined(BOOST_GEOMETRY_DETAIL_SIMD_SSE2)
+
+struct packed_ops
+{
+    typedef __m128d type;
+    static const std::size_t size = 2;
+
+    static inline type zero() { return _mm_setzero_pd(); }
+    static inline type set(double value) { return _mm_set1_pd(value); }
+    static inline type add(type a, type b) { return _mm_add_pd(a, b); }
+    static inline type sub(type a, type b) { return _mm_sub_pd(a, b); }
+    static inline type mul(type a, type b) { return _mm_mul_pd(a, b); }
+    static inline type sqrt(type a) { return _mm_sqrt_pd(a); }
+    static inline type minimum(type a, type b) { return _mm_min_pd(a, b); }
+    static inline type maximum(type a, type b) { return _mm_max_pd(a, b); }
+
+    static inline double sum(type a)
+    {
+        double values[2];
+        _mm_storeu_pd(values, a);
+        return values[0] + values[1];
+    }
+
+    static inline void store(double* values, type a)
+    {
+        _mm_storeu_pd(values, a);
+    }
+
+    // Loads two points, as x0 x1 and y0 y1
+    static inline void load(double const* coordinates, type& x, type& y)
+    {
+        type const first = _mm_loadu_pd(coordinates);
+        type const second = _mm_loadu_pd(coordinates + 2);
+        x = _mm_unpacklo_pd(first, second);
+        y = _mm_unpackhi_pd(first, second);
+    }
+};
+
+#else
+
+typedef scalar_ops packed_ops;
+
+#endif
+
+
+// Applies Sums to the segments, with packed_ops as long as two packs of
+// segments are left, alternating two sums to hide the latency of the
+// additions, and then with scalar_ops
+template <typename PackedSums, typename ScalarSums>
+inline void accumulate(double const* coordinates, std::size_t count,
+                       PackedSums& packed, ScalarSums& scalar)
+{
+    typedef packed_ops ops;
+    typedef typename ops::type type;
+
+    std::size_t const step = 2 * ops::size;
+
+    PackedSums second = packed;
+    std::size_t i = 0;
+    for ( ; i + step < count; i += step)
+    {
+        double const* const p = coordinates + 2 * i;
+        type x1, y1, x2, y2;
+        ops::load(p, x1, y1);
+        ops::load(p + 2, x2, y2);
+        packed.apply(x1, y1, x2, y2);
+        ops::load(p + 2 * ops::size, x1, y1);
+        ops::load(p + 2 * ops::size + 2, x2, y2);
+        second.apply(x1, y1, x2, y2);
+    }
+    packed.merge(second);
+
+    for ( ; i + 1 < count; ++i)
+    {
+        double const* const p = coordinates + 2 * i;
+        scalar.apply(p[0], p[1], p[2], p[3]);
+    }
+}
+
+
+// Sum of (x1 + x2) * (y1 - y2), see strategy::area::cartesian
+template <typename Ops>
+struct area_sums
+{
+    typedef typename Ops::type type;
+
+    area_sums()
+        : sum(Ops::zero())
+    {}
+
+    inline void apply(type x1, type y1, type x2, type y2)
+    {
+        sum = Ops::add(sum, Ops::mul(Ops::add(x1, x2), Ops::sub(y1, y2)));
+    }
+
+    inline void merge(area_sums const& other)
+    {
+        sum = Ops::add(sum, other.sum);
+    }
+
+    type sum;
+};
+
+// Sum of the lengths of the segments, see strategy::distance::pythagoras
+template <typename Ops>
+struct length_sums
+{
+    typedef typename Ops::type type;
+
+    length_sums()
+        : sum(Ops::zero())
+    {}
+
+    inline void apply(type x1, type y1, type x2, type y2)
+    {
+        type const dx = Ops::sub(x2, x1);
+        type const dy = Ops::sub(y2, y1);
+        sum = Ops::add(sum, Ops::sqrt(Ops::add(Ops::mul(dy, dy),
+                                               Ops::mul(dx, dx))));
+    }
+
+    inline void merge(length_sums const& other)
+    {
+        sum = Ops::add(sum, other.sum);
+    }
+
+    type sum;
+};
+
+// Sums of the centroid of the segments translated by -origin,
+// see strategy::centroid::bashein_detmer
+template <typename Ops>
+struct centroid_sums
+{
+    typedef typename Ops::type type;
+
+    centroid_sums(double origin_x, double origin_y)
+        : ox(Ops::set(origin_x))
+        , oy(Ops::set(origin_y))
+        , sum_a2(Ops::zero())
+        , sum_x(Ops::zero())
+        , sum_y(Ops::zero())
+    {}
+
+    inline void apply(type x1, type y1, type x2, type y2)
+    {
+        x1 = Ops::sub(x1, ox);
+        y1 = Ops::sub(y1, oy);
+        x2 = Ops::sub(x2, ox);
+        y2 = Ops::sub(y2, oy);
+        type const ai = Ops::sub(Ops::mul(x1, y2), Ops::mul(y1, x2));
+        sum_a2 = Ops::add(sum_a2, ai);
+        sum_x = Ops::add(sum_x, Ops::mul(ai, Ops::add(x1, x2)));
+        sum_y = Ops::add(sum_y, Ops::mul(ai, Ops::add(y1, y2)));
+    }
+
+    inline void merge(centroid_sums const& other)
+    {
+        sum_a2 = Ops::add(sum_a2, other.sum_a2);
+        sum_x = Ops::add(sum_x, other.sum_x);
+        sum_y = Ops::add(sum_y, other.sum_y);
+    }
+
+    type ox, oy;
+    type sum_a2, sum_x, sum_y;
+};
+
+
+inline double area_sum(double const* coordinates, std::size_t count)
+{
+    area_sums<packed_ops> packed;
+    area_sums<scalar_ops> scalar;
+    accumulate(coordinates, count, packed, scalar);
+    return packed_ops::sum(packed.sum) + scalar.sum;
+}
+
+inline double length_sum(double const* coordinates, std::size_t count)
+{
+    length_sums<packed_ops> packed;
+    length_sums<scalar_ops> scalar;
+    accumulate(coordinates, count, packed, scalar);
+    return packed_ops::sum(packed.sum) + scalar.sum;
+}
+
+inline void centroid_sum(double const* coordinates, std::size_t count,
+                         double origin_x, double origin_y,
+                         double& sum_a2, double& sum_x, double& sum_y)
+{
+    centroid_sums<packed_ops> packed(origin_x, origin_y);
+    centroid_sums<scalar_ops> scalar(origin_x, origin_y);
+    accumulate(coordinates, count, packed, scalar);
+    sum_a2 += packed_ops::sum(packed.sum_a2) + scalar.sum_a2;
+    sum_x += packed_ops::sum(packed.sum_x) + scalar.sum_x;
+    sum_y += packed_ops::sum(packed.sum_y) + scalar.sum_y;
+}
+
+// Minimum and maximum coordinates of count > 0 points. Like expanding a box
+// by the points one by one, a coordinate replaces the minimum only if it is
+// smaller, so NaN coordinates are ignored unless the first point has them.
+inline void bounds(double const* coordinates, std::size_t count,
+                   double& min_x, double& min_y,
+                   double& max_x, double& max_y)
+{
+    typedef packed_ops ops;
+    typedef ops::type type;
+
+    type packed_min_x = ops::set(coordinates[0]);
+    type packed_min_y = ops::set(coordinates[1]);
+    type packed_max_x = packed_min_x;
+    type packed_max_y = packed_min_y;
+
+    std::size_t i = 1;
+    for ( ; i + ops::size <= count; i += ops::size)
+    {
+        type x, y;
+        ops::load(coordinates + 2 * i, x, y);
+        packed_min_x = ops::minimum(x, packed_min_x);
+        packed_min_y = ops::minimum(y, packed_min_y);
+        packed_max_x = ops::maximum(x, packed_max_x);
+        packed_max_y = ops::maximum(y, packed_max_y);
+    }
+
+    double values[4][ops::size];
+    ops::store(values[0], packed_min_x);
+    ops::store(values[1], packed_min_y);
+    ops::store(values[2], packed_max_x);
+    ops::store(values[3], packed_max_y);
+
+    min_x = values[0][0];
+    min_y = values[1][0];
+    max_x = values[2][0];
+    max_y = values[3][0];
+    for (std::size_t j = 1; j < ops::size; ++j)
+    {
+        min_x = scalar_ops::minimum(values[0][j], min_x);
+        min_y = scalar_ops::minimum(values[1][j], min_y);
+        max_x = scalar_ops::maximum(values[2][j], max_x);
+        max_y = scalar_ops::maximum(values[3][j], max_y);
+    }
+
+    for ( ; i < count; ++i)
+    {
+        double const* const p = coordinates + 2 * i;
+        min_x = scalar_ops::minimum(p[0], min_x);
+        min_y = scalar_ops::minimum(p[1], min_y);
+        max_x = scalar_ops::maximum(p[0], max_x);
+        max_y = scalar_ops::maximum(p[1], max_y);
+    }
+}
+
+
+} // namespace BOOST_GEOMETRY_DETAIL_SIMD_NAMESPACE
+
+}} // namespace detail::contiguous
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_DETAIL_CONTIGUOUS_KERNELS_HPP
@@ -20,10 +20,17 @@
 #define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_DISTANCE_PYTHAGORAS_HPP
 
 
+#include <cstddef>
+
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/is_same.hpp>
+
 #include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 
 #include <boost/geometry/geometries/concepts/point_concept.hpp>
 
+#include <boost/geometry/strategies/cartesian/detail/contiguous_kernels.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 
 #include <boost/geometry/util/math.hpp>
@@ -169,9 +176,42 @@ public :
                     )
             );
     }
+
+    // Returns the sum of the distances between consecutive points of count
+    // points of which the coordinates are stored contiguously,
+    // see detail::contiguous_kernel
+    static inline double apply_contiguous(double const* coordinates,
+                                          std::size_t count)
+    {
+        return geometry::detail::contiguous::length_sum(coordinates, count);
+    }
 };
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+template <typename CalculationType, typename Range>
+struct contiguous_kernel<pythagoras<CalculationType>, Range>
+{
+    typedef typename boost::range_value<Range>::type point_type;
+
+    static const bool value
+        = geometry::detail::contiguous::vectorized_sums::value
+        && geometry::detail::has_contiguous_points<Range, double, 2>::value
+        && boost::is_same
+            <
+                typename pythagoras<CalculationType>
+                    ::template calculation_type<point_type, point_type>::type,
+                double
+            >::value;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
 #ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
 namespace services
 {
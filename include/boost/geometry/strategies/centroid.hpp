@@ -18,6 +18,7 @@
 #include <cstddef>
 
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/strategies/tags.hpp>
@@ -35,6 +36,21 @@ struct not_applicable_strategy
 };
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Indicates if Strategy adds the segments of Range with a kernel over all
+// coordinates at once, see apply_contiguous of strategy bashein_detmer
+template <typename Strategy, typename Range>
+struct contiguous_kernel
+    : boost::false_type
+{};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
 namespace services
 {
 
@@ -21,6 +21,7 @@
 
 
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/strategies/tags.hpp>
@@ -30,7 +31,25 @@ namespace boost { namespace geometry
 {
 
 
-namespace strategy { namespace distance { namespace services
+namespace strategy { namespace distance
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Indicates if Strategy calculates the lengths of the segments of Range with
+// a kernel over all coordinates at once, see apply_contiguous of strategy
+// pythagoras
+template <typename Strategy, typename Range>
+struct contiguous_kernel
+    : boost::false_type
+{};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+namespace services
 {
 
 
@@ -102,7 +121,9 @@ struct default_strategy
 };
 
 
-}}} // namespace strategy::distance::services
+} // namespace services
+
+}} // namespace strategy::distance
 
 
 }} // namespace boost::geometry
@@ -17,11 +17,21 @@
 #define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_DISTANCE_HPP
 
 
+#include <algorithm>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/core/radius.hpp>
 
 #include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/inverse_batch.hpp>
 #include <boost/geometry/formulas/meridian_inverse.hpp>
 #include <boost/geometry/formulas/flattening.hpp>
 
@@ -30,6 +40,7 @@
 #include <boost/geometry/strategies/distance.hpp>
 #include <boost/geometry/strategies/geographic/parameters.hpp>
 
+#include <boost/geometry/util/executor.hpp>
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/normalize_spheroidal_coordinates.hpp>
 #include <boost/geometry/util/promote_floating_point.hpp>
@@ -125,12 +136,136 @@ public :
         return apply(lon1, lat1, lon2, lat2, m_spheroid);
     }
 
+    /*!
+    \brief Calculates the distances between all points of two ranges,
+           e.g. two multi-points.
+    \details The distances are stored row-major, the distance between the i-th
+        point of range1 and the j-th point of range2 is stored at
+        out[i * size(range2) + j]. Values depending only on a single point are
+        calculated once per point, see formula::inverse_batch. The results are
+        the same as the results of apply() called for every pair.
+    */
+    template <typename Range1, typename Range2, typename RandomAccessIterator>
+    inline void apply_matrix(Range1 const& range1, Range2 const& range2,
+                             RandomAccessIterator out) const
+    {
+        apply_matrix(range1, range2, out, sequential_executor());
+    }
+
+    /*!
+    \brief Calculates the distances between all points of two ranges,
+           the rows are calculated by the executor, e.g. thread_executor.
+    */
+    template
+    <
+        typename Range1, typename Range2,
+        typename RandomAccessIterator, typename Executor
+    >
+    inline void apply_matrix(Range1 const& range1, Range2 const& range2,
+                             RandomAccessIterator out,
+                             Executor const& executor) const
+    {
+        typedef typename calculation_type
+            <
+                typename boost::range_value<Range1>::type,
+                typename boost::range_value<Range2>::type
+            >::type CT;
+
+        typedef formula::inverse_batch
+            <
+                CT,
+                typename FormulaPolicy::template inverse
+                    <
+                        CT, true, false, false, false, false
+                    >,
+                Spheroid
+            > batch_type;
+
+        typedef typename formula::meridian_inverse
+            <
+                CT, strategy::default_order<FormulaPolicy>::value
+            > meridian_inverse;
+
+        batch_type const batch(m_spheroid);
+
+        typename batch_type::points_type points1, points2;
+        std::vector<CT> arcs1, arcs2;
+        prepare_points(batch, range1, points1, arcs1);
+        prepare_points(batch, range2, points2, arcs2);
+
+        std::size_t const size2 = points2.size();
+        if (size2 == 0)
+        {
+            return;
+        }
+
+        CT const quarter_arc = meridian_inverse::apply(math::half_pi<CT>(), m_spheroid);
+
+        std::size_t const rows = (std::max)(std::size_t(1), std::size_t(4096) / size2);
+
+        geometry::detail::for_each_chunk(executor, points1.size(), rows,
+            [&](std::size_t first, std::size_t last)
+            {
+                for (std::size_t i = first ; i < last ; ++i)
+                {
+                    RandomAccessIterator const row = out + i * size2;
+
+                    // Pairs on the same meridian are calculated with the
+                    // meridian arcs, runs of other pairs with the batch
+                    std::size_t run = 0;
+                    for (std::size_t j = 0 ; j < size2 ; ++j)
+                    {
+                        typename meridian_inverse::result const res
+                            = meridian_inverse::apply(points1.lon[i], points1.lat[i], arcs1[i],
+                                                      points2.lon[j], points2.lat[j], arcs2[j],
+                                                      quarter_arc);
+                        if (res.meridian)
+                        {
+                            if (run < j)
+                            {
+                                batch.apply(points1, i, points2, run, j, row + run);
+                            }
+                            row[j] = res.distance;
+                            run = j + 1;
+                        }
+                    }
+                    if (run < size2)
+                    {
+                        batch.apply(points1, i, points2, run, size2, row + run);
+                    }
+                }
+            });
+    }
+
     inline Spheroid const& model() const
     {
         return m_spheroid;
     }
 
 private :
+    template <typename Batch, typename Range, typename Points, typename CT>
+    inline void prepare_points(Batch const& batch, Range const& range,
+                               Points & points, std::vector<CT> & arcs) const
+    {
+        typedef typename formula::meridian_inverse
+            <
+                CT, strategy::default_order<FormulaPolicy>::value
+            > meridian_inverse;
+
+        std::size_t const count = boost::size(range);
+        points.reserve(count);
+        arcs.reserve(count);
+
+        for (typename boost::range_iterator<Range const>::type
+                it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            CT const lon = get_as_radian<0>(*it);
+            CT const lat = get_as_radian<1>(*it);
+            batch.push_back(points, lon, lat);
+            arcs.push_back(meridian_inverse::apply(lat, m_spheroid));
+        }
+    }
+
     Spheroid m_spheroid;
 };
 
@@ -0,0 +1,878 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_DISTANCE_CHORD_HPP
+#define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_DISTANCE_CHORD_HPP
+
+
+#include <algorithm>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/core/radius.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/dispatch/distance.hpp>
+
+#include <boost/geometry/formulas/flattening.hpp>
+
+#include <boost/geometry/geometries/box.hpp>
+
+#include <boost/geometry/srs/spheroid.hpp>
+
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/geographic/distance_cross_track.hpp>
+
+#include <boost/geometry/strategy/geographic/envelope_segment.hpp>
+
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/promote_floating_point.hpp>
+#include <boost/geometry/util/select_calculation_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace distance
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace geographic_chord
+{
+
+// Geocentric coordinates are calculated on the spheroid scaled to a = 1
+// using the reduced latitude beta:
+//   x = cos(beta) cos(lon), y = cos(beta) sin(lon), z = (1 - f) sin(beta)
+// where cos(beta) = N cos(lat), sin(beta) = N (1 - f) sin(lat)
+// and N = 1 / sqrt(1 - e^2 sin^2(lat)). Both are monotonic in lat.
+template <typename CT>
+struct unit_spheroid
+{
+    template <typename Spheroid>
+    explicit inline unit_spheroid(Spheroid const& spheroid)
+        : a(get_radius<0>(spheroid))
+        , one_minus_f(CT(1) - formula::flattening<CT>(spheroid))
+        , e2(CT(1) - math::sqr(one_minus_f))
+    {}
+
+    inline void reduced_latitude(CT const& lat, CT & cos_beta, CT & sin_beta) const
+    {
+        CT const sin_lat = sin(lat);
+        CT const n = CT(1) / math::sqrt(CT(1) - e2 * math::sqr(sin_lat));
+        cos_beta = n * cos(lat);
+        sin_beta = n * one_minus_f * sin_lat;
+    }
+
+    inline void geocentric(CT const& lon, CT const& lat,
+                           CT & x, CT & y, CT & z) const
+    {
+        CT cos_beta, sin_beta;
+        reduced_latitude(lat, cos_beta, sin_beta);
+        x = cos_beta * cos(lon);
+        y = cos_beta * sin(lon);
+        z = one_minus_f * sin_beta;
+    }
+
+    CT a;
+    CT one_minus_f;
+    CT e2;
+};
+
+// Range of a sinusoid over [l1, l2] given its values v1 and v2 at the ends.
+// The maximum 1 is reached at phase + 2k pi, the minimum -1 at phase + pi + 2k pi.
+template <typename CT>
+inline void trig_range(CT const& v1, CT const& v2,
+                       CT const& l1, CT const& l2, CT const& phase,
+                       CT & min_value, CT & max_value)
+{
+    CT const two_pi = math::two_pi<CT>();
+    CT const pi = math::pi<CT>();
+
+    min_value = (std::min)(v1, v2);
+    max_value = (std::max)(v1, v2);
+
+    if (l2 - l1 >= two_pi)
+    {
+        min_value = -1;
+        max_value = 1;
+        return;
+    }
+
+    if (ceil((l1 - phase) / two_pi) * two_pi + phase <= l2)
+    {
+        max_value = 1;
+    }
+    if (ceil((l1 - phase - pi) / two_pi) * two_pi + phase + pi <= l2)
+    {
+        min_value = -1;
+    }
+}
+
+// Range of the product of [min1, max1] with min1 >= 0 and [min2, max2]
+template <typename CT>
+inline void product_range(CT const& min1, CT const& max1,
+                          CT const& min2, CT const& max2,
+                          CT & min_value, CT & max_value)
+{
+    min_value = min2 >= 0 ? min1 * min2 : max1 * min2;
+    max_value = max2 >= 0 ? max1 * max2 : min1 * max2;
+}
+
+template <typename CT>
+inline CT sqr_distance_to_range(CT const& v, CT const& min_value, CT const& max_value)
+{
+    return v < min_value ? math::sqr(min_value - v)
+         : max_value < v ? math::sqr(v - max_value)
+         : CT(0);
+}
+
+// Squared length of the chord between two points
+template <typename CT, typename Point1, typename Point2>
+inline CT sqr_chord(Point1 const& p1, Point2 const& p2,
+                    unit_spheroid<CT> const& spheroid)
+{
+    CT x1, y1, z1, x2, y2, z2;
+    spheroid.geocentric(get_as_radian<0>(p1), get_as_radian<1>(p1), x1, y1, z1);
+    spheroid.geocentric(get_as_radian<0>(p2), get_as_radian<1>(p2), x2, y2, z2);
+
+    return math::sqr(spheroid.a)
+         * (math::sqr(x1 - x2) + math::sqr(y1 - y2) + math::sqr(z1 - z2));
+}
+
+// Axis-aligned geocentric box containing the part of the surface of the
+// spheroid bounded by a box with the longitudes and latitudes in radians
+template <typename CT>
+struct geocentric_box
+{
+    inline geocentric_box(CT const& lon1, CT const& lat1,
+                          CT const& lon2, CT const& lat2,
+                          unit_spheroid<CT> const& spheroid)
+    {
+        CT cos_beta1, sin_beta1, cos_beta2, sin_beta2;
+        spheroid.reduced_latitude(lat1, cos_beta1, sin_beta1);
+        spheroid.reduced_latitude(lat2, cos_beta2, sin_beta2);
+
+        CT const min_cos_beta = (std::min)(cos_beta1, cos_beta2);
+        CT const max_cos_beta = lat1 <= 0 && 0 <= lat2
+                              ? CT(1)
+                              : (std::max)(cos_beta1, cos_beta2);
+
+        CT const half_pi = math::half_pi<CT>();
+        CT min_cos_lon, max_cos_lon, min_sin_lon, max_sin_lon;
+        trig_range(CT(cos(lon1)), CT(cos(lon2)), lon1, lon2, CT(0),
+                   min_cos_lon, max_cos_lon);
+        trig_range(CT(sin(lon1)), CT(sin(lon2)), lon1, lon2, half_pi,
+                   min_sin_lon, max_sin_lon);
+
+        product_range(min_cos_beta, max_cos_beta, min_cos_lon, max_cos_lon, min_x, max_x);
+        product_range(min_cos_beta, max_cos_beta, min_sin_lon, max_sin_lon, min_y, max_y);
+
+        min_z = spheroid.one_minus_f * sin_beta1;
+        max_z = spheroid.one_minus_f * sin_beta2;
+    }
+
+    template <typename Box>
+    static inline geocentric_box from_box(Box const& box,
+                                          unit_spheroid<CT> const& spheroid)
+    {
+        return geocentric_box(get_as_radian<min_corner, 0>(box),
+                              get_as_radian<min_corner, 1>(box),
+                              get_as_radian<max_corner, 0>(box),
+                              get_as_radian<max_corner, 1>(box),
+                              spheroid);
+    }
+
+    CT min_x, max_x, min_y, max_y, min_z, max_z;
+};
+
+template <typename CT>
+inline CT sqr_distance_of_ranges(CT const& min1, CT const& max1,
+                                 CT const& min2, CT const& max2)
+{
+    return max1 < min2 ? math::sqr(min2 - max1)
+         : max2 < min1 ? math::sqr(min1 - max2)
+         : CT(0);
+}
+
+// Squared distance between a point and the axis-aligned geocentric box
+// containing the part of the surface of the spheroid bounded by the box.
+// It is not greater than the squared chord to any point within the box.
+template <typename CT, typename Point, typename Box>
+inline CT sqr_chord_point_box(Point const& point, Box const& box,
+                              unit_spheroid<CT> const& spheroid)
+{
+    CT x, y, z;
+    spheroid.geocentric(get_as_radian<0>(point), get_as_radian<1>(point), x, y, z);
+
+    geocentric_box<CT> const g = geocentric_box<CT>::from_box(box, spheroid);
+
+    return math::sqr(spheroid.a)
+         * (sqr_distance_to_range(x, g.min_x, g.max_x)
+          + sqr_distance_to_range(y, g.min_y, g.max_y)
+          + sqr_distance_to_range(z, g.min_z, g.max_z));
+}
+
+// Squared distance between the axis-aligned geocentric boxes of two boxes.
+// It is not greater than the squared chord between any points within them.
+template <typename CT, typename Box1, typename Box2>
+inline CT sqr_chord_box_box(Box1 const& box1, Box2 const& box2,
+                            unit_spheroid<CT> const& spheroid)
+{
+    geocentric_box<CT> const g1 = geocentric_box<CT>::from_box(box1, spheroid);
+    geocentric_box<CT> const g2 = geocentric_box<CT>::from_box(box2, spheroid);
+
+    return math::sqr(spheroid.a)
+         * (sqr_distance_of_ranges(g1.min_x, g1.max_x, g2.min_x, g2.max_x)
+          + sqr_distance_of_ranges(g1.min_y, g1.max_y, g2.min_y, g2.max_y)
+          + sqr_distance_of_ranges(g1.min_z, g1.max_z, g2.min_z, g2.max_z));
+}
+
+}} // namespace detail::geographic_chord
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace comparable
+{
+
+/*!
+\brief Comparable version of geographic_chord, the squared length of
+       the chord
+\ingroup strategies
+\tparam Spheroid The spheroid model
+\tparam CalculationType \tparam_calculation
+*/
+template
+<
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_chord
+{
+public :
+    template <typename Point1, typename Point2>
+    struct calculation_type
+        : promote_floating_point
+          <
+              typename select_calculation_type
+                  <
+                      Point1,
+                      Point2,
+                      CalculationType
+                  >::type
+          >
+    {};
+
+    typedef Spheroid model_type;
+
+    inline geographic_chord()
+        : m_spheroid()
+    {}
+
+    explicit inline geographic_chord(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    template <typename Point1, typename Point2>
+    inline typename calculation_type<Point1, Point2>::type
+    apply(Point1 const& p1, Point2 const& p2) const
+    {
+        typedef typename calculation_type<Point1, Point2>::type calc_t;
+
+        return detail::geographic_chord::sqr_chord(p1, p2,
+                    detail::geographic_chord::unit_spheroid<calc_t>(m_spheroid));
+    }
+
+    inline Spheroid const& model() const
+    {
+        return m_spheroid;
+    }
+
+private :
+    Spheroid m_spheroid;
+};
+
+/*!
+\brief Comparable version of geographic_chord_point_box, the squared
+       lower bound of the length of the chord
+\ingroup strategies
+\tparam Spheroid The spheroid model
+\tparam CalculationType \tparam_calculation
+*/
+template
+<
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_chord_point_box
+{
+public :
+    template <typename Point, typename Box>
+    struct calculation_type
+        : geographic_chord
+            <
+                Spheroid, CalculationType
+            >::template calculation_type<Point, typename point_type<Box>::type>
+    {};
+
+    typedef Spheroid model_type;
+
+    inline geographic_chord_point_box()
+        : m_spheroid()
+    {}
+
+    explicit inline geographic_chord_point_box(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    template <typename Point, typename Box>
+    inline typename calculation_type<Point, Box>::type
+    apply(Point const& point, Box const& box) const
+    {
+        typedef typename calculation_type<Point, Box>::type calc_t;
+
+        return detail::geographic_chord::sqr_chord_point_box(point, box,
+                    detail::geographic_chord::unit_spheroid<calc_t>(m_spheroid));
+    }
+
+    inline Spheroid const& model() const
+    {
+        return m_spheroid;
+    }
+
+private :
+    Spheroid m_spheroid;
+};
+
+/*!
+\brief Squared geodesic distance between a point and a segment, comparable
+       with geographic_chord and geographic_chord_point_box
+\ingroup strategies
+\details The distance of geographic_cross_track is squared so it has the
+    unit of the squared chord, which is not greater than it. Together with
+    geographic_chord_point_box the nearest segments of a point are found
+    in the rtree and the segments are sorted by the geodesic distance.
+\tparam FormulaPolicy Formula used to calculate the geodesic distance
+\tparam Spheroid The spheroid model
+\tparam CalculationType \tparam_calculation
+*/
+template
+<
+    typename FormulaPolicy = strategy::andoyer,
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_chord_point_segment
+    : public geographic_cross_track<FormulaPolicy, Spheroid, CalculationType>
+{
+    typedef geographic_cross_track<FormulaPolicy, Spheroid, CalculationType> base_type;
+
+public :
+    typedef Spheroid model_type;
+
+    inline geographic_chord_point_segment()
+        : base_type()
+    {}
+
+    explicit inline geographic_chord_point_segment(Spheroid const& spheroid)
+        : base_type(spheroid)
+    {}
+
+    template <typename Point, typename PointOfSegment>
+    inline typename base_type::template return_type<Point, PointOfSegment>::type
+    apply(Point const& p, PointOfSegment const& sp1, PointOfSegment const& sp2) const
+    {
+        return math::sqr(base_type::apply(p, sp1, sp2));
+    }
+};
+
+/*!
+\brief Squared lower bound of the length of the chord between points of
+       a segment and points of a box on the spheroid
+\ingroup strategies
+\details The distance between the geocentric bounding boxes of the parts of
+    the surface of the spheroid within the envelope of the segment and within
+    the box is returned. It is not greater than geographic_chord_point_segment
+    between the segment and any point within the box so it can be used to
+    prune the nodes of the rtree in nearest queries of segments.
+\tparam FormulaPolicy Formula used to calculate the envelope of the segment
+\tparam Spheroid The spheroid model
+\tparam CalculationType \tparam_calculation
+*/
+template
+<
+    typename FormulaPolicy = strategy::andoyer,
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_chord_segment_box
+{
+public :
+    template <typename PointOfSegment, typename PointOfBox>
+    struct calculation_type
+        : geographic_chord
+            <
+                Spheroid, CalculationType
+            >::template calculation_type<PointOfSegment, PointOfBox>
+    {};
+
+    typedef Spheroid model_type;
+
+    inline geographic_chord_segment_box()
+        : m_spheroid()
+    {}
+
+    explicit inline geographic_chord_segment_box(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    template <typename PointOfSegment, typename Box>
+    inline typename calculation_type
+        <
+            PointOfSegment, typename point_type<Box>::type
+        >::type
+    apply(PointOfSegment const& sp1, PointOfSegment const& sp2,
+          Box const& box) const
+    {
+        typedef typename calculation_type
+            <
+                PointOfSegment, typename point_type<Box>::type
+            >::type calc_t;
+
+        model::box<PointOfSegment> envelope;
+        strategy::envelope::geographic_segment
+            <
+                FormulaPolicy, Spheroid, CalculationType
+            >(m_spheroid).apply(sp1, sp2, envelope);
+
+        return detail::geographic_chord::sqr_chord_box_box(envelope, box,
+                    detail::geographic_chord::unit_spheroid<calc_t>(m_spheroid));
+    }
+
+    inline Spheroid const& model() const
+    {
+        return m_spheroid;
+    }
+
+private :
+    Spheroid m_spheroid;
+};
+
+} // namespace comparable
+
+
+/*!
+\brief Approximate distance for geographic coordinates, the length of
+       the chord between the points on the spheroid
+\ingroup strategies
+\details The points are converted to geocentric coordinates and the
+    straight-line distance between them is returned. The result is never
+    greater than the geodesic distance. The relative difference is about
+    d^2 / (24 R^2) for geodesic distance d, i.e. about 1e-5 at
+    100 km and 1e-3 at 1000 km. The comparable version is
+    strictly increasing with the chord so it can be used to compare
+    distances, e.g. to find candidates in the rtree before calculating
+    exact distances for them.
+\tparam Spheroid The spheroid model
+\tparam CalculationType \tparam_calculation
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.distance.distance_3_with_strategy distance (with strategy)]
+\* [link geometry.reference.srs.srs_spheroid srs::spheroid]
+}
+*/
+template
+<
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_chord
+{
+    typedef comparable::geographic_chord<Spheroid, CalculationType> comparable_type;
+
+public :
+    template <typename Point1, typename Point2>
+    struct calculation_type
+        : comparable_type::template calculation_type<Point1, Point2>
+    {};
+
+    typedef Spheroid model_type;
+
+    inline geographic_chord()
+        : m_spheroid()
+    {}
+
+    explicit inline geographic_chord(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    template <typename Point1, typename Point2>
+    inline typename calculation_type<Point1, Point2>::type
+    apply(Point1 const& p1, Point2 const& p2) const
+    {
+        return math::sqrt(comparable_type(m_spheroid).apply(p1, p2));
+    }
+
+    inline Spheroid const& model() const
+    {
+        return m_spheroid;
+    }
+
+private :
+    Spheroid m_spheroid;
+};
+
+/*!
+\brief Lower bound of the length of the chord between a point and points
+       of a box on the spheroid
+\ingroup strategies
+\details The distance between the point and the geocentric bounding box of
+    the part of the surface of the spheroid within the box is returned.
+    The result is not greater than geographic_chord between the point and
+    any point within the box so it can be used to prune the nodes of the
+    rtree together with geographic_chord.
+\tparam Spheroid The spheroid model
+\tparam CalculationType \tparam_calculation
+*/
+template
+<
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_chord_point_box
+{
+    typedef comparable::geographic_chord_point_box<Spheroid, CalculationType> comparable_type;
+
+public :
+    template <typename Point, typename Box>
+    struct calculation_type
+        : comparable_type::template calculation_type<Point, Box>
+    {};
+
+    typedef Spheroid model_type;
+
+    inline geographic_chord_point_box()
+        : m_spheroid()
+    {}
+
+    explicit inline geographic_chord_point_box(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+    template <typename Point, typename Box>
+    inline typename calculation_type<Point, Box>::type
+    apply(Point const& point, Box const& box) const
+    {
+        return math::sqrt(comparable_type(m_spheroid).apply(point, box));
+    }
+
+    inline Spheroid const& model() const
+    {
+        return m_spheroid;
+    }
+
+private :
+    Spheroid m_spheroid;
+};
+
+
+#ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
+namespace services
+{
+
+template <typename Spheroid, typename CalculationType>
+struct tag<geographic_chord<Spheroid, CalculationType> >
+{
+    typedef strategy_tag_distance_point_point type;
+};
+
+template <typename Spheroid, typename CalculationType, typename P1, typename P2>
+struct return_type<geographic_chord<Spheroid, CalculationType>, P1, P2>
+    : geographic_chord<Spheroid, CalculationType>::template calculation_type<P1, P2>
+{};
+
+template <typename Spheroid, typename CalculationType>
+struct comparable_type<geographic_chord<Spheroid, CalculationType> >
+{
+    typedef comparable::geographic_chord<Spheroid, CalculationType> type;
+};
+
+template <typename Spheroid, typename CalculationType>
+struct get_comparable<geographic_chord<Spheroid, CalculationType> >
+{
+    static inline comparable::geographic_chord<Spheroid, CalculationType>
+        apply(geographic_chord<Spheroid, CalculationType> const& input)
+    {
+        return comparable::geographic_chord<Spheroid, CalculationType>(input.model());
+    }
+};
+
+template <typename Spheroid, typename CalculationType, typename P1, typename P2>
+struct result_from_distance<geographic_chord<Spheroid, CalculationType>, P1, P2>
+{
+    template <typename T>
+    static inline typename return_type<geographic_chord<Spheroid, CalculationType>, P1, P2>::type
+        apply(geographic_chord<Spheroid, CalculationType> const& , T const& value)
+    {
+        return value;
+    }
+};
+
+
+template <typename Spheroid, typename CalculationType>
+struct tag<comparable::geographic_chord<Spheroid, CalculationType> >
+{
+    typedef strategy_tag_distance_point_point type;
+};
+
+template <typename Spheroid, typename CalculationType, typename P1, typename P2>
+struct return_type<comparable::geographic_chord<Spheroid, CalculationType>, P1, P2>
+    : comparable::geographic_chord<Spheroid, CalculationType>::template calculation_type<P1, P2>
+{};
+
+template <typename Spheroid, typename CalculationType>
+struct comparable_type<comparable::geographic_chord<Spheroid, CalculationType> >
+{
+    typedef comparable::geographic_chord<Spheroid, CalculationType> type;
+};
+
+template <typename Spheroid, typename CalculationType>
+struct get_comparable<comparable::geographic_chord<Spheroid, CalculationType> >
+{
+    static inline comparable::geographic_chord<Spheroid, CalculationType>
+        apply(comparable::geographic_chord<Spheroid, CalculationType> const& input)
+    {
+        return input;
+    }
+};
+
+template <typename Spheroid, typename CalculationType, typename P1, typename P2>
+struct result_from_distance<comparable::geographic_chord<Spheroid, CalculationType>, P1, P2>
+{
+    template <typename T>
+    static inline typename return_type<comparable::geographic_chord<Spheroid, CalculationType>, P1, P2>::type
+        apply(comparable::geographic_chord<Spheroid, CalculationType> const& , T const& value)
+    {
+        return value * value;
+    }
+};
+
+
+template <typename Spheroid, typename CalculationType>
+struct tag<geographic_chord_point_box<Spheroid, CalculationType> >
+{
+    typedef strategy_tag_distance_point_box type;
+};
+
+template <typename Spheroid, typename CalculationType, typename P, typename Box>
+struct return_type<geographic_chord_point_box<Spheroid, CalculationType>, P, Box>
+    : geographic_chord_point_box<Spheroid, CalculationType>::template calculation_type<P, Box>
+{};
+
+template <typename Spheroid, typename CalculationType>
+struct comparable_type<geographic_chord_point_box<Spheroid, CalculationType> >
+{
+    typedef comparable::geographic_chord_point_box<Spheroid, CalculationType> type;
+};
+
+template <typename Spheroid, typename CalculationType>
+struct get_comparable<geographic_chord_point_box<Spheroid, CalculationType> >
+{
+    static inline comparable::geographic_chord_point_box<Spheroid, CalculationType>
+        apply(geographic_chord_point_box<Spheroid, CalculationType> const& input)
+    {
+        return comparable::geographic_chord_point_box<Spheroid, CalculationType>(input.model());
+    }
+};
+
+template <typename Spheroid, typename CalculationType, typename P, typename Box>
+struct result_from_distance<geographic_chord_point_box<Spheroid, CalculationType>, P, Box>
+{
+    template <typename T>
+    static inline typename return_type<geographic_chord_point_box<Spheroid, CalculationType>, P, Box>::type
+        apply(geographic_chord_point_box<Spheroid, CalculationType> const& , T const& value)
+    {
+        return value;
+    }
+};
+
+
+template <typename Spheroid, typename CalculationType>
+struct tag<comparable::geographic_chord_point_box<Spheroid, CalculationType> >
+{
+    typedef strategy_tag_distance_point_box type;
+};
+
+template <typename Spheroid, typename CalculationType, typename P, typename Box>
+struct return_type<comparable::geographic_chord_point_box<Spheroid, CalculationType>, P, Box>
+    : comparable::geographic_chord_point_box<Spheroid, CalculationType>::template calculation_type<P, Box>
+{};
+
+template <typename Spheroid, typename CalculationType>
+struct comparable_type<comparable::geographic_chord_point_box<Spheroid, CalculationType> >
+{
+    typedef comparable::geographic_chord_point_box<Spheroid, CalculationType> type;
+};
+
+template <typename Spheroid, typename CalculationType>
+struct get_comparable<comparable::geographic_chord_point_box<Spheroid, CalculationType> >
+{
+    static inline comparable::geographic_chord_point_box<Spheroid, CalculationType>
+        apply(comparable::geographic_chord_point_box<Spheroid, CalculationType> const& input)
+    {
+        return input;
+    }
+};
+
+template <typename Spheroid, typename CalculationType, typename P, typename Box>
+struct result_from_distance<comparable::geographic_chord_point_box<Spheroid, CalculationType>, P, Box>
+{
+    template <typename T>
+    static inline typename return_type<comparable::geographic_chord_point_box<Spheroid, CalculationType>, P, Box>::type
+        apply(comparable::geographic_chord_point_box<Spheroid, CalculationType> const& , T const& value)
+    {
+        return value * value;
+    }
+};
+
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct tag<comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType> >
+{
+    typedef strategy_tag_distance_point_segment type;
+};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType, typename P, typename PS>
+struct return_type<comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType>, P, PS>
+    : comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType>::template return_type<P, PS>
+{};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct comparable_type<comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType> >
+{
+    typedef comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType> type;
+};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct get_comparable<comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType> >
+{
+    static inline comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType>
+        apply(comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType> const& input)
+    {
+        return input;
+    }
+};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType, typename P, typename PS>
+struct result_from_distance<comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType>, P, PS>
+{
+    template <typename T>
+    static inline typename return_type<comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType>, P, PS>::type
+        apply(comparable::geographic_chord_point_segment<FormulaPolicy, Spheroid, CalculationType> const& , T const& value)
+    {
+        return value * value;
+    }
+};
+
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct tag<comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType> >
+{
+    typedef strategy_tag_distance_segment_box type;
+};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType, typename PS, typename PB>
+struct return_type<comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType>, PS, PB>
+    : comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType>::template calculation_type<PS, PB>
+{};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct comparable_type<comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType> >
+{
+    typedef comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType> type;
+};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct get_comparable<comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType> >
+{
+    static inline comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType>
+        apply(comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType> const& input)
+    {
+        return input;
+    }
+};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType, typename PS, typename PB>
+struct result_from_distance<comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType>, PS, PB>
+{
+    template <typename T>
+    static inline typename return_type<comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType>, PS, PB>::type
+        apply(comparable::geographic_chord_segment_box<FormulaPolicy, Spheroid, CalculationType> const& , T const& value)
+    {
+        return value * value;
+    }
+};
+
+} // namespace services
+#endif // DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
+
+
+}} // namespace strategy::distance
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+// The segment and the box are passed to the strategy directly instead of
+// dividing the segment against the sides of the box
+template
+<
+    typename Segment, typename Box,
+    typename FormulaPolicy, typename Spheroid, typename CalculationType
+>
+struct distance
+    <
+        Segment, Box,
+        strategy::distance::comparable::geographic_chord_segment_box
+            <
+                FormulaPolicy, Spheroid, CalculationType
+            >,
+        segment_tag, box_tag, strategy_tag_distance_segment_box, false
+    >
+{
+    typedef strategy::distance::comparable::geographic_chord_segment_box
+        <
+            FormulaPolicy, Spheroid, CalculationType
+        > strategy_type;
+
+    typedef typename strategy::distance::services::return_type
+        <
+            strategy_type,
+            typename point_type<Segment>::type,
+            typename point_type<Box>::type
+        >::type return_type;
+
+    static inline return_type apply(Segment const& segment, Box const& box,
+                                    strategy_type const& strategy)
+    {
+        typename point_type<Segment>::type p[2];
+        geometry::detail::assign_point_from_index<0>(segment, p[0]);
+        geometry::detail::assign_point_from_index<1>(segment, p[1]);
+        return strategy.apply(p[0], p[1], box);
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_DISTANCE_CHORD_HPP
@@ -17,6 +17,7 @@
 
 #include <boost/geometry/strategies/geographic/distance.hpp>
 #include <boost/geometry/strategies/geographic/distance_andoyer.hpp> // backward compatibility
+#include <boost/geometry/strategies/geographic/distance_chord.hpp>
 #include <boost/geometry/strategies/geographic/distance_cross_track.hpp>
 #include <boost/geometry/strategies/geographic/distance_cross_track_point_box.hpp>
 #include <boost/geometry/strategies/geographic/distance_segment_box.hpp>
@@ -131,6 +132,77 @@ public:
 };
 
 
+/*!
+\brief R-tree strategy for geographic coordinates comparing point-point and
+       point-box distances with the chord, see distance::geographic_chord
+\details Nearest neighbors of points are found and nodes are pruned without
+    calling the inverse formula. The values are sorted by the length of the
+    chord which is never greater than the geodesic distance and differs from
+    it by a factor of about (1 + d^2 / (24 R^2)), e.g. 1e-5 at 100 km,
+    so the exact distances can be calculated for the returned values only.
+    Distances to segments are the squared geodesic distances calculated with
+    FormulaPolicy, which are not smaller than the squared chords, and the
+    nodes are pruned with the chord in queries of segments too.
+    Other predicates use FormulaPolicy as in geographic.
+*/
+template
+<
+    typename FormulaPolicy = strategy::andoyer,
+    typename Spheroid = geometry::srs::spheroid<double>,
+    typename CalculationType = void
+>
+struct geographic_chord
+    : geographic<FormulaPolicy, Spheroid, CalculationType>
+{
+    typedef geometry::strategy::distance::geographic_chord
+        <
+            Spheroid, CalculationType
+        > comparable_distance_point_point_strategy_type;
+
+    inline comparable_distance_point_point_strategy_type get_comparable_distance_point_point_strategy() const
+    {
+        return comparable_distance_point_point_strategy_type(this->m_spheroid);
+    }
+
+    typedef geometry::strategy::distance::geographic_chord_point_box
+        <
+            Spheroid, CalculationType
+        > comparable_distance_point_box_strategy_type;
+
+    inline comparable_distance_point_box_strategy_type get_comparable_distance_point_box_strategy() const
+    {
+        return comparable_distance_point_box_strategy_type(this->m_spheroid);
+    }
+
+    typedef geometry::strategy::distance::comparable::geographic_chord_point_segment
+        <
+            FormulaPolicy, Spheroid, CalculationType
+        > comparable_distance_point_segment_strategy_type;
+
+    inline comparable_distance_point_segment_strategy_type get_comparable_distance_point_segment_strategy() const
+    {
+        return comparable_distance_point_segment_strategy_type(this->m_spheroid);
+    }
+
+    typedef geometry::strategy::distance::comparable::geographic_chord_segment_box
+        <
+            FormulaPolicy, Spheroid, CalculationType
+        > comparable_distance_segment_box_strategy_type;
+
+    inline comparable_distance_segment_box_strategy_type get_comparable_distance_segment_box_strategy() const
+    {
+        return comparable_distance_segment_box_strategy_type(this->m_spheroid);
+    }
+
+    geographic_chord()
+    {}
+
+    explicit geographic_chord(Spheroid const& spheroid)
+        : geographic<FormulaPolicy, Spheroid, CalculationType>(spheroid)
+    {}
+};
+
+
 namespace services
 {
 
@@ -25,6 +25,7 @@
 #include <boost/geometry/util/select_most_precise.hpp>
 
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 
 namespace boost { namespace geometry
@@ -64,6 +65,13 @@ struct result_type<Geometry, void>
         >
 {};
 
+// Indicates if Strategy calculates the area of Geometry with a kernel over
+// all coordinates at once, see apply_contiguous of strategy cartesian
+template <typename Strategy, typename Geometry>
+struct contiguous_kernel
+    : boost::false_type
+{};
+
 } // namespace detail
 #endif // DOXYGEN_NO_DETAIL
 
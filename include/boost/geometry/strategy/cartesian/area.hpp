@@ -21,12 +21,18 @@
 #define BOOST_GEOMETRY_STRATEGY_CARTESIAN_AREA_HPP
 
 
+#include <cstddef>
+
 #include <boost/mpl/if.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
 
 //#include <boost/geometry/arithmetic/determinant.hpp>
 #include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/strategies/cartesian/detail/contiguous_kernels.hpp>
 #include <boost/geometry/strategy/area.hpp>
 #include <boost/geometry/util/select_most_precise.hpp>
 
@@ -113,6 +119,20 @@ public :
                 * (return_type(get<1>(p1)) - return_type(get<1>(p2)));
     }
 
+    // Adds the segments between count points of which the coordinates are
+    // stored contiguously, see detail::contiguous_kernel. Reversed, the
+    // segments are traversed from the last point to the first.
+    template <typename Geometry>
+    static inline void apply_contiguous(double const* coordinates,
+                                        std::size_t count,
+                                        bool reversed,
+                                        state<Geometry>& st)
+    {
+        double const sum = geometry::detail::contiguous::area_sum(coordinates,
+                                                                  count);
+        st.sum += reversed ? -sum : sum;
+    }
+
     template <typename Geometry>
     static inline typename result_type<Geometry>::type
         result(state<Geometry>& st)
@@ -122,6 +142,29 @@ public :
 
 };
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+template <typename CalculationType, typename Geometry>
+struct contiguous_kernel<cartesian<CalculationType>, Geometry>
+    : boost::integral_constant
+        <
+            bool,
+            geometry::detail::contiguous::vectorized_sums::value
+            && geometry::detail::has_contiguous_points<Geometry, double, 2>::value
+            && boost::is_same
+                <
+                    typename cartesian<CalculationType>
+                        ::template result_type<Geometry>::type,
+                    double
+                >::value
+        >
+{};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
 #ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
 
 namespace services
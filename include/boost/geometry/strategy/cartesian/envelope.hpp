@@ -21,11 +21,21 @@
 #ifndef BOOST_GEOMETRY_STRATEGY_CARTESIAN_ENVELOPE_HPP
 #define BOOST_GEOMETRY_STRATEGY_CARTESIAN_ENVELOPE_HPP
 
+#include <cstddef>
+
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 #include <boost/geometry/algorithms/detail/envelope/initialize.hpp>
 
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/contiguous_coordinates.hpp>
+
+#include <boost/geometry/strategies/cartesian/detail/contiguous_kernels.hpp>
+
+#include <boost/geometry/strategy/envelope.hpp>
+
 #include <boost/geometry/strategy/cartesian/envelope_box.hpp>
 #include <boost/geometry/strategy/cartesian/envelope_segment.hpp>
 #include <boost/geometry/strategy/cartesian/expand_box.hpp>
@@ -57,6 +67,22 @@ public:
         return boost::end(range);
     }
 
+    // Envelope of count > 0 points of which the coordinates are stored
+    // contiguously, see detail::contiguous_kernel
+    template <typename Box>
+    static inline void apply_contiguous(double const* coordinates,
+                                        std::size_t count,
+                                        Box& mbr)
+    {
+        double min_x, min_y, max_x, max_y;
+        geometry::detail::contiguous::bounds(coordinates, count,
+                                             min_x, min_y, max_x, max_y);
+        geometry::set<min_corner, 0>(mbr, min_x);
+        geometry::set<min_corner, 1>(mbr, min_y);
+        geometry::set<max_corner, 0>(mbr, max_x);
+        geometry::set<max_corner, 1>(mbr, max_y);
+    }
+
     // MultiLinestring, MultiPolygon
 
     template <typename Box>
@@ -97,6 +123,23 @@ public:
     };
 };
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// The coordinates are only compared so the calculation type does not matter
+template <typename CalculationType, typename Range>
+struct contiguous_kernel<cartesian<CalculationType>, Range>
+    : boost::integral_constant
+        <
+            bool,
+            geometry::detail::has_contiguous_points<Range, double, 2>::value
+        >
+{};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
 #ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
 
 namespace services
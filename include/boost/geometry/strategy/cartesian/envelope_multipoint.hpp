@@ -11,17 +11,28 @@
 #ifndef BOOST_GEOMETRY_STRATEGY_CARTESIAN_ENVELOPE_MULTIPOINT_HPP
 #define BOOST_GEOMETRY_STRATEGY_CARTESIAN_ENVELOPE_MULTIPOINT_HPP
 
+#include <cstddef>
+#include <vector>
+
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
+#include <boost/geometry/core/contiguous_coordinates.hpp>
 #include <boost/geometry/core/tags.hpp>
 
 #include <boost/geometry/algorithms/detail/envelope/initialize.hpp>
+#include <boost/geometry/algorithms/detail/envelope/range.hpp>
 
 #include <boost/geometry/strategy/cartesian/envelope.hpp>
 #include <boost/geometry/strategy/cartesian/envelope_point.hpp>
+#include <boost/geometry/strategy/cartesian/expand_box.hpp>
 #include <boost/geometry/strategy/cartesian/expand_point.hpp>
 
+#include <boost/geometry/util/executor.hpp>
+
 
 namespace boost { namespace geometry
 {
@@ -35,27 +46,91 @@ public:
     template <typename MultiPoint, typename Box>
     static inline void apply(MultiPoint const& multipoint, Box& mbr)
     {
-        apply(boost::begin(multipoint), boost::end(multipoint), mbr);
+        apply(multipoint, 0, boost::size(multipoint), mbr,
+              contiguous<MultiPoint>());
+    }
+
+    // The points are split into chunks of which the envelopes are
+    // calculated by the executor and merged
+    template <typename MultiPoint, typename Box, typename Executor>
+    static inline void apply(MultiPoint const& multipoint, Box& mbr,
+                             Executor const& executor)
+    {
+        std::size_t const chunk_size
+            = geometry::detail::envelope::envelope_chunk_size;
+        std::size_t const size = boost::size(multipoint);
+        if (size <= chunk_size)
+        {
+            apply(multipoint, mbr);
+            return;
+        }
+
+        std::vector<Box> boxes((size + chunk_size - 1) / chunk_size);
+        geometry::detail::for_each_chunk(executor, size, chunk_size,
+            [&](std::size_t first, std::size_t last)
+            {
+                apply(multipoint, first, last, boxes[first / chunk_size],
+                      contiguous<MultiPoint>());
+            });
+
+        mbr = boxes.front();
+        for (std::size_t i = 1; i < boxes.size(); ++i)
+        {
+            strategy::expand::cartesian_box::apply(mbr, boxes[i]);
+        }
     }
 
 private:
-    template <typename Iterator, typename Box>
-    static inline void apply(Iterator it,
-                             Iterator last,
-                             Box& mbr)
+    template <typename MultiPoint>
+    struct contiguous
+        : boost::integral_constant
+            <
+                bool,
+                geometry::detail::has_contiguous_points
+                    <
+                        MultiPoint, double, 2
+                    >::value
+            >
+    {};
+
+    // Envelope of the points [first, last)
+    template <typename MultiPoint, typename Box>
+    static inline void apply(MultiPoint const& multipoint,
+                             std::size_t first, std::size_t last,
+                             Box& mbr, boost::false_type)
     {
         geometry::detail::envelope::initialize<Box, 0, dimension<Box>::value>::apply(mbr);
 
-        if (it != last)
+        typename boost::range_iterator<MultiPoint const>::type
+            it = boost::begin(multipoint) + first;
+        typename boost::range_iterator<MultiPoint const>::type const
+            end = boost::begin(multipoint) + last;
+        if (it != end)
         {
             strategy::envelope::cartesian_point::apply(*it, mbr);
 
-            for (++it; it != last; ++it)
+            for (++it; it != end; ++it)
             {
                 strategy::expand::cartesian_point::apply(mbr, *it);
             }
         }
     }
+
+    template <typename MultiPoint, typename Box>
+    static inline void apply(MultiPoint const& multipoint,
+                             std::size_t first, std::size_t last,
+                             Box& mbr, boost::true_type)
+    {
+        if (first == last)
+        {
+            geometry::detail::envelope::initialize<Box, 0, dimension<Box>::value>::apply(mbr);
+            return;
+        }
+
+        strategy::envelope::cartesian<>::apply_contiguous(
+            geometry::detail::coordinates_begin<double>(multipoint) + 2 * first,
+            last - first, mbr);
+    }
 };
 
 
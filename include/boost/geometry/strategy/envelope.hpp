@@ -12,6 +12,7 @@
 #define BOOST_GEOMETRY_STRATEGY_ENVELOPE_HPP
 
 #include <boost/mpl/assert.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 
 namespace boost { namespace geometry
 {
@@ -40,6 +41,21 @@ struct default_strategy
 }}} // namespace strategy::envelope::services
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace strategy { namespace envelope { namespace detail
+{
+
+// Indicates if Strategy calculates the envelope of Range with a kernel over
+// all coordinates at once, see apply_contiguous of strategy cartesian
+template <typename Strategy, typename Range>
+struct contiguous_kernel
+    : boost::false_type
+{};
+
+}}} // namespace strategy::envelope::detail
+#endif // DOXYGEN_NO_DETAIL
+
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_STRATEGY_ENVELOPE_HPP
@@ -17,8 +17,7 @@
 #include <boost/geometry/srs/spheroid.hpp>
 
 #include <boost/geometry/formulas/area_formulas.hpp>
-#include <boost/geometry/formulas/authalic_radius_sqr.hpp>
-#include <boost/geometry/formulas/eccentricity_sqr.hpp>
+#include <boost/geometry/formulas/spheroid_coefficients.hpp>
 
 #include <boost/geometry/strategy/area.hpp>
 #include <boost/geometry/strategies/geographic/parameters.hpp>
@@ -77,31 +76,22 @@ public:
 
 protected :
     struct spheroid_constants
-    {
-        typedef typename boost::mpl::if_c
+        : formula::spheroid_coefficients
             <
-                boost::is_void<CalculationType>::value,
-                typename geometry::radius_type<Spheroid>::type,
-                CalculationType
-            >::type calc_t;
-
+                typename boost::mpl::if_c
+                    <
+                        boost::is_void<CalculationType>::value,
+                        typename geometry::radius_type<Spheroid>::type,
+                        CalculationType
+                    >::type,
+                SeriesOrder
+            >
+    {
         Spheroid m_spheroid;
-        calc_t const m_a2;  // squared equatorial radius
-        calc_t const m_e2;  // squared eccentricity
-        calc_t const m_ep2; // squared second eccentricity
-        calc_t const m_ep;  // second eccentricity
-        calc_t const m_c2;  // squared authalic radius
 
         inline spheroid_constants(Spheroid const& spheroid)
-            : m_spheroid(spheroid)
-            , m_a2(math::sqr(get_radius<0>(spheroid)))
-            , m_e2(formula::eccentricity_sqr<calc_t>(spheroid))
-            , m_ep2(m_e2 / (calc_t(1.0) - m_e2))
-            , m_ep(math::sqrt(m_ep2))
-            , m_c2(formula_dispatch::authalic_radius_sqr
-                    <
-                        calc_t, Spheroid, srs_spheroid_tag
-                    >::apply(m_a2, m_e2))
+            : spheroid_constants::spheroid_coefficients(spheroid)
+            , m_spheroid(spheroid)
         {}
     };
 
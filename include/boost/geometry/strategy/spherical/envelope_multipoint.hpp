@@ -20,6 +20,7 @@
 
 #include <boost/algorithm/minmax_element.hpp>
 #include <boost/range.hpp>
+#include <boost/range/iterator_range.hpp>
 
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/assert.hpp>
@@ -27,6 +28,7 @@
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/tags.hpp>
 
+#include <boost/geometry/util/executor.hpp>
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/range.hpp>
 
@@ -58,8 +60,7 @@ private:
         template <typename Point>
         inline bool operator()(Point const& point1, Point const& point2) const
         {
-            return math::smaller(geometry::get<Dim>(point1),
-                                 geometry::get<Dim>(point2));
+            return geometry::get<Dim>(point1) < geometry::get<Dim>(point2);
         }
     };
 
@@ -170,18 +171,34 @@ private:
         {
             std::sort(boost::begin(range), boost::end(range), lon_less);
 
-            CoordinateType max_gap_left = 0, max_gap_right = 0;
-            CoordinateType max_gap
-                = maximum_gap(range, max_gap_left, max_gap_right);
+            apply_maximum_gap<Constants>(range, lon_min, lon_max);
+        }
+    }
 
-            CoordinateType complement_gap
-                = Constants::period() + lon_min - lon_max;
+    // Replaces the interval [lon_min, lon_max] of the points by the
+    // complement of the maximum gap between their sorted longitudes, if
+    // that gap is larger than the gap across the antimeridian
+    template
+    <
+        typename Constants,
+        typename SortedRange,
+        typename CoordinateType
+    >
+    static inline void apply_maximum_gap(SortedRange const& sorted_range,
+                                         CoordinateType& lon_min,
+                                         CoordinateType& lon_max)
+    {
+        CoordinateType max_gap_left = 0, max_gap_right = 0;
+        CoordinateType max_gap
+            = maximum_gap(sorted_range, max_gap_left, max_gap_right);
 
-            if (math::larger(max_gap, complement_gap))
-            {
-                lon_min = max_gap_right;
-                lon_max = max_gap_left + Constants::period();
-            }
+        CoordinateType complement_gap
+            = Constants::period() + lon_min - lon_max;
+
+        if (math::larger(max_gap, complement_gap))
+        {
+            lon_min = max_gap_right;
+            lon_max = max_gap_left + Constants::period();
         }
     }
 
@@ -227,80 +244,49 @@ private:
         }
     }
 
-public:
-    template <typename MultiPoint, typename Box>
-    static inline void apply(MultiPoint const& multipoint, Box& mbr)
+    // The bounds of the points, which are not poles, and the poles
+    template <typename Constants, typename Points, typename CoordinateType>
+    static inline void get_min_max(Points& points,
+                                   bool has_south_pole,
+                                   bool has_north_pole,
+                                   CoordinateType& lon_min,
+                                   CoordinateType& lat_min,
+                                   CoordinateType& lon_max,
+                                   CoordinateType& lat_max)
     {
-        typedef typename point_type<MultiPoint>::type point_type;
-        typedef typename coordinate_type<MultiPoint>::type coordinate_type;
-        typedef typename boost::range_iterator
-            <
-                MultiPoint const
-            >::type iterator_type;
-
-        typedef math::detail::constants_on_spheroid
-            <
-                coordinate_type,
-                typename geometry::detail::cs_angular_units<MultiPoint>::type
-            > constants;
-
-        if (boost::empty(multipoint))
-        {
-            geometry::detail::envelope::initialize<Box, 0, dimension<Box>::value>::apply(mbr);
-            return;
-        }
-
-        geometry::detail::envelope::initialize<Box, 0, 2>::apply(mbr);
-
-        if (boost::size(multipoint) == 1)
-        {
-            spherical_point::apply(range::front(multipoint), mbr);
-            return;
-        }
-
-        // analyze the points and put the non-pole ones in the
-        // points vector
-        std::vector<point_type> points;
-        bool has_north_pole = false, has_south_pole = false;
-
-        analyze_point_coordinates<constants>(multipoint,
-                                             has_south_pole, has_north_pole,
-                                             std::back_inserter(points));
-
-        coordinate_type lon_min, lat_min, lon_max, lat_max;
         if (points.size() == 1)
         {
             // we have one non-pole point and at least one pole point
             lon_min = geometry::get<0>(range::front(points));
             lon_max = geometry::get<0>(range::front(points));
             lat_min = has_south_pole
-                ? constants::min_latitude()
-                : constants::max_latitude();
+                ? Constants::min_latitude()
+                : Constants::max_latitude();
             lat_max = has_north_pole
-                ? constants::max_latitude()
-                : constants::min_latitude();
+                ? Constants::max_latitude()
+                : Constants::min_latitude();
         }
         else if (points.empty())
         {
             // all points are pole points
             BOOST_GEOMETRY_ASSERT(has_south_pole || has_north_pole);
-            lon_min = coordinate_type(0);
-            lon_max = coordinate_type(0);
+            lon_min = CoordinateType(0);
+            lon_max = CoordinateType(0);
             lat_min = has_south_pole
-                ? constants::min_latitude()
-                : constants::max_latitude();
+                ? Constants::min_latitude()
+                : Constants::max_latitude();
             lat_max = (has_north_pole)
-                ? constants::max_latitude()
-                : constants::min_latitude();
+                ? Constants::max_latitude()
+                : Constants::min_latitude();
         }
         else
         {
-            get_min_max_longitudes<constants>(points,
+            get_min_max_longitudes<Constants>(points,
                                               coordinate_less<0>(),
                                               lon_min,
                                               lon_max);
 
-            get_min_max_latitudes<constants>(points.begin(),
+            get_min_max_latitudes<Constants>(points.begin(),
                                              points.end(),
                                              coordinate_less<1>(),
                                              has_south_pole,
@@ -308,11 +294,25 @@ public:
                                              lat_min,
                                              lat_max);
         }
+    }
+
+    template <typename MultiPoint, typename CoordinateType, typename Box>
+    static inline void assign_box(MultiPoint const& multipoint,
+                                  CoordinateType const& lon_min,
+                                  CoordinateType const& lat_min,
+                                  CoordinateType const& lon_max,
+                                  CoordinateType const& lat_max,
+                                  Box& mbr)
+    {
+        typedef typename boost::range_iterator
+            <
+                MultiPoint const
+            >::type iterator_type;
 
         typedef typename helper_geometry
             <
                 Box,
-                coordinate_type,
+                CoordinateType,
                 typename geometry::detail::cs_angular_units<MultiPoint>::type
             >::type helper_box_type;
 
@@ -339,6 +339,235 @@ public:
                 >::apply(mbr, *it);
         }
     }
+
+    // The points of a chunk of a multipoint which are not poles, and the
+    // bounds of their coordinates
+    template <typename Point>
+    struct chunk_state
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        template <typename Constants, typename Range>
+        inline void apply(Range const& range)
+        {
+            has_south_pole = false;
+            has_north_pole = false;
+            analyze_point_coordinates<Constants>(range,
+                                                 has_south_pole, has_north_pole,
+                                                 std::back_inserter(points));
+            if (! points.empty())
+            {
+                typedef typename std::vector<Point>::const_iterator iterator;
+                std::pair<iterator, iterator> const lon
+                    = boost::minmax_element(points.begin(), points.end(),
+                                            coordinate_less<0>());
+                std::pair<iterator, iterator> const lat
+                    = boost::minmax_element(points.begin(), points.end(),
+                                            coordinate_less<1>());
+                lon_min = geometry::get<0>(*lon.first);
+                lon_max = geometry::get<0>(*lon.second);
+                lat_min = geometry::get<1>(*lat.first);
+                lat_max = geometry::get<1>(*lat.second);
+            }
+        }
+
+        std::vector<Point> points;
+        bool has_south_pole;
+        bool has_north_pole;
+        coordinate_type lon_min, lon_max, lat_min, lat_max;
+    };
+
+public:
+    template <typename MultiPoint, typename Box>
+    static inline void apply(MultiPoint const& multipoint, Box& mbr)
+    {
+        typedef typename point_type<MultiPoint>::type point_type;
+        typedef typename coordinate_type<MultiPoint>::type coordinate_type;
+
+        typedef math::detail::constants_on_spheroid
+            <
+                coordinate_type,
+                typename geometry::detail::cs_angular_units<MultiPoint>::type
+            > constants;
+
+        if (boost::empty(multipoint))
+        {
+            geometry::detail::envelope::initialize<Box, 0, dimension<Box>::value>::apply(mbr);
+            return;
+        }
+
+        geometry::detail::envelope::initialize<Box, 0, 2>::apply(mbr);
+
+        if (boost::size(multipoint) == 1)
+        {
+            spherical_point::apply(range::front(multipoint), mbr);
+            return;
+        }
+
+        // analyze the points and put the non-pole ones in the
+        // points vector
+        std::vector<point_type> points;
+        bool has_north_pole = false, has_south_pole = false;
+
+        analyze_point_coordinates<constants>(multipoint,
+                                             has_south_pole, has_north_pole,
+                                             std::back_inserter(points));
+
+        coordinate_type lon_min, lat_min, lon_max, lat_max;
+        get_min_max<constants>(points, has_south_pole, has_north_pole,
+                               lon_min, lat_min, lon_max, lat_max);
+
+        assign_box(multipoint, lon_min, lat_min, lon_max, lat_max, mbr);
+    }
+
+    // The points are analyzed in chunks by the executor. If the longitudes
+    // span more than half of the period the chunks are sorted by the
+    // executor and merged to find the maximum gap, like apply() does.
+    template <typename MultiPoint, typename Box, typename Executor>
+    static inline void apply(MultiPoint const& multipoint, Box& mbr,
+                             Executor const& executor)
+    {
+        typedef typename point_type<MultiPoint>::type point_type;
+        typedef typename coordinate_type<MultiPoint>::type coordinate_type;
+        typedef typename boost::range_iterator
+            <
+                MultiPoint const
+            >::type iterator_type;
+
+        typedef math::detail::constants_on_spheroid
+            <
+                coordinate_type,
+                typename geometry::detail::cs_angular_units<MultiPoint>::type
+            > constants;
+
+        std::size_t const chunk_size
+            = geometry::detail::envelope::envelope_chunk_size;
+        std::size_t const size = boost::size(multipoint);
+        if (size <= chunk_size)
+        {
+            apply(multipoint, mbr);
+            return;
+        }
+
+        geometry::detail::envelope::initialize<Box, 0, 2>::apply(mbr);
+
+        std::vector<chunk_state<point_type> >
+            chunks((size + chunk_size - 1) / chunk_size);
+        geometry::detail::for_each_chunk(executor, size, chunk_size,
+            [&](std::size_t first, std::size_t last)
+            {
+                iterator_type const begin = boost::begin(multipoint);
+                chunks[first / chunk_size].template apply<constants>(
+                    boost::make_iterator_range(begin + first, begin + last));
+            });
+
+        bool has_north_pole = false, has_south_pole = false;
+        std::size_t count = 0;
+        coordinate_type lon_min = 0, lat_min = 0, lon_max = 0, lat_max = 0;
+        for (std::size_t i = 0; i < chunks.size(); ++i)
+        {
+            chunk_state<point_type> const& chunk = chunks[i];
+            has_south_pole = has_south_pole || chunk.has_south_pole;
+            has_north_pole = has_north_pole || chunk.has_north_pole;
+            if (chunk.points.empty())
+            {
+                continue;
+            }
+
+            if (count == 0 || chunk.lon_min < lon_min)
+            {
+                lon_min = chunk.lon_min;
+            }
+            if (count == 0 || chunk.lon_max > lon_max)
+            {
+                lon_max = chunk.lon_max;
+            }
+            if (count == 0 || chunk.lat_min < lat_min)
+            {
+                lat_min = chunk.lat_min;
+            }
+            if (count == 0 || chunk.lat_max > lat_max)
+            {
+                lat_max = chunk.lat_max;
+            }
+            count += chunk.points.size();
+        }
+
+        if (count <= 1)
+        {
+            // at most one point is not a pole
+            std::vector<point_type> points;
+            for (std::size_t i = 0; i < chunks.size(); ++i)
+            {
+                points.insert(points.end(), chunks[i].points.begin(),
+                              chunks[i].points.end());
+            }
+            get_min_max<constants>(points, has_south_pole, has_north_pole,
+                                   lon_min, lat_min, lon_max, lat_max);
+            assign_box(multipoint, lon_min, lat_min, lon_max, lat_max, mbr);
+            return;
+        }
+
+        if (math::larger(lon_max - lon_min, constants::half_period()))
+        {
+            // the chunks are sorted, and merged pairwise in rounds
+            std::vector<point_type> sorted;
+            std::vector<std::size_t> bounds(1, 0);
+            sorted.reserve(count);
+            for (std::size_t i = 0; i < chunks.size(); ++i)
+            {
+                if (! chunks[i].points.empty())
+                {
+                    sorted.insert(sorted.end(), chunks[i].points.begin(),
+                                  chunks[i].points.end());
+                    bounds.push_back(sorted.size());
+                }
+                std::vector<point_type>().swap(chunks[i].points);
+            }
+
+            executor(bounds.size() - 1, [&](std::size_t i)
+            {
+                std::sort(sorted.begin() + bounds[i],
+                          sorted.begin() + bounds[i + 1],
+                          coordinate_less<0>());
+            });
+
+            while (bounds.size() > 2)
+            {
+                executor((bounds.size() - 1) / 2, [&](std::size_t i)
+                {
+                    std::inplace_merge(sorted.begin() + bounds[2 * i],
+                                       sorted.begin() + bounds[2 * i + 1],
+                                       sorted.begin() + bounds[2 * i + 2],
+                                       coordinate_less<0>());
+                });
+
+                std::vector<std::size_t> merged;
+                for (std::size_t i = 0; i < bounds.size(); i += 2)
+                {
+                    merged.push_back(bounds[i]);
+                }
+                if (merged.back() != bounds.back())
+                {
+                    merged.push_back(bounds.back());
+                }
+                bounds.swap(merged);
+            }
+
+            apply_maximum_gap<constants>(sorted, lon_min, lon_max);
+        }
+
+        if (has_south_pole)
+        {
+            lat_min = constants::min_latitude();
+        }
+        if (has_north_pole)
+        {
+            lat_max = constants::max_latitude();
+        }
+
+        assign_box(multipoint, lon_min, lat_min, lon_max, lat_max, mbr);
+    }
 };
 
 
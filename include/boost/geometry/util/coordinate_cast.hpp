@@ -14,9 +14,18 @@
 #ifndef BOOST_GEOMETRY_UTIL_COORDINATE_CAST_HPP
 #define BOOST_GEOMETRY_UTIL_COORDINATE_CAST_HPP
 
+#include <algorithm>
+#include <cerrno>
+#include <cfloat>
+#include <clocale>
+#include <cstddef>
 #include <cstdlib>
+#include <limits>
 #include <string>
+
+#include <boost/cstdint.hpp>
 #include <boost/lexical_cast.hpp>
+#include <boost/type_traits/conditional.hpp>
 
 namespace boost { namespace geometry
 {
@@ -45,6 +54,293 @@ struct coordinate_cast
 };
 
 
+namespace coordinate_parser_detail
+{
+
+inline bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// strtod() respects LC_NUMERIC so it can only be used if the decimal point
+// of the current C locale is '.'
+inline bool is_c_decimal_point()
+{
+    std::lconv const* lc = std::localeconv();
+    return lc != 0 && lc->decimal_point != 0
+        && lc->decimal_point[0] == '.' && lc->decimal_point[1] == '\0';
+}
+
+template <typename T>
+struct float_traits {};
+
+template <>
+struct float_traits<double>
+{
+    static const boost::uint64_t max_mantissa = boost::uint64_t(1) << 53;
+    static const int max_exponent = 22;
+
+    static inline double apply(const char* str)
+    {
+        return std::strtod(str, 0);
+    }
+};
+
+template <>
+struct float_traits<float>
+{
+    static const boost::uint64_t max_mantissa = boost::uint64_t(1) << 24;
+    static const int max_exponent = 10;
+
+    static inline float apply(const char* str)
+    {
+        return std::strtof(str, 0);
+    }
+};
+
+// Powers of 10 exactly representable in double
+inline double power_of_ten(int i)
+{
+    static const double powers[] =
+    {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    return powers[i];
+}
+
+} // namespace coordinate_parser_detail
+
+
+/*!
+\brief parse a coordinate from a range of characters
+\detail By default a std::string is created and passed to coordinate_cast.
+    For fundamental types the characters are parsed directly, without
+    allocations. Anything not looking like a plain decimal number is
+    passed to coordinate_cast so the result (or the exception) is the same.
+*/
+template <typename CoordinateType>
+struct coordinate_parser
+{
+    static inline CoordinateType apply(const char* first, const char* last)
+    {
+        return coordinate_cast<CoordinateType>::apply(std::string(first, last));
+    }
+};
+
+// Decimal numbers with at most 19 significant digits are converted with
+// one exact multiplication or division if both the mantissa and the power
+// of 10 are exactly representable (Clinger's fast path), which gives the
+// correctly rounded result. Other numbers are converted with strtod/strtof,
+// which are correctly rounded as well.
+template <typename T>
+struct float_coordinate_parser
+{
+    static inline T apply(const char* first, const char* last)
+    {
+        typedef coordinate_parser_detail::float_traits<T> traits;
+        using coordinate_parser_detail::is_digit;
+
+        const char* it = first;
+        bool const negative = it != last && *it == '-';
+        if (negative)
+        {
+            ++it;
+        }
+
+        boost::uint64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+        bool truncated = false;
+
+        const char* const int_first = it;
+        for ( ; it != last && is_digit(*it) ; ++it)
+        {
+            if (digits < 19)
+            {
+                mantissa = mantissa * 10 + boost::uint64_t(*it - '0');
+                digits += mantissa > 0 ? 1 : 0;
+            }
+            else
+            {
+                truncated = truncated || *it != '0';
+                ++exponent;
+            }
+        }
+
+        if (it == int_first)
+        {
+            return fallback(first, last);
+        }
+
+        if (it != last && *it == '.')
+        {
+            const char* const frac_first = ++it;
+            for ( ; it != last && is_digit(*it) ; ++it)
+            {
+                if (digits < 19)
+                {
+                    mantissa = mantissa * 10 + boost::uint64_t(*it - '0');
+                    digits += mantissa > 0 ? 1 : 0;
+                    --exponent;
+                }
+                else
+                {
+                    truncated = truncated || *it != '0';
+                }
+            }
+
+            if (it == frac_first)
+            {
+                return fallback(first, last);
+            }
+        }
+
+        if (it != last && (*it == 'e' || *it == 'E'))
+        {
+            ++it;
+            bool const negative_exponent = it != last && *it == '-';
+            if (it != last && (*it == '-' || *it == '+'))
+            {
+                ++it;
+            }
+
+            const char* const exp_first = it;
+            int e = 0;
+            for ( ; it != last && is_digit(*it) ; ++it)
+            {
+                if (e < 100000)
+                {
+                    e = e * 10 + (*it - '0');
+                }
+            }
+
+            if (it == exp_first)
+            {
+                return fallback(first, last);
+            }
+
+            exponent += negative_exponent ? -e : e;
+        }
+
+        if (it != last)
+        {
+            return fallback(first, last);
+        }
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+        // Intermediate results may be rounded twice
+        truncated = true;
+#endif
+
+        if (! truncated
+            && mantissa <= traits::max_mantissa
+            && exponent >= -traits::max_exponent
+            && exponent <= traits::max_exponent)
+        {
+            T result = static_cast<T>(mantissa);
+            if (exponent < 0)
+            {
+                result /= static_cast<T>(coordinate_parser_detail::power_of_ten(-exponent));
+            }
+            else if (exponent > 0)
+            {
+                result *= static_cast<T>(coordinate_parser_detail::power_of_ten(exponent));
+            }
+            return negative ? -result : result;
+        }
+
+        return convert(first, last);
+    }
+
+private:
+    static inline T convert(const char* first, const char* last)
+    {
+        char buffer[64];
+        std::size_t const size = static_cast<std::size_t>(last - first);
+        if (size < sizeof(buffer) && coordinate_parser_detail::is_c_decimal_point())
+        {
+            std::copy(first, last, buffer);
+            buffer[size] = '\0';
+
+            errno = 0;
+            T const result = coordinate_parser_detail::float_traits<T>::apply(buffer);
+            if (errno != ERANGE)
+            {
+                return result;
+            }
+        }
+        // Also for values out of range, so they're handled as before
+        return fallback(first, last);
+    }
+
+    static inline T fallback(const char* first, const char* last)
+    {
+        return coordinate_cast<T>::apply(std::string(first, last));
+    }
+};
+
+// Optional '-' (for signed types) followed by digits, in range
+template <typename T>
+struct integer_coordinate_parser
+{
+    static inline T apply(const char* first, const char* last)
+    {
+        typedef typename boost::conditional
+            <
+                std::numeric_limits<T>::is_signed, boost::intmax_t, boost::uintmax_t
+            >::type wide_type;
+
+        const char* it = first;
+        bool const negative = std::numeric_limits<T>::is_signed
+                           && it != last && *it == '-';
+        if (negative)
+        {
+            ++it;
+        }
+
+        if (it == last || last - it > std::numeric_limits<T>::digits10)
+        {
+            return fallback(first, last);
+        }
+
+        // At most digits10 digits so there is no overflow of wide_type
+        wide_type result = 0;
+        for ( ; it != last ; ++it)
+        {
+            if (! coordinate_parser_detail::is_digit(*it))
+            {
+                return fallback(first, last);
+            }
+            result = result * 10 + wide_type(*it - '0');
+        }
+
+        return static_cast<T>(negative ? -result : result);
+    }
+
+private:
+    static inline T fallback(const char* first, const char* last)
+    {
+        return coordinate_cast<T>::apply(std::string(first, last));
+    }
+};
+
+template <> struct coordinate_parser<float> : float_coordinate_parser<float> {};
+template <> struct coordinate_parser<double> : float_coordinate_parser<double> {};
+
+template <> struct coordinate_parser<short> : integer_coordinate_parser<short> {};
+template <> struct coordinate_parser<int> : integer_coordinate_parser<int> {};
+template <> struct coordinate_parser<long> : integer_coordinate_parser<long> {};
+template <> struct coordinate_parser<unsigned short> : integer_coordinate_parser<unsigned short> {};
+template <> struct coordinate_parser<unsigned int> : integer_coordinate_parser<unsigned int> {};
+template <> struct coordinate_parser<unsigned long> : integer_coordinate_parser<unsigned long> {};
+
+#if defined(BOOST_HAS_LONG_LONG)
+template <> struct coordinate_parser<boost::long_long_type> : integer_coordinate_parser<boost::long_long_type> {};
+template <> struct coordinate_parser<boost::ulong_long_type> : integer_coordinate_parser<boost::ulong_long_type> {};
+#endif
+
+
 } // namespace detail
 #endif
 
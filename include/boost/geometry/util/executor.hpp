@@ -0,0 +1,219 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_UTIL_EXECUTOR_HPP
+#define BOOST_GEOMETRY_UTIL_EXECUTOR_HPP
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Executor calling all tasks one after another in the calling thread.
+\details An executor is a function object called with the number of tasks
+    and a task function object. It has to call the task for every index
+    in [0, count) and return after all of the calls are finished. The tasks
+    may be called concurrently so they must not modify shared state without
+    synchronization. Algorithms having a parallel mode take an executor
+    so the caller decides how and where the work is run.
+*/
+struct sequential_executor
+{
+    template <typename Task>
+    inline void operator()(std::size_t count, Task const& task) const
+    {
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            task(i);
+        }
+    }
+};
+
+
+/*!
+\brief Executor running tasks in std::threads created for each call.
+\details At most threads_count() threads (including the calling thread) are
+    used. The tasks are distributed dynamically. If any of the tasks throws
+    the remaining ones are not started and the first exception is rethrown
+    in the calling thread. If threads can not be created, the tasks are
+    done by the threads already running.
+*/
+class thread_executor
+{
+public:
+    //! Use std::thread::hardware_concurrency() threads if threads is 0
+    explicit inline thread_executor(std::size_t threads = 0)
+        : m_threads(threads > 0 ? threads : std::thread::hardware_concurrency())
+    {
+        if (m_threads == 0)
+        {
+            m_threads = 1;
+        }
+    }
+
+    inline std::size_t threads_count() const
+    {
+        return m_threads;
+    }
+
+    template <typename Task>
+    inline void operator()(std::size_t count, Task const& task) const
+    {
+        std::size_t const threads = (std::min)(m_threads, count);
+        if (threads <= 1)
+        {
+            sequential_executor()(count, task);
+            return;
+        }
+
+        std::atomic<std::size_t> next(0);
+        std::atomic<bool> failed(false);
+        std::exception_ptr exception;
+        std::mutex exception_mutex;
+
+        auto worker = [&]()
+        {
+            for (;;)
+            {
+                std::size_t const i = next++;
+                if (i >= count || failed)
+                {
+                    return;
+                }
+
+                try
+                {
+                    task(i);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(exception_mutex);
+                    if (! exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                    failed = true;
+                    return;
+                }
+            }
+        };
+
+        // If a thread can not be created, the threads already started and
+        // the calling thread do the remaining tasks
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (std::size_t i = 1 ; i < threads ; ++i)
+        {
+            try
+            {
+                pool.emplace_back(worker);
+            }
+            catch (std::system_error const& )
+            {
+                break;
+            }
+        }
+
+        worker();
+
+        for (std::thread & t : pool)
+        {
+            t.join();
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+private:
+    std::size_t m_threads;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Splits [0, size) into chunks of at most chunk_size elements and calls
+// function(first, last) for each of them using the executor.
+template <typename Executor, typename Function>
+inline void for_each_chunk(Executor const& executor,
+                           std::size_t size, std::size_t chunk_size,
+                           Function const& function)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    if (chunk_size == 0)
+    {
+        chunk_size = size;
+    }
+
+    std::size_t const count = (size + chunk_size - 1) / chunk_size;
+
+    executor(count, [&](std::size_t i)
+    {
+        std::size_t const first = i * chunk_size;
+        std::size_t const last = (std::min)(first + chunk_size, size);
+        function(first, last);
+    });
+}
+
+// Splits each of the ranges [0, sizes[r]) into chunks of at most chunk_size
+// elements and calls function(r, first, last) for each of them using the
+// executor. Small ranges are not merged so every call handles one range.
+template <typename Executor, typename Function>
+inline void for_each_chunk_of_ranges(Executor const& executor,
+                                     std::vector<std::size_t> const& sizes,
+                                     std::size_t chunk_size,
+                                     Function const& function)
+{
+    if (chunk_size == 0)
+    {
+        chunk_size = 1;
+    }
+
+    std::vector<std::pair<std::size_t, std::size_t> > chunks;
+    for (std::size_t r = 0 ; r < sizes.size() ; ++r)
+    {
+        for (std::size_t first = 0 ; first < sizes[r] ; first += chunk_size)
+        {
+            chunks.push_back(std::make_pair(r, first));
+        }
+    }
+
+    executor(chunks.size(), [&](std::size_t i)
+    {
+        std::size_t const r = chunks[i].first;
+        std::size_t const first = chunks[i].second;
+        std::size_t const last = (std::min)(first + chunk_size, sizes[r]);
+        function(r, first, last);
+    });
+}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_UTIL_EXECUTOR_HPP
@@ -199,6 +199,36 @@ inline void resize(Range & rng,
 }
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail {
+
+template <typename Range, typename Size>
+inline auto reserve_impl(Range & rng, Size n, int)
+    -> decltype(rng.reserve(n), void())
+{
+    rng.reserve(n);
+}
+
+template <typename Range, typename Size>
+inline void reserve_impl(Range &, Size, long)
+{}
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+/*!
+\brief Short utility to reserve memory for the elements of a mutable range.
+       It calls the member function reserve() if the range has one
+       and does nothing otherwise.
+\ingroup utility
+*/
+template <typename Range>
+inline void reserve(Range & rng,
+                    typename boost::range_size<Range>::type n)
+{
+    detail::reserve_impl(rng, n, 0);
+}
+
 /*!
 \brief Short utility to conveniently remove an element from the back of a mutable range.
        It uses resize().
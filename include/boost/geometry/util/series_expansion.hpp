@@ -736,6 +736,11 @@ namespace boost { namespace geometry { namespace series_expansion {
 
             evaluate_coeffs_C3(*this, coeffs_C3x, epsilon);
         }
+
+        coeffs_C3(coeffs_C3x<SeriesOrder, CT> const& c3x, CT const& epsilon)
+        {
+            evaluate_coeffs_C3(*this, c3x, epsilon);
+        }
     };
 
     template <size_t SeriesOrder, typename CT>
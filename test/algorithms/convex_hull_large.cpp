@@ -0,0 +1,223 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/incremental_convex_hull.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::ring<point_type, false, false> ring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+double cross(point_type const& o, point_type const& a, point_type const& b)
+{
+    return (bg::get<0>(a) - bg::get<0>(o)) * (bg::get<1>(b) - bg::get<1>(o))
+         - (bg::get<1>(a) - bg::get<1>(o)) * (bg::get<0>(b) - bg::get<0>(o));
+}
+
+// Monotone chain without any filtering, counterclockwise and open, the
+// coordinates are small integers so the cross products are exact
+template <typename Range>
+ring_type brute_force_hull(Range const& range)
+{
+    std::vector<point_type> points(boost::begin(range), boost::end(range));
+    std::sort(points.begin(), points.end(), bg::less<point_type>());
+
+    ring_type hull;
+    for (int pass = 0 ; pass < 2 ; ++pass)
+    {
+        std::size_t const start = hull.size();
+        for (std::size_t i = 0 ; i < points.size() ; ++i)
+        {
+            while (hull.size() >= start + 2
+                && cross(hull[hull.size() - 2], hull.back(), points[i]) <= 0)
+            {
+                hull.pop_back();
+            }
+            hull.push_back(points[i]);
+        }
+        hull.pop_back();
+        std::reverse(points.begin(), points.end());
+    }
+    return hull;
+}
+
+// Compares the vertices, the first vertices of both hulls may differ
+template <typename Hull>
+void check_hull(Hull const& hull, ring_type const& expected,
+                std::string const& caseid)
+{
+    ring_type vertices(boost::begin(hull), boost::end(hull));
+    bool same = vertices.size() == expected.size();
+    if (same && ! vertices.empty())
+    {
+        std::rotate(vertices.begin(),
+                    std::min_element(vertices.begin(), vertices.end(),
+                                     bg::less<point_type>()),
+                    vertices.end());
+        same = std::equal(vertices.begin(), vertices.end(), expected.begin(),
+                          [](point_type const& p, point_type const& q)
+                          {
+                              return bg::equals(p, q);
+                          });
+    }
+    BOOST_CHECK_MESSAGE(same, caseid << " " << bg::wkt(vertices)
+                        << " expected " << bg::wkt(expected));
+}
+
+// Points of a grid in a disk, many interior points and many points on
+// the boundary of the filtering rectangle and of the hull
+multi_point_type make_disk(int radius, std::size_t repeat)
+{
+    multi_point_type result;
+    for (std::size_t r = 0 ; r < repeat ; ++r)
+    {
+        for (int x = -radius ; x <= radius ; ++x)
+        {
+            for (int y = -radius ; y <= radius ; ++y)
+            {
+                if (x * x + y * y <= radius * radius)
+                {
+                    result.push_back(point_type((x * 7 + y * 3 + int(r)) % 11 == 0 ? y : x,
+                                                (x * 7 + y * 3 + int(r)) % 11 == 0 ? x : y));
+                }
+            }
+        }
+    }
+    return result;
+}
+
+// Pseudo-random points of a triangle, the axis-aligned rectangle in the
+// octagon is small
+multi_point_type make_triangle(std::size_t count)
+{
+    multi_point_type result;
+    unsigned int seed = 12345;
+    while (result.size() < count)
+    {
+        seed = seed * 1103515245u + 12345u;
+        int const x = int((seed >> 8) % 2001);
+        seed = seed * 1103515245u + 12345u;
+        int const y = int((seed >> 8) % 2001);
+        if (x + y <= 2000)
+        {
+            result.push_back(point_type(x, y));
+        }
+    }
+    return result;
+}
+
+template <typename Geometry>
+void test_geometry(Geometry const& geometry, std::string const& caseid)
+{
+    ring_type const expected = brute_force_hull(geometry);
+
+    ring_type hull;
+    bg::convex_hull(geometry, hull);
+    check_hull(hull, expected, caseid + " sequential");
+
+    ring_type parallel_hull;
+    bg::convex_hull(geometry, parallel_hull, bg::default_strategy(),
+                    bg::thread_executor(4));
+    check_hull(parallel_hull, expected, caseid + " threads");
+
+    ring_type chunked_hull;
+    bg::convex_hull(geometry, chunked_hull, bg::default_strategy(),
+                    bg::sequential_executor());
+    check_hull(chunked_hull, expected, caseid + " chunks");
+
+    polygon_type polygon;
+    bg::convex_hull(geometry, polygon, bg::default_strategy(),
+                    bg::thread_executor(2));
+    BOOST_CHECK_EQUAL(bg::num_points(polygon), expected.size() + 1);
+
+    bg::incremental_convex_hull<point_type> incremental;
+    incremental.insert_range(geometry);
+    ring_type incremental_hull;
+    incremental.get(incremental_hull);
+    check_hull(incremental_hull, expected, caseid + " incremental");
+}
+
+void test_incremental()
+{
+    bg::incremental_convex_hull<point_type> incremental;
+    ring_type hull;
+    incremental.get(hull);
+    BOOST_CHECK(hull.empty());
+
+    // The hull is updated between the insertions
+    multi_point_type const points = make_triangle(5000);
+    multi_point_type inserted;
+    for (std::size_t i = 0 ; i < points.size() ; ++i)
+    {
+        incremental.insert(points[i]);
+        inserted.push_back(points[i]);
+        if (i % 1000 == 999 || i == 10)
+        {
+            incremental.get(hull);
+            check_hull(hull, brute_force_hull(inserted), "incremental get");
+        }
+    }
+
+    // Points on a circle are never inside the hull
+    incremental.clear();
+    inserted.clear();
+    for (int x = -100 ; x <= 100 ; ++x)
+    {
+        for (int y = -100 ; y <= 100 ; ++y)
+        {
+            if (x * x + y * y == 5525)
+            {
+                incremental.insert(point_type(x, y));
+                inserted.push_back(point_type(x, y));
+            }
+        }
+    }
+    incremental.get(hull);
+    check_hull(hull, brute_force_hull(inserted), "incremental circle");
+}
+
+int test_main(int, char* [])
+{
+    multi_point_type const disk = make_disk(300, 3);
+    BOOST_CHECK(disk.size() > 2 * bg::strategy::convex_hull::detail::graham_andrew_chunk_size);
+    test_geometry(disk, "disk");
+
+    multi_point_type const triangle = make_triangle(300000);
+    test_geometry(triangle, "triangle");
+    test_geometry(linestring_type(triangle.begin(), triangle.end()), "linestring");
+
+    // Collinear, duplicate and few points
+    multi_point_type line;
+    for (int i = 0 ; i < 200000 ; ++i)
+    {
+        line.push_back(point_type(i % 1000, 2 * (i % 1000)));
+    }
+    ring_type hull;
+    bg::convex_hull(line, hull, bg::default_strategy(), bg::thread_executor(4));
+    ring_type sequential_hull;
+    bg::convex_hull(line, sequential_hull);
+    BOOST_CHECK_EQUAL(bg::to_wkt(hull), bg::to_wkt(sequential_hull));
+
+    multi_point_type square;
+    bg::read_wkt("MULTIPOINT((0 0),(2 0),(2 2),(0 2),(1 1),(0.5 1.5))", square);
+    test_geometry(square, "square");
+
+    test_incremental();
+
+    return 0;
+}
@@ -130,6 +130,19 @@ void test_cartesian()
     test_one<P>("POLYGON((0 5, 1 5, 1 6, 1 4, 2 4, 0 4, 0 3, 0 5))", bg::clockwise);
 }
 
+// The result does not depend on the order of the ring type
+template <typename P>
+void test_declared_order()
+{
+    bg::model::ring<P, false> ring_ccw;
+    bg::read_wkt("POLYGON((0 0,0 1,1 1,1 0,0 0))", ring_ccw);
+    test_one(ring_ccw, bg::clockwise);
+
+    bg::model::ring<P, false, false> ring_ccw_open;
+    bg::read_wkt("POLYGON((0 0,1 0,1 1,0 1))", ring_ccw_open);
+    test_one(ring_ccw_open, bg::counterclockwise);
+}
+
 template <typename P>
 void test_spheroidal()
 {
@@ -146,6 +159,10 @@ int test_main(int, char* [])
 
     test_cartesian<bg::model::point<double, 2, bg::cs::cartesian> >();
 
+    test_declared_order<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_declared_order<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >();
+    test_declared_order<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
+
     test_spheroidal<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >();
     test_spheroidal<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
     
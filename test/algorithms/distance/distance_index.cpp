@@ -0,0 +1,151 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/distance_index.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Roads: zigzag linestrings on a grid
+template <typename MultiLinestring>
+MultiLinestring make_roads(double scale)
+{
+    typedef typename bg::point_type<MultiLinestring>::type point_type;
+    MultiLinestring result;
+    for (std::size_t i = 0 ; i < 20 ; ++i)
+    {
+        typename boost::range_value<MultiLinestring>::type road;
+        for (std::size_t j = 0 ; j < 30 ; ++j)
+        {
+            double const x = double(j) + 0.3 * std::sin(double(i * 30 + j));
+            double const y = 2.0 * double(i) + 0.5 * double(j % 2);
+            bg::append(road, point_type(scale * x, scale * y));
+        }
+        result.push_back(road);
+    }
+    return result;
+}
+
+template <typename MultiPoint>
+MultiPoint make_vehicles(std::size_t count, double scale)
+{
+    typedef typename bg::point_type<MultiPoint>::type point_type;
+    MultiPoint result;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const x = -3.0 + 35.0 * std::fabs(std::sin(double(i) * 1.7));
+        double const y = -3.0 + 45.0 * std::fabs(std::cos(double(i) * 2.3));
+        result.push_back(point_type(scale * x, scale * y));
+    }
+    return result;
+}
+
+template <typename Index, typename Query, typename Geometry>
+void check_distance(Index const& index, Query const& query, Geometry const& geometry)
+{
+    double const expected = bg::distance(query, geometry);
+    double const detected = index.distance(query);
+    BOOST_CHECK_CLOSE(detected, expected, 0.0001);
+}
+
+template <typename Point>
+void test_index(double scale)
+{
+    typedef bg::model::linestring<Point> linestring_type;
+    typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+    typedef bg::model::multi_point<Point> multi_point_type;
+
+    multi_linestring_type const roads = make_roads<multi_linestring_type>(scale);
+    multi_point_type const vehicles = make_vehicles<multi_point_type>(200, scale);
+
+    bg::distance_index<multi_linestring_type> const index(roads);
+    for (std::size_t i = 0 ; i < vehicles.size() ; ++i)
+    {
+        check_distance(index, vehicles[i], roads);
+    }
+
+    // Several queries, the searches are bounded by the closest distance
+    for (std::size_t i = 0 ; i + 10 <= vehicles.size() ; i += 10)
+    {
+        multi_point_type const part(vehicles.begin() + i, vehicles.begin() + i + 10);
+        check_distance(index, part, roads);
+    }
+
+    check_distance(index, roads[3], roads);
+    check_distance(index, vehicles, roads);
+
+    linestring_type crossing;
+    bg::append(crossing, Point(scale * 4.1, scale * -1.0));
+    bg::append(crossing, Point(scale * 4.2, scale * 50.0));
+    BOOST_CHECK_EQUAL(index.distance(crossing), 0.0);
+
+    // Other indexed geometries
+    bg::distance_index<linestring_type> const road_index(roads[7]);
+    check_distance(road_index, vehicles, roads[7]);
+    check_distance(road_index, roads[2], roads[7]);
+    check_distance(road_index, vehicles[17], roads[7]);
+
+    bg::distance_index<multi_point_type> const vehicle_index(vehicles);
+    check_distance(vehicle_index, vehicles, vehicles);
+    check_distance(vehicle_index, vehicles[11], vehicles);
+    check_distance(vehicle_index, Point(scale * 1.5, scale * 2.5), vehicles);
+}
+
+template <typename Point>
+void test_strategies()
+{
+    typedef bg::model::linestring<Point> linestring_type;
+
+    linestring_type ls;
+    bg::read_wkt("LINESTRING(0 0,10 0,10 10)", ls);
+
+    bg::distance_index
+        <
+            linestring_type, bg::strategy::distance::comparable::pythagoras<>
+        > const comparable_index(ls);
+    BOOST_CHECK_CLOSE(comparable_index.distance(Point(5, 3)), 9.0, 0.0001);
+    BOOST_CHECK_CLOSE(comparable_index.distance(Point(13, 14)), 25.0, 0.0001);
+
+    bg::distance_index<linestring_type> const index(ls);
+    BOOST_CHECK_CLOSE(index.distance(Point(13, 14)), 5.0, 0.0001);
+    BOOST_CHECK_EQUAL(index.distance(Point(10, 5)), 0.0);
+
+    // One point linestring, a degenerate segment
+    linestring_type single;
+    bg::read_wkt("LINESTRING(1 1)", single);
+    bg::distance_index<linestring_type> const single_index(single);
+    BOOST_CHECK_CLOSE(single_index.distance(Point(4, 5)), 5.0, 0.0001);
+
+    linestring_type empty;
+    bool thrown = false;
+    try
+    {
+        bg::distance_index<linestring_type> const empty_index(empty);
+    }
+    catch (bg::empty_input_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+int test_main(int, char* [])
+{
+    test_index<bg::model::point<double, 2, bg::cs::cartesian> >(1.0);
+    test_index<bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > >(0.01);
+    test_index<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >(0.01);
+    test_strategies<bg::model::point<double, 2, bg::cs::cartesian> >();
+    return 0;
+}
@@ -0,0 +1,298 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <limits>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+// Large enough for several chunks
+std::size_t const large = 300000;
+
+inline double uniform(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53);
+}
+
+template <typename Box>
+void check_boxes(Box const& box, Box const& expected)
+{
+    BOOST_CHECK_MESSAGE(bg::equals(box.min_corner(), expected.min_corner())
+                        && bg::equals(box.max_corner(), expected.max_corner()),
+                        bg::wkt(box.min_corner()) << bg::wkt(box.max_corner())
+                        << " expected " << bg::wkt(expected.min_corner())
+                        << bg::wkt(expected.max_corner()));
+}
+
+// The envelope sequentially, with the sequential executor and with threads
+template <typename Geometry, typename Box>
+void test_executors(Geometry const& geometry, Box const& expected)
+{
+    Box box;
+    bg::envelope(geometry, box);
+    check_boxes(box, expected);
+
+    bg::envelope(geometry, box, bg::default_strategy(),
+                 bg::sequential_executor());
+    check_boxes(box, expected);
+
+    bg::envelope(geometry, box, bg::default_strategy(),
+                 bg::thread_executor(4));
+    check_boxes(box, expected);
+}
+
+template <typename Point>
+void test_cartesian_range(std::size_t count)
+{
+    typedef bg::model::linestring<Point> linestring_type;
+    typedef bg::model::linestring<Point, std::deque> deque_linestring_type;
+    typedef bg::model::multi_point<Point> multi_point_type;
+    typedef bg::model::multi_point<Point, std::deque> deque_multi_point_type;
+    typedef bg::model::box<Point> box_type;
+
+    linestring_type linestring;
+    deque_linestring_type deque_linestring;
+    multi_point_type multi_point;
+    deque_multi_point_type deque_multi_point;
+    std::size_t state = count;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Point const p(1000.0 * uniform(state) - 300.0,
+                      500.0 * uniform(state) + 100.0);
+        linestring.push_back(p);
+        deque_linestring.push_back(p);
+        multi_point.push_back(p);
+        deque_multi_point.push_back(p);
+    }
+
+    // The points of the deques are expanded one by one
+    box_type expected;
+    bg::envelope(deque_linestring, expected);
+
+    test_executors(linestring, expected);
+    test_executors(deque_linestring, expected);
+    test_executors(multi_point, expected);
+    test_executors(deque_multi_point, expected);
+
+    box_type deque_expected;
+    bg::envelope(deque_multi_point, deque_expected);
+    check_boxes(deque_expected, expected);
+}
+
+void test_cartesian()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::point<float, 2, bg::cs::cartesian> float_point_type;
+
+    BOOST_CHECK((bg::strategy::envelope::detail::contiguous_kernel
+        <
+            bg::strategy::envelope::cartesian<>,
+            bg::model::linestring<point_type>
+        >::value));
+    BOOST_CHECK((! bg::strategy::envelope::detail::contiguous_kernel
+        <
+            bg::strategy::envelope::cartesian<>,
+            bg::model::linestring<float_point_type>
+        >::value));
+
+    // Sizes around the width of the kernel
+    for (std::size_t count = 1; count < 20; ++count)
+    {
+        test_cartesian_range<point_type>(count);
+    }
+    test_cartesian_range<point_type>(large);
+    test_cartesian_range<float_point_type>(large);
+    test_cartesian_range<bg::model::point<double, 3, bg::cs::cartesian> >(large);
+
+    // A double box of float points, a float box of double points
+    bg::model::linestring<point_type> linestring;
+    bg::read_wkt("LINESTRING(0.1 0.2,3.3 -1.7,2.5 4.1)", linestring);
+    bg::model::box<float_point_type> float_box;
+    bg::envelope(linestring, float_box);
+    BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 0>(float_box)), 0.1f);
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 1>(float_box)), 4.1f);
+
+    // NaN coordinates after the first point are ignored
+    double const nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t i = 0; i < 8; ++i)
+    {
+        linestring.push_back(point_type(nan, i));
+    }
+    bg::model::box<point_type> box;
+    bg::envelope(linestring, box);
+    check_boxes(box, bg::model::box<point_type>(point_type(0.1, -1.7),
+                                                point_type(3.3, 7)));
+
+    bg::model::linestring<point_type> empty;
+    bg::envelope(empty, box, bg::default_strategy(), bg::thread_executor(4));
+    BOOST_CHECK((bg::get<bg::min_corner, 0>(box) > bg::get<bg::max_corner, 0>(box)));
+}
+
+// Each of the extreme coordinates is in the first and the last chunk, once
+// exactly and once closer than epsilon. If first_exact, the exact value is
+// in the first chunk.
+template <typename Point>
+void test_spherical_near_equal(double lon_min, double lon_max,
+                               double lat_min, double lat_max,
+                               bool first_exact)
+{
+    typedef bg::model::multi_point<Point> multi_point_type;
+    typedef bg::model::box<Point> box_type;
+
+    double const eps = std::numeric_limits<double>::epsilon();
+    double const near_lon_min = lon_min + std::abs(lon_min) * eps;
+    double const near_lon_max = lon_max - std::abs(lon_max) * eps;
+    double const near_lat_min = lat_min + std::abs(lat_min) * eps;
+    double const near_lat_max = lat_max - std::abs(lat_max) * eps;
+    BOOST_CHECK(near_lon_min != lon_min && near_lon_max != lon_max);
+    BOOST_CHECK(near_lat_min != lat_min && near_lat_max != lat_max);
+
+    std::size_t state = 7;
+    multi_point_type multi_point;
+    for (std::size_t i = 0; i < large; ++i)
+    {
+        double const f = 0.1 + 0.8 * uniform(state);
+        multi_point.push_back(Point(lon_min + f * (lon_max - lon_min),
+                                    lat_min + f * (lat_max - lat_min)));
+    }
+
+    Point const exact[] = { Point(lon_min, lat_min), Point(lon_max, lat_max) };
+    Point const near[] = { Point(near_lon_min, near_lat_min),
+                           Point(near_lon_max, near_lat_max) };
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        multi_point[i] = first_exact ? exact[i] : near[i];
+        multi_point[large - 1 - i] = first_exact ? near[i] : exact[i];
+    }
+
+    box_type expected;
+    bg::envelope(multi_point, expected);
+    BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 1>(expected)), lat_min);
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 1>(expected)), lat_max);
+
+    box_type box;
+    bg::envelope(multi_point, box, bg::default_strategy(),
+                 bg::thread_executor(4));
+    BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 0>(box)),
+                      (bg::get<bg::min_corner, 0>(expected)));
+    BOOST_CHECK_EQUAL((bg::get<bg::min_corner, 1>(box)),
+                      (bg::get<bg::min_corner, 1>(expected)));
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 0>(box)),
+                      (bg::get<bg::max_corner, 0>(expected)));
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 1>(box)),
+                      (bg::get<bg::max_corner, 1>(expected)));
+}
+
+template <typename CS>
+void test_spherical_multi_point()
+{
+    typedef bg::model::point<double, 2, CS> point_type;
+    typedef bg::model::multi_point<point_type> multi_point_type;
+    typedef bg::model::box<point_type> box_type;
+
+    std::size_t state = 3;
+
+    // Around the antimeridian
+    multi_point_type antimeridian;
+    for (std::size_t i = 0; i < large; ++i)
+    {
+        double const lon = 160.0 + 30.0 * uniform(state);
+        antimeridian.push_back(point_type(lon > 180.0 ? lon - 360.0 : lon,
+                                          40.0 * uniform(state) - 20.0));
+    }
+    box_type expected;
+    bg::envelope(antimeridian, expected);
+    BOOST_CHECK((bg::get<bg::min_corner, 0>(expected) > 159.0));
+    BOOST_CHECK((bg::get<bg::max_corner, 0>(expected) < 191.0));
+    test_executors(antimeridian, expected);
+
+    // Longitudes spanning more than half of the period, with the largest
+    // gap inside of one of the chunks, and a pole
+    multi_point_type wide;
+    for (std::size_t i = 0; i < large; ++i)
+    {
+        double const lon = i < large / 2
+                         ? -170.0 + 100.0 * uniform(state)
+                         : 20.0 + 140.0 * uniform(state);
+        wide.push_back(point_type(lon, 10.0 * uniform(state)));
+    }
+    wide.push_back(point_type(0.0, 90.0));
+    bg::envelope(wide, expected);
+    BOOST_CHECK_EQUAL((bg::get<bg::max_corner, 1>(expected)), 90.0);
+    test_executors(wide, expected);
+
+    // Near-equal extreme coordinates in different chunks, the smallest and
+    // the largest are expected, exactly
+    test_spherical_near_equal<point_type>(10.0, 50.0, -20.0, 30.0, false);
+    test_spherical_near_equal<point_type>(10.0, 50.0, -20.0, 30.0, true);
+    test_spherical_near_equal<point_type>(-170.0, 160.0, -20.0, 30.0, false);
+    test_spherical_near_equal<point_type>(-170.0, 160.0, -20.0, 30.0, true);
+
+    // Only poles and one other point
+    multi_point_type poles;
+    poles.resize(large, point_type(10.0, -90.0));
+    poles.push_back(point_type(45.0, 30.0));
+    bg::envelope(poles, expected);
+    test_executors(poles, expected);
+}
+
+template <typename CS>
+void test_spherical_linestring()
+{
+    typedef bg::model::point<double, 2, CS> point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::model::box<point_type> box_type;
+
+    // Zigzagging across the antimeridian
+    linestring_type linestring;
+    std::size_t state = 5;
+    for (std::size_t i = 0; i < large; ++i)
+    {
+        double const lon = 175.0 + 10.0 * uniform(state);
+        linestring.push_back(point_type(lon > 180.0 ? lon - 360.0 : lon,
+                                        10.0 * uniform(state)));
+    }
+
+    box_type expected;
+    bg::envelope(linestring, expected);
+    BOOST_CHECK((bg::get<bg::min_corner, 0>(expected) > 174.0));
+    BOOST_CHECK((bg::get<bg::max_corner, 0>(expected) < 186.0));
+
+    box_type box;
+    bg::envelope(linestring, box, bg::default_strategy(),
+                 bg::thread_executor(4));
+    BOOST_CHECK_CLOSE((bg::get<bg::min_corner, 0>(box)),
+                      (bg::get<bg::min_corner, 0>(expected)), 1.0e-9);
+    BOOST_CHECK_CLOSE((bg::get<bg::min_corner, 1>(box)),
+                      (bg::get<bg::min_corner, 1>(expected)), 1.0e-9);
+    BOOST_CHECK_CLOSE((bg::get<bg::max_corner, 0>(box)),
+                      (bg::get<bg::max_corner, 0>(expected)), 1.0e-9);
+    BOOST_CHECK_CLOSE((bg::get<bg::max_corner, 1>(box)),
+                      (bg::get<bg::max_corner, 1>(expected)), 1.0e-9);
+}
+
+int test_main(int, char* [])
+{
+    test_cartesian();
+    test_spherical_multi_point<bg::cs::spherical_equatorial<bg::degree> >();
+    test_spherical_multi_point<bg::cs::geographic<bg::degree> >();
+    test_spherical_linestring<bg::cs::spherical_equatorial<bg::degree> >();
+    test_spherical_linestring<bg::cs::geographic<bg::degree> >();
+
+    return 0;
+}
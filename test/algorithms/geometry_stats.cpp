@@ -0,0 +1,159 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/geometry_stats.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+// Compares all metrics with the separate algorithms
+template <typename Geometry>
+void test_geometry(std::string const& wkt)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::geometry_stats_result<Geometry> result;
+    bg::geometry_stats(geometry, result);
+
+    BOOST_CHECK_CLOSE(result.area, bg::area(geometry), 0.0001);
+    BOOST_CHECK_CLOSE(result.perimeter, bg::perimeter(geometry), 0.0001);
+    BOOST_CHECK_EQUAL(result.num_points, bg::num_points(geometry));
+
+    point_type const centroid = bg::return_centroid<point_type>(geometry);
+    BOOST_CHECK_MESSAGE(bg::distance(result.centroid, centroid) < 1.0e-9,
+                        wkt << " centroid " << bg::wkt(result.centroid)
+                        << " expected " << bg::wkt(centroid));
+
+    bg::model::box<point_type> const envelope
+        = bg::return_envelope<bg::model::box<point_type> >(geometry);
+    BOOST_CHECK_EQUAL(bg::to_wkt(result.envelope), bg::to_wkt(envelope));
+}
+
+// Only the selected metrics are calculated
+void test_selection()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+
+    polygon_type polygon;
+    bg::read_wkt("POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1))", polygon);
+
+    bg::geometry_stats_result<polygon_type> result;
+    bg::geometry_stats<bg::stats_area | bg::stats_num_points>(polygon, result);
+    BOOST_CHECK_CLOSE(result.area, 15.0, 0.0001);
+    BOOST_CHECK_EQUAL(result.num_points, 10u);
+    BOOST_CHECK_EQUAL(result.perimeter, 0.0);
+
+    bg::geometry_stats<bg::stats_perimeter | bg::stats_centroid>(polygon, result);
+    BOOST_CHECK_CLOSE(result.perimeter, 20.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::get<0>(result.centroid), 2.0333333, 0.0001);
+}
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::box<point_type> box_type;
+
+    // The envelope of the segments differs from the envelope of the points
+    polygon_type polygon;
+    bg::read_wkt("POLYGON((-60 50,60 50,60 40,-60 40,-60 50))", polygon);
+
+    bg::geometry_stats_result<polygon_type> result;
+    bg::geometry_stats
+        <
+            bg::stats_area | bg::stats_perimeter | bg::stats_envelope
+        >(polygon, result);
+
+    BOOST_CHECK_CLOSE(result.area, bg::area(polygon), 0.0001);
+    BOOST_CHECK_CLOSE(result.perimeter, bg::perimeter(polygon), 0.0001);
+    BOOST_CHECK_EQUAL(bg::to_wkt(result.envelope),
+                      bg::to_wkt(bg::return_envelope<box_type>(polygon)));
+    BOOST_CHECK((bg::get<bg::max_corner, 1>(result.envelope) > 50.0));
+}
+
+void test_range()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::geometry_stats_result<polygon_type> result_type;
+    typedef bg::default_stats_strategies<polygon_type>::type strategies_type;
+
+    std::vector<polygon_type> polygons;
+    for (int i = 0; i < 1000; ++i)
+    {
+        polygon_type polygon;
+        bg::append(polygon.outer(), point_type(i, 0));
+        bg::append(polygon.outer(), point_type(i, i % 7 + 1));
+        bg::append(polygon.outer(), point_type(i + i % 5 + 1, i % 7 + 1));
+        bg::append(polygon.outer(), point_type(i + 1, 0));
+        bg::append(polygon.outer(), point_type(i, 0));
+        polygons.push_back(polygon);
+    }
+
+    std::vector<result_type> sequential;
+    bg::geometry_stats(polygons, sequential, strategies_type(),
+                       bg::sequential_executor());
+    std::vector<result_type> parallel;
+    bg::geometry_stats(polygons, parallel, strategies_type(),
+                       bg::thread_executor(4));
+
+    BOOST_CHECK_EQUAL(parallel.size(), polygons.size());
+    for (std::size_t i = 0; i < polygons.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(parallel[i].area, sequential[i].area);
+        BOOST_CHECK_EQUAL(parallel[i].area, bg::area(polygons[i]));
+        BOOST_CHECK_EQUAL(parallel[i].perimeter, sequential[i].perimeter);
+        BOOST_CHECK(bg::equals(parallel[i].centroid, sequential[i].centroid));
+        BOOST_CHECK(bg::equals(parallel[i].envelope, sequential[i].envelope));
+    }
+}
+
+template <typename Point>
+void test_all()
+{
+    typedef bg::model::polygon<Point> polygon_type;
+    typedef bg::model::polygon<Point, false, false> ccw_open_polygon_type;
+    typedef bg::model::ring<Point> ring_type;
+    typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+    test_geometry<polygon_type>("POLYGON((0 0,0 7,4 2,2 0,0 0))");
+    test_geometry<polygon_type>("POLYGON((10 10,10 17,14 12,12 10,10 10),"
+                                "(11 11,11 12,12 12,12 11,11 11))");
+    test_geometry<ccw_open_polygon_type>("POLYGON((0 0,2 0,4 2,0 7),"
+                                         "(1 1,1 2,2 2,2 1))");
+    test_geometry<ring_type>("POLYGON((1 1,1 3,3 3,3 1,1 1))");
+    test_geometry<multi_polygon_type>("MULTIPOLYGON(((0 0,0 7,4 2,2 0,0 0)),"
+                                      "((10 10,10 17,14 12,12 10,10 10),"
+                                      "(11 11,11 12,12 12,12 11,11 11)))");
+
+    // Without area the centroid is a point of the border
+    test_geometry<polygon_type>("POLYGON((0 0,0 4,0 2,0 0))");
+    test_geometry<polygon_type>("POLYGON((3 3))");
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_all<bg::model::d2::point_xy<double> >();
+
+    test_selection();
+    test_geographic();
+    test_range();
+
+    return 0;
+}
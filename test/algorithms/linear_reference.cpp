@@ -0,0 +1,186 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/linear_reference.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+
+template <typename Point>
+void check_points(Point const& p, Point const& expected, double tolerance)
+{
+    BOOST_CHECK_MESSAGE(bg::distance(p, expected) <= tolerance,
+                        bg::wkt(p) << " expected " << bg::wkt(expected));
+}
+
+// Compares the points with line_interpolate and locates them again
+template <typename Linestring, typename Strategy>
+void test_interpolate(std::string const& wkt, Strategy const& strategy,
+                      double point_tolerance, double distance_tolerance)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+    typedef bg::model::multi_point<point_type> multi_point_type;
+
+    Linestring linestring;
+    bg::read_wkt(wkt, linestring);
+
+    bg::linear_reference<Linestring, Strategy> const reference(linestring, strategy);
+    double const length = reference.length();
+    BOOST_CHECK_CLOSE(length, double(bg::length(linestring,
+                                                strategy.get_distance_pp_strategy())),
+                      0.0001);
+
+    std::vector<double> distances;
+    for (std::size_t i = 1; i < 20; ++i)
+    {
+        distances.push_back(length * i / 20.0);
+    }
+
+    multi_point_type sorted;
+    reference.interpolate_sorted(distances, sorted);
+    BOOST_CHECK_EQUAL(sorted.size(), distances.size());
+
+    for (std::size_t i = 0; i < distances.size(); ++i)
+    {
+        point_type expected;
+        bg::line_interpolate(linestring, distances[i], expected, strategy);
+
+        point_type p;
+        reference.interpolate(distances[i], p);
+        check_points(p, expected, point_tolerance);
+        BOOST_CHECK(bg::equals(sorted[i], p));
+
+        BOOST_CHECK_MESSAGE(std::fabs(reference.locate(p) - distances[i])
+                                <= distance_tolerance,
+                            "locate " << bg::wkt(p) << ": "
+                            << reference.locate(p) << " expected "
+                            << distances[i]);
+    }
+
+    // Outside of the linestring
+    point_type p;
+    reference.interpolate(-1.0, p);
+    BOOST_CHECK(bg::equals(p, linestring.front()));
+    reference.interpolate(length * 2, p);
+    BOOST_CHECK(bg::equals(p, linestring.back()));
+    BOOST_CHECK(reference.locate(linestring.front()) <= distance_tolerance);
+
+    // Unsorted distances are searched again
+    std::vector<double> unsorted;
+    unsorted.push_back(distances[10]);
+    unsorted.push_back(distances[2]);
+    unsorted.push_back(distances[5]);
+    multi_point_type points;
+    reference.interpolate_sorted(unsorted, points);
+    BOOST_CHECK(bg::equals(points[0], sorted[10]));
+    BOOST_CHECK(bg::equals(points[1], sorted[2]));
+    BOOST_CHECK(bg::equals(points[2], sorted[5]));
+}
+
+void test_cartesian()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::strategy::line_interpolate::cartesian<> strategy_type;
+
+    test_interpolate<linestring_type>("LINESTRING(0 0,10 0,10 10,10 10,20 10)",
+                                      strategy_type(), 1.0e-9, 1.0e-9);
+
+    linestring_type linestring;
+    bg::read_wkt("LINESTRING(0 0,10 0,10 10,10 10,20 10)", linestring);
+    bg::linear_reference<linestring_type> const reference(linestring);
+    BOOST_CHECK_CLOSE(reference.length(), 30.0, 0.0001);
+
+    // Projections of points beside the linestring
+    BOOST_CHECK_CLOSE(reference.locate(point_type(5, 3)), 5.0, 0.0001);
+    BOOST_CHECK_CLOSE(reference.locate(point_type(12, 5)), 15.0, 0.0001);
+    BOOST_CHECK_CLOSE(reference.locate(point_type(25, 20)), 30.0, 0.0001);
+    BOOST_CHECK_EQUAL(reference.locate(point_type(-5, -5)), 0.0);
+
+    point_type p;
+    reference.interpolate(15.0, p);
+    BOOST_CHECK_EQUAL(bg::to_wkt(p), "POINT(10 5)");
+    reference.interpolate(20.0, p);
+    BOOST_CHECK_EQUAL(bg::to_wkt(p), "POINT(10 10)");
+
+    // The same points as densify
+    linestring_type densified, expected;
+    reference.densify(densified, 3.0);
+    bg::densify(linestring, expected, 3.0);
+    BOOST_CHECK_EQUAL(densified.size(), expected.size());
+    for (std::size_t i = 0; i < densified.size() && i < expected.size(); ++i)
+    {
+        check_points(densified[i], expected[i], 1.0e-9);
+    }
+
+    // A single point
+    linestring_type single;
+    bg::read_wkt("LINESTRING(1 2)", single);
+    bg::linear_reference<linestring_type> const single_reference(single);
+    BOOST_CHECK_EQUAL(single_reference.length(), 0.0);
+    BOOST_CHECK_EQUAL(single_reference.locate(point_type(5, 5)), 0.0);
+    single_reference.interpolate(1.0, p);
+    BOOST_CHECK_EQUAL(bg::to_wkt(p), "POINT(1 2)");
+
+    linestring_type empty;
+    BOOST_CHECK_THROW(bg::linear_reference<linestring_type> r(empty),
+                      bg::empty_input_exception);
+}
+
+void test_spherical()
+{
+    typedef bg::model::point<double, 2, bg::cs::spherical_equatorial<bg::degree> > point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::strategy::line_interpolate::spherical<> strategy_type;
+
+    // Distances on the unit sphere
+    test_interpolate<linestring_type>("LINESTRING(0 0,10 10,20 5,30 30,31 30)",
+                                      strategy_type(), 1.0e-9, 1.0e-7);
+
+    linestring_type linestring;
+    bg::read_wkt("LINESTRING(0 0,20 0)", linestring);
+    bg::linear_reference<linestring_type> const reference(linestring);
+    double const degree = bg::math::d2r<double>();
+    BOOST_CHECK_CLOSE(reference.locate(point_type(5, 3)), 5.0 * degree, 0.0001);
+}
+
+void test_geographic()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::strategy::line_interpolate::geographic<> strategy_type;
+
+    // Distances in meters, Andoyer can not distinguish points closer than
+    // about 0.1 meter
+    test_interpolate<linestring_type>("LINESTRING(4.9 52.4,5.1 52.1,6.0 52.2,7.5 53.2)",
+                                      strategy_type(), 1.0e-9, 0.5);
+
+    linestring_type linestring;
+    bg::read_wkt("LINESTRING(0 0,1 0)", linestring);
+    bg::linear_reference<linestring_type> const reference(linestring);
+
+    // Beside the equator the closest point has the same longitude
+    point_type on_equator;
+    reference.interpolate(reference.length() / 2, on_equator);
+    BOOST_CHECK_CLOSE(reference.locate(point_type(bg::get<0>(on_equator), 0.1)),
+                      reference.length() / 2, 0.001);
+}
+
+int test_main(int, char* [])
+{
+    test_cartesian();
+    test_spherical();
+    test_geographic();
+
+    return 0;
+}
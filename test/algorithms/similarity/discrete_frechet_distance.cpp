@@ -8,6 +8,8 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
+#include <cstddef>
 #include <vector>
 
 #include <boost/geometry/geometries/linestring.hpp>
@@ -35,6 +37,82 @@ void test_all_cartesian()
     test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0,3 4,4 3)","LINESTRING(4 3,3 4,0 0)",5);
 
 
+}
+
+// Coupling measure with the full matrix
+template <typename Linestring1, typename Linestring2>
+double brute_force_frechet(Linestring1 const& ls1, Linestring2 const& ls2)
+{
+    std::size_t const a = ls1.size();
+    std::size_t const b = ls2.size();
+    std::vector<double> c(a * b);
+    for (std::size_t i = 0 ; i < a ; i++)
+    {
+        for (std::size_t j = 0 ; j < b ; j++)
+        {
+            double const d = bg::distance(ls1[i], ls2[j]);
+            double m = d;
+            if (i > 0 && j > 0)
+                m = (std::min)(c[(i - 1) * b + j - 1], (std::min)(c[(i - 1) * b + j], c[i * b + j - 1]));
+            else if (i > 0)
+                m = c[(i - 1) * b + j];
+            else if (j > 0)
+                m = c[i * b + j - 1];
+            c[i * b + j] = (std::max)(m, d);
+        }
+    }
+    return c.back();
+}
+
+    template <typename P>
+void test_trajectories()
+{
+    typedef bg::model::linestring<P> linestring_2d;
+
+    // Noisy sine waves with different numbers of points, so the coupling
+    // matrix is used transposed in one of the directions
+    linestring_2d ls1, ls2;
+    for (std::size_t i = 0 ; i < 300 ; i++)
+    {
+        double const x = double(i) * 0.1;
+        bg::append(ls1, P(x, std::sin(x) + 0.05 * std::sin(x * 37.0)));
+    }
+    for (std::size_t i = 0 ; i < 170 ; i++)
+    {
+        double const x = double(i) * 30.0 / 170.0;
+        bg::append(ls2, P(x + 0.2, std::sin(x) + 0.3 + 0.05 * std::cos(x * 23.0)));
+    }
+
+    double const expected = brute_force_frechet(ls1, ls2);
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance(ls1, ls2), expected, 0.0001);
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance(ls2, ls1), expected, 0.0001);
+
+    // The band contains the optimal coupling if wide enough, a narrow band
+    // gives an upper bound
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance_banded(ls1, ls2, 170), expected, 0.0001);
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance_banded(ls2, ls1, 20), expected, 0.0001);
+    BOOST_CHECK(bg::discrete_frechet_distance_banded(ls1, ls2, 0) >= expected);
+    BOOST_CHECK(bg::discrete_frechet_distance_banded(ls1, ls2, 2) >= expected);
+
+    BOOST_CHECK(bg::is_within_discrete_frechet_distance(ls1, ls2, expected * 1.0001));
+    BOOST_CHECK(bg::is_within_discrete_frechet_distance(ls2, ls1, expected * 1.0001));
+    BOOST_CHECK(! bg::is_within_discrete_frechet_distance(ls1, ls2, expected * 0.9999));
+    BOOST_CHECK(! bg::is_within_discrete_frechet_distance(ls2, ls1, expected * 0.9999));
+    BOOST_CHECK(! bg::is_within_discrete_frechet_distance(ls1, ls2, 0.1));
+    BOOST_CHECK(bg::is_within_discrete_frechet_distance(ls1, ls2, expected * expected * 1.0001,
+                    bg::strategy::distance::comparable::pythagoras<>()));
+    BOOST_CHECK(! bg::is_within_discrete_frechet_distance(ls1, ls2, expected * expected * 0.9999,
+                    bg::strategy::distance::comparable::pythagoras<>()));
+    BOOST_CHECK(bg::is_within_discrete_frechet_distance(ls1, ls2, expected * 1.0001,
+                    bg::strategy::distance::pythagoras<>()));
+
+    linestring_2d single;
+    bg::append(single, P(0, 0));
+    BOOST_CHECK(bg::is_within_discrete_frechet_distance(single, single, 0.0));
+    BOOST_CHECK_CLOSE(bg::discrete_frechet_distance_banded(single, ls1, 0),
+                      brute_force_frechet(single, ls1), 0.0001);
+    BOOST_CHECK(bg::is_within_discrete_frechet_distance(ls1, single,
+                    brute_force_frechet(ls1, single)));
 }
 
     template <typename P>
@@ -57,6 +135,12 @@ void test_all_geographic()
     test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0, 1 0)","LINESTRING(0 0, 1 0)",0);
     test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0,3 4,4 3)","LINESTRING(4 3,3 4,0 0)",555093);
 
+    linestring_2d ls1, ls2;
+    bg::read_wkt("LINESTRING(3 0,2 1,3 2)", ls1);
+    bg::read_wkt("LINESTRING(0 0,3 4,4 3)", ls2);
+    BOOST_CHECK(bg::is_within_discrete_frechet_distance(ls1, ls2, 334000.0));
+    BOOST_CHECK(! bg::is_within_discrete_frechet_distance(ls1, ls2, 333000.0));
+
 }
 
     template <typename P>
@@ -84,6 +168,7 @@ int test_main(int, char* [])
 {
     //Cartesian Coordinate System
     test_all_cartesian<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
+    test_trajectories<bg::model::d2::point_xy<double,bg::cs::cartesian> >();
 
     //Geographic Coordinate System
     test_all_geographic<bg::model::d2::point_xy<double,bg::cs::geographic<bg::degree> > >();
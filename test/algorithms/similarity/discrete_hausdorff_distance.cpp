@@ -13,6 +13,7 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
 #include <vector>
 
 #include <boost/geometry/geometries/linestring.hpp>
@@ -21,6 +22,8 @@
 #include <boost/geometry/geometries/multi_linestring.hpp>
 #include <boost/geometry/geometries/multi_point.hpp>
 
+#include <boost/geometry/util/executor.hpp>
+
 #include "test_hausdorff_distance.hpp"
 
     template <typename P>
@@ -99,8 +102,82 @@ void test_all_spherical_equ()
     test_geometry<linestring_2d,linestring_2d >("LINESTRING(0 0,3 4,4 3)","LINESTRING(4 3,3 4,0 0)",0);
 }
 
+// Compares with the brute force scan for trajectories long enough to be
+// processed in several tasks, the early break and the order of the points
+// must not change the result
+template <typename P, typename Executor>
+void test_trajectories(Executor const& executor)
+{
+    typedef bg::model::linestring<P> linestring_2d;
+    typedef bg::model::multi_linestring<linestring_2d> mlinestring_t;
+
+    linestring_2d ls1, ls2;
+    for (int i = 0 ; i < 2000 ; i++)
+    {
+        double const t = i * 0.01;
+        bg::append(ls1, P(t, std::sin(t)));
+        bg::append(ls2, P(t * 1.01 + 0.1, std::sin(t * 0.97) + 0.05 * std::cos(7 * t)));
+    }
+    bg::append(ls2, P(10, 3));
+
+    bg::strategy::distance::pythagoras<> pythagoras;
+
+    double expected = 0;
+    for (std::size_t i = 0 ; i < ls1.size() ; i++)
+    {
+        double nearest = bg::distance(ls1[i], ls2[0]);
+        for (std::size_t j = 1 ; j < ls2.size() ; j++)
+        {
+            nearest = (std::min)(nearest, bg::distance(ls1[i], ls2[j]));
+        }
+        expected = (std::max)(expected, nearest);
+    }
+
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(ls1, ls2), expected, 1e-10);
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(ls1, ls2, pythagoras, executor),
+                      expected, 1e-10);
+
+    // The comparable strategy returns the comparable distance
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(ls1, ls2,
+                          bg::strategy::distance::comparable::pythagoras<>(), executor),
+                      expected * expected, 1e-10);
+
+    mlinestring_t mls1, mls2;
+    mls1.push_back(ls1);
+    mls1.push_back(ls2);
+    mls2.push_back(ls2);
+    mls2.push_back(ls1);
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(mls1, mls2, pythagoras, executor),
+                      bg::discrete_hausdorff_distance(ls2, ls1), 1e-10);
+    BOOST_CHECK_CLOSE(bg::discrete_hausdorff_distance(ls1, mls2, pythagoras, executor),
+                      expected, 1e-10);
+
+    // The prepared geometries are reused for several geometries
+    bg::discrete_hausdorff_prepared<linestring_2d> const prepared(ls2);
+    bg::discrete_hausdorff_prepared<mlinestring_t> const mprepared(mls2);
+    BOOST_CHECK_CLOSE(prepared.distance(ls1), expected, 1e-10);
+    BOOST_CHECK_CLOSE(prepared.distance(ls1, pythagoras, executor),
+                      expected, 1e-10);
+    BOOST_CHECK_EQUAL(prepared.distance(ls2), 0.0);
+    BOOST_CHECK_CLOSE(mprepared.distance(ls1, pythagoras, executor),
+                      bg::discrete_hausdorff_distance(ls1, mls2), 1e-10);
+    BOOST_CHECK_CLOSE(mprepared.distance(mls1, pythagoras),
+                      bg::discrete_hausdorff_distance(mls1, mls2), 1e-10);
+
+    // A point is as far as its nearest point
+    double nearest = bg::distance(ls1[500], ls2[0]);
+    for (std::size_t j = 1 ; j < ls2.size() ; j++)
+    {
+        nearest = (std::min)(nearest, bg::distance(ls1[500], ls2[j]));
+    }
+    BOOST_CHECK_CLOSE(prepared.distance(ls1[500]), nearest, 1e-10);
+}
+
 int test_main(int, char* [])
 {
+    test_trajectories<bg::model::d2::point_xy<double> >(bg::sequential_executor());
+    test_trajectories<bg::model::d2::point_xy<double> >(bg::thread_executor(4));
+
     //Cartesian Coordinate System
     test_all_cartesian<bg::model::d2::point_xy<int,bg::cs::cartesian> >();
     test_all_cartesian<bg::model::d2::point_xy<float,bg::cs::cartesian> >();
@@ -283,6 +283,106 @@ void test_spherical()
 }
 
 
+template <typename P>
+void test_douglas_peucker_buffer()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::strategy::simplify::douglas_peucker
+        <
+            P, bg::strategy::distance::projected_point<double>
+        > dp;
+
+    // A random walk, long enough to make a recursive implementation deep
+    linestring trace;
+    unsigned int seed = 1;
+    double x = 0, y = 0;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        x += double((seed >> 8) % 1000) / 1000.0;
+        seed = seed * 1103515245u + 12345u;
+        y += double((seed >> 8) % 1000) / 1000.0 - 0.5;
+        trace.push_back(P(x, y));
+    }
+
+    linestring expected;
+    bg::simplify(trace, expected, 0.75);
+    BOOST_CHECK(expected.size() > 2 && expected.size() < trace.size() / 10);
+
+    // The buffer is reused
+    bg::strategy::simplify::douglas_peucker_buffer buffer;
+    for (int i = 0; i < 2; ++i)
+    {
+        linestring simplified;
+        dp::apply(trace, std::back_inserter(simplified), 0.75, buffer);
+        BOOST_CHECK_EQUAL(bg::to_wkt(simplified), bg::to_wkt(expected));
+
+        std::vector<std::size_t> indexes;
+        dp::apply_indexes(trace, std::back_inserter(indexes), 0.75, buffer);
+        BOOST_CHECK_EQUAL(indexes.size(), expected.size());
+        bool same = indexes.size() == expected.size();
+        for (std::size_t j = 0; same && j < indexes.size(); ++j)
+        {
+            same = bg::equals(trace[indexes[j]], expected[j]);
+        }
+        BOOST_CHECK(same);
+    }
+
+    linestring simplified;
+    dp::apply(linestring(trace.begin(), trace.begin() + 2),
+              std::back_inserter(simplified), 0.75, buffer);
+    BOOST_CHECK_EQUAL(simplified.size(), 2u);
+}
+
+
+template <typename P>
+void test_visvalingam_whyatt()
+{
+    typedef bg::strategy::simplify::visvalingam_whyatt<P> vw;
+
+    // The areas are 0.1, 5 and 5, after removals 5 and max(10, 5)
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,1 0.1,2 0,3 5,4 0)",
+        "LINESTRING(0 0,2 0,3 5,4 0)", 0.5, vw());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,1 0.1,2 0,3 5,4 0)",
+        "LINESTRING(0 0,3 5,4 0)", 8.0, vw());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,1 0.1,2 0,3 5,4 0)",
+        "LINESTRING(0 0,4 0)", 20.0, vw());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,1 0.1,2 0,3 5,4 0)",
+        "LINESTRING(0 0,1 0.1,2 0,3 5,4 0)", 0.05, vw());
+
+    test_geometry<bg::model::polygon<P> >(
+        "POLYGON((0 0,0 10,5 10.1,10 10,10 0,5 -0.1,0 0))",
+        "POLYGON((0 0,0 10,10 10,10 0,0 0))", 1.0, vw());
+
+    bg::model::linestring<P> line, simplified;
+    bg::read_wkt("LINESTRING(0 0,1 0.1,2 0,3 5,4 0)", line);
+    bg::detail::simplify::simplify_insert(line, std::back_inserter(simplified), 0.5, vw());
+    BOOST_CHECK_EQUAL(bg::to_wkt(simplified), "LINESTRING(0 0,2 0,3 5,4 0)");
+}
+
+
+template <typename P>
+void test_visvalingam_whyatt_geographic()
+{
+    typedef bg::strategy::simplify::visvalingam_whyatt<P> vw;
+
+    bg::model::linestring<P> line, simplified;
+    bg::read_wkt("LINESTRING(4 52,4.05 52.01,4.1 52,4.2 52.5)", line);
+
+    // The triangle of the second point is about 3.8 km2
+    bg::simplify(line, simplified, 1.0e7, vw());
+    BOOST_CHECK_EQUAL(bg::to_wkt(simplified), "LINESTRING(4 52,4.1 52,4.2 52.5)");
+
+    bg::clear(simplified);
+    bg::simplify(line, simplified, 1.0e6, vw());
+    BOOST_CHECK_EQUAL(bg::to_wkt(simplified), bg::to_wkt(line));
+}
+
+
 int test_main(int, char* [])
 {
     // Integer compiles, but simplify-process fails (due to distances)
@@ -300,6 +400,10 @@ int test_main(int, char* [])
 
     test_zigzag<bg::model::d2::point_xy<double> >();
 
+    test_douglas_peucker_buffer<bg::model::d2::point_xy<double> >();
+    test_visvalingam_whyatt<bg::model::d2::point_xy<double> >();
+    test_visvalingam_whyatt_geographic<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
+
 #if defined(HAVE_TTMATH)
     test_all<bg::model::d2::point_xy<ttmath_big> >();
     test_spherical<bg::model::point<ttmath_big, 2, bg::cs::spherical_equatorial<bg::degree> > >();
@@ -0,0 +1,168 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/simplify_coverage.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+// Offset of a vertex of a shared edge, the same for both polygons
+double wiggle(int x, int y, int i)
+{
+    return 0.02 * (((x * 31 + y * 17 + i * 7 + 100) % 5) - 2);
+}
+
+// Points of the edge from (x, y) to (x + dx, y + dy), without the last one,
+// the vertices are moved perpendicular to the edge
+void add_edge(polygon_type::ring_type& ring, int x, int y, int dx, int dy,
+              int count)
+{
+    // The vertices of an edge are the same from both sides
+    int const sx = dx < 0 || dy < 0 ? x + dx : x;
+    int const sy = dx < 0 || dy < 0 ? y + dy : y;
+    for (int k = 0; k < count; ++k)
+    {
+        int const i = dx < 0 || dy < 0 ? count - k : k;
+        double const t = double(i) / count;
+        double const w = i == 0 || i == count ? 0.0
+                       : wiggle(sx, sy, dx != 0 ? i : -i);
+        ring.push_back(point_type(sx + (dx != 0 ? t : w),
+                                  sy + (dy != 0 ? t : w)));
+    }
+}
+
+// Clockwise cells of a grid with wiggly shared edges
+multi_polygon_type make_grid(int size, int count)
+{
+    multi_polygon_type result;
+    for (int x = 0; x < size; ++x)
+    {
+        for (int y = 0; y < size; ++y)
+        {
+            polygon_type polygon;
+            polygon_type::ring_type& ring = polygon.outer();
+            add_edge(ring, x, y, 0, 1, count);
+            add_edge(ring, x, y + 1, 1, 0, count);
+            add_edge(ring, x + 1, y + 1, 0, -1, count);
+            add_edge(ring, x + 1, y, -1, 0, count);
+            ring.push_back(ring.front());
+            result.push_back(polygon);
+        }
+    }
+    return result;
+}
+
+void check_coverage(multi_polygon_type const& input,
+                    multi_polygon_type const& simplified,
+                    double expected_area, std::string const& caseid)
+{
+    BOOST_CHECK_EQUAL(simplified.size(), input.size());
+
+    double total_area = 0;
+    for (std::size_t i = 0; i < simplified.size(); ++i)
+    {
+        std::string message;
+        BOOST_CHECK_MESSAGE(bg::is_valid(simplified[i], message),
+                            caseid << " " << i << " " << message);
+        total_area += bg::area(simplified[i]);
+
+        for (std::size_t j = i + 1; j < simplified.size(); ++j)
+        {
+            BOOST_CHECK_MESSAGE(! bg::overlaps(simplified[i], simplified[j]),
+                                caseid << " " << i << " overlaps " << j);
+        }
+    }
+
+    // No gaps and no overlaps, only the outer boundary changes the area
+    BOOST_CHECK_CLOSE(total_area, expected_area, 0.001);
+}
+
+void test_grid()
+{
+    multi_polygon_type const grid = make_grid(6, 10);
+
+    multi_polygon_type simplified;
+    bg::simplify_coverage(grid, simplified, 0.1);
+    check_coverage(grid, simplified, 36.0, "grid");
+    BOOST_CHECK_LT(bg::num_points(simplified), bg::num_points(grid) / 4);
+
+    // The edges are straightened, the shared corners are kept
+    BOOST_CHECK_EQUAL(bg::num_points(simplified[0]), 5u);
+    BOOST_CHECK(bg::equals(simplified[0], bg::return_envelope<bg::model::box<point_type> >(simplified[0])));
+
+    multi_polygon_type parallel;
+    bg::simplify_coverage(grid, parallel, 0.1,
+                          bg::strategy::simplify::douglas_peucker
+                              <
+                                  point_type,
+                                  bg::strategy::distance::projected_point<>
+                              >(),
+                          bg::thread_executor(4));
+    BOOST_CHECK_EQUAL(bg::to_wkt(parallel), bg::to_wkt(simplified));
+
+    // A small tolerance keeps the wiggles, only collinear points are removed
+    multi_polygon_type detailed;
+    bg::simplify_coverage(grid, detailed, 0.001);
+    check_coverage(grid, detailed, bg::area(grid), "detailed");
+    BOOST_CHECK_GT(bg::num_points(detailed), 3 * bg::num_points(grid) / 4);
+}
+
+void test_hole()
+{
+    // The island fills the hole, both are simplified to the same square
+    multi_polygon_type coverage;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),"
+                 "(2 2,8 2,8.01 5,8 8,5 8.01,2 8,2 2)),"
+                 "((2 2,2 8,5 8.01,8 8,8.01 5,8 2,2 2)))", coverage);
+
+    multi_polygon_type simplified;
+    bg::simplify_coverage(coverage, simplified, 0.1);
+    check_coverage(coverage, simplified, 100.0, "hole");
+    BOOST_CHECK_EQUAL(bg::num_points(simplified), 15u);
+    BOOST_CHECK_CLOSE(bg::area(simplified[1]), 36.0, 0.001);
+}
+
+void test_conflict()
+{
+    // The shared boundary of the polygons would cross the island if it
+    // was simplified to a straight line
+    multi_polygon_type coverage;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 5,0 10,5 10,5 6,4.5 5,5 4,5 0,0 0)),"
+                 "((5 0,5 4,4.5 5,5 6,5 10,10 10,10 0,5 0),"
+                 "(4.7 4.9,4.9 4.9,4.8 5.1,4.7 4.9)),"
+                 "((4.7 4.9,4.8 5.1,4.9 4.9,4.7 4.9)))", coverage);
+
+    multi_polygon_type simplified;
+    bg::simplify_coverage(coverage, simplified, 1.0);
+    check_coverage(coverage, simplified, 100.0, "conflict");
+
+    // The outer boundary is simplified, the shared boundary keeps the bend
+    // and the island is kept
+    BOOST_CHECK_EQUAL(bg::num_points(simplified[0]), 8u);
+    BOOST_CHECK_EQUAL(bg::num_points(simplified[1]), 12u);
+    BOOST_CHECK_EQUAL(bg::num_points(simplified[2]), 4u);
+}
+
+int test_main(int, char* [])
+{
+    test_grid();
+    test_hole();
+    test_conflict();
+
+    return 0;
+}
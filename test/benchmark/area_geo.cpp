@@ -0,0 +1,64 @@
+// Boost.Geometry
+// Benchmark of the geographic area
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+
+#include <boost/geometry.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+// Star shaped polygons with many vertices, resembling boundaries of
+// administrative units
+multi_polygon_type make_multi_polygon(std::size_t polygons, std::size_t vertices)
+{
+    double const pi = bg::math::pi<double>();
+
+    multi_polygon_type mpoly;
+    mpoly.resize(polygons);
+    for (std::size_t p = 0 ; p < polygons ; ++p)
+    {
+        double const lon = -170.0 + 340.0 * double(p) / double(polygons);
+        double const lat = -60.0 + 120.0 * double(p % 7) / 7.0;
+
+        polygon_type & poly = mpoly[p];
+        poly.outer().reserve(vertices + 1);
+        for (std::size_t i = 0 ; i < vertices ; ++i)
+        {
+            double const a = -2.0 * pi * double(i) / double(vertices);
+            double const r = 1.0 + 0.2 * std::sin(13.0 * a);
+            poly.outer().push_back(point_type(lon + r * std::cos(a), lat + r * std::sin(a)));
+        }
+        poly.outer().push_back(poly.outer().front());
+    }
+    return mpoly;
+}
+
+template <typename FormulaPolicy>
+void run(std::string const& name, multi_polygon_type const& mpoly)
+{
+    bg::strategy::area::geographic<FormulaPolicy> const strategy;
+    measure(name, 5, [&]() { return bg::area(mpoly, strategy); });
+}
+
+int main()
+{
+    multi_polygon_type const mpoly = make_multi_polygon(1000, 1000);
+
+    std::cout << "multi_polygon: " << mpoly.size() << " polygons, "
+              << bg::num_points(mpoly) << " points" << std::endl;
+
+    run<bg::strategy::andoyer>("area andoyer", mpoly);
+    run<bg::strategy::thomas>("area thomas", mpoly);
+    run<bg::strategy::vincenty>("area vincenty", mpoly);
+
+    return 0;
+}
@@ -0,0 +1,44 @@
+// Boost.Geometry
+// Benchmarks
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_BENCHMARK_COMMON_HPP
+#define BOOST_GEOMETRY_BENCHMARK_COMMON_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace bg = boost::geometry;
+
+typedef std::chrono::steady_clock clock_type;
+
+// Runs f() repeatedly and prints the best time of a single run in
+// milliseconds, the value returned by the last run is printed as well so
+// the calculation can not be optimized away.
+template <typename Function>
+inline double measure(std::string const& name, std::size_t runs, Function const& f)
+{
+    double best = 0;
+    for (std::size_t i = 0 ; i < runs ; ++i)
+    {
+        clock_type::time_point const start = clock_type::now();
+        auto const result = f();
+        std::chrono::duration<double, std::milli> const d = clock_type::now() - start;
+        if (i == 0 || d.count() < best)
+        {
+            best = d.count();
+        }
+        if (i + 1 == runs)
+        {
+            std::cout << name << ": " << best << " ms (" << result << ")" << std::endl;
+        }
+    }
+    return best;
+}
+
+#endif // BOOST_GEOMETRY_BENCHMARK_COMMON_HPP
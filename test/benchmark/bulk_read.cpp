@@ -0,0 +1,147 @@
+// Boost.Geometry
+// Benchmark of the bulk WKT and WKB readers, reading the geometries and
+// packing an rtree of their envelopes
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/io/wkt/read_lines.hpp>
+#include <boost/geometry/util/executor.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_wkb_batch.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef std::pair<box_type, std::size_t> value_type;
+typedef bg::index::rtree<value_type, bg::index::rstar<16> > rtree_type;
+
+// Newline-delimited parcel-like polygons with projected coordinates
+std::string make_text(std::size_t count)
+{
+    std::ostringstream out;
+    out << std::setprecision(10);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const cx = 150000.0 + 37.123456789 * double(i % 1000);
+        double const cy = 460000.0 + 41.987654321 * double(i / 1000);
+        std::size_t const n = 8 + i % 32;
+
+        out << "POLYGON((";
+        for (std::size_t j = 0 ; j <= n ; ++j)
+        {
+            double const a = -2.0 * bg::math::pi<double>() * double(j % n) / double(n);
+            out << (j > 0 ? "," : "")
+                << cx + 15.0 * std::cos(a) << " " << cy + 15.0 * std::sin(a);
+        }
+        out << "))\n";
+    }
+    return out.str();
+}
+
+int main()
+{
+    std::size_t const count = 200000;
+    std::string const text = make_text(count);
+    std::cout << "WKT: " << double(text.size()) / (1024.0 * 1024.0) << " MB" << std::endl;
+
+    bg::thread_executor const threads;
+    std::cout << "threads: " << threads.threads_count() << std::endl;
+
+    measure("read_wkt per line, envelopes, rtree", 3, [&]()
+    {
+        std::vector<polygon_type> polygons;
+        std::istringstream in(text);
+        std::string line;
+        while (std::getline(in, line))
+        {
+            polygons.push_back(polygon_type());
+            bg::read_wkt(line, polygons.back());
+        }
+        std::vector<value_type> values;
+        values.reserve(polygons.size());
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            values.push_back(value_type(bg::return_envelope<box_type>(polygons[i]), i));
+        }
+        rtree_type rtree(values);
+        return rtree.size();
+    });
+
+    measure("read_wkt_lines sequential, rtree", 3, [&]()
+    {
+        std::vector<polygon_type> polygons;
+        std::vector<value_type> values;
+        bg::read_wkt_lines(text, polygons, values, bg::sequential_executor());
+        rtree_type rtree(values);
+        return rtree.size();
+    });
+
+    measure("read_wkt_lines threads, rtree", 3, [&]()
+    {
+        std::vector<polygon_type> polygons;
+        std::vector<value_type> values;
+        bg::read_wkt_lines(text, polygons, values, threads);
+        rtree_type rtree(values);
+        return rtree.size();
+    });
+
+    std::vector<polygon_type> polygons;
+    bg::read_wkt_lines(text, polygons, threads);
+    std::vector<boost::uint8_t> data;
+    std::vector<boost::uint32_t> offsets;
+    bg::write_wkb_batch(polygons, data, offsets, bg::detail::wkb::byte_order_type::ndr);
+    std::cout << "WKB: " << double(data.size()) / (1024.0 * 1024.0) << " MB" << std::endl;
+
+    measure("read_ewkb per geometry, envelopes, rtree", 3, [&]()
+    {
+        std::vector<polygon_type> result(offsets.size() - 1);
+        std::vector<value_type> values;
+        values.reserve(result.size());
+        for (std::size_t i = 0 ; i < result.size() ; ++i)
+        {
+            bg::read_ewkb(data.data() + offsets[i], offsets[i + 1] - offsets[i], result[i]);
+            values.push_back(value_type(bg::return_envelope<box_type>(result[i]), i));
+        }
+        rtree_type rtree(values);
+        return rtree.size();
+    });
+
+    measure("read_wkb_batch sequential, rtree", 3, [&]()
+    {
+        std::vector<polygon_type> result;
+        std::vector<value_type> values;
+        bg::read_wkb_batch(data.data(), offsets.data(), offsets.size() - 1,
+                           result, values, bg::sequential_executor());
+        rtree_type rtree(values);
+        return rtree.size();
+    });
+
+    measure("read_wkb_batch threads, rtree", 3, [&]()
+    {
+        std::vector<polygon_type> result;
+        std::vector<value_type> values;
+        bg::read_wkb_batch(data.data(), offsets.data(), offsets.size() - 1,
+                           result, values, threads);
+        rtree_type rtree(values);
+        return rtree.size();
+    });
+
+    return 0;
+}
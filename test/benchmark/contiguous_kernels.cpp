@@ -0,0 +1,120 @@
+// Boost.Geometry
+// Benchmark of the area, perimeter and centroid of rings of 10 to 10^7
+// points, with the kernels for points stored contiguously and segment by
+// segment for the same points stored in a deque. Each measurement processes
+// 10^7 points, smaller rings are processed repeatedly.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Area, length and centroid use the kernels only if enabled
+#define BOOST_GEOMETRY_ENABLE_VECTORIZED_SUMS
+
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::ring<point_type> ring_type;
+typedef bg::model::ring<point_type, true, true, std::deque> deque_ring_type;
+
+inline double uniform(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53);
+}
+
+// Clockwise star-shaped rings of size points
+template <typename Ring>
+std::vector<Ring> make_rings(std::size_t count, std::size_t size)
+{
+    double const pi = 3.14159265358979323846;
+    std::vector<Ring> result(count);
+    std::size_t state = 13;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const x = 100000.0 * uniform(state);
+        double const y = 100000.0 * uniform(state);
+        Ring& ring = result[i];
+        for (std::size_t j = 0 ; j + 1 < size ; ++j)
+        {
+            double const angle = -2.0 * pi * j / (size - 1);
+            double const radius = 50.0 + 20.0 * uniform(state);
+            ring.push_back(point_type(x + radius * std::cos(angle),
+                                      y + radius * std::sin(angle)));
+        }
+        ring.push_back(ring.front());
+    }
+    return result;
+}
+
+template <typename Ring>
+void measure_rings(std::string const& name, std::size_t size)
+{
+    std::size_t const count = size < 100000 ? 100000 / size : 1;
+    std::size_t const repeat = 10000000 / (count * size);
+    std::vector<Ring> const rings = make_rings<Ring>(count, size);
+
+    measure("area " + name, 3, [&]()
+    {
+        double sum = 0.0;
+        for (std::size_t r = 0 ; r < repeat ; ++r)
+        {
+            for (std::size_t i = 0 ; i < rings.size() ; ++i)
+            {
+                sum += bg::area(rings[i]);
+            }
+        }
+        return sum;
+    });
+
+    measure("perimeter " + name, 3, [&]()
+    {
+        double sum = 0.0;
+        for (std::size_t r = 0 ; r < repeat ; ++r)
+        {
+            for (std::size_t i = 0 ; i < rings.size() ; ++i)
+            {
+                sum += bg::perimeter(rings[i]);
+            }
+        }
+        return sum;
+    });
+
+    measure("centroid " + name, 3, [&]()
+    {
+        double sum = 0.0;
+        for (std::size_t r = 0 ; r < repeat ; ++r)
+        {
+            for (std::size_t i = 0 ; i < rings.size() ; ++i)
+            {
+                point_type centroid;
+                bg::centroid(rings[i], centroid);
+                sum += bg::get<0>(centroid);
+            }
+        }
+        return sum;
+    });
+}
+
+int main()
+{
+    for (std::size_t size = 10 ; size <= 10000000 ; size *= 10)
+    {
+        std::ostringstream out;
+        out << size;
+        measure_rings<ring_type>("contiguous " + out.str(), size);
+        measure_rings<deque_ring_type>("deque " + out.str(), size);
+    }
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+// Boost.Geometry
+// Benchmark of the convex hull of large multi-points: sequential with the
+// interior filter, in chunks merged by an executor and incremental
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/incremental_convex_hull.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef bg::model::ring<point_type> ring_type;
+
+inline double uniform(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53);
+}
+
+// Uniformly distributed points in a square or in a disk, the hull of
+// a disk has many more vertices
+multi_point_type make_points(std::size_t count, bool disk)
+{
+    std::size_t state = 42;
+    multi_point_type result;
+    result.reserve(count);
+    while (result.size() < count)
+    {
+        double const x = 2.0 * uniform(state) - 1.0;
+        double const y = 2.0 * uniform(state) - 1.0;
+        if (! disk || x * x + y * y <= 1.0)
+        {
+            result.push_back(point_type(150000.0 + 1000.0 * x,
+                                        460000.0 + 1000.0 * y));
+        }
+    }
+    return result;
+}
+
+void run(std::string const& name, multi_point_type const& points,
+         bg::thread_executor const& threads)
+{
+    std::cout << name << ": " << points.size() << " points" << std::endl;
+
+    measure("convex_hull", 3, [&]()
+    {
+        ring_type hull;
+        bg::convex_hull(points, hull);
+        return hull.size();
+    });
+
+    measure("convex_hull chunks, sequential", 3, [&]()
+    {
+        ring_type hull;
+        bg::convex_hull(points, hull, bg::default_strategy(),
+                        bg::sequential_executor());
+        return hull.size();
+    });
+
+    measure("convex_hull chunks, threads", 3, [&]()
+    {
+        ring_type hull;
+        bg::convex_hull(points, hull, bg::default_strategy(), threads);
+        return hull.size();
+    });
+
+    measure("incremental_convex_hull", 3, [&]()
+    {
+        bg::incremental_convex_hull<point_type> incremental;
+        incremental.insert_range(points);
+        ring_type hull;
+        incremental.get(hull);
+        return hull.size();
+    });
+}
+
+int main()
+{
+    std::size_t const count = 10000000;
+
+    bg::thread_executor const threads;
+    std::cout << "threads: " << threads.threads_count() << std::endl;
+
+    run("square", make_points(count, false), threads);
+    run("disk", make_points(count, true), threads);
+
+    return 0;
+}
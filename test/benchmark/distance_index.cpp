@@ -0,0 +1,124 @@
+// Boost.Geometry
+// Benchmark of the distances of vehicles to a road network, calculated by
+// distance() and by a distance_index of the roads built once
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/distance_index.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+
+inline double noise(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53) - 0.5;
+}
+
+// Roads in meters: random walks of 50 points with 40 m segments
+multi_linestring_type make_roads(std::size_t count)
+{
+    std::size_t state = 1;
+    multi_linestring_type result;
+    result.resize(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double x = 20000.0 * (noise(state) + 0.5);
+        double y = 20000.0 * (noise(state) + 0.5);
+        double heading = 6.28 * (noise(state) + 0.5);
+        for (std::size_t j = 0 ; j < 50 ; ++j)
+        {
+            result[i].push_back(point_type(x, y));
+            heading += 0.5 * noise(state);
+            x += 40.0 * std::cos(heading);
+            y += 40.0 * std::sin(heading);
+        }
+    }
+    return result;
+}
+
+int main()
+{
+    multi_linestring_type const roads = make_roads(2000);
+
+    std::size_t state = 7;
+    std::vector<multi_point_type> fleets(2000);
+    for (std::size_t i = 0 ; i < fleets.size() ; ++i)
+    {
+        for (std::size_t j = 0 ; j < 50 ; ++j)
+        {
+            fleets[i].push_back(point_type(20000.0 * (noise(state) + 0.5),
+                                           20000.0 * (noise(state) + 0.5)));
+        }
+    }
+
+    std::cout << "100000 segments, " << fleets.size() << " fleets of 50 vehicles" << std::endl;
+
+    measure("distance(point, roads), 1000 vehicles", 1, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < 20 ; ++i)
+        {
+            for (std::size_t j = 0 ; j < fleets[i].size() ; ++j)
+            {
+                sum += bg::distance(fleets[i][j], roads);
+            }
+        }
+        return sum;
+    });
+
+    measure("distance(fleet, roads), 20 fleets", 1, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < 20 ; ++i)
+        {
+            sum += bg::distance(fleets[i], roads);
+        }
+        return sum;
+    });
+
+    measure("distance_index of roads, build", 3, [&]()
+    {
+        bg::distance_index<multi_linestring_type> const index(roads);
+        return index.distance(fleets[0][0]);
+    });
+
+    bg::distance_index<multi_linestring_type> const index(roads);
+
+    measure("distance_index, point, 100000 vehicles", 3, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < fleets.size() ; ++i)
+        {
+            for (std::size_t j = 0 ; j < fleets[i].size() ; ++j)
+            {
+                sum += index.distance(fleets[i][j]);
+            }
+        }
+        return sum;
+    });
+
+    measure("distance_index, fleet, 2000 fleets", 3, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < fleets.size() ; ++i)
+        {
+            sum += index.distance(fleets[i]);
+        }
+        return sum;
+    });
+
+    return 0;
+}
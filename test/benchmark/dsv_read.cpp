@@ -0,0 +1,90 @@
+// Boost.Geometry
+// Benchmark of the DSV point reader, reading a point dump and packing an
+// rtree of the points
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/io/dsv/read.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 3, bg::cs::cartesian> point_type;
+typedef bg::index::rtree<point_type, bg::index::rstar<16> > rtree_type;
+
+// LIDAR-like points with projected coordinates and an intensity column
+std::string make_text(std::size_t count)
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3) << "x,y,z,intensity\n";
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        out << 150000.0 + 0.137 * double(i % 100000) << ","
+            << 460000.0 + 0.211 * double(i / 100000) << ","
+            << 12.0 + 0.001 * double(i % 7919) << ","
+            << i % 256 << "\n";
+    }
+    return out.str();
+}
+
+int main()
+{
+    std::size_t const count = 2000000;
+    std::string const text = make_text(count);
+    std::cout << "DSV: " << double(text.size()) / (1024.0 * 1024.0) << " MB" << std::endl;
+
+    bg::thread_executor const threads;
+    std::cout << "threads: " << threads.threads_count() << std::endl;
+
+    measure("istream", 3, [&]()
+    {
+        std::vector<point_type> points;
+        std::istringstream in(text);
+        std::string line;
+        std::getline(in, line);
+        double x, y, z;
+        char c;
+        int intensity;
+        while (in >> x >> c >> y >> c >> z >> c >> intensity)
+        {
+            points.push_back(point_type(x, y, z));
+        }
+        return points.size();
+    });
+
+    measure("read_dsv sequential", 3, [&]()
+    {
+        std::vector<point_type> points;
+        bg::read_dsv(text, points, bg::dsv_read_options(",", 1),
+                     bg::sequential_executor());
+        return points.size();
+    });
+
+    measure("read_dsv threads", 3, [&]()
+    {
+        std::vector<point_type> points;
+        bg::read_dsv(text, points, bg::dsv_read_options(",", 1), threads);
+        return points.size();
+    });
+
+    measure("read_dsv threads, rtree", 3, [&]()
+    {
+        std::vector<point_type> points;
+        bg::read_dsv(text, points, bg::dsv_read_options(",", 1), threads);
+        rtree_type rtree(points);
+        return rtree.size();
+    });
+
+    return 0;
+}
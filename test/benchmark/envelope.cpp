@@ -0,0 +1,106 @@
+// Boost.Geometry
+// Benchmark of the envelope of large linestrings and multipoints, with the
+// points stored contiguously and in a deque, sequentially and with threads.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <deque>
+#include <string>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > geo_point_type;
+
+inline double uniform(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53);
+}
+
+template <typename Geometry>
+Geometry make_range(std::size_t size, double lon_min, double lon_width)
+{
+    typedef typename bg::point_type<Geometry>::type p_type;
+    Geometry result;
+    std::size_t state = 11;
+    for (std::size_t i = 0 ; i < size ; ++i)
+    {
+        double const lon = lon_min + lon_width * uniform(state);
+        result.push_back(p_type(lon > 180.0 ? lon - 360.0 : lon,
+                                60.0 * uniform(state) - 30.0));
+    }
+    return result;
+}
+
+// The envelope of a geometry in the cache, calculated repeatedly
+template <typename Geometry>
+void measure_repeated(std::string const& name, Geometry const& geometry)
+{
+    typedef bg::model::box<typename bg::point_type<Geometry>::type> box_type;
+
+    measure(name + " repeated", 3, [&]()
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0 ; i < 1000 ; ++i)
+        {
+            box_type box;
+            bg::envelope(geometry, box);
+            sum += bg::get<bg::min_corner, 0>(box);
+        }
+        return sum;
+    });
+}
+
+template <typename Geometry>
+void measure_envelope(std::string const& name, Geometry const& geometry)
+{
+    typedef bg::model::box<typename bg::point_type<Geometry>::type> box_type;
+
+    measure(name, 3, [&]()
+    {
+        box_type box;
+        bg::envelope(geometry, box);
+        return bg::get<bg::min_corner, 0>(box);
+    });
+
+    measure(name + " threads", 3, [&]()
+    {
+        box_type box;
+        bg::envelope(geometry, box, bg::default_strategy(),
+                     bg::thread_executor());
+        return bg::get<bg::min_corner, 0>(box);
+    });
+}
+
+int main()
+{
+    std::size_t const size = 10000000;
+
+    measure_repeated("linestring",
+        make_range<bg::model::linestring<point_type> >(10000, 0.0, 100.0));
+    measure_repeated("deque linestring",
+        make_range<bg::model::linestring<point_type, std::deque> >(10000, 0.0, 100.0));
+
+    measure_envelope("linestring",
+        make_range<bg::model::linestring<point_type> >(size, 0.0, 100.0));
+    measure_envelope("deque linestring",
+        make_range<bg::model::linestring<point_type, std::deque> >(size, 0.0, 100.0));
+    measure_envelope("multipoint",
+        make_range<bg::model::multi_point<point_type> >(size, 0.0, 100.0));
+
+    // Crossing the antimeridian the geographic longitudes are sorted
+    measure_envelope("geographic multipoint",
+        make_range<bg::model::multi_point<geo_point_type> >(size, 100.0, 100.0));
+    measure_envelope("geographic linestring",
+        make_range<bg::model::linestring<geo_point_type> >(size / 10, 170.0, 20.0));
+
+    return 0;
+}
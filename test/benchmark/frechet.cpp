@@ -0,0 +1,171 @@
+// Boost.Geometry
+// Benchmark of the discrete Frechet distance of trajectories: the distance,
+// the banded approximation and the decision, compared with the coupling
+// measure calculated in the full matrix
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+
+// GPS-like trajectories in meters, the second trajectory of a pair is the
+// first one matched to a road with an offset and fewer points
+inline double noise(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53) - 0.5;
+}
+
+void make_pair(std::size_t seed, std::size_t count,
+               linestring_type& ls1, linestring_type& ls2)
+{
+    std::size_t state = seed * 7919 + 1;
+    double x = 150000.0 + 1000.0 * double(seed % 100);
+    double y = 460000.0 + 1000.0 * double(seed / 100);
+    double heading = 6.28 * (noise(state) + 0.5);
+    ls1.clear();
+    ls2.clear();
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        heading += 0.2 * noise(state);
+        x += 5.0 * std::cos(heading);
+        y += 5.0 * std::sin(heading);
+        ls1.push_back(point_type(x + 2.0 * noise(state), y + 2.0 * noise(state)));
+        if (i % 10 != 3)
+        {
+            ls2.push_back(point_type(x + 3.0 + 2.0 * noise(state), y - 2.0 + 2.0 * noise(state)));
+        }
+    }
+}
+
+double full_matrix(linestring_type const& ls1, linestring_type const& ls2)
+{
+    std::size_t const a = ls1.size();
+    std::size_t const b = ls2.size();
+    std::vector<double> c(a * b);
+    for (std::size_t i = 0 ; i < a ; ++i)
+    {
+        for (std::size_t j = 0 ; j < b ; ++j)
+        {
+            double const d = bg::distance(ls1[i], ls2[j]);
+            double m = d;
+            if (i > 0 && j > 0)
+                m = (std::min)(c[(i - 1) * b + j - 1], (std::min)(c[(i - 1) * b + j], c[i * b + j - 1]));
+            else if (i > 0)
+                m = c[(i - 1) * b + j];
+            else if (j > 0)
+                m = c[i * b + j - 1];
+            c[i * b + j] = (std::max)(m, d);
+        }
+    }
+    return c.back();
+}
+
+template <typename Function>
+void run(std::size_t pairs, std::size_t count, bool with_full, Function const& distance_of)
+{
+    std::vector<linestring_type> first(pairs), second(pairs);
+    for (std::size_t i = 0 ; i < pairs ; ++i)
+    {
+        make_pair(i, count, first[i], second[i]);
+    }
+
+    std::cout << pairs << " pairs of " << count << " points" << std::endl;
+
+    if (with_full)
+    {
+        measure("full matrix", 1, [&]()
+        {
+            double sum = 0;
+            for (std::size_t i = 0 ; i < pairs ; ++i)
+            {
+                sum += full_matrix(first[i], second[i]);
+            }
+            return sum;
+        });
+    }
+
+    distance_of(first, second);
+}
+
+void measure_all(std::vector<linestring_type> const& first,
+                 std::vector<linestring_type> const& second,
+                 bool with_distance)
+{
+    std::size_t const pairs = first.size();
+
+    if (with_distance)
+    {
+        measure("discrete_frechet_distance", 1, [&]()
+        {
+            double sum = 0;
+            for (std::size_t i = 0 ; i < pairs ; ++i)
+            {
+                sum += bg::discrete_frechet_distance(first[i], second[i]);
+            }
+            return sum;
+        });
+    }
+
+    measure("discrete_frechet_distance_banded, 50", 1, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < pairs ; ++i)
+        {
+            sum += bg::discrete_frechet_distance_banded(first[i], second[i], 50);
+        }
+        return sum;
+    });
+
+    measure("is_within_discrete_frechet_distance, 15 m", 1, [&]()
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0 ; i < pairs ; ++i)
+        {
+            count += bg::is_within_discrete_frechet_distance(first[i], second[i], 15.0) ? 1 : 0;
+        }
+        return count;
+    });
+
+    measure("is_within_discrete_frechet_distance, 5 m", 1, [&]()
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0 ; i < pairs ; ++i)
+        {
+            count += bg::is_within_discrete_frechet_distance(first[i], second[i], 5.0) ? 1 : 0;
+        }
+        return count;
+    });
+}
+
+int main()
+{
+    run(20, 4000, true,
+        [](std::vector<linestring_type> const& first,
+           std::vector<linestring_type> const& second)
+        {
+            measure_all(first, second, true);
+        });
+
+    // The coupling matrix of these pairs does not fit in memory
+    run(4, 100000, false,
+        [](std::vector<linestring_type> const& first,
+           std::vector<linestring_type> const& second)
+        {
+            measure_all(first, second, false);
+        });
+
+    return 0;
+}
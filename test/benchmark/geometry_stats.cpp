@@ -0,0 +1,118 @@
+// Boost.Geometry
+// Benchmark of the area, perimeter, centroid, envelope and number of points
+// of many polygons, calculated separately, fused in one pass and in parallel
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/geometry_stats.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::geometry_stats_result<polygon_type> result_type;
+typedef bg::default_stats_strategies<polygon_type>::type strategies_type;
+
+inline double uniform(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53);
+}
+
+// Star-shaped clockwise polygons with a hole, spread over a large area
+std::vector<polygon_type> make_polygons(std::size_t count, std::size_t size)
+{
+    double const pi = 3.14159265358979323846;
+    std::vector<polygon_type> result(count);
+    std::size_t state = 11;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const x = 100000.0 * uniform(state);
+        double const y = 100000.0 * uniform(state);
+        polygon_type& polygon = result[i];
+        for (std::size_t j = 0 ; j < size ; ++j)
+        {
+            double const angle = -2.0 * pi * j / size;
+            double const radius = 50.0 + 20.0 * uniform(state);
+            polygon.outer().push_back(point_type(x + radius * std::cos(angle),
+                                                 y + radius * std::sin(angle)));
+        }
+        polygon.outer().push_back(polygon.outer().front());
+
+        polygon.inners().resize(1);
+        for (std::size_t j = 0 ; j < size / 4 ; ++j)
+        {
+            double const angle = 2.0 * pi * j / (size / 4);
+            polygon.inners()[0].push_back(point_type(x + 10.0 * std::cos(angle),
+                                                     y + 10.0 * std::sin(angle)));
+        }
+        polygon.inners()[0].push_back(polygon.inners()[0].front());
+    }
+    return result;
+}
+
+int main()
+{
+    std::vector<polygon_type> const polygons = make_polygons(100000, 100);
+
+    measure("area, perimeter, centroid, envelope, num_points", 3, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            sum += bg::area(polygons[i]);
+            sum += bg::perimeter(polygons[i]);
+            point_type const c = bg::return_centroid<point_type>(polygons[i]);
+            box_type const b = bg::return_envelope<box_type>(polygons[i]);
+            sum += bg::get<0>(c) + bg::get<bg::min_corner, 0>(b);
+            sum += double(bg::num_points(polygons[i]));
+        }
+        return sum;
+    });
+
+    measure("geometry_stats", 3, [&]()
+    {
+        double sum = 0;
+        result_type result;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            bg::geometry_stats(polygons[i], result);
+            sum += result.area + result.perimeter + bg::get<0>(result.centroid)
+                 + bg::get<bg::min_corner, 0>(result.envelope)
+                 + double(result.num_points);
+        }
+        return sum;
+    });
+
+    measure("geometry_stats area and centroid", 3, [&]()
+    {
+        double sum = 0;
+        result_type result;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            bg::geometry_stats<bg::stats_area | bg::stats_centroid>(polygons[i], result);
+            sum += result.area + bg::get<0>(result.centroid);
+        }
+        return sum;
+    });
+
+    measure("geometry_stats range, 4 threads", 3, [&]()
+    {
+        std::vector<result_type> results;
+        bg::geometry_stats(polygons, results, strategies_type(),
+                           bg::thread_executor(4));
+        return results.back().area;
+    });
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Boost.Geometry
+// Benchmark of the discrete Hausdorff distance of trajectories, compared
+// with the brute force scan of all pairs of points
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+
+// GPS-like trajectories in meters: a smooth random walk with noise, the
+// second trajectory of a pair follows the first one with an offset
+inline double noise(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53) - 0.5;
+}
+
+void make_pair(std::size_t seed, std::size_t count,
+               linestring_type& ls1, linestring_type& ls2)
+{
+    std::size_t state = seed * 7919 + 1;
+    double x = 150000.0 + 1000.0 * double(seed % 100);
+    double y = 460000.0 + 1000.0 * double(seed / 100);
+    double heading = 6.28 * (noise(state) + 0.5);
+    ls1.clear();
+    ls2.clear();
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        heading += 0.2 * noise(state);
+        x += 5.0 * std::cos(heading);
+        y += 5.0 * std::sin(heading);
+        ls1.push_back(point_type(x + 2.0 * noise(state), y + 2.0 * noise(state)));
+        if (i % 10 != 3)
+        {
+            ls2.push_back(point_type(x + 8.0 + 3.0 * noise(state), y - 4.0 + 3.0 * noise(state)));
+        }
+    }
+}
+
+template <typename Range1, typename Range2>
+double brute_force(Range1 const& r1, Range2 const& r2)
+{
+    double result = 0;
+    for (std::size_t i = 0 ; i < r1.size() ; ++i)
+    {
+        double nearest = bg::distance(r1[i], r2[0]);
+        for (std::size_t j = 1 ; j < r2.size() ; ++j)
+        {
+            double const d = bg::distance(r1[i], r2[j]);
+            if (d < nearest)
+            {
+                nearest = d;
+            }
+        }
+        if (nearest > result)
+        {
+            result = nearest;
+        }
+    }
+    return result;
+}
+
+int main()
+{
+    std::size_t const pairs = 200;
+    std::size_t const count = 2000;
+
+    std::vector<linestring_type> first(pairs), second(pairs);
+    for (std::size_t i = 0 ; i < pairs ; ++i)
+    {
+        make_pair(i, count, first[i], second[i]);
+    }
+
+    bg::strategy::distance::pythagoras<> const strategy;
+    bg::thread_executor const threads;
+    std::cout << "threads: " << threads.threads_count() << std::endl;
+
+    measure("brute force", 1, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < pairs ; ++i)
+        {
+            sum += brute_force(first[i], second[i]);
+        }
+        return sum;
+    });
+
+    measure("discrete_hausdorff_distance", 3, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < pairs ; ++i)
+        {
+            sum += bg::discrete_hausdorff_distance(first[i], second[i]);
+        }
+        return sum;
+    });
+
+    measure("discrete_hausdorff_distance, threads", 3, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < pairs ; ++i)
+        {
+            sum += bg::discrete_hausdorff_distance(first[i], second[i], strategy, threads);
+        }
+        return sum;
+    });
+
+    // The second trajectories prepared once, like for comparisons of one
+    // trajectory with many others
+    std::vector<bg::discrete_hausdorff_prepared<linestring_type> > prepared;
+    for (std::size_t i = 0 ; i < pairs ; ++i)
+    {
+        prepared.push_back(bg::discrete_hausdorff_prepared<linestring_type>(second[i]));
+    }
+
+    measure("discrete_hausdorff_prepared", 3, [&]()
+    {
+        double sum = 0;
+        for (std::size_t i = 0 ; i < pairs ; ++i)
+        {
+            sum += prepared[i].distance(first[i]);
+        }
+        return sum;
+    });
+
+    return 0;
+}
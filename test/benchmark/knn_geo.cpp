@@ -0,0 +1,83 @@
+// Boost.Geometry
+// Benchmark of the nearest neighbors query in the rtree of geographic points
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include "benchmark_common.hpp"
+
+namespace bgi = boost::geometry::index;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+
+std::vector<point_type> make_points(std::size_t count, unsigned seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> lon(-180, 180);
+    std::uniform_real_distribution<double> lat(-80, 80);
+
+    std::vector<point_type> points;
+    points.reserve(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        points.push_back(point_type(lon(gen), lat(gen)));
+    }
+    return points;
+}
+
+// Finds k nearest neighbors of every query point and sums the exact
+// distances to them.
+template <typename IndexStrategy>
+void run(std::string const& name,
+         std::vector<point_type> const& points,
+         std::vector<point_type> const& queries,
+         std::size_t k)
+{
+    typedef bgi::parameters<bgi::rstar<16>, IndexStrategy> parameters_type;
+    bgi::rtree<point_type, parameters_type> const rtree(points);
+
+    bg::strategy::distance::geographic<bg::strategy::andoyer> const exact;
+    std::vector<point_type> result;
+    result.reserve(k);
+
+    measure(name, 5, [&]()
+    {
+        double sum = 0;
+        for (point_type const& q : queries)
+        {
+            result.clear();
+            rtree.query(bgi::nearest(q, static_cast<unsigned>(k)),
+                        std::back_inserter(result));
+            for (point_type const& p : result)
+            {
+                sum += bg::distance(q, p, exact);
+            }
+        }
+        return sum;
+    });
+}
+
+int main()
+{
+    std::vector<point_type> const points = make_points(1000000, 1);
+    std::vector<point_type> const queries = make_points(10000, 2);
+
+    std::cout << "points: " << points.size()
+              << ", queries: " << queries.size() << std::endl;
+
+    run<bg::strategy::index::geographic<> >("knn 1 andoyer", points, queries, 1);
+    run<bg::strategy::index::geographic_chord<> >("knn 1 chord", points, queries, 1);
+    run<bg::strategy::index::geographic<> >("knn 10 andoyer", points, queries, 10);
+    run<bg::strategy::index::geographic_chord<> >("knn 10 chord", points, queries, 10);
+
+    return 0;
+}
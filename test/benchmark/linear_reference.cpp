@@ -0,0 +1,134 @@
+// Boost.Geometry
+// Benchmark of repeated queries on a geographic linestring of 10^5 points,
+// with line_interpolate and densify calculating the lengths for each call
+// and with a linear_reference calculating them once.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/linear_reference.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+
+inline double uniform(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53);
+}
+
+int main()
+{
+    std::size_t const size = 100000;
+    std::size_t const queries = 1000;
+
+    // A random walk of steps of about 100 meters
+    linestring_type linestring;
+    std::size_t state = 7;
+    double x = 4.0, y = 52.0;
+    for (std::size_t i = 0 ; i < size ; ++i)
+    {
+        linestring.push_back(point_type(x, y));
+        x += 0.0015 * uniform(state);
+        y += 0.001 * (uniform(state) - 0.4);
+    }
+
+    bg::linear_reference<linestring_type> const reference(linestring);
+    double const length = reference.length();
+
+    std::vector<double> distances;
+    for (std::size_t i = 0 ; i < queries ; ++i)
+    {
+        distances.push_back(length * uniform(state));
+    }
+
+    measure("line_interpolate", 3, [&]()
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0 ; i < distances.size() ; ++i)
+        {
+            point_type p;
+            bg::line_interpolate(linestring, distances[i], p);
+            sum += bg::get<0>(p);
+        }
+        return sum;
+    });
+
+    measure("linear_reference construction", 3, [&]()
+    {
+        bg::linear_reference<linestring_type> const r(linestring);
+        return r.length();
+    });
+
+    measure("linear_reference interpolate", 3, [&]()
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0 ; i < distances.size() ; ++i)
+        {
+            point_type p;
+            reference.interpolate(distances[i], p);
+            sum += bg::get<0>(p);
+        }
+        return sum;
+    });
+
+    std::vector<double> sorted = distances;
+    std::sort(sorted.begin(), sorted.end());
+    measure("linear_reference interpolate_sorted", 3, [&]()
+    {
+        multi_point_type points;
+        reference.interpolate_sorted(sorted, points);
+        return bg::get<0>(points.back());
+    });
+
+    multi_point_type nearby;
+    reference.interpolate_sorted(sorted, nearby);
+    for (std::size_t i = 0 ; i < nearby.size() ; ++i)
+    {
+        bg::set<1>(nearby[i], bg::get<1>(nearby[i]) + 0.0005);
+    }
+    measure("linear_reference locate", 3, [&]()
+    {
+        double sum = 0.0;
+        for (std::size_t i = 0 ; i < nearby.size() ; ++i)
+        {
+            sum += reference.locate(nearby[i]);
+        }
+        return sum;
+    });
+
+    // Most or few of the segments are divided
+    double const max_distances[] = { 20.0, 150.0 };
+    for (std::size_t i = 0 ; i < 2 ; ++i)
+    {
+        double const max_distance = max_distances[i];
+        std::string const suffix = i == 0 ? " 20 m" : " 150 m";
+
+        measure("densify" + suffix, 3, [&]()
+        {
+            linestring_type out;
+            bg::densify(linestring, out, max_distance);
+            return out.size();
+        });
+
+        measure("linear_reference densify" + suffix, 3, [&]()
+        {
+            linestring_type out;
+            reference.densify(out, max_distance);
+            return out.size();
+        });
+    }
+
+    return 0;
+}
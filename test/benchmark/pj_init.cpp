@@ -0,0 +1,54 @@
+// Boost.Geometry
+// Benchmark of the initialization of projections from proj4 strings
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll_type;
+typedef bg::model::point<double, 2, bg::cs::cartesian> xy_type;
+
+int main()
+{
+    std::vector<std::string> const definitions = {
+        "+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs",
+        "+proj=merc +ellps=WGS84 +units=m",
+        "+proj=merc +a=6378137 +b=6378137 +lat_ts=0.0 +lon_0=0.0 +x_0=0.0 +y_0=0 +k=1.0 +units=m +nadgrids=@null +wktext +no_defs",
+        "+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995 +x_0=400000 +y_0=0 +ellps=clrk80 +units=m +no_defs",
+        "+proj=utm +zone=32 +ellps=intl +towgs84=-87,-98,-121 +units=m +no_defs",
+        "+proj=lcc +lat_1=49 +lat_2=44 +lat_0=46.5 +lon_0=3 +x_0=700000 +y_0=6600000 +ellps=GRS80 +towgs84=0,0,0,0,0,0,0 +units=m +no_defs",
+        "+proj=stere +lat_0=90 +lat_ts=70 +lon_0=-45 +k=1 +x_0=0 +y_0=0 +datum=WGS84 +units=us-ft +no_defs",
+        "+proj=sterea +lat_0=52.15616055555555 +lon_0=5.38763888888889 +k=0.9999079 +x_0=155000 +y_0=463000 +ellps=bessel +towgs84=565.417,50.3319,465.552,-0.398957,0.343988,-1.8774,4.0725 +units=m +pm=lisbon +no_defs"
+    };
+
+    std::size_t const count = 20000;
+
+    for (std::size_t d = 0 ; d < definitions.size() ; ++d)
+    {
+        std::string const& def = definitions[d];
+        std::cout << def << std::endl;
+        measure("  pj_init", 5, [&]()
+        {
+            double sum = 0;
+            for (std::size_t i = 0 ; i < count ; ++i)
+            {
+                bg::srs::projection<> const prj = bg::srs::proj4(def);
+                xy_type xy;
+                prj.forward(ll_type(4, 51), xy);
+                sum += bg::get<0>(xy);
+            }
+            return sum;
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+// Boost.Geometry
+// Benchmark of the simplification of long GPS traces with Douglas-Peucker,
+// with and without a reused buffer, and with Visvalingam-Whyatt, and of
+// the simplification of a coverage of polygons
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/simplify_coverage.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::strategy::simplify::douglas_peucker
+    <
+        point_type, bg::strategy::distance::projected_point<>
+    > dp_type;
+typedef bg::strategy::simplify::visvalingam_whyatt<point_type> vw_type;
+
+inline double noise(std::size_t& state)
+{
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    return double(state >> 11) / double(1ull << 53) - 0.5;
+}
+
+// Traces in meters, one point per second with a slowly changing heading
+std::vector<linestring_type> make_traces(std::size_t count, std::size_t size)
+{
+    std::vector<linestring_type> result(count);
+    std::size_t state = 7;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double x = 150000.0, y = 460000.0, heading = 0.0;
+        for (std::size_t j = 0 ; j < size ; ++j)
+        {
+            heading += 0.05 * noise(state);
+            x += 10.0 * std::cos(heading) + noise(state);
+            y += 10.0 * std::sin(heading) + noise(state);
+            result[i].push_back(point_type(x, y));
+        }
+    }
+    return result;
+}
+
+// Points of a noisy edge, the same from both sides
+void add_edge(polygon_type::ring_type& ring, double x, double y,
+              double dx, double dy, std::size_t size, bool reversed)
+{
+    std::size_t state = std::size_t(x * 7919 + y * 104729 + dx * 3 + dy);
+    std::vector<point_type> points;
+    for (std::size_t i = 0 ; i < size ; ++i)
+    {
+        double const t = double(i) / size;
+        double const w = i == 0 ? 0.0 : 0.01 * noise(state);
+        points.push_back(point_type(x + dx * t + dy * w, y + dy * t + dx * w));
+    }
+    if (reversed)
+    {
+        points.push_back(point_type(x + dx, y + dy));
+        std::reverse(points.begin(), points.end());
+        points.pop_back();
+    }
+    ring.insert(ring.end(), points.begin(), points.end());
+}
+
+// Clockwise cells of a grid sharing their noisy edges
+multi_polygon_type make_coverage(std::size_t count, std::size_t size)
+{
+    multi_polygon_type result;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        for (std::size_t j = 0 ; j < count ; ++j)
+        {
+            double const x = 10.0 * i, y = 10.0 * j;
+            polygon_type polygon;
+            polygon_type::ring_type& ring = polygon.outer();
+            add_edge(ring, x, y, 0, 10, size, false);
+            add_edge(ring, x, y + 10, 10, 0, size, false);
+            add_edge(ring, x + 10, y, 0, 10, size, true);
+            add_edge(ring, x, y, 10, 0, size, true);
+            ring.push_back(ring.front());
+            result.push_back(polygon);
+        }
+    }
+    return result;
+}
+
+int main()
+{
+    std::vector<linestring_type> const traces = make_traces(20, 100000);
+
+    measure("simplify douglas_peucker", 3, [&]()
+    {
+        std::size_t points = 0;
+        for (std::size_t i = 0 ; i < traces.size() ; ++i)
+        {
+            linestring_type simplified;
+            bg::simplify(traces[i], simplified, 2.0);
+            points += simplified.size();
+        }
+        return points;
+    });
+
+    measure("douglas_peucker reused buffer, indexes", 3, [&]()
+    {
+        bg::strategy::simplify::douglas_peucker_buffer buffer;
+        std::vector<std::size_t> indexes;
+        std::size_t points = 0;
+        for (std::size_t i = 0 ; i < traces.size() ; ++i)
+        {
+            indexes.clear();
+            dp_type::apply_indexes(traces[i], std::back_inserter(indexes), 2.0, buffer);
+            points += indexes.size();
+        }
+        return points;
+    });
+
+    measure("simplify visvalingam_whyatt", 3, [&]()
+    {
+        std::size_t points = 0;
+        for (std::size_t i = 0 ; i < traces.size() ; ++i)
+        {
+            linestring_type simplified;
+            bg::simplify(traces[i], simplified, 20.0, vw_type());
+            points += simplified.size();
+        }
+        return points;
+    });
+
+    multi_polygon_type const coverage = make_coverage(50, 200);
+
+    measure("simplify polygons of coverage, is_valid", 3, [&]()
+    {
+        multi_polygon_type simplified;
+        bg::simplify(coverage, simplified, 0.2);
+        std::size_t valid = 0;
+        for (std::size_t i = 0 ; i < simplified.size() ; ++i)
+        {
+            valid += bg::is_valid(simplified[i]) ? 1 : 0;
+        }
+        return bg::num_points(simplified) + valid;
+    });
+
+    measure("simplify_coverage", 3, [&]()
+    {
+        multi_polygon_type simplified;
+        bg::simplify_coverage(coverage, simplified, 0.2);
+        return bg::num_points(simplified);
+    });
+
+    measure("simplify_coverage 4 threads", 3, [&]()
+    {
+        multi_polygon_type simplified;
+        bg::simplify_coverage(coverage, simplified, 0.2,
+                              bg::strategy::simplify::douglas_peucker
+                                  <
+                                      point_type,
+                                      bg::strategy::distance::projected_point<>
+                                  >(),
+                              bg::thread_executor(4));
+        return bg::num_points(simplified);
+    });
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+// Boost.Geometry
+// Benchmark of the parallel transformation and projection of large geometries
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <thread>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll_type;
+typedef bg::model::point<double, 2, bg::cs::cartesian> xy_type;
+typedef bg::model::multi_polygon<bg::model::polygon<ll_type> > mpoly_ll_type;
+typedef bg::model::multi_polygon<bg::model::polygon<xy_type> > mpoly_xy_type;
+
+mpoly_ll_type make_multi_polygon(std::size_t polygons, std::size_t vertices)
+{
+    double const pi = bg::math::pi<double>();
+
+    mpoly_ll_type mpoly;
+    mpoly.resize(polygons);
+    for (std::size_t p = 0 ; p < polygons ; ++p)
+    {
+        double const lon = 10.0 + 10.0 * double(p) / double(polygons);
+        double const lat = 45.0 + 10.0 * double(p % 7) / 7.0;
+
+        auto & ring = mpoly[p].outer();
+        ring.reserve(vertices + 1);
+        for (std::size_t i = 0 ; i < vertices ; ++i)
+        {
+            double const a = -2.0 * pi * double(i) / double(vertices);
+            ring.push_back(ll_type(lon + std::cos(a), lat + std::sin(a)));
+        }
+        ring.push_back(ring.front());
+    }
+    return mpoly;
+}
+
+bg::srs::transformation<> const tr(
+    bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs"),
+    bg::srs::proj4("+proj=utm +zone=32 +ellps=intl +towgs84=-87,-98,-121 +units=m +no_defs"));
+bg::srs::projection<> const prj = bg::srs::proj4("+proj=tmerc +lat_0=0 +lon_0=15 +ellps=WGS84 +units=m");
+
+template <typename Executor>
+void run(std::string const& name, mpoly_ll_type const& mpoly, Executor const& executor)
+{
+    mpoly_xy_type result;
+    measure("transformation " + name, 3, [&]()
+    {
+        tr.forward(mpoly, result, executor);
+        return bg::get<0>(result.back().outer().back());
+    });
+    measure("projection " + name, 3, [&]()
+    {
+        prj.forward(mpoly, result, executor);
+        return bg::get<0>(result.back().outer().back());
+    });
+}
+
+int main()
+{
+    mpoly_ll_type const mpoly = make_multi_polygon(100, 40000);
+
+    std::cout << "multi_polygon: " << mpoly.size() << " polygons, "
+              << bg::num_points(mpoly) << " points" << std::endl;
+
+    mpoly_xy_type result;
+    measure("transformation without executor", 3, [&]()
+    {
+        tr.forward(mpoly, result);
+        return bg::get<0>(result.back().outer().back());
+    });
+    measure("projection without executor", 3, [&]()
+    {
+        prj.forward(mpoly, result);
+        return bg::get<0>(result.back().outer().back());
+    });
+
+    run("sequential", mpoly, bg::sequential_executor());
+
+    std::size_t const max_threads = (std::max)(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1 ; threads <= max_threads ; threads *= 2)
+    {
+        run(std::to_string(threads) + " threads", mpoly, bg::thread_executor(threads));
+    }
+
+    return 0;
+}
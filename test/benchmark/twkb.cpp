@@ -0,0 +1,130 @@
+// Boost.Geometry
+// Benchmark of TWKB compared to WKB, the sizes and the times of encoding
+// and decoding are reported
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/extensions/gis/io/twkb/read_twkb.hpp>
+#include <boost/geometry/extensions/gis/io/twkb/write_twkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_ewkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::linestring<point_type> linestring_type;
+
+typedef std::vector<boost::uint8_t> byte_vector;
+typedef std::vector<boost::int64_t> offset_vector;
+
+// Parcel-like polygons with projected coordinates
+std::vector<polygon_type> make_parcels(std::size_t count)
+{
+    std::vector<polygon_type> result(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const cx = 150000.0 + 37.123456789 * double(i % 1000);
+        double const cy = 460000.0 + 41.987654321 * double(i / 1000);
+        std::size_t const n = 5 + i % 16;
+        for (std::size_t j = 0 ; j <= n ; ++j)
+        {
+            double const a = -2.0 * bg::math::pi<double>() * double(j % n) / double(n);
+            double const r = 15.0 + double((i * 7 + j * 13) % 100) / 20.0;
+            result[i].outer().push_back(point_type(cx + r * std::cos(a), cy + r * std::sin(a)));
+        }
+    }
+    return result;
+}
+
+// Road-like linestrings with many vertices at small distances
+std::vector<linestring_type> make_roads(std::size_t count)
+{
+    std::vector<linestring_type> result(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double x = 150000.0 + double(i * 37 % 20000);
+        double y = 460000.0 + double(i * 91 % 20000);
+        std::size_t const n = 50 + i % 150;
+        for (std::size_t j = 0 ; j < n ; ++j)
+        {
+            x += 10.0 * std::sin(double(i + j) * 0.37) + 3.141;
+            y += 10.0 * std::cos(double(i * j) * 0.11) - 1.234;
+            result[i].push_back(point_type(x, y));
+        }
+    }
+    return result;
+}
+
+template <typename Geometry>
+void run(std::string const& name, std::vector<Geometry> const& geometries, int precision)
+{
+    byte_vector wkb, twkb;
+    offset_vector wkb_offsets, twkb_offsets;
+    bg::twkb_options const options(precision);
+
+    measure(name + ", WKB write", 5, [&]()
+    {
+        wkb.clear();
+        wkb_offsets.clear();
+        bg::write_wkb_batch(geometries, wkb, wkb_offsets,
+                            bg::detail::wkb::byte_order_type::ndr);
+        return wkb.size();
+    });
+    measure(name + ", TWKB write", 5, [&]()
+    {
+        twkb.clear();
+        twkb_offsets.clear();
+        bg::write_twkb_batch(geometries, twkb, twkb_offsets, options);
+        return twkb.size();
+    });
+
+    measure(name + ", WKB read", 5, [&]()
+    {
+        std::size_t points = 0;
+        Geometry geometry;
+        for (std::size_t i = 0 ; i + 1 < wkb_offsets.size() ; ++i)
+        {
+            bg::read_ewkb(wkb.data() + wkb_offsets[i],
+                          std::size_t(wkb_offsets[i + 1] - wkb_offsets[i]), geometry);
+            points += bg::num_points(geometry);
+        }
+        return points;
+    });
+    measure(name + ", TWKB read", 5, [&]()
+    {
+        std::size_t points = 0;
+        Geometry geometry;
+        for (std::size_t i = 0 ; i + 1 < twkb_offsets.size() ; ++i)
+        {
+            bg::read_twkb(twkb.data() + twkb_offsets[i],
+                          std::size_t(twkb_offsets[i + 1] - twkb_offsets[i]), geometry);
+            points += bg::num_points(geometry);
+        }
+        return points;
+    });
+
+    std::cout << "  WKB " << wkb.size() / 1024 << " KB, TWKB "
+              << twkb.size() / 1024 << " KB" << std::endl;
+}
+
+int main()
+{
+    run("parcels, precision 2", make_parcels(200000), 2);
+    run("roads, precision 2", make_roads(50000), 2);
+    run("roads, precision 0", make_roads(50000), 0);
+
+    return 0;
+}
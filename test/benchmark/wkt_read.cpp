@@ -0,0 +1,113 @@
+// Boost.Geometry
+// Benchmark of the WKT reader, the throughput is reported in MB/s
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::linestring<point_type> linestring_type;
+
+// Parcel-like polygons with projected coordinates written with the given
+// precision
+std::vector<std::string> make_polygons(std::size_t count, int precision)
+{
+    std::vector<std::string> result;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const cx = 150000.0 + 37.123456789 * double(i % 1000);
+        double const cy = 460000.0 + 41.987654321 * double(i / 1000);
+        std::size_t const n = 8 + i % 32;
+
+        std::ostringstream out;
+        out << std::setprecision(precision) << "POLYGON((";
+        for (std::size_t j = 0 ; j <= n ; ++j)
+        {
+            double const a = 2.0 * bg::math::pi<double>() * double(j % n) / double(n);
+            out << (j > 0 ? "," : "")
+                << cx + 15.0 * std::cos(a) << " " << cy + 15.0 * std::sin(a);
+        }
+        out << "))";
+        result.push_back(out.str());
+    }
+    return result;
+}
+
+template <typename Geometry>
+void run(std::string const& name, std::vector<std::string> const& wkts)
+{
+    std::size_t bytes = 0;
+    for (std::size_t i = 0 ; i < wkts.size() ; ++i)
+    {
+        bytes += wkts[i].size();
+    }
+
+    double const ms = measure(name, 5, [&]()
+    {
+        std::size_t points = 0;
+        Geometry geometry;
+        for (std::size_t i = 0 ; i < wkts.size() ; ++i)
+        {
+            bg::read_wkt(wkts[i], geometry);
+            points += bg::num_points(geometry);
+        }
+        return points;
+    });
+
+    std::cout << "  " << double(bytes) / (1024.0 * 1024.0) / (ms / 1000.0)
+              << " MB/s" << std::endl;
+}
+
+int main()
+{
+    std::size_t const count = 20000;
+
+    run<polygon_type>("polygon, 3 decimals", make_polygons(count, 9));
+    run<polygon_type>("polygon, round trip", make_polygons(count, 17));
+
+    std::vector<std::string> multi_polygons;
+    {
+        std::vector<std::string> const polygons = make_polygons(count, 9);
+        for (std::size_t i = 0 ; i + 4 <= polygons.size() ; i += 4)
+        {
+            std::string wkt = "MULTIPOLYGON(";
+            for (std::size_t j = 0 ; j < 4 ; ++j)
+            {
+                wkt += (j > 0 ? "," : "") + polygons[i + j].substr(7);
+            }
+            multi_polygons.push_back(wkt + ")");
+        }
+    }
+    run<multi_polygon_type>("multipolygon, 3 decimals", multi_polygons);
+
+    std::vector<std::string> linestrings;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        std::ostringstream out;
+        out << "LINESTRING(";
+        for (std::size_t j = 0 ; j < 20 ; ++j)
+        {
+            out << (j > 0 ? "," : "") << int(i + j) << " " << int(i * j % 1000);
+        }
+        out << ")";
+        linestrings.push_back(out.str());
+    }
+    run<linestring_type>("linestring, integers", linestrings);
+
+    return 0;
+}
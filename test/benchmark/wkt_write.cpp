@@ -0,0 +1,111 @@
+// Boost.Geometry
+// Benchmark of the WKT writers, the throughput is reported in MB/s
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include "benchmark_common.hpp"
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+// Parcel-like polygons with projected coordinates
+std::vector<polygon_type> make_polygons(std::size_t count, double step)
+{
+    std::vector<polygon_type> result(count);
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const cx = 150000.0 + step * double(i % 1000);
+        double const cy = 460000.0 + step * double(i / 1000);
+        std::size_t const n = 8 + i % 32;
+        for (std::size_t j = 0 ; j <= n ; ++j)
+        {
+            double const a = 2.0 * bg::math::pi<double>() * double(j % n) / double(n);
+            double const x = cx + 15.0 * std::cos(a);
+            double const y = cy + 15.0 * std::sin(a);
+            // rounded to mm or not rounded
+            result[i].outer().push_back(step == 37.0
+                ? point_type(std::round(x * 1000) / 1000, std::round(y * 1000) / 1000)
+                : point_type(x, y));
+        }
+    }
+    return result;
+}
+
+void run(std::string const& name, std::vector<polygon_type> const& polygons)
+{
+    std::cout << name << std::endl;
+
+    std::size_t bytes = 0;
+    {
+        std::string output;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            output.clear();
+            bg::to_wkt(polygons[i], output);
+            bytes += output.size();
+        }
+    }
+    double const mb = double(bytes) / (1024.0 * 1024.0);
+
+    double const ms_stream = measure("  ostream, precision 17", 5, [&]()
+    {
+        std::size_t size = 0;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            std::ostringstream out;
+            out.precision(std::numeric_limits<double>::max_digits10);
+            out << bg::wkt(polygons[i]);
+            size += out.str().size();
+        }
+        return size;
+    });
+    std::cout << "    " << mb / (ms_stream / 1000.0) << " MB/s" << std::endl;
+
+    double const ms_to_wkt = measure("  to_wkt", 5, [&]()
+    {
+        std::size_t size = 0;
+        std::string output;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            output.clear();
+            bg::to_wkt(polygons[i], output);
+            size += output.size();
+        }
+        return size;
+    });
+    std::cout << "    " << mb / (ms_to_wkt / 1000.0) << " MB/s" << std::endl;
+
+    std::vector<char> buffer(4096);
+    double const ms_buffer = measure("  to_wkt, buffer", 5, [&]()
+    {
+        std::size_t size = 0;
+        for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+        {
+            size += bg::to_wkt(polygons[i], buffer.data(), buffer.size());
+        }
+        return size;
+    });
+    std::cout << "    " << mb / (ms_buffer / 1000.0) << " MB/s" << std::endl;
+}
+
+int main()
+{
+    std::size_t const count = 20000;
+
+    run("polygon, rounded to 3 decimals", make_polygons(count, 37.0));
+    run("polygon, not rounded", make_polygons(count, 37.123456789));
+
+    return 0;
+}
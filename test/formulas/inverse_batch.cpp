@@ -0,0 +1,143 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <vector>
+
+#include "test_formula.hpp"
+#include "inverse_cases.hpp"
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/inverse_batch.hpp>
+#include <boost/geometry/formulas/karney_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+
+#include <boost/geometry/geometries/multi_point.hpp>
+#include <boost/geometry/geometries/point.hpp>
+
+#include <boost/geometry/srs/spheroid.hpp>
+
+#include <boost/geometry/strategies/geographic/distance.hpp>
+#include <boost/geometry/strategies/geographic/parameters.hpp>
+
+
+std::size_t const count = sizeof(expected) / sizeof(expected_results);
+
+// The coordinates are multiplied by d2r, or 1 for formulas taking degrees
+template <typename Inverse>
+void test_batch(std::string const& name, double d2r = bg::math::d2r<double>())
+{
+    bg::srs::spheroid<double> spheroid(6378137.0, 6356752.3142451793);
+
+    typedef bg::formula::inverse_batch
+        <
+            double, Inverse, bg::srs::spheroid<double>
+        > batch_type;
+
+    batch_type batch(spheroid);
+
+    typename batch_type::points_type points1, points2;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        batch.push_back(points1, expected[i].p1.lon * d2r, expected[i].p1.lat * d2r);
+        batch.push_back(points2, expected[i].p2.lon * d2r, expected[i].p2.lat * d2r);
+    }
+
+    BOOST_CHECK_EQUAL(points1.size(), count);
+    BOOST_CHECK_EQUAL(points2.size(), count);
+
+    std::vector<double> matrix(count * count);
+    batch.apply(points1, points2, matrix.begin());
+
+    std::vector<double> matrix_mt(count * count);
+    batch.apply(points1, points2, matrix_mt.begin(), bg::thread_executor(4));
+
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        for (std::size_t j = 0 ; j < count ; ++j)
+        {
+            double const d = Inverse::apply(expected[i].p1.lon * d2r, expected[i].p1.lat * d2r,
+                                            expected[j].p2.lon * d2r, expected[j].p2.lat * d2r,
+                                            spheroid).distance;
+
+            // The same operations are performed so the results are equal
+            BOOST_CHECK_MESSAGE(matrix[i * count + j] == d,
+                name << " " << i << " " << j << ": " << matrix[i * count + j] << " != " << d);
+            BOOST_CHECK_MESSAGE(matrix_mt[i * count + j] == d,
+                name << " mt " << i << " " << j << ": " << matrix_mt[i * count + j] << " != " << d);
+        }
+    }
+
+    // one-to-many
+    std::vector<double> row(count);
+    batch.apply(points1, 1, points2, 0, count, row.begin());
+    for (std::size_t j = 0 ; j < count ; ++j)
+    {
+        BOOST_CHECK_EQUAL(row[j], matrix[count + j]);
+    }
+}
+
+template <typename FormulaPolicy>
+void test_strategy(std::string const& name)
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_type;
+    typedef bg::model::multi_point<point_type> mp_type;
+
+    mp_type mp1, mp2;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        mp1.push_back(point_type(expected[i].p1.lon, expected[i].p1.lat));
+        mp2.push_back(point_type(expected[i].p2.lon, expected[i].p2.lat));
+    }
+    // meridians, including one crossing the pole
+    mp1.push_back(point_type(10, 20));
+    mp2.push_back(point_type(10, -30));
+    mp2.push_back(point_type(-170, 80));
+
+    bg::strategy::distance::geographic<FormulaPolicy> strategy;
+
+    std::vector<double> matrix(mp1.size() * mp2.size());
+    strategy.apply_matrix(mp1, mp2, matrix.begin());
+
+    std::vector<double> matrix_mt(mp1.size() * mp2.size());
+    strategy.apply_matrix(mp1, mp2, matrix_mt.begin(), bg::thread_executor(3));
+
+    for (std::size_t i = 0 ; i < mp1.size() ; ++i)
+    {
+        for (std::size_t j = 0 ; j < mp2.size() ; ++j)
+        {
+            double const d = strategy.apply(mp1[i], mp2[j]);
+            std::size_t const k = i * mp2.size() + j;
+
+            BOOST_CHECK_MESSAGE(matrix[k] == d,
+                name << " " << i << " " << j << ": " << matrix[k] << " != " << d);
+            BOOST_CHECK_MESSAGE(matrix_mt[k] == d,
+                name << " mt " << i << " " << j << ": " << matrix_mt[k] << " != " << d);
+        }
+    }
+
+    // empty ranges
+    mp_type empty;
+    strategy.apply_matrix(mp1, empty, matrix.begin());
+    strategy.apply_matrix(empty, mp2, matrix.begin());
+}
+
+int test_main(int, char*[])
+{
+    test_batch<bg::formula::andoyer_inverse<double, true, false> >("andoyer");
+    test_batch<bg::formula::thomas_inverse<double, true, false> >("thomas");
+    test_batch<bg::formula::vincenty_inverse<double, true, false> >("vincenty");
+    test_batch<bg::formula::karney_inverse<double, true, false> >("karney", 1.0);
+    test_batch<bg::strategy::andoyer::inverse<double, true, false> >("andoyer_policy");
+
+    test_strategy<bg::strategy::andoyer>("andoyer");
+    test_strategy<bg::strategy::thomas>("thomas");
+    test_strategy<bg::strategy::vincenty>("vincenty");
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include "test_formula.hpp"
+
+#include <boost/geometry/formulas/area_formulas.hpp>
+#include <boost/geometry/formulas/authalic_radius_sqr.hpp>
+#include <boost/geometry/formulas/eccentricity_sqr.hpp>
+#include <boost/geometry/formulas/flattening.hpp>
+#include <boost/geometry/formulas/spheroid_coefficients.hpp>
+
+#include <boost/geometry/srs/spheroid.hpp>
+
+
+template <std::size_t SeriesOrder>
+void test_order(bg::srs::spheroid<double> const& spheroid)
+{
+    typedef bg::formula::spheroid_coefficients<double, SeriesOrder> coeffs_type;
+    coeffs_type const c(spheroid);
+
+    double const f = bg::formula::flattening<double>(spheroid);
+    double const n = f / (2.0 - f);
+    double const e2 = bg::formula::eccentricity_sqr<double>(spheroid);
+    double const ep2 = e2 / (1.0 - e2);
+
+    BOOST_CHECK_EQUAL(c.m_a, bg::get_radius<0>(spheroid));
+    BOOST_CHECK_EQUAL(c.m_b, bg::get_radius<2>(spheroid));
+    BOOST_CHECK_EQUAL(c.m_f, f);
+    BOOST_CHECK_EQUAL(c.m_n, n);
+    BOOST_CHECK_EQUAL(c.m_e2, e2);
+    BOOST_CHECK_EQUAL(c.m_ep2, ep2);
+    BOOST_CHECK_EQUAL(c.m_ep, std::sqrt(ep2));
+    BOOST_CHECK_EQUAL(c.m_c2, bg::formula::authalic_radius_sqr<double>(spheroid));
+
+    std::size_t const size = ((SeriesOrder + 2) * (SeriesOrder + 1)) / 2;
+    std::size_t const coeffs_size = coeffs_type::area_coeffs_size;
+    BOOST_CHECK_EQUAL(coeffs_size, size);
+
+    double coeffs_n[size];
+    bg::formula::area_formulas<double, SeriesOrder, true>::evaluate_coeffs_n(n, coeffs_n);
+    double coeffs_ep[size];
+    bg::formula::area_formulas<double, SeriesOrder, false>::evaluate_coeffs_ep(bg::math::sqr(c.m_ep), coeffs_ep);
+
+    for (std::size_t i = 0 ; i < size ; ++i)
+    {
+        BOOST_CHECK_EQUAL(c.m_area_coeffs_n[i], coeffs_n[i]);
+        BOOST_CHECK_EQUAL(c.m_area_coeffs_ep[i], coeffs_ep[i]);
+    }
+}
+
+int test_main(int, char*[])
+{
+    // WGS84
+    bg::srs::spheroid<double> const wgs84(6378137.0, 6356752.3142451793);
+
+    test_order<0>(wgs84);
+    test_order<1>(wgs84);
+    test_order<2>(wgs84);
+    test_order<5>(wgs84);
+
+    // sphere
+    bg::srs::spheroid<double> const sphere(6371000.0, 6371000.0);
+    test_order<2>(sphere);
+
+    return 0;
+}
@@ -24,15 +24,19 @@ void test_dsv(std::string const& wkt, std::string const& expected, bool json = f
     Geometry geometry;
     bg::read_wkt(wkt, geometry);
     std::ostringstream out;
+    std::string str = "dsv:";
     if (json)
     {
         out << bg::dsv(geometry, ", ", "[", "]", ", ", "[ ", " ]", ", ");
+        bg::to_dsv(geometry, str, ", ", "[", "]", ", ", "[ ", " ]", ", ");
     }
     else
     {
         out << bg::dsv(geometry);
+        bg::to_dsv(geometry, str);
     }
     BOOST_CHECK_EQUAL(out.str(), expected);
+    BOOST_CHECK_EQUAL(str, "dsv:" + expected);
 }
 
 
@@ -94,6 +98,13 @@ int test_main(int, char* [])
     test_all<double>();
     test_all<int>();
 
+    {
+        typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+        std::string str;
+        bg::to_dsv(point_type(0.1 + 0.2, -1e25), str);
+        BOOST_CHECK_EQUAL(str, "(0.30000000000000004, -1e+25)");
+    }
+
     return 0;
 }
 
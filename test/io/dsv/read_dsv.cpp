@@ -0,0 +1,162 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/io/dsv/read.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+typedef bg::model::point<float, 2, bg::cs::cartesian> point_float_type;
+typedef bg::model::point<int, 2, bg::cs::cartesian> point_int_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+
+template <typename Output>
+void test_dsv(std::string const& text, std::string const& expected,
+              bg::dsv_read_options const& options = bg::dsv_read_options())
+{
+    Output output;
+    bg::read_dsv(text, output, options);
+    std::ostringstream out;
+    for (std::size_t i = 0 ; i < output.size() ; ++i)
+    {
+        out << (i > 0 ? "," : "") << bg::wkt(output[i]);
+    }
+    BOOST_CHECK_EQUAL(out.str(), expected);
+}
+
+template <typename Output>
+void test_invalid(std::string const& text,
+                  bg::dsv_read_options const& options = bg::dsv_read_options())
+{
+    Output output;
+    bool thrown = false;
+    try
+    {
+        bg::read_dsv(text, output, options);
+    }
+    catch (bg::read_dsv_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK_MESSAGE(thrown, "no exception for '" << text << "'");
+}
+
+void test_formats()
+{
+    typedef std::vector<point_type> points;
+
+    test_dsv<points>("1,2\n3.5,-4.25\n", "POINT(1 2),POINT(3.5 -4.25)");
+    test_dsv<points>("1,2\r\n3,4", "POINT(1 2),POINT(3 4)");
+    test_dsv<points>(" 1 , 2 \n\n\t\n3,4\n", "POINT(1 2),POINT(3 4)");
+    test_dsv<points>("# comment\n1,2\n  # indented\n", "POINT(1 2)");
+    test_dsv<points>("1e3,2.5E-1\n", "POINT(1000 0.25)");
+    test_dsv<points>("", "");
+
+    // Further columns are ignored
+    test_dsv<points>("1,2,3,intensity\n", "POINT(1 2)");
+
+    // Header
+    test_dsv<points>("x,y\n1,2\n", "POINT(1 2)", bg::dsv_read_options(",", 1));
+    test_dsv<points>("x,y\n", "", bg::dsv_read_options(",", 3));
+
+    // Other separators, runs of spaces separate once
+    test_dsv<points>("1;2\n3\t4\n", "POINT(1 2),POINT(3 4)", bg::dsv_read_options(";\t"));
+    test_dsv<points>("1   2 99\n  3 4\n", "POINT(1 2),POINT(3 4)", bg::dsv_read_options(" "));
+    test_dsv<points>("1|2\n", "POINT(1 2)", bg::dsv_read_options("|"));
+
+    test_dsv<std::vector<point3d_type> >("1,2,3\n4,5,6\n", "POINT(1 2 3),POINT(4 5 6)");
+    test_dsv<std::vector<point_float_type> >("1.5,2\n", "POINT(1.5 2)");
+    test_dsv<std::vector<point_int_type> >("-1,2\n", "POINT(-1 2)");
+
+    multi_point_type multi_point;
+    bg::read_dsv(std::string("1,2\n3,4\n"), multi_point);
+    bg::read_dsv(std::string("5,6\n"), multi_point);
+    BOOST_CHECK_EQUAL(bg::to_wkt(multi_point), "MULTIPOINT((1 2),(3 4),(5 6))");
+
+    test_invalid<points>("1\n");
+    test_invalid<points>("1,\n");
+    test_invalid<points>(",2\n");
+    test_invalid<points>("1,,2\n");
+    test_invalid<points>("1 2\n");
+    test_invalid<points>("1,2 3\n");
+    test_invalid<points>("1,a\n");
+    test_invalid<points>("1,2x\n");
+    test_invalid<std::vector<point3d_type> >("1,2\n");
+    test_invalid<points>("1;2\n");
+}
+
+template <typename Executor>
+void test_parallel(Executor const& executor)
+{
+    // Long enough to be read in several chunks
+    std::string body;
+    std::size_t const count = 200000;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        std::ostringstream out;
+        out << double(i % 1000) + 0.125 << "," << double(i / 1000) + 0.5
+            << "," << i << (i % 2 == 0 ? "\r\n" : "\n");
+        body += out.str();
+    }
+    std::string text = "x,y,z\n" + body;
+    BOOST_CHECK(text.size() > 4 * bg::detail::io::bulk_chunk_bytes);
+
+    std::vector<point3d_type> points(1);
+    bg::read_dsv(text, points, bg::dsv_read_options(",", 1), executor);
+    BOOST_CHECK_EQUAL(points.size(), count + 1);
+    bool ordered = true;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        point3d_type const& p = points[i + 1];
+        ordered = ordered && bg::get<0>(p) == double(i % 1000) + 0.125
+                          && bg::get<1>(p) == double(i / 1000) + 0.5
+                          && bg::get<2>(p) == double(i);
+    }
+    BOOST_CHECK(ordered);
+
+    multi_point_type multi_point;
+    bg::read_dsv(text, multi_point, bg::dsv_read_options(",", 1), executor);
+    BOOST_CHECK_EQUAL(multi_point.size(), count);
+
+    bg::index::rtree<point_type, bg::index::rstar<16> > rtree(multi_point);
+    BOOST_CHECK_EQUAL(rtree.count(point_type(7.125, 42.5)), 1u);
+
+    // An invalid line in one of the chunks
+    text += "1,2,3\n4\n";
+    text += body;
+    bool thrown = false;
+    try
+    {
+        points.clear();
+        bg::read_dsv(text, points, bg::dsv_read_options(",", 1), executor);
+    }
+    catch (bg::read_dsv_exception const& e)
+    {
+        thrown = true;
+        BOOST_CHECK_EQUAL(e.line, "4");
+    }
+    BOOST_CHECK(thrown);
+}
+
+int test_main(int, char* [])
+{
+    test_formats();
+    test_parallel(bg::sequential_executor());
+    test_parallel(bg::thread_executor(4));
+    return 0;
+}
@@ -113,6 +113,27 @@ void test_all()
         os << "</svg>";
     }
 
+    {
+        // Integral coordinates are written the same way
+        std::stringstream os;
+        std::string str;
+        os << bg::svg(pt, style) << bg::svg(b, style) << bg::svg(s, style)
+           << bg::svg(ls, style) << bg::svg(r, style) << bg::svg(po, style)
+           << bg::svg(m_pt, m_style) << bg::svg(m_ls, m_style)
+           << bg::svg(m_po, m_style) << bg::svg(var, style);
+        bg::to_svg(pt, str, style);
+        bg::to_svg(b, str, style);
+        bg::to_svg(s, str, style);
+        bg::to_svg(ls, str, style);
+        bg::to_svg(r, str, style);
+        bg::to_svg(po, str, style);
+        bg::to_svg(m_pt, str, m_style);
+        bg::to_svg(m_ls, str, m_style);
+        bg::to_svg(m_po, str, m_style);
+        bg::to_svg(var, str, style);
+        BOOST_CHECK_EQUAL(str, os.str());
+    }
+
     {
 #ifdef TEST_WITH_SVG
         std::ofstream os("test2.svg", std::ios::trunc);
@@ -144,8 +165,114 @@ void test_all()
     }
 }
 
+inline std::size_t count_substrings(std::string const& str, std::string const& sub)
+{
+    std::size_t count = 0;
+    for (std::size_t pos = str.find(sub); pos != std::string::npos;
+         pos = str.find(sub, pos + sub.size()))
+    {
+        count++;
+    }
+    return count;
+}
+
+inline bool has_negative_number(std::string const& str)
+{
+    for (std::size_t pos = str.find('-'); pos != std::string::npos;
+         pos = str.find('-', pos + 1))
+    {
+        if (pos + 1 < str.size() && str[pos + 1] >= '0' && str[pos + 1] <= '9')
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename P, typename Geometry>
+std::string map_geometry(Geometry const& geometry, double pixel_size, bool clip)
+{
+    typedef bg::model::box<P> box;
+
+    std::ostringstream os;
+    {
+        bg::svg_mapper<P> mapper(os, 100, 100);
+        mapper.add(box(P(0, 0), P(100, 100)));
+        mapper.set_vertex_culling(pixel_size);
+        mapper.set_clipping(clip, 0.0);
+        mapper.map(geometry, "stroke:black");
+    }
+    return os.str();
+}
+
+template <typename P>
+void test_culling_clipping()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    // The map has 1 SVG pixel per unit, many vertices are mapped to the same
+    // pixels, the first and the last vertex are kept
+    linestring ls;
+    for (int i = 0; i <= 1000; i++)
+    {
+        ls.push_back(P(0.5 + i * 0.05, 50.5 + (i % 2) * 0.01));
+    }
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(ls, 0.0, false), ","), 1001u);
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(ls, 1.0, false), ","), 52u);
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(ls, 10.0, false), ","), 7u);
+
+    // Rings within one pixel are not written
+    polygon po;
+    push_back_square(po.outer(), 10.2, 80.0);
+    po.inners().resize(2);
+    push_back_square(po.inners()[0], 50.2, 50.201);
+    push_back_square(po.inners()[1], 20.2, 30.0);
+    bg::correct(po);
+
+    polygon small;
+    push_back_square(small.outer(), 50.2, 50.201);
+
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(po, 0.0, false), "M "), 3u);
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(po, 1.0, false), "M "), 2u);
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(small, 0.0, false), "<path"), 1u);
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(small, 1.0, false), "<path"), 0u);
+
+    // Geometries crossing or outside the map are clipped
+    linestring crossing;
+    crossing.push_back(P(-100.0, 50.0));
+    crossing.push_back(P(200.0, 50.0));
+    crossing.push_back(P(200.0, 60.0));
+    crossing.push_back(P(-100.0, 60.0));
+
+    polygon outside;
+    push_back_square(outside.outer(), 300.0, 400.0);
+
+    polygon overlapping;
+    push_back_square(overlapping.outer(), -50.0, 50.0);
+    bg::correct(overlapping);
+
+    std::string const clipped_ls = map_geometry<P>(crossing, 0.0, true);
+    BOOST_CHECK_EQUAL(count_substrings(clipped_ls, "<polyline"), 2u);
+    BOOST_CHECK(! has_negative_number(clipped_ls));
+
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(outside, 0.0, true), "<path"), 0u);
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(outside, 0.0, false), "<path"), 1u);
+
+    std::string const clipped_po = map_geometry<P>(overlapping, 1.0, true);
+    BOOST_CHECK_EQUAL(count_substrings(clipped_po, "<path"), 1u);
+    BOOST_CHECK(! has_negative_number(clipped_po));
+    BOOST_CHECK(has_negative_number(map_geometry<P>(overlapping, 1.0, false)));
+
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(P(50, 50), 0.0, true), "<circle"), 1u);
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(P(150, 50), 0.0, true), "<circle"), 0u);
+    BOOST_CHECK_EQUAL(count_substrings(map_geometry<P>(P(150, 50), 0.0, false), "<circle"), 1u);
+}
+
 int test_main(int, char* [])
 {
+    test_culling_clipping< boost::geometry::model::d2::point_xy<double> >();
+
     test_all< boost::geometry::model::d2::point_xy<double> >();
     test_all< boost::geometry::model::d2::point_xy<int> >();
 
@@ -0,0 +1,150 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/io/wkt/read_lines.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+std::string square(std::size_t i)
+{
+    std::ostringstream out;
+    double const x = double(i % 100);
+    double const y = double(i / 100);
+    out << "POLYGON((" << x << " " << y << "," << x << " " << y + 0.5 << ","
+        << x + 0.5 << " " << y + 0.5 << "," << x + 0.5 << " " << y << ","
+        << x << " " << y << "))";
+    return out.str();
+}
+
+// Lines long enough to cross the boundaries of the chunks parsed in parallel
+std::string make_text(std::size_t count, std::vector<std::string>& lines)
+{
+    std::string text;
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        lines.push_back(square(i));
+        text += lines.back();
+        text += i % 3 == 0 ? "\r\n" : "\n";
+        if (i % 7 == 0)
+        {
+            text += "  \n";
+        }
+    }
+    return text;
+}
+
+template <typename Executor>
+void test_read_lines(Executor const& executor)
+{
+    std::vector<std::string> lines;
+    std::string const text = make_text(40000, lines);
+    BOOST_CHECK(text.size() > 4 * bg::detail::io::bulk_chunk_bytes);
+
+    std::vector<polygon_type> polygons;
+    bg::read_wkt_lines(text, polygons, executor);
+    BOOST_CHECK_EQUAL(polygons.size(), lines.size());
+    for (std::size_t i = 0 ; i < polygons.size() ; ++i)
+    {
+        polygon_type expected;
+        bg::read_wkt(lines[i], expected);
+        BOOST_CHECK_MESSAGE(bg::equals(polygons[i], expected), "line " << i);
+    }
+
+    // The geometries and envelopes are appended, indexes refer to the
+    // output vector
+    std::vector<polygon_type> appended(1);
+    std::vector<std::pair<box_type, std::size_t> > values;
+    bg::read_wkt_lines(text, appended, values, executor);
+    BOOST_CHECK_EQUAL(appended.size(), lines.size() + 1);
+    BOOST_CHECK_EQUAL(values.size(), lines.size());
+    for (std::size_t i = 0 ; i < values.size() ; ++i)
+    {
+        BOOST_CHECK_EQUAL(values[i].second, i + 1);
+        box_type const expected = bg::return_envelope<box_type>(appended[i + 1]);
+        BOOST_CHECK(bg::equals(values[i].first, expected));
+    }
+
+    std::vector<box_type> boxes;
+    polygons.clear();
+    bg::read_wkt_lines(text, polygons, boxes, executor);
+    BOOST_CHECK_EQUAL(boxes.size(), polygons.size());
+    BOOST_CHECK(bg::equals(boxes[123], bg::return_envelope<box_type>(polygons[123])));
+
+    // The rtree is packed from the envelopes
+    bg::index::rtree<std::pair<box_type, std::size_t>, bg::index::rstar<16> >
+        rtree(values);
+    std::vector<std::pair<box_type, std::size_t> > found;
+    rtree.query(bg::index::intersects(point_type(5.25, 3.25)), std::back_inserter(found));
+    BOOST_CHECK_EQUAL(found.size(), 1u);
+    if (! found.empty())
+    {
+        BOOST_CHECK_EQUAL(found.front().second, 306u);
+    }
+}
+
+template <typename Executor>
+void test_special(Executor const& executor)
+{
+    std::vector<polygon_type> polygons;
+    bg::read_wkt_lines(std::string(), polygons, executor);
+    BOOST_CHECK(polygons.empty());
+
+    bg::read_wkt_lines(std::string("\n \r\n\n"), polygons, executor);
+    BOOST_CHECK(polygons.empty());
+
+    // The last line does not need to be terminated
+    bg::read_wkt_lines(std::string("POLYGON((0 0,0 1,1 1,0 0))\nPOLYGON((0 0,0 2,2 2,0 0))"),
+                       polygons, executor);
+    BOOST_CHECK_EQUAL(polygons.size(), 2u);
+    BOOST_CHECK_EQUAL(bg::to_wkt(polygons[1]), "POLYGON((0 0,0 2,2 2,0 0))");
+
+    std::vector<point_type> points;
+    bg::read_wkt_lines(std::string("POINT(1 2)\r\nPOINT(3 4)\r\n"), points, executor);
+    BOOST_CHECK_EQUAL(points.size(), 2u);
+    BOOST_CHECK_EQUAL(bg::to_wkt(points[1]), "POINT(3 4)");
+
+    // Invalid lines throw
+    std::vector<std::string> lines;
+    std::string text = make_text(5000, lines);
+    text += "POLYGON((0 0,0 1,1 1,0 0)\n";
+    text += make_text(5000, lines);
+
+    bool thrown = false;
+    try
+    {
+        bg::read_wkt_lines(text, polygons, executor);
+    }
+    catch (bg::read_wkt_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+int test_main(int, char* [])
+{
+    test_read_lines(bg::sequential_executor());
+    test_read_lines(bg::thread_executor(4));
+    test_special(bg::sequential_executor());
+    test_special(bg::thread_executor(4));
+    return 0;
+}
@@ -17,6 +17,9 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
+#include <iomanip>
+#include <limits>
 #include <sstream>
 #include <string>
 
@@ -44,6 +47,8 @@ void check_wkt(G const& geometry, std::string const& expected)
     out << bg::wkt(geometry);
     BOOST_CHECK_EQUAL(boost::to_upper_copy(out.str()),
                       boost::to_upper_copy(expected));
+    BOOST_CHECK_EQUAL(boost::to_upper_copy(bg::to_wkt(geometry)),
+                      boost::to_upper_copy(expected));
 }
 
 template <typename G>
@@ -256,11 +261,148 @@ void test_all()
 }
 #endif
 
+template <typename T>
+void test_coordinate(std::string const& str, T const& expected)
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> P;
+    P p;
+    bg::read_wkt("POINT(" + str + " " + str + ")", p);
+    BOOST_CHECK_MESSAGE(bg::get<0>(p) == expected && bg::get<1>(p) == expected,
+                        "  Expected:" << expected << " Got:" << bg::get<0>(p)
+                        << " for: " << str);
+}
+
+template <typename T>
+void test_round_trip(T const& value)
+{
+    std::ostringstream out;
+    out << std::setprecision(std::numeric_limits<T>::max_digits10) << value;
+    test_coordinate<T>(out.str(), value);
+}
+
+void test_coordinates()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+
+    test_coordinate<double>("0.1", 0.1);
+    test_coordinate<double>("-2.5e-3", -0.0025);
+    test_coordinate<double>("123456.789", 123456.789);
+    test_coordinate<double>("1E+2", 100.0);
+    test_coordinate<double>("000.000", 0.0);
+    test_coordinate<double>("12345678901234567890123", 12345678901234567890123.0);
+    test_coordinate<double>("0.30000000000000004441", 0.30000000000000004441);
+    // Converted by lexical_cast
+    test_coordinate<double>("1.", 1.0);
+    test_coordinate<double>(".5", 0.5);
+    test_coordinate<double>("+1", 1.0);
+
+    test_round_trip<double>(0.1 + 0.2);
+    test_round_trip<double>(-71.06455799999999);
+    test_round_trip<double>(1.7976931348623157e308);
+    test_round_trip<double>(2.2250738585072014e-308);
+    test_round_trip<double>(9007199254740993.0);
+    test_round_trip<double>(1.0 / 3.0);
+    test_round_trip<float>(0.1f);
+    test_round_trip<float>(16777217.0f);
+    test_round_trip<float>(3.4028235e38f);
+    for (int i = 1 ; i < 1000 ; ++i)
+    {
+        test_round_trip<double>(std::sqrt(double(i)) * 1000.0);
+        test_round_trip<double>(std::exp(double(i) / 7.0));
+        test_round_trip<float>(std::sqrt(float(i)));
+    }
+
+    test_coordinate<int>("-2147483648", -2147483647 - 1);
+    test_coordinate<int>("007", 7);
+    test_coordinate<int>("+7", 7);
+
+    test_wrong_wkt<P>("POINT(1x 2)", "bad lexical cast");
+    test_wrong_wkt<P>("POINT(1e 2)", "bad lexical cast");
+    test_wrong_wkt<P>("POINT(- 2)", "bad lexical cast");
+    test_wrong_wkt<P>("POINT(1e400 2)", "bad lexical cast");
+    test_wrong_wkt<bg::model::point<int, 2, bg::cs::cartesian> >("POINT(1.5 2)",
+                                                                 "bad lexical cast");
+    test_wrong_wkt<bg::model::point<int, 2, bg::cs::cartesian> >("POINT(2147483648 2)",
+                                                                 "bad lexical cast");
+    test_wrong_wkt<bg::model::point<unsigned int, 2, bg::cs::cartesian> >("POINT(1 2)x",
+                                                                          "too many tokens at 'x'");
+
+    // Sequences of different sizes are read into reused geometries
+    bg::model::multi_polygon<bg::model::polygon<P> > mpoly;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 1,1 1,0 0),(0 0,0 1,1 1,0 0)),((0 0,0 1,1 1,0 0)))", mpoly);
+    BOOST_CHECK_EQUAL(mpoly.size(), 2u);
+    BOOST_CHECK_EQUAL(mpoly[0].inners().size(), 1u);
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 1,1 1,0 0)))", mpoly);
+    BOOST_CHECK_EQUAL(mpoly.size(), 1u);
+    BOOST_CHECK_EQUAL(mpoly[0].inners().size(), 0u);
+    BOOST_CHECK_EQUAL(bg::num_points(mpoly), 4u);
+}
+
+template <typename G>
+void test_to_wkt(G const& geometry, std::string const& expected)
+{
+    BOOST_CHECK_EQUAL(bg::to_wkt(geometry), expected);
+
+    G read;
+    bg::read_wkt(expected, read);
+    BOOST_CHECK_EQUAL(bg::to_wkt(read), expected);
+}
+
+void test_to_wkt()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::point<float, 3, bg::cs::cartesian> P3f;
+
+    test_to_wkt(P(0.1 + 0.2, 1e21), "POINT(0.30000000000000004 1e+21)");
+    test_to_wkt(P(-0.0, 123456.789), "POINT(-0 123456.789)");
+    test_to_wkt(P(1e-7, 0.000001), "POINT(1e-7 0.000001)");
+    test_to_wkt(P(4.9e-324, -1.7976931348623157e308),
+                "POINT(5e-324 -1.7976931348623157e+308)");
+    test_to_wkt(P3f(0.1f, 16777216.0f, 3.4028235e38f),
+                "POINT(0.1 16777216 3.4028235e+38)");
+    test_to_wkt(bg::model::point<long long, 2, bg::cs::cartesian>(
+                    -9223372036854775807LL - 1, 9223372036854775807LL),
+                "POINT(-9223372036854775808 9223372036854775807)");
+
+    // Closed like by wkt()
+    bg::model::polygon<P> poly;
+    bg::read_wkt("POLYGON((0 0,0 0.5,0.25 0.5))", poly);
+    test_to_wkt(poly, "POLYGON((0 0,0 0.5,0.25 0.5,0 0))");
+
+    // Appended, the buffer is reused
+    std::string str = "1;";
+    bg::to_wkt(P(1, 2), str);
+    str += ";";
+    bg::to_wkt(poly, str);
+    BOOST_CHECK_EQUAL(str, "1;POINT(1 2);POLYGON((0 0,0 0.5,0.25 0.5,0 0))");
+
+    // Written to a buffer, truncated if too small
+    char buffer[12] = "xxxxxxxxxxx";
+    BOOST_CHECK_EQUAL(bg::to_wkt(P(1.5, 2), buffer, sizeof(buffer)), 12u);
+    BOOST_CHECK_EQUAL(std::string(buffer), "POINT(1.5 2");
+    BOOST_CHECK_EQUAL(bg::to_wkt(P(1, 2), buffer, sizeof(buffer)), 10u);
+    BOOST_CHECK_EQUAL(std::string(buffer), "POINT(1 2)");
+    BOOST_CHECK_EQUAL(bg::to_wkt(P(1, 2), buffer, 0), 10u);
+    BOOST_CHECK_EQUAL(std::string(buffer), "POINT(1 2)");
+
+    // Read back exactly
+    for (int i = 1 ; i < 1000 ; ++i)
+    {
+        P const p(std::sqrt(double(i)) * 1e5, std::exp(-double(i) / 3.0));
+        P read;
+        bg::read_wkt(bg::to_wkt(p), read);
+        BOOST_CHECK(bg::get<0>(read) == bg::get<0>(p) && bg::get<1>(read) == bg::get<1>(p));
+    }
+}
+
 int test_main(int, char* [])
 {
     test_all<double>();
     test_all<int>();
 
+    test_coordinates();
+    test_to_wkt();
+
 #if defined(HAVE_TTMATH)
     test_all<ttmath_big>();
 #endif
@@ -0,0 +1,147 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <string>
+
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/projections/impl/pj_init.hpp>
+#include <boost/geometry/srs/projections/impl/pj_param.hpp>
+#include <boost/geometry/srs/projections/proj4.hpp>
+
+
+namespace bgsd = bg::srs::detail;
+namespace bgpd = bg::projections::detail;
+
+void check_parameter(bgsd::proj4_parameters const& params, std::size_t i,
+                     std::string const& name, std::string const& value)
+{
+    BOOST_CHECK(i < params.size());
+    if (i < params.size())
+    {
+        BOOST_CHECK_EQUAL(std::string(params[i].name.begin(), params[i].name.end()), name);
+        BOOST_CHECK_EQUAL(std::string(params[i].value.begin(), params[i].value.end()), value);
+        // null-terminated
+        BOOST_CHECK_EQUAL(params[i].name.data()[params[i].name.size()], '\0');
+        BOOST_CHECK_EQUAL(params[i].value.data()[params[i].value.size()], '\0');
+    }
+}
+
+void test_parse()
+{
+    {
+        bgsd::proj4_parameters const params(" +proj=tmerc  +lat_0=52d10'N +towgs84=1, 2,3 +no_defs\t");
+        BOOST_CHECK_EQUAL(params.size(), 4u);
+        check_parameter(params, 0, "proj", "tmerc");
+        check_parameter(params, 1, "lat_0", "52d10'N");
+        check_parameter(params, 2, "towgs84", "1, 2,3");
+        check_parameter(params, 3, "no_defs", "");
+    }
+
+    {
+        // Separated by " +" only, leading '+' and white space removed
+        bgsd::proj4_parameters const params("++proj=merc+k=1 ++a=1=2 +  + x_0=2 +");
+        BOOST_CHECK_EQUAL(params.size(), 3u);
+        check_parameter(params, 0, "proj", "merc+k=1");
+        check_parameter(params, 1, "a", "1=2");
+        check_parameter(params, 2, "x_0", "2");
+    }
+
+    BOOST_CHECK_EQUAL(bgsd::proj4_parameters("").size(), 0u);
+    BOOST_CHECK_EQUAL(bgsd::proj4_parameters(" + ").size(), 0u);
+
+    // The copies refer to the same values
+    bgsd::proj4_parameters copy("+proj=longlat");
+    {
+        std::string const str = "+proj=merc +ellps=WGS84";
+        bgsd::proj4_parameters const params(str);
+        copy = params;
+    }
+    check_parameter(copy, 0, "proj", "merc");
+    check_parameter(copy, 1, "ellps", "WGS84");
+}
+
+void test_ids()
+{
+    int count = 0;
+    for (int id = 0 ; id <= bgsd::proj4_name_upper_m ; ++id)
+    {
+        const char* name = bgsd::proj4_parameter_name(id);
+        if (name != 0)
+        {
+            BOOST_CHECK_EQUAL(bgsd::proj4_parameter_id(name), id);
+            ++count;
+        }
+    }
+    BOOST_CHECK_EQUAL(count, 81);
+
+    BOOST_CHECK_EQUAL(bgsd::proj4_parameter_id("lat_0"), int(bg::srs::dpar::lat_0));
+    BOOST_CHECK_EQUAL(bgsd::proj4_parameter_id("R_A"), int(bg::srs::dpar::r_au));
+    BOOST_CHECK_EQUAL(bgsd::proj4_parameter_id("M"), int(bgsd::proj4_name_upper_m));
+    BOOST_CHECK_EQUAL(bgsd::proj4_parameter_id("wktext"), int(bgsd::proj4_name_unknown));
+    BOOST_CHECK_EQUAL(bgsd::proj4_parameter_id(""), int(bgsd::proj4_name_unknown));
+}
+
+void test_find()
+{
+    bgsd::proj4_parameters const params("+proj=hammer +M=2 +W=0.5 +wktext +south +lat_1=10.5 +units=ft");
+
+    double m = 0;
+    BOOST_CHECK(bgpd::pj_param_f<bg::srs::spar::m>(params, "M", bg::srs::dpar::m, m));
+    BOOST_CHECK_EQUAL(m, 2.0);
+    BOOST_CHECK(! bgpd::pj_param_f<bg::srs::spar::m>(params, "m", bg::srs::dpar::m, m));
+    BOOST_CHECK(bgpd::pj_param_exists(params, "wktext"));
+    BOOST_CHECK(! bgpd::pj_param_exists(params, "no_off"));
+    BOOST_CHECK(bgpd::pj_get_param_b<bg::srs::spar::south>(params, "south", bg::srs::dpar::south));
+    BOOST_CHECK_CLOSE((bgpd::pj_get_param_r<double, bg::srs::spar::lat_1>(params, "lat_1", bg::srs::dpar::lat_1)),
+                      10.5 * bg::math::d2r<double>(), 1e-12);
+    BOOST_CHECK(bgpd::pj_get_param_s(params, "units", bg::srs::dpar::units) == "ft");
+    BOOST_CHECK(bgpd::pj_get_param_s(params, "ellps", bg::srs::dpar::ellps).empty());
+
+    double to_meter = 0, fr_meter = 0;
+    bgpd::pj_init_units<double, false>(params, to_meter, fr_meter, 1., 1.);
+    BOOST_CHECK_CLOSE(to_meter, 0.3048, 1e-12);
+}
+
+void test_init()
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll_t;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> xy_t;
+
+    bgsd::proj4_parameters const params("+proj=longlat +towgs84=1,2,3,4 +units=us-ft +pm=2d30'");
+    bg::projections::parameters<double> const par = bgpd::pj_init<double>(params);
+    BOOST_CHECK_EQUAL(par.id.name, "longlat");
+    BOOST_CHECK_EQUAL(par.datum_params[3], 4.0 * bgpd::sec_to_rad<double>());
+    BOOST_CHECK_CLOSE(par.to_meter, 1200. / 3937., 1e-12);
+    BOOST_CHECK_CLOSE(par.from_greenwich, 2.5 * bg::math::d2r<double>(), 1e-12);
+
+    BOOST_CHECK_THROW(bgpd::pj_init<double>(bgsd::proj4_parameters("+proj=longlat +towgs84=1,,3")),
+                      bg::bad_str_cast);
+    BOOST_CHECK_THROW(bgpd::pj_init<double>(bgsd::proj4_parameters("+proj=longlat +towgs84=1,2,")),
+                      bg::bad_str_cast);
+    BOOST_CHECK_THROW(bgpd::pj_init<double>(bgsd::proj4_parameters("+proj=longlat +units=abc")),
+                      bg::projection_exception);
+
+    bg::srs::projection<> const prj = bg::srs::proj4("+proj=tmerc +ellps=WGS84 +lat_0=1d30'N +lon_0=5 +units=km");
+    xy_t xy;
+    prj.forward(ll_t(5, 1.5), xy);
+    BOOST_CHECK_SMALL(bg::get<0>(xy), 1e-9);
+    BOOST_CHECK_SMALL(bg::get<1>(xy), 1e-9);
+}
+
+int test_main(int, char*[])
+{
+    test_parse();
+    test_ids();
+    test_find();
+    test_init();
+
+    return 0;
+}
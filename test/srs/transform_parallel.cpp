@@ -0,0 +1,178 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/util/executor.hpp>
+
+
+template <typename Ring>
+void fill_ring(Ring & ring, double lon, double lat, double radius, std::size_t count)
+{
+    double const pi = bg::math::pi<double>();
+    for (std::size_t i = 0 ; i < count ; ++i)
+    {
+        double const a = -2 * pi * double(i) / double(count);
+        bg::range::push_back(ring,
+            typename bg::point_type<Ring>::type(lon + radius * std::cos(a),
+                                                lat + radius * std::sin(a)));
+    }
+    if (bg::closure<Ring>::value == bg::closed)
+    {
+        bg::range::push_back(ring, bg::range::front(ring));
+    }
+}
+
+// Rings larger than the chunks, some of the points can not be projected
+template <typename MultiPolygon>
+MultiPolygon make_multi_polygon(double scale)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_t;
+
+    MultiPolygon mpoly;
+    for (int i = 0 ; i < 4 ; ++i)
+    {
+        polygon_t poly;
+        fill_ring(poly.outer(), scale * (-60 + 40 * i), scale * (20 * i - 10),
+                  scale * 15, 10000 + 1000 * i);
+        poly.inners().resize(2);
+        fill_ring(poly.inners()[0], scale * (-60 + 40 * i), scale * (20 * i - 10),
+                  scale * 2, 5000);
+        fill_ring(poly.inners()[1], scale * (-60 + 40 * i), scale * (20 * i - 10),
+                  scale * 5, 3);
+        mpoly.push_back(poly);
+    }
+    return mpoly;
+}
+
+// Also NaN produced for invalid points in both
+inline bool same_value(double v1, double v2)
+{
+    return v1 == v2 || (v1 != v1 && v2 != v2);
+}
+
+template <typename G1, typename G2>
+void check_equal(G1 const& g1, G2 const& g2)
+{
+    typedef typename bg::point_type<G1>::type point_t;
+
+    std::vector<point_t> points1, points2;
+    bg::for_each_point(g1, [&](point_t const& p) { points1.push_back(p); });
+    bg::for_each_point(g2, [&](point_t const& p) { points2.push_back(p); });
+
+    BOOST_CHECK_EQUAL(points1.size(), points2.size());
+    std::size_t errors = 0;
+    for (std::size_t i = 0 ; i < (std::min)(points1.size(), points2.size()) ; ++i)
+    {
+        if (! same_value(bg::get<0>(points1[i]), bg::get<0>(points2[i]))
+         || ! same_value(bg::get<1>(points1[i]), bg::get<1>(points2[i])))
+        {
+            ++errors;
+        }
+    }
+    BOOST_CHECK_EQUAL(errors, 0u);
+}
+
+template <typename Executor>
+void test_transformation(Executor const& executor)
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll_t;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> xy_t;
+    typedef bg::model::multi_polygon<bg::model::polygon<ll_t> > mpoly_ll_t;
+    typedef bg::model::multi_polygon<bg::model::polygon<xy_t> > mpoly_xy_t;
+    typedef bg::model::linestring<xy_t> ls_xy_t;
+
+    bg::srs::transformation<> const tr(
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs"),
+        bg::srs::proj4("+proj=tmerc +lat_0=0 +lon_0=-62 +k=0.9995 +x_0=400000 +y_0=0 +ellps=clrk80 +units=m +no_defs"));
+
+    mpoly_ll_t const mpoly = make_multi_polygon<mpoly_ll_t>(1);
+
+    mpoly_xy_t expected, result;
+    bool const res_expected = tr.forward(mpoly, expected);
+    bool const res = tr.forward(mpoly, result, executor);
+    BOOST_CHECK_EQUAL(res, res_expected);
+    check_equal(result, expected);
+
+    mpoly_ll_t inv_expected, inv_result;
+    BOOST_CHECK_EQUAL(tr.inverse(result, inv_result, executor),
+                      tr.inverse(expected, inv_expected));
+    check_equal(inv_result, inv_expected);
+
+    // In place, datum shift
+    bg::srs::transformation<> const tr_datum(
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs"),
+        bg::srs::proj4("+proj=longlat +ellps=airy +datum=OSGB36 +no_defs"));
+    mpoly_ll_t datum_expected, in_place = mpoly;
+    BOOST_CHECK_EQUAL(tr_datum.forward(in_place, in_place, executor),
+                      tr_datum.forward(mpoly, datum_expected));
+    check_equal(in_place, datum_expected);
+
+    // Invalid points
+    bg::srs::transformation<> const tr_merc(
+        bg::srs::proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs"),
+        bg::srs::proj4("+proj=merc +ellps=WGS84 +units=m"));
+    bg::model::linestring<ll_t> ls;
+    for (int i = 0 ; i < 10000 ; ++i)
+    {
+        ls.push_back(ll_t(0.01 * i, i % 100 == 0 ? 90.0 : 0.005 * i));
+    }
+    ls_xy_t ls_expected, ls_result;
+    bool const ls_res_expected = tr_merc.forward(ls, ls_expected);
+    BOOST_CHECK(! ls_res_expected);
+    BOOST_CHECK_EQUAL(tr_merc.forward(ls, ls_result, executor), ls_res_expected);
+    check_equal(ls_result, ls_expected);
+}
+
+template <typename Executor>
+void test_projection(Executor const& executor)
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > ll_t;
+    typedef bg::model::point<double, 2, bg::cs::cartesian> xy_t;
+    typedef bg::model::multi_polygon<bg::model::polygon<ll_t> > mpoly_ll_t;
+    // different order and closure
+    typedef bg::model::multi_polygon<bg::model::polygon<xy_t, false, false> > mpoly_xy_t;
+
+    bg::srs::projection<> const prj = bg::srs::proj4("+proj=merc +ellps=WGS84 +units=m");
+
+    // Points near the poles can not be projected
+    mpoly_ll_t const mpoly = make_multi_polygon<mpoly_ll_t>(1.5);
+
+    mpoly_xy_t expected, result;
+    bool const res_expected = prj.forward(mpoly, expected);
+    BOOST_CHECK(! res_expected);
+    BOOST_CHECK_EQUAL(prj.forward(mpoly, result, executor), res_expected);
+    check_equal(result, expected);
+
+    mpoly_ll_t inv_expected, inv_result;
+    BOOST_CHECK_EQUAL(prj.inverse(result, inv_result, executor),
+                      prj.inverse(expected, inv_expected));
+    check_equal(inv_result, inv_expected);
+
+    // Not parallelized
+    ll_t const pt(10, 20);
+    xy_t pt_expected, pt_result;
+    prj.forward(pt, pt_expected);
+    prj.forward(pt, pt_result, executor);
+    check_equal(pt_result, pt_expected);
+}
+
+int test_main(int, char*[])
+{
+    test_transformation(bg::sequential_executor());
+    test_transformation(bg::thread_executor(4));
+
+    test_projection(bg::sequential_executor());
+    test_projection(bg::thread_executor(4));
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Area, length and centroid use the kernels only if enabled
+#define BOOST_GEOMETRY_ENABLE_VECTORIZED_SUMS
+
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/adapted/std_array.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+BOOST_GEOMETRY_REGISTER_STD_ARRAY_CS(cs::cartesian)
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+
+// The same points in a ring processed by the kernels and in a ring processed
+// segment by segment
+template <bool ClockWise, bool Closed>
+void test_ring(std::size_t count)
+{
+    typedef bg::model::ring<point_type, ClockWise, Closed> ring_type;
+    typedef bg::model::ring
+        <
+            point_type, ClockWise, Closed, std::deque
+        > deque_ring_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef bg::model::linestring<point_type, std::deque> deque_linestring_type;
+
+    BOOST_CHECK((bg::detail::has_contiguous_points<ring_type, double, 2>::value));
+    BOOST_CHECK((! bg::detail::has_contiguous_points<deque_ring_type, double, 2>::value));
+
+    // A star with a sign depending on the orientation, away from the origin
+    ring_type ring;
+    deque_ring_type deque_ring;
+    double const sign = ClockWise ? -1.0 : 1.0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        double const angle = sign * 2.0 * bg::math::pi<double>() * i / count;
+        double const radius = i % 2 == 0 ? 10.0 : 7.0 + (i % 5);
+        point_type const p(1000.0 + radius * std::cos(angle),
+                           2000.0 + radius * std::sin(angle));
+        ring.push_back(p);
+        deque_ring.push_back(p);
+    }
+    if (Closed)
+    {
+        ring.push_back(ring.front());
+        deque_ring.push_back(deque_ring.front());
+    }
+
+    double const expected_area = bg::area(deque_ring);
+    BOOST_CHECK(expected_area > 0.0);
+    BOOST_CHECK_CLOSE(bg::area(ring), expected_area, 1.0e-9);
+    BOOST_CHECK_CLOSE(bg::perimeter(ring), bg::perimeter(deque_ring), 1.0e-9);
+
+    linestring_type const linestring(ring.begin(), ring.end());
+    deque_linestring_type const deque_linestring(ring.begin(), ring.end());
+    BOOST_CHECK_CLOSE(bg::length(linestring), bg::length(deque_linestring), 1.0e-9);
+
+    point_type centroid(0, 0), expected_centroid(0, 0);
+    bg::centroid(ring, centroid);
+    bg::centroid(deque_ring, expected_centroid);
+    BOOST_CHECK_CLOSE(bg::get<0>(centroid), bg::get<0>(expected_centroid), 1.0e-9);
+    BOOST_CHECK_CLOSE(bg::get<1>(centroid), bg::get<1>(expected_centroid), 1.0e-9);
+
+    bg::model::polygon<point_type, ClockWise, Closed> polygon;
+    polygon.outer().assign(ring.begin(), ring.end());
+    BOOST_CHECK_CLOSE(bg::area(polygon), expected_area, 1.0e-9);
+}
+
+template <bool ClockWise, bool Closed>
+void test_rings()
+{
+    // Sizes around the width and the unrolling of the kernels
+    for (std::size_t count = 3; count < 40; ++count)
+    {
+        test_ring<ClockWise, Closed>(count);
+    }
+    test_ring<ClockWise, Closed>(1001);
+}
+
+void test_traits()
+{
+    typedef bg::model::d2::point_xy<double> point_xy_type;
+    typedef std::array<double, 2> array_type;
+    typedef bg::model::point<float, 2, bg::cs::cartesian> float_point_type;
+
+    BOOST_CHECK((bg::detail::has_contiguous_points<std::vector<point_xy_type>, double, 2>::value));
+    BOOST_CHECK((bg::detail::has_contiguous_points<std::vector<array_type>, double, 2>::value));
+    BOOST_CHECK((! bg::detail::has_contiguous_points<std::vector<float_point_type>, double, 2>::value));
+
+    // Only calculations in double use the kernels
+    BOOST_CHECK((bg::strategy::area::detail::contiguous_kernel
+        <
+            bg::strategy::area::cartesian<>, bg::model::ring<point_type>
+        >::value));
+    BOOST_CHECK((! bg::strategy::area::detail::contiguous_kernel
+        <
+            bg::strategy::area::cartesian<long double>, bg::model::ring<point_type>
+        >::value));
+    BOOST_CHECK((bg::strategy::distance::detail::contiguous_kernel
+        <
+            bg::strategy::distance::pythagoras<>, bg::model::linestring<point_type>
+        >::value));
+    BOOST_CHECK((bg::strategy::centroid::detail::contiguous_kernel
+        <
+            bg::strategy::centroid::bashein_detmer<point_type>, bg::model::ring<point_type>
+        >::value));
+
+    bg::model::linestring<array_type> line;
+    array_type p0 = {{0.0, 0.0}}, p1 = {{3.0, 4.0}}, p2 = {{3.0, 0.0}};
+    line.push_back(p0);
+    line.push_back(p1);
+    line.push_back(p2);
+    BOOST_CHECK_CLOSE(bg::length(line), 9.0, 1.0e-9);
+}
+
+int test_main(int, char* [])
+{
+    test_rings<true, true>();
+    test_rings<false, true>();
+    test_rings<true, false>();
+    test_rings<false, false>();
+    test_traits();
+
+    return 0;
+}
@@ -0,0 +1,271 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <boost/geometry/algorithms/comparable_distance.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/srs/spheroid.hpp>
+#include <boost/geometry/strategies/geographic/distance_chord.hpp>
+#include <boost/geometry/strategies/geographic/distance_vincenty.hpp>
+#include <boost/geometry/strategies/geographic/index.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+namespace bgi = bg::index;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_t;
+typedef bg::model::box<point_t> box_t;
+typedef bg::model::segment<point_t> segment_t;
+
+typedef bgi::parameters
+    <
+        bgi::rstar<16>,
+        bg::strategy::index::geographic_chord<>
+    > chord_parameters_t;
+
+// Compares the distances of the nearest values with the k smallest distances
+template <typename Rtree, typename Query, typename Value, typename Strategy>
+void check_nearest(Rtree const& rtree, Query const& query,
+                   std::vector<Value> const& values, std::size_t k,
+                   Strategy const& strategy)
+{
+    std::vector<Value> result;
+    rtree.query(bgi::nearest(query, k), std::back_inserter(result));
+    BOOST_CHECK_EQUAL(result.size(), k);
+
+    std::vector<double> expected;
+    for (std::size_t j = 0 ; j < values.size() ; ++j)
+    {
+        expected.push_back(bg::distance(query, values[j], strategy));
+    }
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<double> found;
+    for (std::size_t j = 0 ; j < result.size() ; ++j)
+    {
+        found.push_back(bg::distance(query, result[j], strategy));
+    }
+    std::sort(found.begin(), found.end());
+
+    for (std::size_t j = 0 ; j < found.size() ; ++j)
+    {
+        BOOST_CHECK_EQUAL(found[j], expected[j]);
+    }
+}
+
+void test_point_point()
+{
+    bg::srs::spheroid<double> const spheroid;
+    bg::strategy::distance::geographic_chord<> const chord(spheroid);
+    bg::strategy::distance::vincenty<> const vincenty(spheroid);
+
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<double> lon(-180, 180);
+    std::uniform_real_distribution<double> lat(-90, 90);
+    std::uniform_real_distribution<double> delta(-1, 1);
+
+    for (int i = 0 ; i < 1000 ; ++i)
+    {
+        point_t const p1(lon(gen), lat(gen));
+        point_t const p2(lon(gen), lat(gen));
+
+        double const c = bg::distance(p1, p2, chord);
+        double const d = bg::distance(p1, p2, vincenty);
+        BOOST_CHECK_LE(c, d * (1 + 1e-12));
+        BOOST_CHECK_CLOSE(bg::comparable_distance(p1, p2, chord), c * c, 1e-10);
+
+        // less than about 100 km
+        double const lat1 = bg::get<1>(p1);
+        point_t const p3(bg::get<0>(p1) + delta(gen) / 2,
+                         lat1 + (lat1 > 0 ? -0.5 : 0.5) * std::abs(delta(gen)));
+        double const c13 = bg::distance(p1, p3, chord);
+        double const d13 = bg::distance(p1, p3, vincenty);
+        BOOST_CHECK_LE(c13, d13 * (1 + 1e-12));
+        BOOST_CHECK_LE(d13 - c13, d13 * 2e-5);
+    }
+
+    BOOST_CHECK_EQUAL(bg::distance(point_t(10, 20), point_t(10, 20), chord), 0.0);
+    // diameter between the poles
+    BOOST_CHECK_CLOSE(bg::distance(point_t(0, 90), point_t(0, -90), chord),
+                      2 * bg::get_radius<2>(spheroid), 1e-10);
+    // diameter of the equator, across the antimeridian
+    BOOST_CHECK_CLOSE(bg::distance(point_t(-90, 0), point_t(90, 0), chord),
+                      2 * bg::get_radius<0>(spheroid), 1e-10);
+}
+
+void test_point_box(double lon1, double lat1, double lon2, double lat2)
+{
+    bg::strategy::distance::geographic_chord<> const chord;
+    bg::strategy::distance::geographic_chord_point_box<> const bound;
+
+    box_t const box(point_t(lon1, lat1), point_t(lon2, lat2));
+
+    std::mt19937 gen(54321);
+    std::uniform_real_distribution<double> lon(-180, 180);
+    std::uniform_real_distribution<double> lat(-90, 90);
+
+    for (int i = 0 ; i < 50 ; ++i)
+    {
+        point_t const p(lon(gen), lat(gen));
+        double const b = bg::distance(p, box, bound);
+        BOOST_CHECK_CLOSE(bg::comparable_distance(p, box, bound), b * b, 1e-10);
+
+        double min_c = -1;
+        for (int j = 0 ; j <= 20 ; ++j)
+        {
+            for (int k = 0 ; k <= 20 ; ++k)
+            {
+                point_t const q(lon1 + (lon2 - lon1) * j / 20,
+                                lat1 + (lat2 - lat1) * k / 20);
+                double const c = bg::distance(p, q, chord);
+                BOOST_CHECK_LE(b, c + 1e-6);
+                if (min_c < 0 || c < min_c)
+                {
+                    min_c = c;
+                }
+            }
+        }
+
+        // The bound is not looser than the size of small boxes
+        if (lon2 - lon1 <= 1 && lat2 - lat1 <= 1)
+        {
+            BOOST_CHECK_LE(min_c - b, 2 * bg::distance(box.min_corner(),
+                                                       box.max_corner(),
+                                                       chord));
+        }
+    }
+
+    point_t const inside((lon1 + lon2) / 2, (lat1 + lat2) / 2);
+    BOOST_CHECK_EQUAL(bg::distance(inside, box, bound), 0.0);
+}
+
+void test_segment_box(double lon1, double lat1, double lon2, double lat2)
+{
+    typedef bg::strategy::distance::comparable::geographic_chord_point_segment<> ps_t;
+    typedef bg::strategy::distance::comparable::geographic_chord_segment_box<> sb_t;
+    bg::strategy::distance::geographic_cross_track<> const cross_track;
+
+    box_t const box(point_t(lon1, lat1), point_t(lon2, lat2));
+
+    std::mt19937 gen(97531);
+    std::uniform_real_distribution<double> lon(-180, 180);
+    std::uniform_real_distribution<double> lat(-80, 80);
+    std::uniform_real_distribution<double> delta(-5, 5);
+
+    for (int i = 0 ; i < 50 ; ++i)
+    {
+        point_t const p(lon(gen), lat(gen));
+        segment_t const s(p, point_t(bg::get<0>(p) + delta(gen),
+                                     bg::get<1>(p) + delta(gen)));
+        double const b = bg::comparable_distance(s, box, sb_t());
+
+        for (int j = 0 ; j <= 10 ; ++j)
+        {
+            for (int k = 0 ; k <= 10 ; ++k)
+            {
+                point_t const q(lon1 + (lon2 - lon1) * j / 10,
+                                lat1 + (lat2 - lat1) * k / 10);
+                double const d = bg::distance(q, s, cross_track);
+                BOOST_CHECK_CLOSE(bg::comparable_distance(q, s, ps_t()), d * d, 1e-10);
+                BOOST_CHECK_LE(b, d * d * (1 + 1e-12) + 1e-6);
+            }
+        }
+    }
+}
+
+void test_rtree_nearest()
+{
+    bg::strategy::distance::geographic_chord<> const chord;
+
+    std::mt19937 gen(2468);
+    std::uniform_real_distribution<double> lon(-180, 180);
+    std::uniform_real_distribution<double> lat(-90, 90);
+
+    std::vector<point_t> points;
+    for (int i = 0 ; i < 2000 ; ++i)
+    {
+        points.push_back(point_t(lon(gen), lat(gen)));
+    }
+
+    bgi::rtree<point_t, chord_parameters_t> const rtree(points);
+
+    for (int i = 0 ; i < 20 ; ++i)
+    {
+        check_nearest(rtree, point_t(lon(gen), lat(gen)), points, 10, chord);
+    }
+}
+
+// Segments are compared with the squared geodesic distance and the nodes
+// with the chord, which is not greater
+void test_rtree_nearest_segments()
+{
+    bg::strategy::distance::geographic_cross_track<> const cross_track;
+
+    std::mt19937 gen(1357);
+    std::uniform_real_distribution<double> lon(-180, 180);
+    std::uniform_real_distribution<double> lat(-80, 80);
+    std::uniform_real_distribution<double> delta(-1, 1);
+
+    std::vector<point_t> points;
+    std::vector<segment_t> segments;
+    for (int i = 0 ; i < 2000 ; ++i)
+    {
+        point_t const p(lon(gen), lat(gen));
+        point_t const q(bg::get<0>(p) + 2 * delta(gen), bg::get<1>(p) + delta(gen));
+        points.push_back(p);
+        segments.push_back(segment_t(p, q));
+    }
+
+    bgi::rtree<segment_t, chord_parameters_t> const segment_rtree(segments);
+    bgi::rtree<point_t, chord_parameters_t> const point_rtree(points);
+
+    for (int i = 0 ; i < 50 ; ++i)
+    {
+        point_t const p(lon(gen), lat(gen));
+        check_nearest(segment_rtree, p, segments, 1, cross_track);
+        check_nearest(segment_rtree, p, segments, 5, cross_track);
+
+        segment_t const s(p, point_t(bg::get<0>(p) + 3 * delta(gen),
+                                     bg::get<1>(p) + 3 * delta(gen)));
+        check_nearest(point_rtree, s, points, 5, cross_track);
+        check_nearest(segment_rtree, s, segments, 5, cross_track);
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_point_point();
+
+    test_point_box(10, 20, 10.5, 20.5);
+    test_point_box(-1, -1, 1, 1);
+    test_point_box(170, 40, 190, 50);
+    test_point_box(-180, 80, 180, 90);
+    test_point_box(-180, -90, 180, -60);
+    test_point_box(-30, -10, 60, 10);
+    test_point_box(0, -90, 200, 90);
+
+    test_segment_box(10, 20, 10.5, 20.5);
+    test_segment_box(170, 40, 190, 50);
+    test_segment_box(-180, 80, 180, 90);
+    test_segment_box(-30, -10, 60, 10);
+
+    test_rtree_nearest();
+    test_rtree_nearest_segments();
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/util/executor.hpp>
+
+
+template <typename Executor>
+void test_executor(Executor const& executor)
+{
+    // The results are checked in the calling thread, the checks are not
+    // thread-safe
+    std::vector<int> calls(1000, 0);
+    executor(calls.size(), [&](std::size_t i) { ++calls[i]; });
+    for (std::size_t i = 0 ; i < calls.size() ; ++i)
+    {
+        BOOST_CHECK_EQUAL(calls[i], 1);
+    }
+
+    std::atomic<std::size_t> unexpected_calls(0);
+    executor(0, [&](std::size_t) { ++unexpected_calls; });
+    BOOST_CHECK_EQUAL(unexpected_calls, 0u);
+
+    std::vector<int> elements(1003, 0);
+    std::atomic<std::size_t> chunks(0);
+    std::atomic<std::size_t> max_chunk_size(0);
+    bg::detail::for_each_chunk(executor, elements.size(), 100,
+        [&](std::size_t first, std::size_t last)
+        {
+            std::size_t size = max_chunk_size;
+            while (last - first > size
+                && ! max_chunk_size.compare_exchange_weak(size, last - first))
+            {}
+            for (std::size_t i = first ; i < last ; ++i)
+            {
+                ++elements[i];
+            }
+            ++chunks;
+        });
+    BOOST_CHECK_EQUAL(chunks, 11u);
+    BOOST_CHECK_EQUAL(max_chunk_size, 100u);
+    for (std::size_t i = 0 ; i < elements.size() ; ++i)
+    {
+        BOOST_CHECK_EQUAL(elements[i], 1);
+    }
+
+    bool thrown = false;
+    try
+    {
+        executor(100, [](std::size_t i)
+        {
+            if (i == 50)
+            {
+                throw std::runtime_error("task");
+            }
+        });
+    }
+    catch (std::runtime_error const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+int test_main(int, char* [])
+{
+    test_executor(bg::sequential_executor());
+    test_executor(bg::thread_executor(1));
+    test_executor(bg::thread_executor(4));
+    test_executor(bg::thread_executor());
+
+    BOOST_CHECK(bg::thread_executor().threads_count() >= 1);
+    BOOST_CHECK_EQUAL(bg::thread_executor(3).threads_count(), 3u);
+
+    return 0;
+}